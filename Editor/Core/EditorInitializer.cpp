@@ -65,7 +65,8 @@ void EditorInitializer::InitializeEditorComponents(
     // Connect viewport to UI's selected entity for synchronized selection
     viewport.SetSelectedEntityPtr(editorUI.GetSelectedEntityPtr());
 
-    //editorUI.SetViewport(&viewport);  // Connect UI to viewport for gizmo controls
+    // Connect UI to viewport so inspector edits redraw the scene
+    editorUI.SetViewport(&viewport);
 
     // Initialize asset browser with textures directory
     assetBrowser.Initialize(texturesPath);
@@ -240,6 +240,7 @@ private:
                 if (m_playModeManager.StartPlayMode()) {
                     m_viewport.SetCameraControlsEnabled(false);
                     m_viewport.SetDragDropEnabled(false);
+                    m_viewport.SetContinuousRendering(true);
                 }
             }
         );
@@ -250,6 +251,7 @@ private:
                 m_playModeManager.StopPlayMode();
                 m_viewport.SetCameraControlsEnabled(true);
                 m_viewport.SetDragDropEnabled(true);
+                m_viewport.SetContinuousRendering(false);
             }
         );
 
@@ -12,6 +12,7 @@
  */
 
 #include "ContentEditorUI.hpp"
+#include "../UI/EditorViewport.hpp"
 #include <filesystem>
 
 
@@ -168,8 +169,15 @@ void ContentEditorUI::DrawProperties(GP2Engine::Registry& registry, bool& hasUns
 
         // Disable property editing during PLAY mode
         ImGui::BeginDisabled(isPlaying);
-        DrawComponentEditor(registry, m_selectedEntity, hasUnsavedChanges);
+        bool edited = false;
+        DrawComponentEditor(registry, m_selectedEntity, edited);
         ImGui::EndDisabled();
+
+        // Fields are edited in place, so tell the viewport to redraw
+        if (edited) {
+            hasUnsavedChanges = true;
+            if (m_viewport) m_viewport->MarkDirty();
+        }
     }
 
     ImGui::End();
@@ -74,6 +74,12 @@ public:
     void SetSelectedEntity(GP2Engine::EntityID entity) { m_selectedEntity = entity; }
     GP2Engine::EntityID* GetSelectedEntityPtr() { return &m_selectedEntity; }
 
+    /**
+     * @brief Set the viewport to redraw when the inspector edits a component
+     * @param viewport Pointer to the scene viewport
+     */
+    void SetViewport(EditorViewport* viewport) { m_viewport = viewport; }
+
 private:
 
     void DrawAudioComponentEditor(GP2Engine::Registry& registry, GP2Engine::EntityID entity, bool& hasUnsavedChanges);
@@ -112,6 +118,9 @@ private:
     GP2Engine::TileMap* m_tileMap = nullptr;
     GP2Engine::TileRenderer* m_tileRenderer = nullptr;
 
+    // === VIEWPORT ===
+    EditorViewport* m_viewport = nullptr;     // Redrawn after inspector edits
+
 
     // === PANEL RENDERING ===
     /**
@@ -66,11 +66,8 @@ bool HollowsPlayMode::Start(GP2Engine::Registry& registry, GP2Engine::Camera& /*
         // Set initial texture to idle state
         spriteComp->sprite->SetTexture(idleTexture);
 
-        // Register all directional walk animations and idle animation
-        Hollows::SetupWalkRightAnimation(*spriteComp->sprite);
-        Hollows::SetupWalkUpAnimation(*spriteComp->sprite);
-        Hollows::SetupWalkDownAnimation(*spriteComp->sprite);
-        Hollows::SetupIdleAnimation(*spriteComp->sprite);
+        // Share the directional walk and idle clips
+        spriteComp->sprite->SetAnimationClips(Hollows::GetPlayerAnimationClips());
 
         // Start with walk_right animation in paused state
         spriteComp->sprite->PlayAnimation("walk_right");
@@ -117,11 +114,8 @@ bool HollowsPlayMode::Start(GP2Engine::Registry& registry, GP2Engine::Camera& /*
                 // Set initial texture to vertical sprite sheet
                 monsterSpriteComp->sprite->SetTexture(monsterVerticalTexture);
 
-                // Register all directional walk animations for monster
-                Hollows::SetupMonsterWalkLeftAnimation(*monsterSpriteComp->sprite);
-                Hollows::SetupMonsterWalkRightAnimation(*monsterSpriteComp->sprite);
-                Hollows::SetupMonsterWalkUpAnimation(*monsterSpriteComp->sprite);
-                Hollows::SetupMonsterWalkDownAnimation(*monsterSpriteComp->sprite);
+                // Share the directional walk clips for monster
+                monsterSpriteComp->sprite->SetAnimationClips(Hollows::GetMonsterAnimationClips());
 
                 // Start playing walk down animation
                 monsterSpriteComp->sprite->PlayAnimation("monster_walk_down");
@@ -134,6 +128,7 @@ bool HollowsPlayMode::Start(GP2Engine::Registry& registry, GP2Engine::Camera& /*
             aiComp.chaseSpeed = 200.0f;  // Slightly slower than player
             aiComp.detectionRange = 200.0f;
             aiComp.usePathfinding = true;
+            aiComp.useFlowField = true;  // Monsters chasing the player share one field
             aiComp.horizontalTexture = monsterHorizontalTexture.get();
             aiComp.verticalTexture = monsterVerticalTexture.get();
             aiComp.currentAnimation = "monster_walk_down";
@@ -175,6 +170,13 @@ void HollowsPlayMode::Update(GP2Engine::Registry& registry, float deltaTime, GP2
     // Update AI system (processes all entities with AIComponent)
     m_aiSystem.Update(registry, deltaTime);
 
+    // Step physics bodies at a fixed rate (integrate, collide, interpolate Transform2D)
+    GP2Engine::Profiler& profiler = GP2Engine::Profiler::GetInstance();
+    profiler.StartTiming("Physics");
+    const int physicsSteps = m_physicsWorld.Update(registry, m_physicsTimestep, deltaTime);
+    profiler.EndTiming("Physics");
+    profiler.AddCount("PhysicsSteps", physicsSteps);
+
     // Update audio engine (positional audio, sound cleanup, etc.)
     DKAudioEngine::Update();
 
@@ -200,4 +202,6 @@ void HollowsPlayMode::Stop() {
     // This clears entity references and game-specific state
     m_playerController = Hollows::PlayerController();
     m_aiSystem = GP2Engine::AISystem();
+    m_physicsWorld.Clear();
+    m_physicsTimestep.Reset();
 }
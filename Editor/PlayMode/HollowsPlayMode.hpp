@@ -49,6 +49,10 @@ private:
     // AI system for enemy behavior and pathfinding (ECS-based)
     GP2Engine::AISystem m_aiSystem;
 
+    // Steps every entity with a PhysicsComponent
+    GP2Engine::PhysicsWorld m_physicsWorld;
+    GP2Engine::FixedTimestep m_physicsTimestep;
+
     // Timestamp for frame time tracking
     float m_lastFrameTime = 0.0f;
 };
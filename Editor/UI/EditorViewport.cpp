@@ -7,11 +7,15 @@
  * through framebuffer and displays it in a resizable ImGui window.
  * Handles camera controls, entity selection/dragging and asset drag-drop from
  * the asset browser.
+ *
+ * While the editor is idle the framebuffer is not re-rendered; the previous
+ * image is displayed again and counted as a skipped frame.
  */
 
 #include "EditorViewport.hpp"
 #include <imgui.h>
 #include <glad/glad.h>
+#include <cstdio>
 #include <limits>
 
 EditorViewport::~EditorViewport() {
@@ -37,6 +41,7 @@ void EditorViewport::Initialize(GP2Engine::Registry* registry, GP2Engine::Camera
 }
 
 void EditorViewport::Update(float deltaTime) {
+    m_timeSinceRender += deltaTime;
     HandleInput(deltaTime);
 }
 
@@ -49,8 +54,14 @@ void EditorViewport::Render() {
     m_isHovered = ImGui::IsWindowHovered();
     m_isFocused = ImGui::IsWindowFocused();
 
-    // Render scene to framebuffer
-    RenderScene();
+    // Render scene to framebuffer only if the last image is out of date
+    if (NeedsSceneRender()) {
+        RenderScene();
+        m_renderedFrames++;
+    }
+    else {
+        m_skippedFrames++;
+    }
 
     // Get available space in viewport panel
     ImVec2 viewportPanelSize = ImGui::GetContentRegionAvail();
@@ -68,6 +79,14 @@ void EditorViewport::Render() {
 
         RenderGizmo();
 
+        // Redraw counters in the bottom-left corner
+        char redrawStats[64];
+        snprintf(redrawStats, sizeof(redrawStats), "Redrawn %llu | Skipped %llu",
+            static_cast<unsigned long long>(m_renderedFrames), static_cast<unsigned long long>(m_skippedFrames));
+        ImGui::GetWindowDrawList()->AddText(
+            ImVec2(viewportPos.x + 6.0f, viewportPos.y + viewportPanelSize.y - ImGui::GetTextLineHeight() - 4.0f),
+            IM_COL32(200, 200, 200, 160), redrawStats);
+
         // Drag-drop target for assets from AssetBrowser (only in edit mode)
         if (m_dragDropEnabled && ImGui::BeginDragDropTarget()) {
             if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("ASSET_PATH")) {
@@ -184,6 +203,7 @@ void EditorViewport::HandleInput(float deltaTime) {
                 if (auto* transform = m_registry->GetComponent<GP2Engine::Transform2D>(*m_selectedEntityPtr)) {
                     // Move entity to mouse position 
                     transform->position = sceneMousePos - m_dragOffset;
+                    MarkDirty();
                 }
             }
         }
@@ -361,6 +381,7 @@ void EditorViewport::HandleGizmoDragging(const GP2Engine::Vector2D& sceneMousePo
     // Handle dragging
     if (m_isGizmoDragging && GP2Engine::Input::IsMouseButtonHeld(GP2Engine::MouseButton::Left)) {
         GP2Engine::Vector2D delta = sceneMousePos - m_gizmoDragStart;
+        MarkDirty();
 
         switch (m_currentGizmoOperation) {
         case GizmoOperation::TRANSLATE:
@@ -587,12 +608,61 @@ void EditorViewport::RenderScaleGizmo(float gizmoScale) {
 }
 
 
-void EditorViewport::RenderScene() {
-    if (!m_registry || !m_camera) return;
+bool EditorViewport::NeedsSceneRender() {
+    if (!m_registry || !m_camera) return false;
 
     // Camera projection remains fixed to scene bounds, but position/zoom controlled externally
     m_camera->SetOrthographic(0.0f, (float)m_sceneWidth, (float)m_sceneHeight, 0.0f);
 
+    const glm::mat4 viewProjection = m_camera->GetViewProjectionMatrix();
+    const GP2Engine::EntityID selection = m_selectedEntityPtr ? *m_selectedEntityPtr : GP2Engine::INVALID_ENTITY;
+    const bool collisionBoxes = m_showCollisionBoxes && *m_showCollisionBoxes;
+
+    // Inspector fields and gizmos call MarkDirty() after editing components in
+    // place. Other panels (e.g. the level editor) also edit in place, which the
+    // registry version does not see, so any input counts as a change as well.
+    // The panels apply their edits after the viewport has drawn, so keep
+    // redrawing for a couple of frames after the input stops.
+    const ImGuiIO& io = ImGui::GetIO();
+    bool hasInput = io.MouseWheel != 0.0f || io.MouseWheelH != 0.0f || !io.InputQueueCharacters.empty();
+    for (int button = 0; button < IM_ARRAYSIZE(io.MouseDown) && !hasInput; ++button) {
+        hasInput = io.MouseDown[button] || io.MouseReleased[button];
+    }
+    for (int key = ImGuiKey_NamedKey_BEGIN; key < ImGuiKey_NamedKey_END && !hasInput; ++key) {
+        hasInput = ImGui::IsKeyDown(static_cast<ImGuiKey>(key));
+    }
+    if (hasInput) {
+        m_inputSettleFrames = INPUT_SETTLE_FRAMES;
+    }
+
+    const bool dirty = m_sceneDirty
+        || m_continuousRendering
+        || m_inputSettleFrames > 0
+        || m_timeSinceRender >= IDLE_REFRESH_INTERVAL
+        || m_registry->GetVersion() != m_renderedRegistryVersion
+        || viewProjection != m_renderedViewProjection
+        || selection != m_renderedSelection
+        || collisionBoxes != m_renderedCollisionBoxes;
+
+    if (m_inputSettleFrames > 0) {
+        m_inputSettleFrames--;
+    }
+    if (!dirty) {
+        return false;
+    }
+
+    m_sceneDirty = false;
+    m_timeSinceRender = 0.0f;
+    m_renderedRegistryVersion = m_registry->GetVersion();
+    m_renderedViewProjection = viewProjection;
+    m_renderedSelection = selection;
+    m_renderedCollisionBoxes = collisionBoxes;
+    return true;
+}
+
+void EditorViewport::RenderScene() {
+    if (!m_registry || !m_camera) return;
+
     // Bind framebuffer for texture rendering
     m_framebuffer.Bind();
 
@@ -699,76 +769,99 @@ void EditorViewport::RenderEntityLabels() {
     }
 }
 
-GP2Engine::EntityID EditorViewport::PickEntityAtPosition(const GP2Engine::Vector2D& scenePos) {
-    if (!m_registry) return GP2Engine::INVALID_ENTITY;
+bool EditorViewport::ComputePickBounds(GP2Engine::EntityID entity, GP2Engine::AABB& bounds, int& renderLayer) {
+    auto* transform = m_registry->GetComponent<GP2Engine::Transform2D>(entity);
+    if (!transform) return false;
 
-    // Iterate through all entities and check if mouse is within their bounds
-    // Pick the top most entity (highest render layer)
-    GP2Engine::EntityID pickedEntity = GP2Engine::INVALID_ENTITY;
-    int highestRenderLayer = std::numeric_limits<int>::min();
+    auto* spriteComp = m_registry->GetComponent<GP2Engine::SpriteComponent>(entity);
+    auto* textComp = m_registry->GetComponent<GP2Engine::TextComponent>(entity);
 
-    for (GP2Engine::EntityID entity : m_registry->GetActiveEntities()) {
-        auto* transform = m_registry->GetComponent<GP2Engine::Transform2D>(entity);
-        if (!transform) continue;
+    if (spriteComp) {
+        // Sprite entity bounds (centered on the entity)
+        GP2Engine::Vector2D entitySize(
+            spriteComp->size.x * transform->scale.x,
+            spriteComp->size.y * transform->scale.y
+        );
 
-        auto* spriteComp = m_registry->GetComponent<GP2Engine::SpriteComponent>(entity);
-        auto* textComp = m_registry->GetComponent<GP2Engine::TextComponent>(entity);
+        bounds = GP2Engine::AABB(transform->position.x - entitySize.x * 0.5f,
+                                 transform->position.y - entitySize.y * 0.5f,
+                                 entitySize.x, entitySize.y);
+        renderLayer = spriteComp->renderLayer;
+        return true;
+    }
 
-        // Skip entities with neither sprite nor text
-        if (!spriteComp && !textComp) continue;
+    if (textComp && textComp->font) {
+        // Text is rendered from the top-left corner, offset from the entity
+        float textWidth = textComp->font->CalculateTextWidth(textComp->text, textComp->scale * transform->scale.x);
+        float textHeight = textComp->font->GetFontSize() * textComp->scale * transform->scale.y;
 
-        // Calculate entity bounds based on component type
-        float left, right, top, bottom;
-        int renderLayer = 0;
+        bounds = GP2Engine::AABB(transform->position.x + textComp->offset.x,
+                                 transform->position.y + textComp->offset.y,
+                                 textWidth, textHeight);
+        renderLayer = textComp->renderLayer;
+        return true;
+    }
 
-        if (spriteComp) {
-            // Sprite entity bounds
-            GP2Engine::Vector2D entityPos = transform->position;
-            GP2Engine::Vector2D entitySize(
-                spriteComp->size.x * transform->scale.x,
-                spriteComp->size.y * transform->scale.y
-            );
-
-            left = entityPos.x - entitySize.x * 0.5f;
-            right = entityPos.x + entitySize.x * 0.5f;
-            top = entityPos.y - entitySize.y * 0.5f;
-            bottom = entityPos.y + entitySize.y * 0.5f;
-            renderLayer = spriteComp->renderLayer;
-        }
-        else if (textComp && textComp->font) {
-            // Text entity bounds
-            // Calculate text dimensions
-            float textWidth = textComp->font->CalculateTextWidth(textComp->text, textComp->scale * transform->scale.x);
-            float textHeight = textComp->font->GetFontSize() * textComp->scale * transform->scale.y;
-
-            // Apply offset from TextComponent
-            GP2Engine::Vector2D entityPos(
-                transform->position.x + textComp->offset.x,
-                transform->position.y + textComp->offset.y
-            );
-
-            // Text is rendered from top-left corner, so adjust bounds accordingly
-            left = entityPos.x;
-            right = entityPos.x + textWidth;
-            top = entityPos.y;
-            bottom = entityPos.y + textHeight;
-            renderLayer = textComp->renderLayer;
-        }
-        else {
-            continue; // Skip if text entity has no font
-        }
+    // Neither sprite nor text with a font
+    return false;
+}
+
+void EditorViewport::RefreshPickTree() {
+    GP2Engine::AABB bounds;
+    int renderLayer = 0;
 
-        // Check if mouse is within bounds
-        if (scenePos.x >= left && scenePos.x <= right &&
-            scenePos.y >= top && scenePos.y <= bottom) {
+    if (!m_pickTreeValid || m_registry->GetVersion() != m_pickTreeVersion) {
+        m_pickTree.Clear();
+        m_pickProxies.clear();
+        m_pickEntities.clear();
 
-            // Pick entity with highest render layer (drawn on top)
-            if (renderLayer > highestRenderLayer) {
-                pickedEntity = entity;
-                highestRenderLayer = renderLayer;
+        for (GP2Engine::EntityID entity : m_registry->GetActiveEntities()) {
+            if (!ComputePickBounds(entity, bounds, renderLayer)) continue;
+
+            if (entity >= m_pickProxies.size()) {
+                m_pickProxies.resize(static_cast<size_t>(entity) + 1, GP2Engine::DynamicAABBTree::NULL_NODE);
             }
+            m_pickProxies[entity] = m_pickTree.CreateProxy(bounds, entity);
+            m_pickEntities.push_back(entity);
+        }
+
+        m_pickTreeVersion = m_registry->GetVersion();
+        m_pickTreeValid = true;
+        return;
+    }
+
+    // Transforms are edited in place (gizmos, inspector); refit the boxes that moved
+    for (GP2Engine::EntityID entity : m_pickEntities) {
+        if (!ComputePickBounds(entity, bounds, renderLayer)) continue;
+
+        const int proxy = m_pickProxies[entity];
+        const GP2Engine::AABB& previous = m_pickTree.GetBounds(proxy);
+        if (previous.x != bounds.x || previous.y != bounds.y || previous.width != bounds.width || previous.height != bounds.height) {
+            m_pickTree.MoveProxy(proxy, bounds, GP2Engine::Vector2D(0.0f, 0.0f));
         }
     }
+}
+
+GP2Engine::EntityID EditorViewport::PickEntityAtPosition(const GP2Engine::Vector2D& scenePos) {
+    if (!m_registry) return GP2Engine::INVALID_ENTITY;
+
+    RefreshPickTree();
+
+    // Only entities whose bounds contain the mouse are visited;
+    // pick the top most one (highest render layer)
+    GP2Engine::EntityID pickedEntity = GP2Engine::INVALID_ENTITY;
+    int highestRenderLayer = std::numeric_limits<int>::min();
+
+    m_pickTree.QueryPoint(scenePos, [&](int proxy) {
+        GP2Engine::EntityID entity = m_pickTree.GetUserData(proxy);
+        GP2Engine::AABB bounds;
+        int renderLayer = 0;
+        if (ComputePickBounds(entity, bounds, renderLayer) && renderLayer > highestRenderLayer) {
+            pickedEntity = entity;
+            highestRenderLayer = renderLayer;
+        }
+        return false;
+    });
 
     return pickedEntity;
 }
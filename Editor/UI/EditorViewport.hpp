@@ -5,6 +5,10 @@
  *
  * Renders all entities in the scene with visual feedback,
  * allows camera manipulation, and provides visual selection.
+ *
+ * The scene is only re-rendered into the framebuffer when something visible
+ * may have changed (registry version, camera, selection, debug flags, editor
+ * input or play mode); otherwise the last framebuffer texture is shown again.
  */
 
 #pragma once
@@ -60,6 +64,28 @@ public:
      */
     void SetDebugVisualization(bool* showCollisionBoxes) { m_showCollisionBoxes = showCollisionBoxes; }
 
+    /**
+     * @brief Re-render the scene every frame instead of only when it changed (for play mode)
+     * @param enabled Whether the scene is rendered every frame
+     */
+    void SetContinuousRendering(bool enabled) { m_continuousRendering = enabled; m_sceneDirty = true; }
+
+    /**
+     * @brief Force the scene to be re-rendered next frame
+     * Use after editing components in place (inspector, gizmos), which the registry version does not see
+     */
+    void MarkDirty() { m_sceneDirty = true; }
+
+    /**
+     * @brief Get number of frames the scene was rendered into the framebuffer
+     */
+    uint64_t GetRenderedFrameCount() const { return m_renderedFrames; }
+
+    /**
+     * @brief Get number of frames that reused the previous framebuffer image
+     */
+    uint64_t GetSkippedFrameCount() const { return m_skippedFrames; }
+
     /**
      * @brief Get dragged texture path (for receiving drops from AssetBrowser)
      */
@@ -135,12 +161,34 @@ private:
     EditorDebugRenderer m_debugRenderer;
     bool* m_showCollisionBoxes = nullptr;
 
+    // Redraw tracking (state the framebuffer image was last rendered with)
+    bool m_sceneDirty = true;
+    bool m_continuousRendering = false;
+    uint64_t m_renderedRegistryVersion = 0;
+    glm::mat4 m_renderedViewProjection{ 0.0f };
+    GP2Engine::EntityID m_renderedSelection = GP2Engine::INVALID_ENTITY;
+    bool m_renderedCollisionBoxes = false;
+    int m_inputSettleFrames = 0;           // Frames left to redraw after editor input stops
+    float m_timeSinceRender = 0.0f;
+    uint64_t m_renderedFrames = 0;
+    uint64_t m_skippedFrames = 0;
+
+    static constexpr int INPUT_SETTLE_FRAMES = 2;          // UI panels apply edits after the viewport has drawn
+    static constexpr float IDLE_REFRESH_INTERVAL = 1.0f;   // Catches in-place edits made without input
+
     // Gizmo variables
     GizmoOperation m_currentGizmoOperation = GizmoOperation::TRANSLATE;
     GizmoMode m_currentGizmoMode = GizmoMode::WORLD;
     GP2Engine::Vector2D m_gizmoDragStart{ 0.0f, 0.0f };
     GP2Engine::Transform2D m_gizmoTransformStart;
     
+    // Picking broadphase (entity bounds, rebuilt when the registry version changes)
+    GP2Engine::DynamicAABBTree m_pickTree;
+    std::vector<int> m_pickProxies;                        // Tree proxy per EntityID (NULL_NODE if not pickable)
+    std::vector<GP2Engine::EntityID> m_pickEntities;       // Entities in the tree
+    uint64_t m_pickTreeVersion = 0;
+    bool m_pickTreeValid = false;
+
     bool m_wasEntityClicked = false;// Gizmo dragging state
     bool m_isGizmoDragging = false;
     GP2Engine::Vector2D m_clickPosition{ 0.0f, 0.0f };
@@ -188,6 +236,26 @@ private:
      */
     GP2Engine::EntityID PickEntityAtPosition(const GP2Engine::Vector2D& scenePos);
 
+    /**
+     * @brief Compute the clickable bounds of an entity (sprite size or text extent)
+     * @param entity Entity to measure
+     * @param bounds Receives the bounds in scene coordinates
+     * @param renderLayer Receives the entity's render layer
+     * @return false if the entity has nothing to click on
+     */
+    bool ComputePickBounds(GP2Engine::EntityID entity, GP2Engine::AABB& bounds, int& renderLayer);
+
+    /**
+     * @brief Bring the picking tree up to date (rebuild after structural changes, otherwise refit moved entities)
+     */
+    void RefreshPickTree();
+
+    /**
+     * @brief Check if the framebuffer image is out of date
+     * @return true if the scene has to be rendered this frame
+     */
+    bool NeedsSceneRender();
+
     /**
      * @brief Render scene entities
      */
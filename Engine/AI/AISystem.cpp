@@ -9,15 +9,25 @@
  */
 
 #include "AISystem.hpp"
+#include <ECS/Systems.hpp>
 #include <Graphics/Sprite.hpp>
 #include <Graphics/Texture.hpp>
 #include <Physics/PhysicsSystem.hpp>
 #include <algorithm>
 #include <iostream>
+#include <limits>
 
 namespace GP2Engine {
 
+    AISystem::AISystem() : m_collisionSystem(std::make_unique<EntityCollisionSystem>()) {}
+    AISystem::~AISystem() = default;
+    AISystem::AISystem(AISystem&&) noexcept = default;
+    AISystem& AISystem::operator=(AISystem&&) noexcept = default;
+
     void AISystem::Update(Registry& registry, float deltaTime) {
+        // Pick up moves made since the last frame (player, editor, other systems)
+        m_collisionSystem->Sync(registry);
+
         // Iterate over all entities with AIComponent
         for (EntityID entity : registry.GetActiveEntities()) {
             AIComponent* aiComp = registry.GetComponent<AIComponent>(entity);
@@ -27,9 +37,12 @@ namespace GP2Engine {
             if (!transform) continue; // AI requires Transform2D
 
             // Get target entity transform
-            if (aiComp->targetEntity == INVALID_ENTITY) continue;
-            Transform2D* targetTransform = registry.GetComponent<Transform2D>(aiComp->targetEntity);
-            if (!targetTransform) continue;
+            Transform2D* targetTransform = aiComp->targetEntity != INVALID_ENTITY
+                ? registry.GetComponent<Transform2D>(aiComp->targetEntity) : nullptr;
+            if (!targetTransform) {
+                CancelPathRequest(entity);
+                continue;
+            }
 
             // Calculate direction to target (for range checking)
             Vector2D directionToTarget = ComputeDirectionToTarget(
@@ -39,18 +52,37 @@ namespace GP2Engine {
             // Update chasing state
             aiComp->isChasing = (directionToTarget.x != 0.0f || directionToTarget.y != 0.0f);
 
+            // Only the grid path branch collects requests; one left in flight would lead to the
+            // target's old cell by the time the agent follows its own path again
+            if (!aiComp->isChasing || !aiComp->usePathfinding || aiComp->useFlowField) {
+                CancelPathRequest(entity);
+            }
+
             // If target is out of range, don't chase
             if (aiComp->isChasing) {
                 Vector2D movementDirection(0.0f, 0.0f);
 
                 // Only use pathfinding (no fallback)
-                if (aiComp->usePathfinding && m_gridWidth > 0 && m_gridHeight > 0) {
+                if (aiComp->usePathfinding && aiComp->useFlowField && m_navGrid.GetCellCount() > 0) {
+                    // Shared field per target: a lookup instead of a search per agent
+                    movementDirection = FollowFlowField(aiComp->targetEntity, transform->position, targetTransform->position);
+                }
+                else if (aiComp->usePathfinding && m_navGrid.GetCellCount() > 0) {
                     // Update path recalculation timer
                     aiComp->pathRecalculateTimer += deltaTime;
 
                     // Get entity's path (or create if doesn't exist)
                     std::vector<GridNode>& currentPath = m_entityPaths[entity];
 
+                    // A deferred request finished: switch to the new path, picking it up where the
+                    // agent is now rather than at the cell it submitted from
+                    auto requestIt = m_pathRequests.find(entity);
+                    if (requestIt != m_pathRequests.end() && m_pathQueue.TakeResult(requestIt->second, currentPath)) {
+                        m_pathRequests.erase(requestIt);
+                        requestIt = m_pathRequests.end();
+                        aiComp->currentPathIndex = ClosestPathIndex(currentPath, WorldToGrid(transform->position));
+                    }
+
                     // Recalculate path periodically or if we don't have a path
                     if (currentPath.empty() || aiComp->pathRecalculateTimer >= aiComp->pathRecalculateInterval) {
                         aiComp->pathRecalculateTimer = 0.0f;
@@ -59,9 +91,17 @@ namespace GP2Engine {
                         GridNode startNode = WorldToGrid(transform->position);
                         GridNode goalNode = WorldToGrid(targetTransform->position);
 
-                        // Find path using A*
-                        currentPath = FindPath(startNode, goalNode);
-                        aiComp->currentPathIndex = 0;
+                        if (m_deferPaths && !m_useHierarchy) {
+                            // Keep following the current path until the queue answers
+                            if (requestIt == m_pathRequests.end()) {
+                                m_pathRequests[entity] = m_pathQueue.Submit(startNode, goalNode);
+                            }
+                        }
+                        else {
+                            // Find path (reuses the path's storage)
+                            RequestPath(entity, startNode, goalNode, currentPath);
+                            aiComp->currentPathIndex = 0;
+                        }
                     }
 
                     // Follow the path if we have one
@@ -79,6 +119,11 @@ namespace GP2Engine {
                             // Move to next waypoint
                             aiComp->currentPathIndex++;
 
+                            // End of a hierarchical segment: refine the next one (its first cell is this one)
+                            if (aiComp->currentPathIndex >= currentPath.size() && RefineNextSegment(entity, currentPath)) {
+                                aiComp->currentPathIndex = 1;
+                            }
+
                             // Check if we reached the end of the path
                             if (aiComp->currentPathIndex >= currentPath.size()) {
                                 // Reached destination, clear path
@@ -119,6 +164,9 @@ namespace GP2Engine {
                         }
                     }
 
+                    // Later AIs in this update must see the new position
+                    m_collisionSystem->NotifyMoved(registry, entity);
+
                     // Update animation based on movement direction
                     UpdateAnimation(registry, entity, movementDirection, *aiComp);
                 }
@@ -130,6 +178,74 @@ namespace GP2Engine {
                 spriteComp->sprite->UpdateAnimation(deltaTime);
             }
         }
+
+        // Requests and paths of agents that were destroyed (or lost their AI) would never be collected
+        auto isGone = [&registry](EntityID entity) {
+            return !registry.IsEntityAlive(entity) || !registry.GetComponent<AIComponent>(entity);
+        };
+        for (auto it = m_pathRequests.begin(); it != m_pathRequests.end();) {
+            if (!isGone(it->first)) {
+                ++it;
+                continue;
+            }
+            m_pathQueue.Cancel(it->second);
+            it = m_pathRequests.erase(it);
+        }
+        std::erase_if(m_entityPaths, [&isGone](const auto& entry) { return isGone(entry.first); });
+        std::erase_if(m_entityRoutes, [&isGone](const auto& entry) { return isGone(entry.first); });
+
+        // Each field holds a whole-grid array; drop the fields of targets that are gone
+        std::erase_if(m_flowFields, [&registry](const auto& entry) { return !registry.IsEntityAlive(entry.first); });
+
+        // Deferred searches run after every agent has moved, within the frame budget
+        if (m_deferPaths) {
+            m_pathQueue.Process(m_navGrid);
+        }
+    }
+
+    void AISystem::CancelPathRequest(EntityID entity) {
+        auto it = m_pathRequests.find(entity);
+        if (it == m_pathRequests.end()) return;
+        m_pathQueue.Cancel(it->second);
+        m_pathRequests.erase(it);
+    }
+
+    size_t AISystem::ClosestPathIndex(const std::vector<GridNode>& path, const GridNode& cell) const {
+        // The agent's own cell if the path crosses it, otherwise the nearest waypoint (later ones win ties)
+        size_t closest = 0;
+        int closestDistance = std::numeric_limits<int>::max();
+        for (size_t i = 0; i < path.size(); ++i) {
+            const int dx = path[i].x - cell.x;
+            const int dy = path[i].y - cell.y;
+            const int distance = dx * dx + dy * dy;
+            if (distance <= closestDistance) {
+                closest = i;
+                closestDistance = distance;
+            }
+            if (distance == 0) break;
+        }
+        return closest;
+    }
+
+    Vector2D AISystem::FollowFlowField(EntityID targetEntity, const Vector2D& position, const Vector2D& targetPosition) {
+        FlowField& field = m_flowFields[targetEntity];
+        field.SetDiagonal(m_pathfinder.IsDiagonal());
+        field.SetTarget(m_navGrid, WorldToGrid(targetPosition)); // Restarts only when the target changes cell
+
+        // Head for the centre of the next cell towards the target
+        const GridNode cell = WorldToGrid(position);
+        GridNode next;
+        Vector2D toWaypoint(0.0f, 0.0f);
+        if (field.GetNextStep(m_navGrid, cell, next)) {
+            toWaypoint = GridToWorld(next) - position;
+        }
+        else if (cell == field.GetTarget()) {
+            // Same cell as the target: go straight for it
+            toWaypoint = targetPosition - position;
+        }
+
+        if (toWaypoint.length() < 0.0001f) return Vector2D(0.0f, 0.0f);
+        return toWaypoint.normalized();
     }
 
     Vector2D AISystem::ComputeDirectionToTarget(
@@ -163,40 +279,7 @@ namespace GP2Engine {
     }
 
     bool AISystem::WouldCollide(Registry& registry, EntityID entity, const Vector2D& position) {
-        // Inline collision check to avoid dependency on EntityCollisionSystem
-        auto* sprite = registry.GetComponent<SpriteComponent>(entity);
-        auto* transform = registry.GetComponent<Transform2D>(entity);
-        if (!sprite || !transform) return false;
-
-        // Create AABB at test position
-        float scaledWidth = sprite->size.x * transform->scale.x;
-        float scaledHeight = sprite->size.y * transform->scale.y;
-        AABB testBox(position.x - scaledWidth * 0.5f, position.y - scaledHeight * 0.5f, scaledWidth, scaledHeight);
-
-        // Test against all other entities
-        for (EntityID other : registry.GetActiveEntities()) {
-            if (other == entity) continue;
-
-            auto* otherSprite = registry.GetComponent<SpriteComponent>(other);
-            auto* otherTransform = registry.GetComponent<Transform2D>(other);
-            auto* otherTag = registry.GetComponent<Tag>(other);
-            if (!otherSprite || !otherTransform || !otherTag) continue;
-
-            // Skip non-solid entities
-            if (otherTag->name == "Background" || otherTag->name == "StressTest") continue;
-
-            // Create AABB for other entity
-            float otherScaledWidth = otherSprite->size.x * otherTransform->scale.x;
-            float otherScaledHeight = otherSprite->size.y * otherTransform->scale.y;
-            AABB otherBox(otherTransform->position.x - otherScaledWidth * 0.5f,
-                         otherTransform->position.y - otherScaledHeight * 0.5f,
-                         otherScaledWidth, otherScaledHeight);
-
-            // Check intersection
-            if (testBox.Intersects(otherBox)) return true;
-        }
-
-        return false;
+        return m_collisionSystem->WouldCollide(registry, entity, position);
     }
 
     void AISystem::UpdateAnimation(
@@ -277,168 +360,108 @@ namespace GP2Engine {
     }
 
     void AISystem::SetupPathfindingGrid(int gridWidth, int gridHeight, float tileSize) {
-        m_gridWidth = gridWidth;
-        m_gridHeight = gridHeight;
         m_tileSize = tileSize;
 
         // Initialize grid (all walkable by default)
-        m_obstacles.resize(m_gridHeight);
-        for (int y = 0; y < m_gridHeight; ++y) {
-            m_obstacles[y].resize(m_gridWidth, false);
-        }
-    }
+        m_navGrid.Resize(gridWidth, gridHeight);
+        m_flowFields.clear();
 
-    void AISystem::SetWalkable(int x, int y, bool walkable) {
-        if (!IsInBounds(x, y)) return;
-        m_obstacles[y][x] = !walkable; // true = obstacle, false = walkable
-    }
+        // Rebuilt on the next request, once the obstacles are in
+        m_hierarchy.Clear();
+        m_entityRoutes.clear();
+        m_pathQueue.Clear();
+        m_pathRequests.clear();
 
-    bool AISystem::IsWalkable(int x, int y) const {
-        if (!IsInBounds(x, y)) return false;
-        return !m_obstacles[y][x]; // Invert: obstacle = false, walkable = true
+        // Paths through the old grid are re-requested on the next Update
+        m_entityPaths.clear();
     }
 
-    bool AISystem::IsInBounds(int x, int y) const {
-        return x >= 0 && x < m_gridWidth && y >= 0 && y < m_gridHeight;
+    void AISystem::SetWalkable(int x, int y, bool walkable) {
+        if (m_navGrid.SetWalkable(x, y, walkable) && m_hierarchy.IsBuilt()) {
+            m_hierarchy.OnCellChanged(m_navGrid, x, y);
+        }
     }
 
-    GridNode AISystem::WorldToGrid(const Vector2D& worldPos) const {
-        return GridNode(
-            static_cast<int>(worldPos.x / m_tileSize),
-            static_cast<int>(worldPos.y / m_tileSize)
-        );
-    }
+    void AISystem::SetPathfindingMode(GridPathfinder::Mode mode, bool diagonal) {
+        m_pathfinder.SetMode(mode);
+        m_pathfinder.SetDiagonal(diagonal);
+        m_pathQueue.SetPathfindingMode(mode, diagonal);
 
-    Vector2D AISystem::GridToWorld(const GridNode& node) const {
-        // Return center of tile
-        return Vector2D(
-            (node.x + 0.5f) * m_tileSize,
-            (node.y + 0.5f) * m_tileSize
-        );
+        if (m_hierarchy.IsDiagonal() != diagonal) {
+            m_hierarchy.SetDiagonal(diagonal);
+            m_hierarchy.Clear();
+        }
     }
 
-    std::vector<GridNode> AISystem::FindPath(const GridNode& start, const GridNode& goal) {
-        // Validate start and goal
-        if (!IsWalkable(start.x, start.y) || !IsWalkable(goal.x, goal.y)) {
-            return {}; // No path if start or goal is blocked
+    void AISystem::SetHierarchical(bool enabled, int clusterSize) {
+        m_useHierarchy = enabled;
+        if (clusterSize != m_clusterSize) {
+            m_clusterSize = clusterSize;
+            m_hierarchy.Clear();
         }
-
-        // Open set: nodes to evaluate (priority queue by fCost)
-        std::priority_queue<AStarNode, std::vector<AStarNode>, std::greater<AStarNode>> openSet;
-
-        // Closed set: nodes already evaluated
-        std::unordered_map<GridNode, bool, GridNode::Hash> closedSet;
-
-        // G-costs: best known cost from start to each node
-        std::unordered_map<GridNode, float, GridNode::Hash> gCosts;
-
-        // Parent tracking for path reconstruction
-        std::unordered_map<GridNode, GridNode, GridNode::Hash> cameFrom;
-
-        // Initialize start node
-        float startH = Heuristic(start, goal);
-        openSet.push(AStarNode(start, 0, startH));
-        gCosts[start] = 0;
-
-        // A* main loop
-        while (!openSet.empty()) {
-            // Get node with lowest fCost
-            AStarNode current = openSet.top();
-            openSet.pop();
-
-            // Skip if already processed
-            if (closedSet[current.node]) continue;
-
-            // Mark as processed
-            closedSet[current.node] = true;
-
-            // Goal reached!
-            if (current.node == goal) {
-                return ReconstructPath(cameFrom, start, goal);
-            }
-
-            // Check all neighbors
-            std::vector<GridNode> neighbors = GetNeighbors(current.node);
-            for (const GridNode& neighbor : neighbors) {
-                // Skip if already evaluated
-                if (closedSet[neighbor]) continue;
-
-                // Calculate tentative gCost (always 1.0 for orthogonal movement)
-                float moveCost = 1.0f;
-                float tentativeGCost = current.gCost + moveCost;
-
-                // Check if this path to neighbor is better
-                auto it = gCosts.find(neighbor);
-                if (it == gCosts.end() || tentativeGCost < it->second) {
-                    // Update best path to neighbor
-                    gCosts[neighbor] = tentativeGCost;
-                    cameFrom[neighbor] = current.node;
-
-                    // Add to open set
-                    float hCost = Heuristic(neighbor, goal);
-                    openSet.push(AStarNode(neighbor, tentativeGCost, hCost));
-                }
-            }
+        if (!enabled) {
+            m_hierarchy.Clear();
+            m_entityRoutes.clear();
         }
-
-        // No path found
-        return {};
     }
 
-    float AISystem::Heuristic(const GridNode& a, const GridNode& b) const {
-        // Manhattan distance for 4-directional movement
-        int dx = std::abs(a.x - b.x);
-        int dy = std::abs(a.y - b.y);
-        return static_cast<float>(dx + dy);
+    void AISystem::SetDeferredPaths(bool enabled, double frameBudgetUs, int threadCount) {
+        m_deferPaths = enabled;
+        m_pathQueue.SetFrameBudget(frameBudgetUs);
+        m_pathQueue.SetThreadCount(threadCount);
+        if (!enabled) {
+            m_pathQueue.Clear();
+            m_pathRequests.clear();
+        }
     }
 
-    std::vector<GridNode> AISystem::GetNeighbors(const GridNode& node) const {
-        std::vector<GridNode> neighbors;
-
-        // 4-directional neighbors (orthogonal only - no diagonal)
-        const int dx[] = { 0, 1, 0, -1 };
-        const int dy[] = { -1, 0, 1, 0 };
-
-        for (int i = 0; i < 4; ++i) {
-            int nx = node.x + dx[i];
-            int ny = node.y + dy[i];
+    void AISystem::RequestPath(EntityID entity, const GridNode& start, const GridNode& goal, std::vector<GridNode>& path) {
+        if (!m_useHierarchy) {
+            m_pathfinder.FindPath(m_navGrid, start, goal, path);
+            return;
+        }
 
-            if (IsWalkable(nx, ny)) {
-                neighbors.push_back(GridNode(nx, ny));
-            }
+        if (!m_hierarchy.IsBuilt()) {
+            m_hierarchy.Build(m_navGrid, m_clusterSize);
         }
 
-        return neighbors;
+        // Only the first segment is refined now; the rest as the agent gets there
+        AbstractRoute& route = m_entityRoutes[entity];
+        route.segment = 0;
+        path.clear();
+        if (m_hierarchy.FindAbstractPath(m_navGrid, start, goal, route.waypoints) && !RefineNextSegment(entity, path)) {
+            path.assign(1, start);
+        }
     }
 
-    std::vector<GridNode> AISystem::ReconstructPath(
-        const std::unordered_map<GridNode, GridNode, GridNode::Hash>& cameFrom,
-        const GridNode& start,
-        const GridNode& goal
-    ) {
-        std::vector<GridNode> path;
-        GridNode current = goal;
-
-        // Trace back from goal to start
-        while (current != start) {
-            path.push_back(current);
+    bool AISystem::RefineNextSegment(EntityID entity, std::vector<GridNode>& path) {
+        if (!m_useHierarchy) return false;
 
-            auto it = cameFrom.find(current);
-            if (it == cameFrom.end()) {
-                // Path reconstruction failed
-                return {};
-            }
+        auto routeIt = m_entityRoutes.find(entity);
+        if (routeIt == m_entityRoutes.end()) return false;
 
-            current = it->second;
-        }
+        AbstractRoute& route = routeIt->second;
+        if (route.segment + 1 >= route.waypoints.size()) return false;
 
-        // Add start node
-        path.push_back(start);
+        const GridNode& from = route.waypoints[route.segment];
+        const GridNode& to = route.waypoints[route.segment + 1];
+        ++route.segment;
+        return m_hierarchy.RefineSegment(m_navGrid, from, to, path);
+    }
 
-        // Reverse to get path from start to goal
-        std::reverse(path.begin(), path.end());
+    GridNode AISystem::WorldToGrid(const Vector2D& worldPos) const {
+        return GridNode(
+            static_cast<int>(worldPos.x / m_tileSize),
+            static_cast<int>(worldPos.y / m_tileSize)
+        );
+    }
 
-        return path;
+    Vector2D AISystem::GridToWorld(const GridNode& node) const {
+        // Return center of tile
+        return Vector2D(
+            (node.x + 0.5f) * m_tileSize,
+            (node.y + 0.5f) * m_tileSize
+        );
     }
 
     void AISystem::RenderDebug(DebugRenderer& debugRenderer, Registry& registry) {
@@ -476,10 +499,27 @@ namespace GP2Engine {
                 }
             }
 
+            // Flow field agents have no stored path: trace the field from their cell into a local path,
+            // so drawing never changes what the agent follows
+            const std::vector<GridNode>* drawnPath = nullptr;
+            size_t targetIndex = aiComp->currentPathIndex;
+            std::vector<GridNode> tracedPath;
+            if (aiComp->useFlowField) {
+                auto fieldIt = m_flowFields.find(aiComp->targetEntity);
+                if (fieldIt != m_flowFields.end()) {
+                    fieldIt->second.TracePath(m_navGrid, WorldToGrid(transform->position), tracedPath, 256);
+                    drawnPath = &tracedPath;
+                    targetIndex = tracedPath.size() > 1 ? 1 : 0;   // The cell after the agent's own
+                }
+            }
+            else {
+                auto pathIt = m_entityPaths.find(entity);
+                if (pathIt != m_entityPaths.end()) drawnPath = &pathIt->second;
+            }
+
             // Draw current path if we have one
-            auto pathIt = m_entityPaths.find(entity);
-            if (pathIt != m_entityPaths.end() && !pathIt->second.empty()) {
-                const std::vector<GridNode>& currentPath = pathIt->second;
+            if (drawnPath && !drawnPath->empty()) {
+                const std::vector<GridNode>& currentPath = *drawnPath;
 
                 // Draw path as connected lines (green)
                 for (size_t i = 0; i < currentPath.size() - 1; ++i) {
@@ -514,8 +554,8 @@ namespace GP2Engine {
                 }
 
                 // Draw current target waypoint (yellow circle)
-                if (aiComp->currentPathIndex < currentPath.size()) {
-                    Vector2D currentTarget = GridToWorld(currentPath[aiComp->currentPathIndex]);
+                if (targetIndex < currentPath.size()) {
+                    Vector2D currentTarget = GridToWorld(currentPath[targetIndex]);
                     debugRenderer.DrawCircle(
                         currentTarget,
                         m_tileSize * 0.3f,
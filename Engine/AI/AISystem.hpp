@@ -8,10 +8,17 @@
  * any entity can have AI by attaching AIComponent.
  *
  * Features:
- * - A* pathfinding algorithm for smart navigation
- * - Grid-based obstacle detection
+ * - A* or Jump Point Search pathfinding for smart navigation (GridPathfinder)
+ * - Grid-based obstacle detection on a bitset NavGrid
  * - Target tracking and chase behavior
  * - Path recalculation when target moves
+ * - Shared flow field per target for agents with useFlowField, so many
+ *   chasers cost about as much as one
+ * - Optional hierarchical (HPA*) paths for large maps: an abstract route
+ *   through cluster entrances, refined one segment at a time as the agent
+ *   walks it
+ * - Optional deferred path requests: searches go through a PathRequestQueue
+ *   under a per-frame budget while agents keep their previous path
  * - Dynamic animation switching based on movement direction
  */
 
@@ -20,36 +27,18 @@
 #include <ECS/Registry.hpp>
 #include <ECS/Component.hpp>
 #include <Graphics/DebugRenderer.hpp>
+#include "FlowField.hpp"
+#include "GridPathfinder.hpp"
+#include "HierarchicalPathfinder.hpp"
+#include "NavGrid.hpp"
+#include "PathRequestQueue.hpp"
 #include <vector>
-#include <queue>
 #include <unordered_map>
+#include <memory>
 
 namespace GP2Engine {
 
-    /**
-     * @brief Grid node for A* pathfinding
-     */
-    struct GridNode {
-        int x, y;
-
-        GridNode() : x(0), y(0) {}
-        GridNode(int nx, int ny) : x(nx), y(ny) {}
-
-        bool operator==(const GridNode& other) const {
-            return x == other.x && y == other.y;
-        }
-
-        bool operator!=(const GridNode& other) const {
-            return !(*this == other);
-        }
-
-        // Hash function for unordered_map
-        struct Hash {
-            size_t operator()(const GridNode& node) const {
-                return std::hash<int>()(node.x) ^ (std::hash<int>()(node.y) << 1);
-            }
-        };
-    };
+    class EntityCollisionSystem;
 
     /**
      * @brief ECS System for AI pathfinding and behavior
@@ -62,10 +51,15 @@ namespace GP2Engine {
      * - Dynamic animation switching
      *
      * The system maintains a shared pathfinding grid that all AI entities use.
+     * Movement is validated through its own EntityCollisionSystem broadphase,
+     * which is synced once per Update and told about every AI move.
      */
     class AISystem {
     public:
-        AISystem() = default;
+        AISystem();
+        ~AISystem();
+        AISystem(AISystem&&) noexcept;
+        AISystem& operator=(AISystem&&) noexcept;
 
         /**
          * @brief Update all entities with AIComponent
@@ -87,9 +81,52 @@ namespace GP2Engine {
          * @param x Grid X coordinate
          * @param y Grid Y coordinate
          * @param walkable True if walkable, false for obstacle
+         *
+         * Only the clusters around the cell are updated when hierarchical
+         * paths are enabled.
          */
         void SetWalkable(int x, int y, bool walkable);
 
+        /**
+         * @brief Choose how paths are searched on the grid
+         * @param mode A* or Jump Point Search (same path costs, JPS expands far fewer nodes)
+         * @param diagonal True for 8-directional movement without corner cutting
+         */
+        void SetPathfindingMode(GridPathfinder::Mode mode, bool diagonal = false);
+
+        /**
+         * @brief Use hierarchical (HPA*) paths instead of full-grid searches
+         * @param enabled Near-optimal paths, much cheaper to request on large maps
+         * @param clusterSize Cluster side in cells
+         */
+        void SetHierarchical(bool enabled, int clusterSize = 16);
+        bool IsHierarchical() const { return m_useHierarchy; }
+
+        /**
+         * @brief Queue path requests instead of searching inside the agent loop
+         *
+         * Requests are processed at the end of Update within the budget, and
+         * an agent keeps following its previous path until the new one
+         * arrives. Hierarchical routes stay immediate (their abstract search
+         * is already cheap and refinement is lazy).
+         *
+         * @param enabled Use the queue
+         * @param frameBudgetUs Microseconds of searching per frame
+         * @param threadCount Threads searching in parallel, including the caller
+         */
+        void SetDeferredPaths(bool enabled, double frameBudgetUs = 1000.0, int threadCount = 1);
+        bool IsDeferringPaths() const { return m_deferPaths; }
+
+        /**
+         * @brief Queue depth, frame time and latency of deferred path requests
+         */
+        const PathRequestQueue& GetPathQueue() const { return m_pathQueue; }
+
+        /**
+         * @brief Shared navigation grid
+         */
+        const NavGrid& GetNavGrid() const { return m_navGrid; }
+
         /**
          * @brief Render debug visualization for all AI entities
          * @param debugRenderer Debug renderer for drawing debug shapes
@@ -99,38 +136,46 @@ namespace GP2Engine {
 
     private:
         // Shared pathfinding grid (all AI entities use this)
-        int m_gridWidth = 0;
-        int m_gridHeight = 0;
         float m_tileSize = 64.0f;
-        std::vector<std::vector<bool>> m_obstacles;  // false = walkable, true = obstacle
+        NavGrid m_navGrid;
+        GridPathfinder m_pathfinder;                // Search state reused by every path request
+        HierarchicalPathfinder m_hierarchy;         // Built on the first hierarchical request
+        bool m_useHierarchy = false;
+        int m_clusterSize = 16;
+        PathRequestQueue m_pathQueue;
+        bool m_deferPaths = false;
 
         // Per-entity path storage
         std::unordered_map<EntityID, std::vector<GridNode>> m_entityPaths;
 
+        // Abstract route per entity in hierarchical mode; m_entityPaths holds
+        // the refined segment ending at waypoints[segment]
+        struct AbstractRoute {
+            std::vector<GridNode> waypoints;
+            size_t segment = 0;
+        };
+        std::unordered_map<EntityID, AbstractRoute> m_entityRoutes;
+
+        // Request in flight per entity when paths are deferred
+        std::unordered_map<EntityID, PathRequestQueue::Handle> m_pathRequests;
+
+        // Flow fields shared by all agents chasing the same target
+        std::unordered_map<EntityID, FlowField> m_flowFields;
+
+        // Broadphase for movement collision checks
+        std::unique_ptr<EntityCollisionSystem> m_collisionSystem;
+
         // Helper methods
         Vector2D ComputeDirectionToTarget(Registry& registry, EntityID aiEntity, EntityID targetEntity, float detectionRange);
         bool WouldCollide(Registry& registry, EntityID entity, const Vector2D& position);
+        Vector2D FollowFlowField(EntityID targetEntity, const Vector2D& position, const Vector2D& targetPosition);
+        void RequestPath(EntityID entity, const GridNode& start, const GridNode& goal, std::vector<GridNode>& path);
+        bool RefineNextSegment(EntityID entity, std::vector<GridNode>& path);
+        void CancelPathRequest(EntityID entity);
+        size_t ClosestPathIndex(const std::vector<GridNode>& path, const GridNode& cell) const;
         void UpdateAnimation(Registry& registry, EntityID entity, const Vector2D& direction, AIComponent& aiComp);
 
-        // A* pathfinding methods
-        struct AStarNode {
-            GridNode node;
-            float gCost, hCost, fCost;
-            AStarNode() : gCost(0), hCost(0), fCost(0) {}
-            AStarNode(const GridNode& n, float g, float h) : node(n), gCost(g), hCost(h), fCost(g + h) {}
-            bool operator>(const AStarNode& other) const { return fCost > other.fCost; }
-        };
-
-        std::vector<GridNode> FindPath(const GridNode& start, const GridNode& goal);
-        float Heuristic(const GridNode& a, const GridNode& b) const;
-        std::vector<GridNode> GetNeighbors(const GridNode& node) const;
-        bool IsInBounds(int x, int y) const;
-        bool IsWalkable(int x, int y) const;
-        std::vector<GridNode> ReconstructPath(
-            const std::unordered_map<GridNode, GridNode, GridNode::Hash>& cameFrom,
-            const GridNode& start,
-            const GridNode& goal
-        );
+        // Grid conversion
         GridNode WorldToGrid(const Vector2D& worldPos) const;
         Vector2D GridToWorld(const GridNode& node) const;
     };
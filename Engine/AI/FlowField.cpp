@@ -0,0 +1,279 @@
+/**
+ * @file FlowField.cpp
+ * @author Asri (100%)
+ * @brief Implementation of the lazily built flow field
+ */
+
+#include "FlowField.hpp"
+#include "GridPathfinder.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <random>
+
+namespace GP2Engine {
+
+    namespace {
+        using Clock = std::chrono::high_resolution_clock;
+
+        double MillisecondsSince(Clock::time_point start) {
+            return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        }
+
+        constexpr float SQRT2 = 1.41421356f;
+
+        // Orthogonal directions, then diagonals
+        constexpr int DIRECTION_X[8] = { 0, 1, 0, -1, 1, 1, -1, -1 };
+        constexpr int DIRECTION_Y[8] = { -1, 0, 1, 0, -1, 1, 1, -1 };
+
+        // Same movement rule as GridPathfinder: no corner cutting
+        bool CanStep(const NavGrid& grid, int x, int y, int dx, int dy) {
+            if (!grid.IsWalkable(x + dx, y + dy)) return false;
+            return dx == 0 || dy == 0 || (grid.IsWalkable(x + dx, y) && grid.IsWalkable(x, y + dy));
+        }
+    }
+
+    // ============================================================================
+    // TARGET
+    // ============================================================================
+
+    void FlowField::SetDiagonal(bool diagonal) {
+        if (m_diagonal == diagonal) return;
+        m_diagonal = diagonal;
+        m_stale = true;
+    }
+
+    void FlowField::SetTarget(const NavGrid& grid, const GridNode& target) {
+        if (m_hasTarget && target == m_target && IsCurrent(grid)) return;
+
+        m_target = target;
+        m_hasTarget = true;
+        Restart(grid);
+    }
+
+    bool FlowField::IsCurrent(const NavGrid& grid) const {
+        return !m_stale && grid.GetWidth() == m_gridWidth && grid.GetHeight() == m_gridHeight &&
+               grid.GetVersion() == m_gridVersion;
+    }
+
+    void FlowField::Restart(const NavGrid& grid) {
+        m_gridWidth = grid.GetWidth();
+        m_gridHeight = grid.GetHeight();
+        m_gridVersion = grid.GetVersion();
+        m_stale = false;
+
+        const size_t cellCount = grid.GetCellCount();
+        if (m_cells.size() < cellCount) {
+            m_cells.resize(cellCount, CellState{ 0.0f, NO_CELL, 0, false });
+        }
+        m_queue.clear();
+        m_queueHead = 0;
+        m_heap.clear();
+
+        // Stamps from 4 billion restarts ago would look current again: clear once on wrap
+        if (++m_generation == 0) {
+            for (CellState& cell : m_cells) cell.stamp = 0;
+            m_generation = 1;
+        }
+
+        ++m_stats.restarts;
+        m_stats.expanded = 0;
+
+        if (grid.IsWalkable(m_target.x, m_target.y)) {
+            Discover(grid.ToIndex(m_target.x, m_target.y), NO_CELL, 0.0f);
+        }
+    }
+
+    // ============================================================================
+    // LAZY DIJKSTRA
+    // ============================================================================
+
+    void FlowField::Discover(uint32_t cell, uint32_t from, float distance) {
+        // Breadth-first with unit costs: the first distance found is final
+        m_cells[cell] = { distance, from, m_generation, !m_diagonal };
+        if (m_diagonal) {
+            m_heap.push_back({ distance, cell });
+            std::push_heap(m_heap.begin(), m_heap.end(), std::greater<HeapEntry>());
+        }
+        else {
+            m_queue.push_back(cell);
+        }
+    }
+
+    bool FlowField::Settle(const NavGrid& grid, const GridNode& cell, uint32_t& index) {
+        if (!m_hasTarget) return false;
+        if (!IsCurrent(grid)) Restart(grid);
+        if (!grid.IsWalkable(cell.x, cell.y)) return false;
+
+        index = grid.ToIndex(cell.x, cell.y);
+        while (m_cells[index].stamp != m_generation || !m_cells[index].settled) {
+            uint32_t current;
+            if (m_diagonal) {
+                if (m_heap.empty()) return false;
+                std::pop_heap(m_heap.begin(), m_heap.end(), std::greater<HeapEntry>());
+                const HeapEntry entry = m_heap.back();
+                m_heap.pop_back();
+
+                // Skip entries left behind by a shorter distance found later
+                CellState& state = m_cells[entry.cell];
+                if (state.settled || entry.distance > state.distance) continue;
+                state.settled = true;
+                current = entry.cell;
+            }
+            else {
+                if (m_queueHead == m_queue.size()) return false;
+                current = m_queue[m_queueHead++];
+            }
+
+            ++m_stats.expanded;
+            ExpandCell(grid, current);
+        }
+        return true;
+    }
+
+    void FlowField::ExpandCell(const NavGrid& grid, uint32_t cell) {
+        const uint32_t width = static_cast<uint32_t>(grid.GetWidth());
+        const int x = static_cast<int>(cell % width);
+        const int y = static_cast<int>(cell / width);
+        const float distance = m_cells[cell].distance;
+
+        // Moves are symmetric, so stepping out from the target finds the way back
+        const int count = m_diagonal ? 8 : 4;
+        for (int i = 0; i < count; ++i) {
+            if (!CanStep(grid, x, y, DIRECTION_X[i], DIRECTION_Y[i])) continue;
+
+            const uint32_t neighbor = grid.ToIndex(x + DIRECTION_X[i], y + DIRECTION_Y[i]);
+            const float candidate = distance + (i < 4 ? 1.0f : SQRT2);
+            CellState& state = m_cells[neighbor];
+            if (state.stamp != m_generation) {
+                Discover(neighbor, cell, candidate);
+            }
+            else if (!state.settled && candidate < state.distance) {
+                state.distance = candidate;
+                state.next = cell;
+                m_heap.push_back({ candidate, neighbor });
+                std::push_heap(m_heap.begin(), m_heap.end(), std::greater<HeapEntry>());
+            }
+        }
+    }
+
+    // ============================================================================
+    // QUERIES
+    // ============================================================================
+
+    bool FlowField::GetNextStep(const NavGrid& grid, const GridNode& from, GridNode& next) {
+        uint32_t index;
+        if (!Settle(grid, from, index)) return false;
+
+        const uint32_t step = m_cells[index].next;
+        if (step == NO_CELL) return false;
+
+        const uint32_t width = static_cast<uint32_t>(grid.GetWidth());
+        next = GridNode(static_cast<int>(step % width), static_cast<int>(step / width));
+        return true;
+    }
+
+    float FlowField::GetDistance(const NavGrid& grid, const GridNode& from) {
+        uint32_t index;
+        return Settle(grid, from, index) ? m_cells[index].distance : -1.0f;
+    }
+
+    bool FlowField::TracePath(const NavGrid& grid, const GridNode& from, std::vector<GridNode>& path, size_t maxCells) {
+        path.clear();
+        uint32_t index;
+        if (!Settle(grid, from, index)) return false;
+
+        // Every cell on the way has a smaller distance, so it is settled too
+        const uint32_t width = static_cast<uint32_t>(grid.GetWidth());
+        for (uint32_t cell = index; cell != NO_CELL; cell = m_cells[cell].next) {
+            if (maxCells != 0 && path.size() == maxCells) break;
+            path.push_back(GridNode(static_cast<int>(cell % width), static_cast<int>(cell / width)));
+        }
+        return true;
+    }
+
+    // ============================================================================
+    // BENCHMARK
+    // ============================================================================
+
+    FlowField::BenchmarkResult FlowField::RunBenchmark(int size, size_t agents, int targetMoves) {
+        BenchmarkResult result;
+        result.width = result.height = std::max(size, 2);
+        result.agents = agents;
+        result.targetMoves = std::max(targetMoves, 1);
+        const int side = result.width;
+
+        // Rooms-like map: wall segments on an open floor
+        std::mt19937 rng(2024);
+        std::uniform_int_distribution<int> cellDist(0, side - 1);
+        NavGrid grid;
+        grid.Resize(side, side);
+        const int walls = side * side / 256;
+        for (int i = 0; i < walls; ++i) {
+            const int x = cellDist(rng), y = cellDist(rng);
+            const int length = 4 + static_cast<int>(rng() % 28);
+            const bool horizontal = (rng() & 1) != 0;
+            for (int j = 0; j < length; ++j) {
+                grid.SetWalkable(horizontal ? x + j : x, horizontal ? y : y + j, false);
+            }
+        }
+
+        auto randomWalkable = [&]() {
+            GridNode cell(cellDist(rng), cellDist(rng));
+            while (!grid.IsWalkable(cell.x, cell.y)) cell = GridNode(cellDist(rng), cellDist(rng));
+            return cell;
+        };
+        std::vector<GridNode> chasers(agents);
+        for (GridNode& chaser : chasers) chaser = randomWalkable();
+
+        // The target walks one cell per move
+        std::vector<GridNode> targets;
+        targets.push_back(randomWalkable());
+        while (static_cast<int>(targets.size()) < result.targetMoves) {
+            GridNode next = targets.back();
+            const int direction = static_cast<int>(rng() % 4);
+            next.x += DIRECTION_X[direction];
+            next.y += DIRECTION_Y[direction];
+            if (grid.IsWalkable(next.x, next.y)) targets.push_back(next);
+        }
+
+        FlowField field;
+        GridNode step;
+        size_t expanded = 0;
+        auto start = Clock::now();
+        for (const GridNode& target : targets) {
+            field.SetTarget(grid, target);
+            for (const GridNode& chaser : chasers) {
+                field.GetNextStep(grid, chaser, step);
+            }
+            expanded += field.GetStats().expanded;
+        }
+        result.flowMsPerMove = MillisecondsSince(start) / result.targetMoves;
+        result.cellsPerMove = static_cast<double>(expanded) / result.targetMoves;
+
+        GridPathfinder pathfinder;
+        pathfinder.SetMode(GridPathfinder::Mode::JumpPoint);
+        std::vector<GridNode> path;
+        start = Clock::now();
+        for (const GridNode& target : targets) {
+            for (const GridNode& chaser : chasers) {
+                pathfinder.FindPath(grid, chaser, target, path);
+            }
+        }
+        result.pathMsPerMove = MillisecondsSince(start) / result.targetMoves;
+
+        // Field distances against searched costs, for the last target
+        for (const GridNode& chaser : chasers) {
+            const bool found = pathfinder.FindPath(grid, chaser, targets.back(), path);
+            const float distance = field.GetDistance(grid, chaser);
+            if (found != (distance >= 0.0f) ||
+                (found && std::fabs(distance - pathfinder.GetLastStats().cost) > 1e-3f)) {
+                result.costsMatch = false;
+            }
+        }
+
+        return result;
+    }
+
+} // namespace GP2Engine
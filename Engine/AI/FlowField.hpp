@@ -0,0 +1,135 @@
+/**
+ * @file FlowField.hpp
+ * @author Asri (100%)
+ * @brief Shared distance field towards one target on a NavGrid
+ *
+ * Instead of every chaser searching its own path to the same target, one
+ * Dijkstra pass runs outwards from the target and stores, for every cell it
+ * reaches, the distance to the target and the neighbouring cell one step
+ * closer. An agent's next step is then a single lookup, so a thousand
+ * chasers cost about the same as one.
+ *
+ * The pass is lazy and resumable: it only grows until the cell being asked
+ * about is settled and continues from where it stopped on the next query.
+ * When the target moves to another cell (or the grid changes) the field
+ * restarts in O(1) with a generation stamp and regrows only as far as the
+ * agents need it.
+ *
+ * Features:
+ * - 4-directional (breadth-first, unit costs) or 8-directional movement
+ *   (heap, diagonals cost sqrt(2), no corner cutting)
+ * - Next step, distance and full path lookups from any cell
+ * - Same path costs as GridPathfinder with the same movement
+ */
+
+#pragma once
+
+#include "NavGrid.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GP2Engine {
+
+    /**
+     * @brief Lazily built flow field towards one target cell
+     */
+    class FlowField {
+    public:
+        struct Stats {
+            size_t restarts = 0;        // Target cell or grid changes
+            size_t expanded = 0;        // Cells settled since the last restart
+        };
+
+        struct BenchmarkResult {
+            int width = 0, height = 0;
+            size_t agents = 0;
+            int targetMoves = 0;
+            double flowMsPerMove = 0.0;     // Restart + one next-step lookup per agent
+            double pathMsPerMove = 0.0;     // One GridPathfinder (Jump Point) search per agent
+            double cellsPerMove = 0.0;      // Cells the field settled per move
+            bool costsMatch = true;         // Field distances equal the searched path costs
+        };
+
+        // 8-directional movement (false = 4-directional); restarts the field
+        void SetDiagonal(bool diagonal);
+        bool IsDiagonal() const { return m_diagonal; }
+
+        /**
+         * @brief Aim the field at a target cell
+         *
+         * Cheap to call every frame: the field only restarts if the cell,
+         * the grid size or the grid's version changed.
+         */
+        void SetTarget(const NavGrid& grid, const GridNode& target);
+
+        const GridNode& GetTarget() const { return m_target; }
+        bool HasTarget() const { return m_hasTarget; }
+
+        /**
+         * @brief Neighbouring cell one step closer to the target
+         * @return False if the target is unreachable from the cell (or the
+         *         cell is the target itself)
+         */
+        bool GetNextStep(const NavGrid& grid, const GridNode& from, GridNode& next);
+
+        /**
+         * @brief Path cost from a cell to the target, -1 if unreachable
+         */
+        float GetDistance(const NavGrid& grid, const GridNode& from);
+
+        /**
+         * @brief Cells from a cell to the target inclusive (cleared first)
+         * @param maxCells Stop after this many cells (0 = no limit)
+         * @return False if the target is unreachable
+         */
+        bool TracePath(const NavGrid& grid, const GridNode& from, std::vector<GridNode>& path, size_t maxCells = 0);
+
+        const Stats& GetStats() const { return m_stats; }
+
+        /**
+         * Random size x size map with one target walking a cell per move and
+         * `agents` chasers: per move, the flow field (restart and one lookup
+         * per agent) against one Jump Point Search per agent.
+         */
+        static BenchmarkResult RunBenchmark(int size, size_t agents, int targetMoves);
+
+    private:
+        static constexpr uint32_t NO_CELL = 0xFFFFFFFFu;
+
+        struct CellState {
+            float distance;
+            uint32_t next;          // Neighbour towards the target (NO_CELL at the target)
+            uint32_t stamp;         // Valid only while stamp == m_generation
+            bool settled;           // Distance is final
+        };
+
+        struct HeapEntry {
+            float distance;
+            uint32_t cell;
+            bool operator>(const HeapEntry& other) const { return distance > other.distance; }
+        };
+
+        std::vector<CellState> m_cells;
+        std::vector<uint32_t> m_queue;      // 4-directional frontier (FIFO)
+        size_t m_queueHead = 0;
+        std::vector<HeapEntry> m_heap;      // 8-directional frontier (lazy deletion)
+        uint32_t m_generation = 0;
+
+        GridNode m_target;
+        bool m_hasTarget = false;
+        bool m_diagonal = false;
+        bool m_stale = true;                // Movement changed since the last restart
+        int m_gridWidth = 0;
+        int m_gridHeight = 0;
+        uint64_t m_gridVersion = 0;
+        Stats m_stats;
+
+        void Restart(const NavGrid& grid);
+        bool IsCurrent(const NavGrid& grid) const;
+        bool Settle(const NavGrid& grid, const GridNode& cell, uint32_t& index);
+        void Discover(uint32_t cell, uint32_t from, float distance);
+        void ExpandCell(const NavGrid& grid, uint32_t cell);
+    };
+
+} // namespace GP2Engine
@@ -0,0 +1,586 @@
+/**
+ * @file GridPathfinder.cpp
+ * @author Asri (100%)
+ * @brief Implementation of A* over a NavGrid with an indexed binary heap
+ */
+
+#include "GridPathfinder.hpp"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <queue>
+#include <random>
+#include <unordered_map>
+
+namespace GP2Engine {
+
+    namespace {
+        using Clock = std::chrono::high_resolution_clock;
+
+        double SecondsSince(Clock::time_point start) {
+            return std::chrono::duration<double>(Clock::now() - start).count();
+        }
+
+        constexpr float UNVISITED = std::numeric_limits<float>::infinity();
+        constexpr float SQRT2 = 1.41421356f;
+
+        // Orthogonal directions, then diagonals
+        constexpr int DIRECTION_X[8] = { 0, 1, 0, -1, 1, 1, -1, -1 };
+        constexpr int DIRECTION_Y[8] = { -1, 0, 1, 0, -1, 1, 1, -1 };
+
+        float Manhattan(int x, int y, const GridNode& goal) {
+            return static_cast<float>(std::abs(x - goal.x) + std::abs(y - goal.y));
+        }
+
+        uint64_t ReverseBits(uint64_t bits) {
+            bits = ((bits >> 1) & 0x5555555555555555ull) | ((bits & 0x5555555555555555ull) << 1);
+            bits = ((bits >> 2) & 0x3333333333333333ull) | ((bits & 0x3333333333333333ull) << 2);
+            bits = ((bits >> 4) & 0x0F0F0F0F0F0F0F0Full) | ((bits & 0x0F0F0F0F0F0F0F0Full) << 4);
+            bits = ((bits >> 8) & 0x00FF00FF00FF00FFull) | ((bits & 0x00FF00FF00FF00FFull) << 8);
+            bits = ((bits >> 16) & 0x0000FFFF0000FFFFull) | ((bits & 0x0000FFFF0000FFFFull) << 16);
+            return (bits >> 32) | (bits << 32);
+        }
+
+        float StepCost(int diagonal, int straight) {
+            return static_cast<float>(diagonal) * SQRT2 + static_cast<float>(straight);
+        }
+
+        // Scattered blocked cells (scatterPercent of them) plus wall segments
+        // that force detours, and random walkable start/goal pairs
+        void BuildBenchmarkMap(int side, int scatterPercent, int queries, std::mt19937& rng, NavGrid& grid,
+                               std::vector<std::pair<GridNode, GridNode>>& pairs) {
+            grid.Resize(side, side);
+            std::uniform_int_distribution<int> cellDist(0, side - 1);
+            for (int y = 0; y < side; ++y) {
+                for (int x = 0; x < side; ++x) {
+                    if (static_cast<int>(rng() % 100) < scatterPercent) grid.SetWalkable(x, y, false);
+                }
+            }
+            const int walls = side * side / 256;
+            for (int i = 0; i < walls; ++i) {
+                const int x = cellDist(rng), y = cellDist(rng);
+                const int length = 4 + static_cast<int>(rng() % 28);
+                const bool horizontal = (rng() & 1) != 0;
+                for (int j = 0; j < length; ++j) {
+                    grid.SetWalkable(horizontal ? x + j : x, horizontal ? y : y + j, false);
+                }
+            }
+
+            pairs.clear();
+            pairs.reserve(static_cast<size_t>(std::max(queries, 0)));
+            for (int attempt = 0; static_cast<int>(pairs.size()) < queries && attempt < queries * 20; ++attempt) {
+                const GridNode from(cellDist(rng), cellDist(rng));
+                const GridNode to(cellDist(rng), cellDist(rng));
+                if (grid.IsWalkable(from.x, from.y) && grid.IsWalkable(to.x, to.y)) pairs.emplace_back(from, to);
+            }
+        }
+
+        // The A* AISystem used before GridPathfinder (hash maps and a priority
+        // queue with duplicates), kept as the benchmark baseline
+        float LegacyFindPath(const NavGrid& grid, const GridNode& start, const GridNode& goal) {
+            struct OpenNode {
+                GridNode node;
+                float gCost, fCost;
+                bool operator>(const OpenNode& other) const { return fCost > other.fCost; }
+            };
+
+            if (!grid.IsWalkable(start.x, start.y) || !grid.IsWalkable(goal.x, goal.y)) return -1.0f;
+
+            std::priority_queue<OpenNode, std::vector<OpenNode>, std::greater<OpenNode>> openSet;
+            std::unordered_map<GridNode, bool, GridNode::Hash> closedSet;
+            std::unordered_map<GridNode, float, GridNode::Hash> gCosts;
+            std::unordered_map<GridNode, GridNode, GridNode::Hash> cameFrom;
+
+            openSet.push({ start, 0.0f, Manhattan(start.x, start.y, goal) });
+            gCosts[start] = 0.0f;
+
+            const int dx[] = { 0, 1, 0, -1 };
+            const int dy[] = { -1, 0, 1, 0 };
+            while (!openSet.empty()) {
+                OpenNode current = openSet.top();
+                openSet.pop();
+                if (closedSet[current.node]) continue;
+                closedSet[current.node] = true;
+
+                if (current.node == goal) return current.gCost;
+
+                std::vector<GridNode> neighbors;
+                for (int i = 0; i < 4; ++i) {
+                    if (grid.IsWalkable(current.node.x + dx[i], current.node.y + dy[i])) {
+                        neighbors.push_back(GridNode(current.node.x + dx[i], current.node.y + dy[i]));
+                    }
+                }
+                for (const GridNode& neighbor : neighbors) {
+                    if (closedSet[neighbor]) continue;
+                    const float tentative = current.gCost + 1.0f;
+                    auto it = gCosts.find(neighbor);
+                    if (it == gCosts.end() || tentative < it->second) {
+                        gCosts[neighbor] = tentative;
+                        cameFrom[neighbor] = current.node;
+                        openSet.push({ neighbor, tentative, tentative + Manhattan(neighbor.x, neighbor.y, goal) });
+                    }
+                }
+            }
+            return -1.0f;
+        }
+    }
+
+    // ============================================================================
+    // SEARCH
+    // ============================================================================
+
+    bool GridPathfinder::FindPath(const NavGrid& grid, const GridNode& start, const GridNode& goal, std::vector<GridNode>& path) {
+        path.clear();
+        m_stats = Stats();
+
+        if (!grid.IsWalkable(start.x, start.y) || !grid.IsWalkable(goal.x, goal.y)) {
+            return false; // No path if start or goal is blocked
+        }
+
+        BeginSearch(grid.GetCellCount());
+
+        const uint32_t startIndex = grid.ToIndex(start.x, start.y);
+        const uint32_t goalIndex = grid.ToIndex(goal.x, goal.y);
+
+        NodeState& startNode = m_nodes[startIndex];
+        startNode = { 0.0f, Heuristic(start.x, start.y, goal), NO_NODE, NO_NODE, m_generation };
+        Push(startIndex);
+
+        while (!m_heap.empty()) {
+            const uint32_t current = PopMin();
+            ++m_stats.expanded;
+
+            if (current == goalIndex) {
+                m_stats.cost = m_nodes[current].g;
+                BuildPath(grid, current, path);
+                return true;
+            }
+
+            if (m_mode == Mode::JumpPoint) {
+                ExpandJumpPoint(grid, current, goal);
+            }
+            else {
+                ExpandAStar(grid, current, goal);
+            }
+        }
+
+        // No path found
+        return false;
+    }
+
+    float GridPathfinder::Heuristic(int x, int y, const GridNode& goal) const {
+        const int dx = std::abs(x - goal.x);
+        const int dy = std::abs(y - goal.y);
+        if (!m_diagonal) {
+            // Manhattan distance for 4-directional movement
+            return static_cast<float>(dx + dy);
+        }
+        // Octile distance: diagonal steps first, then straight
+        return StepCost(std::min(dx, dy), std::abs(dx - dy));
+    }
+
+    void GridPathfinder::Relax(uint32_t node, uint32_t from, float g, int x, int y, const GridNode& goal) {
+        NodeState& state = m_nodes[node];
+        if (state.stamp != m_generation) {
+            state = { UNVISITED, UNVISITED, NO_NODE, NO_NODE, m_generation };
+        }
+        // The heuristic is consistent, so an expanded node is final
+        if (state.heapIndex == CLOSED || g >= state.g) return;
+
+        state.g = g;
+        state.f = g + Heuristic(x, y, goal);
+        state.parent = from;
+        if (state.heapIndex == NO_NODE) {
+            Push(node);
+        }
+        else {
+            SiftUp(state.heapIndex);
+            ++m_stats.decreased;
+        }
+    }
+
+    void GridPathfinder::ExpandAStar(const NavGrid& grid, uint32_t current, const GridNode& goal) {
+        const int width = grid.GetWidth();
+        const int x = static_cast<int>(current % static_cast<uint32_t>(width));
+        const int y = static_cast<int>(current / static_cast<uint32_t>(width));
+        const float g = m_nodes[current].g;
+
+        // Orthogonal neighbors first, then diagonals when enabled
+        const int count = m_diagonal ? 8 : 4;
+        for (int i = 0; i < count; ++i) {
+            const int dx = DIRECTION_X[i];
+            const int dy = DIRECTION_Y[i];
+            if (!CanStep(grid, x, y, dx, dy)) continue;
+
+            const int nx = x + dx;
+            const int ny = y + dy;
+            Relax(grid.ToIndex(nx, ny), current, g + (i < 4 ? 1.0f : SQRT2), nx, ny, goal);
+        }
+    }
+
+    // ============================================================================
+    // JUMP POINT SEARCH
+    // ============================================================================
+
+    bool GridPathfinder::CanStep(const NavGrid& grid, int x, int y, int dx, int dy) {
+        if (!grid.IsWalkable(x + dx, y + dy)) return false;
+        // No corner cutting: a diagonal step needs both orthogonal cells free
+        return dx == 0 || dy == 0 || (grid.IsWalkable(x + dx, y) && grid.IsWalkable(x, y + dy));
+    }
+
+    void GridPathfinder::ExpandJumpPoint(const NavGrid& grid, uint32_t current, const GridNode& goal) {
+        const uint32_t width = static_cast<uint32_t>(grid.GetWidth());
+        const int x = static_cast<int>(current % width);
+        const int y = static_cast<int>(current / width);
+        const NodeState& node = m_nodes[current];
+        const float g = node.g;
+
+        // Directions worth jumping in: all of them from the start, otherwise the
+        // natural and possibly forced neighbors for the direction we arrived in
+        int directions[8][2];
+        int count = 0;
+        auto add = [&](int dx, int dy) {
+            directions[count][0] = dx;
+            directions[count][1] = dy;
+            ++count;
+        };
+
+        if (node.parent == NO_NODE) {
+            const int total = m_diagonal ? 8 : 4;
+            for (int i = 0; i < total; ++i) add(DIRECTION_X[i], DIRECTION_Y[i]);
+        }
+        else {
+            const int px = static_cast<int>(node.parent % width);
+            const int py = static_cast<int>(node.parent / width);
+            const int dx = (x > px) - (x < px);
+            const int dy = (y > py) - (y < py);
+
+            if (dx != 0 && dy != 0) {
+                add(dx, 0);
+                add(0, dy);
+                add(dx, dy);
+            }
+            else if (dx != 0) {
+                add(dx, 0);
+                add(0, 1);
+                add(0, -1);
+                if (m_diagonal) {
+                    add(dx, 1);
+                    add(dx, -1);
+                }
+            }
+            else {
+                add(0, dy);
+                add(1, 0);
+                add(-1, 0);
+                if (m_diagonal) {
+                    add(1, dy);
+                    add(-1, dy);
+                }
+            }
+        }
+
+        for (int i = 0; i < count; ++i) {
+            const int dx = directions[i][0];
+            const int dy = directions[i][1];
+            int jx, jy;
+            if (!Jump(grid, x, y, dx, dy, goal, jx, jy)) continue;
+
+            // Jumps are straight or exactly diagonal
+            const int distance = std::max(std::abs(jx - x), std::abs(jy - y));
+            const float cost = (dx != 0 && dy != 0) ? StepCost(distance, 0) : static_cast<float>(distance);
+            Relax(grid.ToIndex(jx, jy), current, g + cost, jx, jy, goal);
+        }
+    }
+
+    bool GridPathfinder::Jump(const NavGrid& grid, int x, int y, int dx, int dy, const GridNode& goal, int& outX, int& outY) {
+        if (dy == 0) {
+            outY = y;
+            return JumpHorizontal(grid, x, y, dx, goal, outX);
+        }
+
+        while (true) {
+            if (!CanStep(grid, x, y, dx, dy)) return false;
+            x += dx;
+            y += dy;
+            ++m_stats.scanned;
+
+            if (x == goal.x && y == goal.y) break;
+
+            if (dx != 0 && dy != 0) {
+                // Diagonal: stop where a straight jump along either component finds something
+                int sx, sy;
+                if (Jump(grid, x, y, dx, 0, goal, sx, sy) || Jump(grid, x, y, 0, dy, goal, sx, sy)) break;
+            }
+            else {
+                // Forced neighbor: a cell beside us opens up right after a wall
+                if ((grid.IsWalkable(x - 1, y) && !grid.IsWalkable(x - 1, y - dy)) ||
+                    (grid.IsWalkable(x + 1, y) && !grid.IsWalkable(x + 1, y - dy))) break;
+
+                // 4-directional paths go vertical first: any horizontal jump point
+                // seen from this column makes this cell a turning point
+                int sx, sy;
+                if (!m_diagonal && (Jump(grid, x, y, 1, 0, goal, sx, sy) || Jump(grid, x, y, -1, 0, goal, sx, sy))) break;
+            }
+        }
+
+        outX = x;
+        outY = y;
+        return true;
+    }
+
+    bool GridPathfinder::JumpHorizontal(const NavGrid& grid, int x, int y, int dx, const GridNode& goal, int& outX) {
+        // Scan 64 cells at a time: the jump ends at the first forced neighbor
+        // (a cell above or below that is open right after a blocked one) or
+        // the goal, unless a blocked cell in the row comes first
+        while (true) {
+            // Bit i is the i-th cell ahead of x
+            uint64_t blocked, forced;
+            if (dx > 0) {
+                const int base = x + 1;
+                blocked = grid.GetBlockedBits(base, y);
+                forced = (~grid.GetBlockedBits(base, y - 1) & grid.GetBlockedBits(base - 1, y - 1)) |
+                         (~grid.GetBlockedBits(base, y + 1) & grid.GetBlockedBits(base - 1, y + 1));
+            }
+            else {
+                // Read the 64 cells left of x and mirror them so bit 0 is x - 1
+                const int base = x - 64;
+                blocked = ReverseBits(grid.GetBlockedBits(base, y));
+                forced = ReverseBits((~grid.GetBlockedBits(base, y - 1) & grid.GetBlockedBits(base + 1, y - 1)) |
+                                     (~grid.GetBlockedBits(base, y + 1) & grid.GetBlockedBits(base + 1, y + 1)));
+            }
+            const int goalAhead = (goal.x - x) * dx - 1;
+            if (goal.y == y && goalAhead >= 0 && goalAhead < 64) forced |= uint64_t(1) << goalAhead;
+
+            const int firstBlocked = blocked != 0 ? std::countr_zero(blocked) : 64;
+            const int firstStop = forced != 0 ? std::countr_zero(forced) : 64;
+            if (firstStop < firstBlocked) {
+                m_stats.scanned += static_cast<size_t>(firstStop) + 1;
+                outX = x + (firstStop + 1) * dx;
+                return true;
+            }
+            m_stats.scanned += static_cast<size_t>(firstBlocked);
+            if (firstBlocked < 64) return false;
+            x += 64 * dx;
+        }
+    }
+
+    void GridPathfinder::BuildPath(const NavGrid& grid, uint32_t goalIndex, std::vector<GridNode>& path) const {
+        const uint32_t width = static_cast<uint32_t>(grid.GetWidth());
+
+        // Trace back from goal to start, filling in the cells a jump skipped
+        for (uint32_t node = goalIndex; node != NO_NODE; node = m_nodes[node].parent) {
+            int x = static_cast<int>(node % width);
+            int y = static_cast<int>(node / width);
+            path.push_back(GridNode(x, y));
+
+            const uint32_t parent = m_nodes[node].parent;
+            if (parent == NO_NODE) break;
+            const int px = static_cast<int>(parent % width);
+            const int py = static_cast<int>(parent / width);
+            const int dx = (px > x) - (px < x);
+            const int dy = (py > y) - (py < y);
+            for (x += dx, y += dy; x != px || y != py; x += dx, y += dy) {
+                path.push_back(GridNode(x, y));
+            }
+        }
+
+        // Reverse to get path from start to goal
+        std::reverse(path.begin(), path.end());
+    }
+
+    void GridPathfinder::BeginSearch(size_t cellCount) {
+        if (m_nodes.size() < cellCount) {
+            m_nodes.resize(cellCount, NodeState{ UNVISITED, UNVISITED, NO_NODE, NO_NODE, 0 });
+        }
+        m_heap.clear();
+
+        // Stamps from 4 billion searches ago would look current again: clear once on wrap
+        if (++m_generation == 0) {
+            for (NodeState& node : m_nodes) node.stamp = 0;
+            m_generation = 1;
+        }
+    }
+
+    // ============================================================================
+    // INDEXED HEAP
+    // ============================================================================
+
+    bool GridPathfinder::Less(uint32_t a, uint32_t b) const {
+        const NodeState& na = m_nodes[a];
+        const NodeState& nb = m_nodes[b];
+        return na.f < nb.f || (na.f == nb.f && na.g > nb.g);
+    }
+
+    void GridPathfinder::Push(uint32_t node) {
+        m_nodes[node].heapIndex = static_cast<uint32_t>(m_heap.size());
+        m_heap.push_back(node);
+        SiftUp(m_nodes[node].heapIndex);
+        ++m_stats.pushed;
+    }
+
+    uint32_t GridPathfinder::PopMin() {
+        const uint32_t top = m_heap.front();
+        m_nodes[top].heapIndex = CLOSED;
+
+        const uint32_t last = m_heap.back();
+        m_heap.pop_back();
+        if (!m_heap.empty()) {
+            m_heap[0] = last;
+            m_nodes[last].heapIndex = 0;
+            SiftDown(0);
+        }
+        return top;
+    }
+
+    void GridPathfinder::SiftUp(uint32_t slot) {
+        const uint32_t node = m_heap[slot];
+        while (slot > 0) {
+            const uint32_t parentSlot = (slot - 1) / 2;
+            const uint32_t parent = m_heap[parentSlot];
+            if (!Less(node, parent)) break;
+            m_heap[slot] = parent;
+            m_nodes[parent].heapIndex = slot;
+            slot = parentSlot;
+        }
+        m_heap[slot] = node;
+        m_nodes[node].heapIndex = slot;
+    }
+
+    void GridPathfinder::SiftDown(uint32_t slot) {
+        const uint32_t count = static_cast<uint32_t>(m_heap.size());
+        const uint32_t node = m_heap[slot];
+        while (true) {
+            uint32_t child = slot * 2 + 1;
+            if (child >= count) break;
+            if (child + 1 < count && Less(m_heap[child + 1], m_heap[child])) ++child;
+            if (!Less(m_heap[child], node)) break;
+            m_heap[slot] = m_heap[child];
+            m_nodes[m_heap[slot]].heapIndex = slot;
+            slot = child;
+        }
+        m_heap[slot] = node;
+        m_nodes[node].heapIndex = slot;
+    }
+
+    // ============================================================================
+    // BENCHMARK
+    // ============================================================================
+
+    GridPathfinder::BenchmarkResult GridPathfinder::RunBenchmark(int size, int queries) {
+        BenchmarkResult result;
+        result.width = result.height = std::max(size, 2);
+        const int side = result.width;
+
+        std::mt19937 rng(2024);
+        NavGrid grid;
+        std::vector<std::pair<GridNode, GridNode>> pairs;
+        BuildBenchmarkMap(side, 20, queries, rng, grid, pairs);
+        result.blockedCells = grid.GetBlockedCount();
+        result.queries = pairs.size();
+        if (pairs.empty()) return result;
+
+        GridPathfinder pathfinder;
+        std::vector<GridNode> path;
+        std::vector<float> costs;
+        std::vector<size_t> expandedPerQuery;
+        costs.reserve(pairs.size());
+        expandedPerQuery.reserve(pairs.size());
+        size_t expanded = 0, pathCells = 0;
+
+        const auto start = Clock::now();
+        for (const auto& pair : pairs) {
+            const bool found = pathfinder.FindPath(grid, pair.first, pair.second, path);
+            expanded += pathfinder.GetLastStats().expanded;
+            expandedPerQuery.push_back(pathfinder.GetLastStats().expanded);
+            if (found) {
+                ++result.found;
+                pathCells += path.size();
+            }
+            costs.push_back(found ? pathfinder.GetLastStats().cost : -1.0f);
+        }
+        result.pathsPerSecond = result.queries / std::max(SecondsSince(start), 1e-9);
+        result.avgExpanded = static_cast<double>(expanded) / result.queries;
+        result.avgPathLength = result.found > 0 ? static_cast<double>(pathCells) / result.found : 0.0;
+
+        // The hash map version is far slower on big maps: repeat queries until
+        // they add up to a fixed number of expanded nodes
+        const size_t budgetNodes = 500000;
+        size_t legacyNodes = 0;
+        while (result.legacyQueries < result.queries &&
+               (result.legacyQueries == 0 || legacyNodes + expandedPerQuery[result.legacyQueries] <= budgetNodes)) {
+            legacyNodes += expandedPerQuery[result.legacyQueries++];
+        }
+        const auto legacyStart = Clock::now();
+        for (size_t i = 0; i < result.legacyQueries; ++i) {
+            if (LegacyFindPath(grid, pairs[i].first, pairs[i].second) != costs[i]) result.costsMatch = false;
+        }
+        const double legacySeconds = std::max(SecondsSince(legacyStart), 1e-9);
+        result.legacyPathsPerSecond = result.legacyQueries / legacySeconds;
+
+        // Same slice on the new search, for a like-for-like ratio
+        const auto sliceStart = Clock::now();
+        for (size_t i = 0; i < result.legacyQueries; ++i) {
+            pathfinder.FindPath(grid, pairs[i].first, pairs[i].second, path);
+        }
+        result.speedup = legacySeconds / std::max(SecondsSince(sliceStart), 1e-9);
+
+        return result;
+    }
+
+    GridPathfinder::JumpPointBenchmarkResult GridPathfinder::RunJumpPointBenchmark(int size, int queries) {
+        JumpPointBenchmarkResult result;
+        result.width = result.height = std::max(size, 2);
+
+        std::mt19937 rng(2024);
+        NavGrid grid;
+        std::vector<std::pair<GridNode, GridNode>> pairs;
+        BuildBenchmarkMap(result.width, 0, queries, rng, grid, pairs);
+        result.queries = pairs.size();
+        if (pairs.empty()) return result;
+
+        GridPathfinder pathfinder;
+        std::vector<GridNode> path;
+        std::vector<float> costs(pairs.size());
+
+        for (int movement = 0; movement < JumpPointBenchmarkResult::MOVEMENTS; ++movement) {
+            pathfinder.SetDiagonal(movement == 1);
+
+            // A* first: its costs are the reference
+            pathfinder.SetMode(Mode::AStar);
+            size_t expanded = 0;
+            auto start = Clock::now();
+            for (size_t i = 0; i < pairs.size(); ++i) {
+                const bool found = pathfinder.FindPath(grid, pairs[i].first, pairs[i].second, path);
+                expanded += pathfinder.GetLastStats().expanded;
+                costs[i] = found ? pathfinder.GetLastStats().cost : -1.0f;
+                if (found) ++result.found[movement];
+            }
+            result.aStarUs[movement] = SecondsSince(start) * 1e6 / result.queries;
+            result.aStarExpanded[movement] = static_cast<double>(expanded) / result.queries;
+
+            pathfinder.SetMode(Mode::JumpPoint);
+            expanded = 0;
+            size_t scanned = 0;
+            start = Clock::now();
+            for (size_t i = 0; i < pairs.size(); ++i) {
+                const bool found = pathfinder.FindPath(grid, pairs[i].first, pairs[i].second, path);
+                expanded += pathfinder.GetLastStats().expanded;
+                scanned += pathfinder.GetLastStats().scanned;
+
+                // Jumps add whole segments at once, so allow for float rounding
+                const float cost = found ? pathfinder.GetLastStats().cost : -1.0f;
+                if (std::fabs(cost - costs[i]) > 1e-3f * std::max(costs[i], 1.0f)) result.costsMatch[movement] = false;
+            }
+            result.jumpUs[movement] = SecondsSince(start) * 1e6 / result.queries;
+            result.jumpExpanded[movement] = static_cast<double>(expanded) / result.queries;
+            result.jumpScanned[movement] = static_cast<double>(scanned) / result.queries;
+        }
+
+        return result;
+    }
+
+} // namespace GP2Engine
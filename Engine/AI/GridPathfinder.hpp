@@ -0,0 +1,158 @@
+/**
+ * @file GridPathfinder.hpp
+ * @author Asri (100%)
+ * @brief A* and Jump Point Search over a NavGrid with preallocated node state
+ *
+ * All per-node search state (g cost, f cost, parent, heap slot) lives in one
+ * array indexed by cell, allocated once for the grid size and reused by every
+ * search. Instead of clearing it, each search bumps a generation counter and
+ * a node whose stamp is older is treated as unvisited, so starting a search
+ * costs nothing however large the grid is.
+ *
+ * Jump Point Search (JPS) runs the same A* loop but, instead of pushing
+ * every neighbour, scans straight (and diagonal) lines from each node and
+ * only queues the cells where an optimal path may have to turn. On a
+ * uniform-cost grid it returns paths of the same cost as A* while expanding
+ * far fewer nodes; the skipped cells are filled back in, so callers get the
+ * same cell-by-cell path.
+ *
+ * Features:
+ * - 4-directional movement (unit cost, Manhattan heuristic) or 8-directional
+ *   movement (diagonals cost sqrt(2), octile heuristic, no corner cutting:
+ *   a diagonal step needs both cells beside it free)
+ * - A* or Jump Point Search, chosen per pathfinder
+ * - Indexed binary min-heap: every node is in the open list at most once and
+ *   a cheaper route lowers its key in place (decrease-key)
+ * - Ties on f are broken towards larger g, so open areas are crossed without
+ *   expanding every equally good cell
+ * - No allocation per search once the arrays and the output path have grown
+ */
+
+#pragma once
+
+#include "NavGrid.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GP2Engine {
+
+    /**
+     * @brief Reusable A* search state for one grid size
+     */
+    class GridPathfinder {
+    public:
+        enum class Mode {
+            AStar,          // Every walkable neighbour is queued
+            JumpPoint       // Only jump points are queued
+        };
+
+        /**
+         * @brief Counters of the last FindPath call
+         */
+        struct Stats {
+            size_t expanded = 0;        // Nodes taken from the open list
+            size_t pushed = 0;          // Nodes added to the open list
+            size_t decreased = 0;       // Decrease-key updates
+            size_t scanned = 0;         // Cells stepped over by jumps (JumpPoint only)
+            float cost = 0.0f;          // Path cost (0 if none)
+        };
+
+        struct BenchmarkResult {
+            int width = 0, height = 0;
+            size_t blockedCells = 0;
+            size_t queries = 0;
+            size_t found = 0;               // Queries with a path
+            double pathsPerSecond = 0.0;
+            double avgExpanded = 0.0;
+            double avgPathLength = 0.0;     // Cells, over found paths
+            size_t legacyQueries = 0;       // First queries repeated on the hash map A*
+            double legacyPathsPerSecond = 0.0;
+            double speedup = 0.0;           // Legacy time / new time on the repeated queries
+            bool costsMatch = true;         // Same path costs on the repeated queries
+        };
+
+        struct JumpPointBenchmarkResult {
+            static constexpr int MOVEMENTS = 2;     // [0] 4-directional, [1] 8-directional
+
+            int width = 0, height = 0;
+            size_t queries = 0;
+            size_t found[MOVEMENTS] = {};
+            double aStarExpanded[MOVEMENTS] = {};   // Per query
+            double jumpExpanded[MOVEMENTS] = {};
+            double jumpScanned[MOVEMENTS] = {};
+            double aStarUs[MOVEMENTS] = {};         // Per query
+            double jumpUs[MOVEMENTS] = {};
+            bool costsMatch[MOVEMENTS] = { true, true };
+        };
+
+        void SetMode(Mode mode) { m_mode = mode; }
+        Mode GetMode() const { return m_mode; }
+
+        // 8-directional movement (false = 4-directional)
+        void SetDiagonal(bool diagonal) { m_diagonal = diagonal; }
+        bool IsDiagonal() const { return m_diagonal; }
+
+        /**
+         * @brief Find a shortest path with the current mode and movement
+         * @param grid Walkability grid
+         * @param start Start cell
+         * @param goal Goal cell
+         * @param path Receives the cells from start to goal inclusive (cleared first)
+         * @return True if a path was found
+         */
+        bool FindPath(const NavGrid& grid, const GridNode& start, const GridNode& goal, std::vector<GridNode>& path);
+
+        const Stats& GetLastStats() const { return m_stats; }
+
+        /**
+         * Random size x size map with scattered walls: paths per second over
+         * random walkable start/goal pairs, and the first queries again on the
+         * previous hash map A* to compare speed and path costs.
+         */
+        static BenchmarkResult RunBenchmark(int size, int queries);
+
+        /**
+         * Same kind of map, each query run with A* and with Jump Point Search
+         * for 4- and 8-directional movement: nodes expanded and time per
+         * query, and whether every path cost matches.
+         */
+        static JumpPointBenchmarkResult RunJumpPointBenchmark(int size, int queries);
+
+    private:
+        static constexpr uint32_t NO_NODE = 0xFFFFFFFFu;
+        static constexpr uint32_t CLOSED = 0xFFFFFFFEu;     // heapIndex of an expanded node
+
+        // Search state of one cell, valid only while stamp == m_generation
+        struct NodeState {
+            float g;
+            float f;
+            uint32_t parent;
+            uint32_t heapIndex;     // Slot in m_heap, NO_NODE if never queued, CLOSED once expanded
+            uint32_t stamp;
+        };
+
+        std::vector<NodeState> m_nodes;
+        std::vector<uint32_t> m_heap;       // Open list: node indices, min f at the front
+        uint32_t m_generation = 0;
+        Mode m_mode = Mode::AStar;
+        bool m_diagonal = false;
+        Stats m_stats;
+
+        void BeginSearch(size_t cellCount);
+        float Heuristic(int x, int y, const GridNode& goal) const;
+        void Relax(uint32_t node, uint32_t from, float g, int x, int y, const GridNode& goal);
+        void ExpandAStar(const NavGrid& grid, uint32_t current, const GridNode& goal);
+        void ExpandJumpPoint(const NavGrid& grid, uint32_t current, const GridNode& goal);
+        bool Jump(const NavGrid& grid, int x, int y, int dx, int dy, const GridNode& goal, int& outX, int& outY);
+        bool JumpHorizontal(const NavGrid& grid, int x, int y, int dx, const GridNode& goal, int& outX);
+        void BuildPath(const NavGrid& grid, uint32_t goalIndex, std::vector<GridNode>& path) const;
+        static bool CanStep(const NavGrid& grid, int x, int y, int dx, int dy);
+        bool Less(uint32_t a, uint32_t b) const;
+        void Push(uint32_t node);
+        uint32_t PopMin();
+        void SiftUp(uint32_t slot);
+        void SiftDown(uint32_t slot);
+    };
+
+} // namespace GP2Engine
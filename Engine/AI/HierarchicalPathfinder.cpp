@@ -0,0 +1,617 @@
+/**
+ * @file HierarchicalPathfinder.cpp
+ * @author Asri (100%)
+ * @brief Implementation of hierarchical pathfinding (HPA*)
+ */
+
+#include "HierarchicalPathfinder.hpp"
+#include "GridPathfinder.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <random>
+
+namespace GP2Engine {
+
+    namespace {
+        using Clock = std::chrono::high_resolution_clock;
+
+        double MicrosecondsSince(Clock::time_point start) {
+            return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+        }
+
+        constexpr float INF = std::numeric_limits<float>::infinity();
+        constexpr float SQRT2 = 1.41421356f;
+
+        // Openings narrower than this get one entrance pair in the middle, wider ones one at each end
+        constexpr int WIDE_ENTRANCE = 6;
+
+        // Orthogonal directions, then diagonals
+        constexpr int DIRECTION_X[8] = { 0, 1, 0, -1, 1, 1, -1, -1 };
+        constexpr int DIRECTION_Y[8] = { -1, 0, 1, 0, -1, 1, 1, -1 };
+
+        // Same movement rule as GridPathfinder: no corner cutting
+        bool CanStep(const NavGrid& grid, int x, int y, int dx, int dy) {
+            if (!grid.IsWalkable(x + dx, y + dy)) return false;
+            return dx == 0 || dy == 0 || (grid.IsWalkable(x + dx, y) && grid.IsWalkable(x, y + dy));
+        }
+
+        float PathCost(const std::vector<GridNode>& path) {
+            float cost = 0.0f;
+            for (size_t i = 1; i < path.size(); ++i) {
+                const bool diagonal = path[i].x != path[i - 1].x && path[i].y != path[i - 1].y;
+                cost += diagonal ? SQRT2 : 1.0f;
+            }
+            return cost;
+        }
+    }
+
+    // ============================================================================
+    // BUILD
+    // ============================================================================
+
+    void HierarchicalPathfinder::Build(const NavGrid& grid, int clusterSize) {
+        Clear();
+        m_clusterSize = std::max(clusterSize, 2);
+        m_gridWidth = grid.GetWidth();
+        m_gridHeight = grid.GetHeight();
+        m_gridVersion = grid.GetVersion();
+        m_clustersX = (m_gridWidth + m_clusterSize - 1) / m_clusterSize;
+        m_clustersY = (m_gridHeight + m_clusterSize - 1) / m_clusterSize;
+
+        m_clusters.resize(static_cast<size_t>(m_clustersX) * static_cast<size_t>(m_clustersY));
+        for (int cy = 0; cy < m_clustersY; ++cy) {
+            for (int cx = 0; cx < m_clustersX; ++cx) {
+                Cluster& cluster = m_clusters[static_cast<size_t>(cy) * m_clustersX + cx];
+                cluster.x = cx * m_clusterSize;
+                cluster.y = cy * m_clusterSize;
+                cluster.width = std::min(m_clusterSize, m_gridWidth - cluster.x);
+                cluster.height = std::min(m_clusterSize, m_gridHeight - cluster.y);
+            }
+        }
+
+        for (int cy = 0; cy < m_clustersY; ++cy) {
+            for (int cx = 0; cx < m_clustersX; ++cx) {
+                const uint32_t cluster = static_cast<uint32_t>(cy * m_clustersX + cx);
+                if (cx + 1 < m_clustersX) RebuildBorder(grid, cluster, false);
+                if (cy + 1 < m_clustersY) RebuildBorder(grid, cluster, true);
+            }
+        }
+        for (uint32_t cluster = 0; cluster < m_clusters.size(); ++cluster) {
+            RebuildDistances(grid, cluster);
+        }
+    }
+
+    void HierarchicalPathfinder::Clear() {
+        m_clusterSize = 0;
+        m_clustersX = m_clustersY = 0;
+        m_gridWidth = m_gridHeight = 0;
+        m_clusters.clear();
+        m_nodes.clear();
+        m_freeNodes.clear();
+        m_liveNodes = 0;
+        m_clusterUpdates = 0;
+    }
+
+    uint32_t HierarchicalPathfinder::ClusterOf(int x, int y) const {
+        return static_cast<uint32_t>((y / m_clusterSize) * m_clustersX + x / m_clusterSize);
+    }
+
+    void HierarchicalPathfinder::RebuildBorder(const NavGrid& grid, uint32_t cluster, bool bottom) {
+        const uint32_t border = cluster * 2 + (bottom ? 1 : 0);
+        RemoveBorderNodes(border);
+
+        const uint32_t other = bottom ? cluster + static_cast<uint32_t>(m_clustersX) : cluster + 1;
+        const Cluster& here = m_clusters[cluster];
+        const int length = bottom ? here.width : here.height;
+
+        // Cell i of the border on this side (x, y) and across it (x + ox, y + oy)
+        const int ox = bottom ? 0 : 1;
+        const int oy = bottom ? 1 : 0;
+        auto cellAt = [&](int i, int& x, int& y) {
+            x = bottom ? here.x + i : here.x + here.width - 1;
+            y = bottom ? here.y + here.height - 1 : here.y + i;
+        };
+        auto isOpen = [&](int i) {
+            int x, y;
+            cellAt(i, x, y);
+            return grid.IsWalkable(x, y) && grid.IsWalkable(x + ox, y + oy);
+        };
+        auto addPair = [&](int i) {
+            int x, y;
+            cellAt(i, x, y);
+            const uint32_t a = AddNode(cluster, grid.ToIndex(x, y), border);
+            const uint32_t b = AddNode(other, grid.ToIndex(x + ox, y + oy), border);
+            m_nodes[a].partner = b;
+            m_nodes[b].partner = a;
+        };
+
+        // One entrance pair per opening, or one at each end of a wide opening
+        int i = 0;
+        while (i < length) {
+            if (!isOpen(i)) {
+                ++i;
+                continue;
+            }
+            const int first = i;
+            while (i < length && isOpen(i)) ++i;
+            const int last = i - 1;
+
+            if (last - first + 1 < WIDE_ENTRANCE) {
+                addPair((first + last) / 2);
+            }
+            else {
+                addPair(first);
+                addPair(last);
+            }
+        }
+    }
+
+    void HierarchicalPathfinder::RemoveBorderNodes(uint32_t border) {
+        const uint32_t cluster = border / 2;
+        const uint32_t other = (border & 1) ? cluster + static_cast<uint32_t>(m_clustersX) : cluster + 1;
+
+        for (uint32_t id : { cluster, other }) {
+            std::vector<uint32_t>& nodes = m_clusters[id].nodes;
+            size_t kept = 0;
+            for (uint32_t node : nodes) {
+                if (m_nodes[node].border == border) {
+                    m_nodes[node].cluster = NONE;
+                    m_freeNodes.push_back(node);
+                    --m_liveNodes;
+                    continue;
+                }
+                m_nodes[node].slot = static_cast<uint32_t>(kept);
+                nodes[kept++] = node;
+            }
+            nodes.resize(kept);
+        }
+    }
+
+    uint32_t HierarchicalPathfinder::AddNode(uint32_t cluster, uint32_t cell, uint32_t border) {
+        uint32_t id;
+        if (!m_freeNodes.empty()) {
+            id = m_freeNodes.back();
+            m_freeNodes.pop_back();
+        }
+        else {
+            id = static_cast<uint32_t>(m_nodes.size());
+            m_nodes.emplace_back();
+        }
+
+        std::vector<uint32_t>& nodes = m_clusters[cluster].nodes;
+        m_nodes[id] = { cell, cluster, NONE, border, static_cast<uint32_t>(nodes.size()) };
+        nodes.push_back(id);
+        ++m_liveNodes;
+        return id;
+    }
+
+    void HierarchicalPathfinder::RebuildDistances(const NavGrid& grid, uint32_t clusterIndex) {
+        Cluster& cluster = m_clusters[clusterIndex];
+        const size_t count = cluster.nodes.size();
+        cluster.distances.assign(count * count, INF);
+        ++m_clusterUpdates;
+
+        // Moves are symmetric, so one search per entrance fills a row and a column
+        const uint32_t width = static_cast<uint32_t>(m_gridWidth);
+        for (size_t i = 0; i < count; ++i) {
+            cluster.distances[i * count + i] = 0.0f;
+            if (i + 1 == count) break;
+
+            const uint32_t cell = m_nodes[cluster.nodes[i]].cell;
+            SearchCluster(grid, cluster, static_cast<int>(cell % width), static_cast<int>(cell / width));
+            for (size_t j = i + 1; j < count; ++j) {
+                const uint32_t other = m_nodes[cluster.nodes[j]].cell;
+                const int local = (static_cast<int>(other / width) - cluster.y) * cluster.width +
+                                  (static_cast<int>(other % width) - cluster.x);
+                const float distance = m_localDistance[static_cast<size_t>(local)];
+                cluster.distances[i * count + j] = distance;
+                cluster.distances[j * count + i] = distance;
+            }
+        }
+    }
+
+    void HierarchicalPathfinder::OnCellChanged(const NavGrid& grid, int x, int y) {
+        if (!IsBuilt()) return;
+        if (grid.GetWidth() != m_gridWidth || grid.GetHeight() != m_gridHeight) {
+            Build(grid, m_clusterSize);
+            return;
+        }
+        if (x < 0 || y < 0 || x >= m_gridWidth || y >= m_gridHeight) return;
+
+        const uint32_t cluster = ClusterOf(x, y);
+        const Cluster& bounds = m_clusters[cluster];
+        const int cx = static_cast<int>(cluster) % m_clustersX;
+        const int cy = static_cast<int>(cluster) / m_clustersX;
+        const uint32_t row = static_cast<uint32_t>(m_clustersX);
+
+        // The cell's own cluster, plus the neighbours sharing a border it lies on
+        uint32_t dirty[5] = { cluster };
+        int dirtyCount = 1;
+        if (x == bounds.x + bounds.width - 1 && cx + 1 < m_clustersX) {
+            RebuildBorder(grid, cluster, false);
+            dirty[dirtyCount++] = cluster + 1;
+        }
+        if (x == bounds.x && cx > 0) {
+            RebuildBorder(grid, cluster - 1, false);
+            dirty[dirtyCount++] = cluster - 1;
+        }
+        if (y == bounds.y + bounds.height - 1 && cy + 1 < m_clustersY) {
+            RebuildBorder(grid, cluster, true);
+            dirty[dirtyCount++] = cluster + row;
+        }
+        if (y == bounds.y && cy > 0) {
+            RebuildBorder(grid, cluster - row, true);
+            dirty[dirtyCount++] = cluster - row;
+        }
+
+        for (int i = 0; i < dirtyCount; ++i) {
+            RebuildDistances(grid, dirty[i]);
+        }
+        m_gridVersion = grid.GetVersion();
+    }
+
+    size_t HierarchicalPathfinder::GetAbstractEdgeCount() const {
+        // One border crossing per entrance, plus every connected pair inside a cluster
+        size_t edges = m_liveNodes;
+        for (const Cluster& cluster : m_clusters) {
+            const size_t count = cluster.nodes.size();
+            for (size_t i = 0; i < count * count; ++i) {
+                if (i % (count + 1) != 0 && cluster.distances[i] < INF) ++edges;
+            }
+        }
+        return edges;
+    }
+
+    // ============================================================================
+    // CLUSTER SEARCH
+    // ============================================================================
+
+    void HierarchicalPathfinder::SearchCluster(const NavGrid& grid, const Cluster& cluster, int sourceX, int sourceY) {
+        const size_t cellCount = static_cast<size_t>(cluster.width) * static_cast<size_t>(cluster.height);
+        m_localDistance.assign(cellCount, INF);
+        m_localParent.assign(cellCount, NONE);
+        m_localOpen.clear();
+
+        const uint32_t source = static_cast<uint32_t>((sourceY - cluster.y) * cluster.width + (sourceX - cluster.x));
+        m_localDistance[source] = 0.0f;
+        m_localOpen.push_back({ 0.0f, source });
+
+        // Dijkstra that never leaves the cluster: a heap for 8 directions,
+        // a plain FIFO for 4 (unit costs, so the first distance found is final)
+        const int directions = m_diagonal ? 8 : 4;
+        size_t head = 0;
+        while (m_diagonal ? !m_localOpen.empty() : head < m_localOpen.size()) {
+            SearchEntry entry = m_localOpen[head];
+            if (m_diagonal) {
+                std::pop_heap(m_localOpen.begin(), m_localOpen.end(), std::greater<SearchEntry>());
+                entry = m_localOpen.back();
+                m_localOpen.pop_back();
+                if (entry.f > m_localDistance[entry.node]) continue;
+            }
+            else {
+                ++head;
+            }
+
+            const int lx = static_cast<int>(entry.node) % cluster.width;
+            const int ly = static_cast<int>(entry.node) / cluster.width;
+            for (int i = 0; i < directions; ++i) {
+                const int nx = lx + DIRECTION_X[i];
+                const int ny = ly + DIRECTION_Y[i];
+                if (nx < 0 || ny < 0 || nx >= cluster.width || ny >= cluster.height) continue;
+                if (!CanStep(grid, cluster.x + lx, cluster.y + ly, DIRECTION_X[i], DIRECTION_Y[i])) continue;
+
+                const uint32_t neighbor = static_cast<uint32_t>(ny * cluster.width + nx);
+                const float distance = entry.f + (i < 4 ? 1.0f : SQRT2);
+                if (distance < m_localDistance[neighbor]) {
+                    m_localDistance[neighbor] = distance;
+                    m_localParent[neighbor] = entry.node;
+                    m_localOpen.push_back({ distance, neighbor });
+                    if (m_diagonal) std::push_heap(m_localOpen.begin(), m_localOpen.end(), std::greater<SearchEntry>());
+                }
+            }
+        }
+    }
+
+    // ============================================================================
+    // ABSTRACT SEARCH
+    // ============================================================================
+
+    float HierarchicalPathfinder::Heuristic(uint32_t fromCell, uint32_t toCell) const {
+        const uint32_t width = static_cast<uint32_t>(m_gridWidth);
+        const int dx = std::abs(static_cast<int>(fromCell % width) - static_cast<int>(toCell % width));
+        const int dy = std::abs(static_cast<int>(fromCell / width) - static_cast<int>(toCell / width));
+        if (!m_diagonal) return static_cast<float>(dx + dy);
+        return static_cast<float>(std::min(dx, dy)) * SQRT2 + static_cast<float>(std::abs(dx - dy));
+    }
+
+    bool HierarchicalPathfinder::FindAbstractPath(const NavGrid& grid, const GridNode& start, const GridNode& goal,
+                                                  std::vector<GridNode>& waypoints) {
+        waypoints.clear();
+        m_stats = Stats();
+        if (!IsBuilt() || !grid.IsWalkable(start.x, start.y) || !grid.IsWalkable(goal.x, goal.y)) return false;
+
+        // The grid changed without OnCellChanged: start over
+        if (grid.GetWidth() != m_gridWidth || grid.GetHeight() != m_gridHeight || grid.GetVersion() != m_gridVersion) {
+            Build(grid, m_clusterSize);
+        }
+
+        if (start == goal) {
+            waypoints.push_back(start);
+            return true;
+        }
+
+        const uint32_t startCell = grid.ToIndex(start.x, start.y);
+        const uint32_t goalCell = grid.ToIndex(goal.x, goal.y);
+        const uint32_t startCluster = ClusterOf(start.x, start.y);
+        const uint32_t goalCluster = ClusterOf(goal.x, goal.y);
+        const uint32_t width = static_cast<uint32_t>(m_gridWidth);
+
+        // Hook start and goal into their clusters
+        auto distancesFrom = [&](uint32_t clusterIndex, const GridNode& cell, std::vector<float>& out) {
+            const Cluster& cluster = m_clusters[clusterIndex];
+            SearchCluster(grid, cluster, cell.x, cell.y);
+            out.resize(cluster.nodes.size());
+            for (size_t i = 0; i < cluster.nodes.size(); ++i) {
+                const uint32_t node = m_nodes[cluster.nodes[i]].cell;
+                out[i] = m_localDistance[(node / width - cluster.y) * cluster.width + (node % width - cluster.x)];
+            }
+        };
+        float direct = INF;
+        distancesFrom(startCluster, start, m_startDistance);
+        if (startCluster == goalCluster) {
+            const Cluster& cluster = m_clusters[startCluster];
+            direct = m_localDistance[(goal.y - cluster.y) * cluster.width + (goal.x - cluster.x)];
+        }
+        distancesFrom(goalCluster, goal, m_goalDistance);
+
+        // Entrances are 0..N-1, then the start and the goal
+        const uint32_t startNode = static_cast<uint32_t>(m_nodes.size());
+        const uint32_t goalNode = startNode + 1;
+        if (m_search.size() < m_nodes.size() + 2) m_search.resize(m_nodes.size() + 2, SearchState{ INF, NONE, 0 });
+        if (++m_generation == 0) {
+            for (SearchState& state : m_search) state.stamp = 0;
+            m_generation = 1;
+        }
+        m_open.clear();
+
+        auto cellOf = [&](uint32_t node) {
+            return node == startNode ? startCell : (node == goalNode ? goalCell : m_nodes[node].cell);
+        };
+        auto relax = [&](uint32_t node, uint32_t from, float g) {
+            SearchState& state = m_search[node];
+            if (state.stamp != m_generation) state = { INF, NONE, m_generation };
+            if (g >= state.g) return;
+            state.g = g;
+            state.parent = from;
+            m_open.push_back({ g + Heuristic(cellOf(node), goalCell), node });
+            std::push_heap(m_open.begin(), m_open.end(), std::greater<SearchEntry>());
+        };
+
+        relax(startNode, NONE, 0.0f);
+        bool found = false;
+        while (!m_open.empty()) {
+            std::pop_heap(m_open.begin(), m_open.end(), std::greater<SearchEntry>());
+            const SearchEntry entry = m_open.back();
+            m_open.pop_back();
+
+            const uint32_t current = entry.node;
+            const float g = m_search[current].g;
+            if (entry.f > g + Heuristic(cellOf(current), goalCell)) continue; // Superseded entry
+            ++m_stats.abstractExpanded;
+
+            if (current == goalNode) {
+                found = true;
+                break;
+            }
+
+            if (current == startNode) {
+                const Cluster& cluster = m_clusters[startCluster];
+                for (size_t i = 0; i < cluster.nodes.size(); ++i) {
+                    if (m_startDistance[i] < INF) relax(cluster.nodes[i], current, g + m_startDistance[i]);
+                }
+                if (direct < INF) relax(goalNode, current, g + direct);
+                continue;
+            }
+
+            const Node& node = m_nodes[current];
+            const Cluster& cluster = m_clusters[node.cluster];
+            const size_t count = cluster.nodes.size();
+            const float* row = &cluster.distances[node.slot * count];
+            for (size_t i = 0; i < count; ++i) {
+                if (i != node.slot && row[i] < INF) relax(cluster.nodes[i], current, g + row[i]);
+            }
+            relax(node.partner, current, g + 1.0f);
+            if (node.cluster == goalCluster && m_goalDistance[node.slot] < INF) {
+                relax(goalNode, current, g + m_goalDistance[node.slot]);
+            }
+        }
+        if (!found) return false;
+
+        m_stats.cost = m_search[goalNode].g;
+        for (uint32_t node = goalNode; node != NONE; node = m_search[node].parent) {
+            const uint32_t cell = cellOf(node);
+            const GridNode waypoint(static_cast<int>(cell % width), static_cast<int>(cell / width));
+            if (waypoints.empty() || waypoints.back() != waypoint) waypoints.push_back(waypoint);
+        }
+        std::reverse(waypoints.begin(), waypoints.end());
+        return true;
+    }
+
+    bool HierarchicalPathfinder::RefineSegment(const NavGrid& grid, const GridNode& from, const GridNode& to,
+                                               std::vector<GridNode>& cells) {
+        cells.clear();
+        if (!IsBuilt() || !grid.IsWalkable(from.x, from.y) || !grid.IsWalkable(to.x, to.y)) return false;
+        if (from == to) {
+            cells.push_back(from);
+            return true;
+        }
+
+        // Consecutive waypoints either cross a border or share a cluster
+        const uint32_t clusterIndex = ClusterOf(from.x, from.y);
+        if (clusterIndex != ClusterOf(to.x, to.y)) {
+            const int dx = to.x - from.x;
+            const int dy = to.y - from.y;
+            if (std::abs(dx) > 1 || std::abs(dy) > 1 || (!m_diagonal && dx != 0 && dy != 0) ||
+                !CanStep(grid, from.x, from.y, dx, dy)) {
+                return false;
+            }
+            cells.push_back(from);
+            cells.push_back(to);
+            return true;
+        }
+
+        // Search from the far end so the parents lead from `from` to `to`
+        const Cluster& cluster = m_clusters[clusterIndex];
+        SearchCluster(grid, cluster, to.x, to.y);
+        uint32_t local = static_cast<uint32_t>((from.y - cluster.y) * cluster.width + (from.x - cluster.x));
+        if (m_localDistance[local] == INF) return false;
+
+        for (; local != NONE; local = m_localParent[local]) {
+            cells.push_back(GridNode(cluster.x + static_cast<int>(local) % cluster.width,
+                                     cluster.y + static_cast<int>(local) / cluster.width));
+        }
+        return true;
+    }
+
+    bool HierarchicalPathfinder::FindPath(const NavGrid& grid, const GridNode& start, const GridNode& goal,
+                                          std::vector<GridNode>& path) {
+        path.clear();
+        std::vector<GridNode> waypoints;
+        if (!FindAbstractPath(grid, start, goal, waypoints)) return false;
+
+        path.push_back(waypoints.front());
+        std::vector<GridNode> segment;
+        for (size_t i = 1; i < waypoints.size(); ++i) {
+            if (!RefineSegment(grid, waypoints[i - 1], waypoints[i], segment)) {
+                path.clear();
+                return false;
+            }
+            path.insert(path.end(), segment.begin() + 1, segment.end());
+        }
+        return true;
+    }
+
+    // ============================================================================
+    // BENCHMARK
+    // ============================================================================
+
+    HierarchicalPathfinder::BenchmarkResult HierarchicalPathfinder::RunBenchmark(int size, int clusterSize, int queries) {
+        BenchmarkResult result;
+        result.width = result.height = std::max(size, 2);
+        result.clusterSize = std::max(clusterSize, 2);
+        const int side = result.width;
+
+        // Rooms: walls every 40 cells with two doorways per wall, plus scattered blocks
+        std::mt19937 rng(2024);
+        std::uniform_int_distribution<int> cellDist(0, side - 1);
+        NavGrid grid;
+        grid.Resize(side, side);
+        const int room = 40;
+        for (int line = room; line < side; line += room) {
+            for (int i = 0; i < side; ++i) {
+                grid.SetWalkable(line, i, false);
+                grid.SetWalkable(i, line, false);
+            }
+        }
+        for (int line = room; line < side; line += room) {
+            for (int span = 0; span < side; span += room) {
+                for (int door = 0; door < 2; ++door) {
+                    const int at = span + 1 + static_cast<int>(rng() % static_cast<uint32_t>(room - 5));
+                    const int doorWidth = 2 + static_cast<int>(rng() % 3);
+                    for (int i = at; i < std::min(at + doorWidth, side); ++i) {
+                        if (i % room == 0) continue;
+                        grid.SetWalkable(line, i, true);
+                        grid.SetWalkable(i, line, true);
+                    }
+                }
+            }
+        }
+        const size_t blocks = static_cast<size_t>(side) * static_cast<size_t>(side) / 64;
+        for (size_t i = 0; i < blocks; ++i) {
+            const int x = cellDist(rng), y = cellDist(rng);
+            for (int dy = 0; dy < 3; ++dy) {
+                for (int dx = 0; dx < 3; ++dx) grid.SetWalkable(x + dx, y + dy, false);
+            }
+        }
+
+        HierarchicalPathfinder hierarchy;
+        auto start = Clock::now();
+        hierarchy.Build(grid, result.clusterSize);
+        result.buildMs = MicrosecondsSince(start) / 1000.0;
+        result.entrances = hierarchy.GetEntranceCount();
+        result.abstractEdges = hierarchy.GetAbstractEdgeCount();
+
+        // Tile edits: block a random cell and open it again
+        const int edits = 500;
+        start = Clock::now();
+        for (int i = 0; i < edits; ++i) {
+            const int x = cellDist(rng), y = cellDist(rng);
+            if (!grid.IsWalkable(x, y)) continue;
+            grid.SetWalkable(x, y, false);
+            hierarchy.OnCellChanged(grid, x, y);
+            grid.SetWalkable(x, y, true);
+            hierarchy.OnCellChanged(grid, x, y);
+        }
+        result.editUs = MicrosecondsSince(start) / (edits * 2);
+
+        std::vector<std::pair<GridNode, GridNode>> pairs;
+        for (int attempt = 0; static_cast<int>(pairs.size()) < queries && attempt < queries * 20; ++attempt) {
+            const GridNode from(cellDist(rng), cellDist(rng));
+            const GridNode to(cellDist(rng), cellDist(rng));
+            if (grid.IsWalkable(from.x, from.y) && grid.IsWalkable(to.x, to.y)) pairs.emplace_back(from, to);
+        }
+        result.queries = pairs.size();
+        if (pairs.empty()) return result;
+
+        std::vector<GridNode> waypoints, segment, path;
+        start = Clock::now();
+        for (const auto& pair : pairs) {
+            if (hierarchy.FindAbstractPath(grid, pair.first, pair.second, waypoints)) ++result.found;
+        }
+        result.abstractUs = MicrosecondsSince(start) / result.queries;
+
+        start = Clock::now();
+        for (const auto& pair : pairs) {
+            if (hierarchy.FindAbstractPath(grid, pair.first, pair.second, waypoints) && waypoints.size() > 1) {
+                hierarchy.RefineSegment(grid, waypoints[0], waypoints[1], segment);
+            }
+        }
+        result.firstSegmentUs = MicrosecondsSince(start) / result.queries;
+
+        std::vector<float> costs;
+        costs.reserve(pairs.size());
+        start = Clock::now();
+        for (const auto& pair : pairs) {
+            costs.push_back(hierarchy.FindPath(grid, pair.first, pair.second, path) ? PathCost(path) : -1.0f);
+        }
+        result.refinedUs = MicrosecondsSince(start) / result.queries;
+
+        // Full-grid A* takes far longer on big maps: repeat queries for about two seconds
+        GridPathfinder pathfinder;
+        double gridTotalUs = 0.0, ratioSum = 0.0;
+        size_t ratioCount = 0;
+        while (result.gridQueries < pairs.size() && gridTotalUs < 2.0e6) {
+            const auto& pair = pairs[result.gridQueries];
+            start = Clock::now();
+            const bool found = pathfinder.FindPath(grid, pair.first, pair.second, path);
+            gridTotalUs += MicrosecondsSince(start);
+
+            const float hierarchical = costs[result.gridQueries];
+            if (found != (hierarchical >= 0.0f)) result.sameReachability = false;
+            if (found && pathfinder.GetLastStats().cost > 0.0f) {
+                ratioSum += hierarchical / pathfinder.GetLastStats().cost;
+                ++ratioCount;
+            }
+            ++result.gridQueries;
+        }
+        result.gridUs = gridTotalUs / static_cast<double>(result.gridQueries);
+        result.costRatio = ratioCount > 0 ? ratioSum / static_cast<double>(ratioCount) : 1.0;
+
+        return result;
+    }
+
+} // namespace GP2Engine
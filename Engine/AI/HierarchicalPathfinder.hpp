@@ -0,0 +1,182 @@
+/**
+ * @file HierarchicalPathfinder.hpp
+ * @author Asri (100%)
+ * @brief Hierarchical pathfinding (HPA*) over a NavGrid
+ *
+ * The grid is cut into square clusters. Wherever two neighbouring clusters
+ * share an open stretch of border, entrance nodes are placed on both sides
+ * (one pair in the middle of a short opening, one at each end of a long
+ * one). Each cluster stores the path cost between every pair of its
+ * entrances, found by a search that stays inside the cluster. A query then
+ * searches this small abstract graph (entrances plus the start and goal
+ * hooked into their clusters) instead of the whole grid, and returns the
+ * entrances it passes as waypoints. Each waypoint-to-waypoint segment is
+ * refined into grid cells only when the agent gets there.
+ *
+ * Paths are near-optimal: they are forced through entrance cells, so they
+ * can be a few percent longer than the shortest grid path.
+ *
+ * Features:
+ * - 4- or 8-directional movement (same rules as GridPathfinder)
+ * - Changing a cell only rebuilds the borders it lies on and the distance
+ *   tables of the clusters around it
+ * - Lazy refinement: RefineSegment expands one pair of waypoints at a time,
+ *   searching only the cluster they share
+ */
+
+#pragma once
+
+#include "NavGrid.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GP2Engine {
+
+    /**
+     * @brief Cluster/entrance abstraction of a NavGrid with abstract A*
+     */
+    class HierarchicalPathfinder {
+    public:
+        struct Stats {
+            size_t abstractExpanded = 0;    // Abstract nodes taken from the open list (last query)
+            float cost = 0.0f;              // Abstract path cost (last query)
+        };
+
+        struct BenchmarkResult {
+            int width = 0, height = 0;
+            int clusterSize = 0;
+            size_t entrances = 0;           // Abstract nodes
+            size_t abstractEdges = 0;
+            double buildMs = 0.0;
+            double editUs = 0.0;            // SetWalkable + cluster update, per edit
+            size_t queries = 0;
+            size_t found = 0;
+            double abstractUs = 0.0;        // Abstract path, per query
+            double firstSegmentUs = 0.0;    // Abstract path + first refined segment (what an agent waits for)
+            double refinedUs = 0.0;         // Abstract path + every segment refined
+            size_t gridQueries = 0;         // Queries repeated on full-grid A*
+            double gridUs = 0.0;            // Full-grid A*, per query
+            double costRatio = 0.0;         // Refined path cost / shortest cost, averaged
+            bool sameReachability = true;   // HPA* finds a path exactly when A* does
+        };
+
+        // 8-directional movement (false = 4-directional); call Build afterwards
+        void SetDiagonal(bool diagonal) { m_diagonal = diagonal; }
+        bool IsDiagonal() const { return m_diagonal; }
+
+        /**
+         * @brief Build clusters, entrances and distance tables for a grid
+         * @param clusterSize Cluster side in cells
+         */
+        void Build(const NavGrid& grid, int clusterSize = 16);
+        void Clear();
+
+        bool IsBuilt() const { return m_clusterSize > 0; }
+        int GetClusterSize() const { return m_clusterSize; }
+
+        /**
+         * @brief Update the abstraction after one cell changed
+         *
+         * Rebuilds the borders the cell lies on and the distance tables of
+         * the clusters whose entrances or interior changed.
+         */
+        void OnCellChanged(const NavGrid& grid, int x, int y);
+
+        /**
+         * @brief Abstract path as waypoints
+         * @param waypoints Start, the entrances passed, goal (cleared first)
+         * @return True if a path was found
+         */
+        bool FindAbstractPath(const NavGrid& grid, const GridNode& start, const GridNode& goal, std::vector<GridNode>& waypoints);
+
+        /**
+         * @brief Grid cells from one waypoint to the next, both included (cleared first)
+         */
+        bool RefineSegment(const NavGrid& grid, const GridNode& from, const GridNode& to, std::vector<GridNode>& cells);
+
+        /**
+         * @brief Abstract path with every segment refined (cleared first)
+         */
+        bool FindPath(const NavGrid& grid, const GridNode& start, const GridNode& goal, std::vector<GridNode>& path);
+
+        const Stats& GetLastStats() const { return m_stats; }
+        size_t GetEntranceCount() const { return m_liveNodes; }
+        size_t GetAbstractEdgeCount() const;
+        size_t GetClusterUpdateCount() const { return m_clusterUpdates; }
+
+        /**
+         * Generated size x size map (rooms walled off with doorways, plus
+         * scattered blocks): build time, edit cost, and per-query abstract,
+         * first-segment and fully refined times against full-grid A* on a
+         * slice of the queries, with the path cost ratio.
+         */
+        static BenchmarkResult RunBenchmark(int size, int clusterSize, int queries);
+
+    private:
+        static constexpr uint32_t NONE = 0xFFFFFFFFu;
+
+        struct Node {
+            uint32_t cell;          // Grid index
+            uint32_t cluster;       // NONE while on the free list
+            uint32_t partner;       // Entrance on the other side of the border
+            uint32_t border;        // cluster * 2 (+1 for the bottom border) that created it
+            uint32_t slot;          // Position in the cluster's node list
+        };
+
+        struct Cluster {
+            int x, y;               // First cell
+            int width, height;
+            std::vector<uint32_t> nodes;
+            std::vector<float> distances;   // nodes x nodes, row-major; infinity if not connected inside
+        };
+
+        struct SearchEntry {
+            float f;
+            uint32_t node;
+            bool operator>(const SearchEntry& other) const { return f > other.f; }
+        };
+
+        struct SearchState {
+            float g;
+            uint32_t parent;
+            uint32_t stamp;
+        };
+
+        int m_clusterSize = 0;
+        int m_clustersX = 0;
+        int m_clustersY = 0;
+        int m_gridWidth = 0;
+        int m_gridHeight = 0;
+        uint64_t m_gridVersion = 0;
+        bool m_diagonal = false;
+
+        std::vector<Cluster> m_clusters;
+        std::vector<Node> m_nodes;
+        std::vector<uint32_t> m_freeNodes;
+        size_t m_liveNodes = 0;
+        size_t m_clusterUpdates = 0;
+
+        // Cluster-local search (Dijkstra inside one cluster)
+        std::vector<float> m_localDistance;
+        std::vector<uint32_t> m_localParent;
+        std::vector<SearchEntry> m_localOpen;
+
+        // Abstract search
+        std::vector<SearchState> m_search;
+        std::vector<SearchEntry> m_open;
+        std::vector<float> m_startDistance;     // Start cell to each entrance of its cluster
+        std::vector<float> m_goalDistance;
+        uint32_t m_generation = 0;
+        Stats m_stats;
+
+        uint32_t ClusterOf(int x, int y) const;
+        void RebuildBorder(const NavGrid& grid, uint32_t cluster, bool bottom);
+        void RemoveBorderNodes(uint32_t border);
+        uint32_t AddNode(uint32_t cluster, uint32_t cell, uint32_t border);
+        void RebuildDistances(const NavGrid& grid, uint32_t cluster);
+        void SearchCluster(const NavGrid& grid, const Cluster& cluster, int sourceX, int sourceY);
+        float Heuristic(uint32_t fromCell, uint32_t toCell) const;
+    };
+
+} // namespace GP2Engine
@@ -0,0 +1,60 @@
+/**
+ * @file NavGrid.cpp
+ * @author Asri (100%)
+ * @brief Implementation of the flat walkability grid
+ */
+
+#include "NavGrid.hpp"
+#include <algorithm>
+
+namespace GP2Engine {
+
+    void NavGrid::Resize(int width, int height) {
+        m_width = std::max(width, 0);
+        m_height = std::max(height, 0);
+        // Spare word: GetBlockedBits reads the word after the last cell it needs
+        m_blocked.assign((GetCellCount() + 63) / 64 + 1, 0);
+        m_blockedCount = 0;
+        ++m_version;
+    }
+
+    bool NavGrid::SetWalkable(int x, int y, bool walkable) {
+        if (!IsInBounds(x, y)) return false;
+
+        const uint32_t index = ToIndex(x, y);
+        uint64_t& word = m_blocked[index >> 6];
+        const uint64_t bit = uint64_t(1) << (index & 63);
+        if (((word & bit) == 0) == walkable) return false;
+
+        if (walkable) {
+            word &= ~bit;
+            --m_blockedCount;
+        }
+        else {
+            word |= bit;
+            ++m_blockedCount;
+        }
+        ++m_version;
+        return true;
+    }
+
+    uint64_t NavGrid::GetBlockedBits(int x, int y) const {
+        if (y < 0 || y >= m_height || x >= m_width || x <= -64) return ~uint64_t(0);
+
+        // Read the cells inside the row, starting at an arbitrary bit
+        const int first = std::max(x, 0);
+        const int count = std::min(x + 64, m_width) - first;
+        const uint32_t index = ToIndex(first, y);
+        const uint32_t shift = index & 63;
+        uint64_t bits = m_blocked[index >> 6] >> shift;
+        if (shift != 0) bits |= m_blocked[(index >> 6) + 1] << (64 - shift);
+
+        // Cells past either end of the row read as blocked
+        const uint64_t inside = count == 64 ? ~uint64_t(0) : (uint64_t(1) << count) - 1;
+        bits = (bits & inside) | ~inside;
+        const int offset = first - x;
+        if (offset > 0) bits = (bits << offset) | ((uint64_t(1) << offset) - 1);
+        return bits;
+    }
+
+} // namespace GP2Engine
@@ -0,0 +1,110 @@
+/**
+ * @file NavGrid.hpp
+ * @author Asri (100%)
+ * @brief Flat walkability grid shared by the pathfinders
+ *
+ * Cells are stored row-major, one bit per cell, so a 1024x1024 map fits in
+ * 128 KB and neighbour checks touch the same few cache lines. Cell (x, y)
+ * has index y * width + x; the pathfinders keep their per-node state in
+ * arrays of that size.
+ *
+ * Features:
+ * - One bit per cell (set = blocked), all cells walkable after Resize
+ * - Out of bounds cells read as blocked
+ * - 64 cells of a row read at once, for scans that skip open space
+ * - Version counter bumped by every effective change, so caches built on
+ *   the grid can tell when they are stale
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace GP2Engine {
+
+    /**
+     * @brief Grid node for A* pathfinding
+     */
+    struct GridNode {
+        int x, y;
+
+        GridNode() : x(0), y(0) {}
+        GridNode(int nx, int ny) : x(nx), y(ny) {}
+
+        bool operator==(const GridNode& other) const {
+            return x == other.x && y == other.y;
+        }
+
+        bool operator!=(const GridNode& other) const {
+            return !(*this == other);
+        }
+
+        // Hash function for unordered_map
+        struct Hash {
+            size_t operator()(const GridNode& node) const {
+                return std::hash<int>()(node.x) ^ (std::hash<int>()(node.y) << 1);
+            }
+        };
+    };
+
+    /**
+     * @brief Bitset walkability grid
+     */
+    class NavGrid {
+    public:
+        /**
+         * @brief Resize the grid; every cell becomes walkable
+         * @param width Cells per row
+         * @param height Rows
+         */
+        void Resize(int width, int height);
+
+        /**
+         * @brief Mark a cell as walkable or blocked
+         * @return True if the cell changed
+         */
+        bool SetWalkable(int x, int y, bool walkable);
+
+        bool IsInBounds(int x, int y) const {
+            return x >= 0 && x < m_width && y >= 0 && y < m_height;
+        }
+
+        bool IsWalkable(int x, int y) const {
+            return IsInBounds(x, y) && IsWalkableIndex(ToIndex(x, y));
+        }
+
+        // No bounds check: index must be below GetCellCount()
+        bool IsWalkableIndex(uint32_t index) const {
+            return (m_blocked[index >> 6] & (uint64_t(1) << (index & 63))) == 0;
+        }
+
+        /**
+         * @brief Blocked bits of 64 cells in one row
+         * @return Bit i set if cell (x + i, y) is blocked or out of bounds
+         */
+        uint64_t GetBlockedBits(int x, int y) const;
+
+        uint32_t ToIndex(int x, int y) const {
+            return static_cast<uint32_t>(y) * static_cast<uint32_t>(m_width) + static_cast<uint32_t>(x);
+        }
+
+        int GetWidth() const { return m_width; }
+        int GetHeight() const { return m_height; }
+        size_t GetCellCount() const { return static_cast<size_t>(m_width) * static_cast<size_t>(m_height); }
+        size_t GetBlockedCount() const { return m_blockedCount; }
+
+        // Bumped by every Resize and effective SetWalkable
+        uint64_t GetVersion() const { return m_version; }
+
+    private:
+        int m_width = 0;
+        int m_height = 0;
+        size_t m_blockedCount = 0;
+        uint64_t m_version = 0;
+        std::vector<uint64_t> m_blocked;    // Bit per cell, row-major, plus one spare word
+    };
+
+} // namespace GP2Engine
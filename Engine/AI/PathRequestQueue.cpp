@@ -0,0 +1,269 @@
+/**
+ * @file PathRequestQueue.cpp
+ * @author Asri (100%)
+ * @brief Implementation of the budgeted path request queue
+ */
+
+#include "PathRequestQueue.hpp"
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace GP2Engine {
+
+    namespace {
+        using Clock = std::chrono::steady_clock;
+
+        double MicrosecondsSince(Clock::time_point start) {
+            return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+        }
+
+        // Nearest-rank percentile; sorts the samples
+        double Percentile(std::vector<double>& samples, double percentile) {
+            if (samples.empty()) return 0.0;
+            std::sort(samples.begin(), samples.end());
+            const double rank = std::clamp(percentile, 0.0, 100.0) / 100.0 * static_cast<double>(samples.size());
+            const size_t index = static_cast<size_t>(std::ceil(rank));
+            return samples[index > 0 ? index - 1 : 0];
+        }
+    }
+
+    PathRequestQueue::PathRequestQueue() : m_pathfinders(1) {}
+    PathRequestQueue::~PathRequestQueue() = default;
+    PathRequestQueue::PathRequestQueue(PathRequestQueue&&) noexcept = default;
+    PathRequestQueue& PathRequestQueue::operator=(PathRequestQueue&&) noexcept = default;
+
+    // ============================================================================
+    // SETTINGS
+    // ============================================================================
+
+    void PathRequestQueue::SetPathfindingMode(GridPathfinder::Mode mode, bool diagonal) {
+        m_mode = mode;
+        m_diagonal = diagonal;
+        for (GridPathfinder& pathfinder : m_pathfinders) {
+            pathfinder.SetMode(mode);
+            pathfinder.SetDiagonal(diagonal);
+        }
+    }
+
+    void PathRequestQueue::SetThreadCount(int threadCount) {
+        threadCount = std::max(threadCount, 1);
+        if (threadCount == m_threadCount) return;
+        m_threadCount = threadCount;
+
+        m_pathfinders.resize(static_cast<size_t>(threadCount));
+        SetPathfindingMode(m_mode, m_diagonal);
+
+        if (threadCount == 1) {
+            m_workers.reset();
+        }
+        else if (m_workers) {
+            m_workers->SetThreadCount(threadCount);
+        }
+        else {
+            m_workers = std::make_unique<WorkerPool>(threadCount);
+        }
+    }
+
+    // ============================================================================
+    // REQUESTS
+    // ============================================================================
+
+    PathRequestQueue::Handle PathRequestQueue::Submit(const GridNode& start, const GridNode& goal) {
+        const Handle handle = m_nextHandle++;
+        Request& request = m_requests[handle];
+        request.start = start;
+        request.goal = goal;
+        request.submitted = Clock::now();
+
+        m_pending.push_back(handle);
+        ++m_stats.submitted;
+        return handle;
+    }
+
+    void PathRequestQueue::Cancel(Handle handle) {
+        auto it = m_requests.find(handle);
+        if (it == m_requests.end()) return;
+
+        if (it->second.status == Status::Pending) {
+            m_pending.erase(std::find(m_pending.begin(), m_pending.end(), handle));
+        }
+        m_requests.erase(it);
+        ++m_stats.cancelled;
+    }
+
+    PathRequestQueue::Status PathRequestQueue::GetStatus(Handle handle) const {
+        auto it = m_requests.find(handle);
+        return it != m_requests.end() ? it->second.status : Status::Unknown;
+    }
+
+    bool PathRequestQueue::TakeResult(Handle handle, std::vector<GridNode>& path) {
+        auto it = m_requests.find(handle);
+        if (it == m_requests.end() || it->second.status == Status::Pending) return false;
+
+        path.swap(it->second.path);
+        m_requests.erase(it);
+        return true;
+    }
+
+    void PathRequestQueue::Clear() {
+        m_requests.clear();
+        m_pending.clear();
+    }
+
+    // ============================================================================
+    // PROCESSING
+    // ============================================================================
+
+    void PathRequestQueue::Process(const NavGrid& grid) {
+        const auto start = Clock::now();
+        m_stats.processedLastFrame = 0;
+
+        // One request per thread per round; the budget is checked between rounds
+        while (!m_pending.empty()) {
+            if (m_stats.processedLastFrame > 0 && MicrosecondsSince(start) >= m_frameBudgetUs) break;
+
+            m_batch.clear();
+            while (!m_pending.empty() && m_batch.size() < m_pathfinders.size()) {
+                m_batch.push_back(&m_requests[m_pending.front()]);
+                m_pending.pop_front();
+            }
+
+            auto search = [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    Request& request = *m_batch[i];
+                    const bool found = m_pathfinders[i].FindPath(grid, request.start, request.goal, request.path);
+                    request.status = found ? Status::Done : Status::Failed;
+                }
+            };
+            if (m_workers && m_batch.size() > 1) {
+                m_workers->ParallelFor(m_batch.size(), 1, search);
+            }
+            else {
+                search(0, m_batch.size());
+            }
+
+            for (Request* request : m_batch) {
+                Complete(*request, request->status == Status::Done);
+            }
+            m_stats.processedLastFrame += m_batch.size();
+        }
+
+        m_stats.lastFrameUs = MicrosecondsSince(start);
+        m_stats.maxFrameUs = std::max(m_stats.maxFrameUs, m_stats.lastFrameUs);
+    }
+
+    void PathRequestQueue::Complete(Request& request, bool found) {
+        if (!found) request.path.clear();
+        ++m_stats.completed;
+
+        const double latency = MicrosecondsSince(request.submitted);
+        if (m_latencies.size() < LATENCY_SAMPLES) {
+            m_latencies.push_back(latency);
+        }
+        else {
+            m_latencies[m_latencyNext] = latency;
+        }
+        m_latencyNext = (m_latencyNext + 1) % LATENCY_SAMPLES;
+    }
+
+    double PathRequestQueue::GetLatencyPercentile(double percentile) const {
+        std::vector<double> samples = m_latencies;
+        return Percentile(samples, percentile) / 1000.0;
+    }
+
+    // ============================================================================
+    // BENCHMARK
+    // ============================================================================
+
+    PathRequestQueue::BenchmarkResult PathRequestQueue::RunBenchmark(int size, size_t agents, int frames, double budgetUs,
+                                                                     int threads) {
+        BenchmarkResult result;
+        result.width = result.height = std::max(size, 2);
+        result.agents = agents;
+        result.frames = std::max(frames, 1);
+        result.budgetUs = budgetUs;
+        result.threads = std::max(threads, 1);
+        const int side = result.width;
+        const int repathInterval = 30;
+
+        // Rooms-like map: wall segments on an open floor
+        std::mt19937 rng(2024);
+        std::uniform_int_distribution<int> cellDist(0, side - 1);
+        NavGrid grid;
+        grid.Resize(side, side);
+        const int walls = side * side / 256;
+        for (int i = 0; i < walls; ++i) {
+            const int x = cellDist(rng), y = cellDist(rng);
+            const int length = 4 + static_cast<int>(rng() % 28);
+            const bool horizontal = (rng() & 1) != 0;
+            for (int j = 0; j < length; ++j) {
+                grid.SetWalkable(horizontal ? x + j : x, horizontal ? y : y + j, false);
+            }
+        }
+
+        auto randomWalkable = [&]() {
+            GridNode cell(cellDist(rng), cellDist(rng));
+            while (!grid.IsWalkable(cell.x, cell.y)) cell = GridNode(cellDist(rng), cellDist(rng));
+            return cell;
+        };
+        std::vector<GridNode> starts(agents), goals(agents);
+        for (size_t i = 0; i < agents; ++i) {
+            starts[i] = randomWalkable();
+            goals[i] = randomWalkable();
+        }
+
+        // Every search on the frame the timers fire
+        GridPathfinder pathfinder;
+        std::vector<GridNode> path;
+        double syncTotalUs = 0.0;
+        for (int frame = 0; frame < result.frames; ++frame) {
+            const auto start = Clock::now();
+            if (frame % repathInterval == 0) {
+                for (size_t i = 0; i < agents; ++i) pathfinder.FindPath(grid, starts[i], goals[i], path);
+            }
+            const double frameUs = MicrosecondsSince(start);
+            syncTotalUs += frameUs;
+            result.syncMaxFrameMs = std::max(result.syncMaxFrameMs, frameUs / 1000.0);
+        }
+        result.syncMeanFrameMs = syncTotalUs / 1000.0 / result.frames;
+
+        // Same timers through the queue; an agent with a request in flight does not submit again
+        PathRequestQueue queue;
+        queue.SetFrameBudget(budgetUs);
+        queue.SetThreadCount(result.threads);
+        std::vector<Handle> handles(agents, INVALID_HANDLE);
+        std::vector<int> submitFrames(agents, 0);
+        std::vector<double> latencyFrames;
+        double queuedTotalUs = 0.0;
+        for (int frame = 0; frame < result.frames; ++frame) {
+            const auto start = Clock::now();
+            if (frame % repathInterval == 0) {
+                for (size_t i = 0; i < agents; ++i) {
+                    if (handles[i] != INVALID_HANDLE) continue;
+                    handles[i] = queue.Submit(starts[i], goals[i]);
+                    submitFrames[i] = frame;
+                }
+            }
+            result.maxQueueDepth = std::max(result.maxQueueDepth, queue.GetQueueDepth());
+            queue.Process(grid);
+            for (size_t i = 0; i < agents; ++i) {
+                if (handles[i] != INVALID_HANDLE && queue.TakeResult(handles[i], path)) {
+                    handles[i] = INVALID_HANDLE;
+                    latencyFrames.push_back(static_cast<double>(frame - submitFrames[i]));
+                }
+            }
+            const double frameUs = MicrosecondsSince(start);
+            queuedTotalUs += frameUs;
+            result.queuedMaxFrameMs = std::max(result.queuedMaxFrameMs, frameUs / 1000.0);
+        }
+        result.queuedMeanFrameMs = queuedTotalUs / 1000.0 / result.frames;
+        result.completed = latencyFrames.size();
+        result.latencyP50Frames = Percentile(latencyFrames, 50.0);
+        result.latencyP95Frames = Percentile(latencyFrames, 95.0);
+        result.latencyP99Frames = Percentile(latencyFrames, 99.0);
+
+        return result;
+    }
+
+} // namespace GP2Engine
@@ -0,0 +1,177 @@
+/**
+ * @file PathRequestQueue.hpp
+ * @author Asri (100%)
+ * @brief Deferred path requests processed under a per-frame time budget
+ *
+ * Instead of searching as soon as an agent's recalculation timer fires,
+ * agents submit a (start, goal) request and get a handle back. Process runs
+ * once per frame and works through the queue in submission order until its
+ * microsecond budget is spent, so ten agents re-pathing on the same frame
+ * spread over the next few frames instead of stalling one. Finished paths
+ * wait under their handle until the agent takes them; until then the agent
+ * keeps following the path it already has.
+ *
+ * With more than one thread, each round of Process hands one request to
+ * every thread of a WorkerPool (each with its own GridPathfinder) and the
+ * budget is checked between rounds.
+ *
+ * Features:
+ * - Handles are never reused, so a stale handle just reports Unknown
+ * - At least one request is processed per frame, whatever the budget
+ * - Queue depth, per-frame processing time and submit-to-result latency
+ *   percentiles over the last LATENCY_SAMPLES requests
+ *
+ * A single search is not split across frames: the budget is checked
+ * between requests, so one long search can still overrun it.
+ */
+
+#pragma once
+
+#include "GridPathfinder.hpp"
+#include "NavGrid.hpp"
+#include <Core/WorkerPool.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace GP2Engine {
+
+    /**
+     * @brief Budgeted queue of grid path requests
+     */
+    class PathRequestQueue {
+    public:
+        using Handle = uint64_t;
+        static constexpr Handle INVALID_HANDLE = 0;
+        static constexpr size_t LATENCY_SAMPLES = 1024;
+
+        enum class Status {
+            Unknown,    // Never submitted, cancelled or already taken
+            Pending,
+            Done,       // Path found
+            Failed      // No path
+        };
+
+        struct Stats {
+            size_t submitted = 0;
+            size_t completed = 0;           // Done or Failed
+            size_t cancelled = 0;
+            size_t processedLastFrame = 0;
+            double lastFrameUs = 0.0;       // Time spent in the last Process
+            double maxFrameUs = 0.0;
+        };
+
+        struct BenchmarkResult {
+            int width = 0, height = 0;
+            size_t agents = 0;
+            int frames = 0;
+            double budgetUs = 0.0;
+            int threads = 1;
+            double syncMaxFrameMs = 0.0;    // Every due request searched on the spot
+            double syncMeanFrameMs = 0.0;
+            double queuedMaxFrameMs = 0.0;  // Process with the budget, once per frame
+            double queuedMeanFrameMs = 0.0;
+            size_t maxQueueDepth = 0;
+            double latencyP50Frames = 0.0;  // Frames from submit to result (0 = same frame)
+            double latencyP95Frames = 0.0;
+            double latencyP99Frames = 0.0;
+            size_t completed = 0;
+        };
+
+        PathRequestQueue();
+        ~PathRequestQueue();
+        PathRequestQueue(PathRequestQueue&&) noexcept;
+        PathRequestQueue& operator=(PathRequestQueue&&) noexcept;
+
+        // Search settings used for every request (see GridPathfinder)
+        void SetPathfindingMode(GridPathfinder::Mode mode, bool diagonal);
+
+        // Microseconds Process may spend per frame
+        void SetFrameBudget(double microseconds) { m_frameBudgetUs = microseconds; }
+        double GetFrameBudget() const { return m_frameBudgetUs; }
+
+        /**
+         * @brief Threads searching in parallel, including the caller (1 = main thread only)
+         */
+        void SetThreadCount(int threadCount);
+        int GetThreadCount() const { return m_threadCount; }
+
+        /**
+         * @brief Queue a path request
+         * @return Handle to poll with GetStatus and collect with TakeResult
+         */
+        Handle Submit(const GridNode& start, const GridNode& goal);
+
+        // Drop a request, pending or finished
+        void Cancel(Handle handle);
+
+        Status GetStatus(Handle handle) const;
+
+        /**
+         * @brief Collect a finished request and release its handle
+         * @param path Receives the path (empty if none was found)
+         * @return False while the request is still pending (or unknown)
+         */
+        bool TakeResult(Handle handle, std::vector<GridNode>& path);
+
+        /**
+         * @brief Run queued requests until the frame budget is spent
+         * @param grid Grid to search; must not change while Process runs
+         */
+        void Process(const NavGrid& grid);
+
+        // Drop every request
+        void Clear();
+
+        size_t GetQueueDepth() const { return m_pending.size(); }
+        const Stats& GetStats() const { return m_stats; }
+
+        /**
+         * @brief Submit-to-result latency over the recent requests
+         * @param percentile 0-100
+         * @return Milliseconds (0 before any request finished)
+         */
+        double GetLatencyPercentile(double percentile) const;
+
+        /**
+         * Random size x size map where every agent re-paths on the same frame
+         * every 30 frames: frame times with each search run on the spot
+         * against the queue with the given budget and thread count.
+         */
+        static BenchmarkResult RunBenchmark(int size, size_t agents, int frames, double budgetUs, int threads);
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        struct Request {
+            GridNode start;
+            GridNode goal;
+            Status status = Status::Pending;
+            std::vector<GridNode> path;
+            Clock::time_point submitted;
+        };
+
+        std::unordered_map<Handle, Request> m_requests;
+        std::deque<Handle> m_pending;               // Not yet searched, in submission order
+        Handle m_nextHandle = 1;
+
+        GridPathfinder::Mode m_mode = GridPathfinder::Mode::AStar;
+        bool m_diagonal = false;
+        double m_frameBudgetUs = 1000.0;
+        int m_threadCount = 1;
+        std::vector<GridPathfinder> m_pathfinders;  // One per thread
+        std::unique_ptr<WorkerPool> m_workers;
+        std::vector<Request*> m_batch;
+
+        std::vector<double> m_latencies;            // Ring buffer, microseconds
+        size_t m_latencyNext = 0;
+        Stats m_stats;
+
+        void Complete(Request& request, bool found);
+    };
+
+} // namespace GP2Engine
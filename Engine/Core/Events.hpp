@@ -98,6 +98,25 @@ namespace GP2Engine {
         std::string itemType;
     };
 
+    /**
+     * @brief Event fired when a tile's value changes (e.g. a door opens or a wall is placed)
+     */
+    struct TileChangedEvent {
+        int col;
+        int row;
+        int oldValue;
+        int newValue;
+        bool collidable;    // Collidability of the new value
+    };
+
+    /**
+     * @brief Event fired when a whole tile map's collision is rebuilt (map or tile definitions loaded)
+     */
+    struct TileMapReloadedEvent {
+        int cols;
+        int rows;
+    };
+
     // ===== MENU EVENTS =====
 
     /**
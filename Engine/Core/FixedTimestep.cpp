@@ -0,0 +1,58 @@
+/**
+ * @file FixedTimestep.cpp
+ * @author Adi (100%)
+ * @brief Implementation of the fixed-step accumulator
+ */
+
+#include "FixedTimestep.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace GP2Engine {
+
+    FixedTimestep::FixedTimestep(float stepTime, int maxStepsPerFrame)
+        : m_stepTime(stepTime > 0.0f ? stepTime : DEFAULT_STEP_TIME),
+          m_maxSteps(std::max(maxStepsPerFrame, 1)) {
+    }
+
+    int FixedTimestep::Advance(float frameDelta) {
+        // Negative or NaN deltas (clock hiccups) add nothing
+        if (frameDelta > 0.0f) {
+            m_accumulator += frameDelta;
+        }
+
+        int steps = 0;
+        while (m_accumulator >= m_stepTime && steps < m_maxSteps) {
+            m_accumulator -= m_stepTime;
+            ++steps;
+        }
+
+        // Still behind after the cap: drop the whole steps so the next frame does not start behind too
+        if (m_accumulator >= m_stepTime) {
+            const double remainder = std::fmod(m_accumulator, static_cast<double>(m_stepTime));
+            m_droppedTime += static_cast<float>(m_accumulator - remainder);
+            m_accumulator = remainder;
+        }
+
+        m_lastSteps = steps;
+        m_totalSteps += static_cast<unsigned long long>(steps);
+        return steps;
+    }
+
+    void FixedTimestep::Reset() {
+        m_accumulator = 0.0;
+        m_lastSteps = 0;
+    }
+
+    void FixedTimestep::SetStepTime(float stepTime) {
+        if (stepTime > 0.0f) {
+            m_stepTime = stepTime;
+            m_accumulator = std::fmod(m_accumulator, static_cast<double>(m_stepTime));
+        }
+    }
+
+    void FixedTimestep::SetMaxStepsPerFrame(int maxSteps) {
+        m_maxSteps = std::max(maxSteps, 1);
+    }
+
+} // namespace GP2Engine
@@ -0,0 +1,82 @@
+/**
+ * @file FixedTimestep.hpp
+ * @author Adi (100%)
+ * @brief Fixed-step accumulator for frame-rate independent simulation
+ *
+ * FixedTimestep turns the variable frame delta from Time into a whole number
+ * of fixed simulation steps. Leftover time carries over to the next frame and
+ * is exposed as an interpolation factor so rendering can blend between the
+ * last two simulation states.
+ *
+ * Features:
+ * - Same step size every update (deterministic, no tunnelling on frame spikes)
+ * - Max steps per frame cap; time beyond the cap is dropped (no spiral of death)
+ * - Interpolation alpha in [0, 1) for rendering between steps
+ *
+ * Usage:
+ * @code
+ * int steps = m_fixedStep.Advance(Time::DeltaTime());
+ * for (int i = 0; i < steps; ++i) {
+ *     physicsWorld.Step(registry, m_fixedStep.GetStepTime());
+ * }
+ * physicsWorld.Interpolate(registry, m_fixedStep.GetAlpha());
+ * @endcode
+ */
+
+#pragma once
+
+namespace GP2Engine {
+
+    /**
+     * @brief Fixed-step accumulator
+     */
+    class FixedTimestep {
+    public:
+        static constexpr float DEFAULT_STEP_TIME = 1.0f / 60.0f;
+        static constexpr int DEFAULT_MAX_STEPS = 5;
+
+        /**
+         * @param stepTime Simulation step in seconds
+         * @param maxStepsPerFrame Most steps run for one frame (extra time is dropped)
+         */
+        explicit FixedTimestep(float stepTime = DEFAULT_STEP_TIME, int maxStepsPerFrame = DEFAULT_MAX_STEPS);
+
+        /**
+         * @brief Add a frame's delta time
+         *
+         * @param frameDelta Variable frame time in seconds
+         * @return Number of fixed steps to run this frame (0..max steps)
+         */
+        int Advance(float frameDelta);
+
+        /**
+         * @brief Forget accumulated time (e.g. after loading or unpausing)
+         */
+        void Reset();
+
+        void SetStepTime(float stepTime);
+        void SetMaxStepsPerFrame(int maxSteps);
+
+        float GetStepTime() const { return m_stepTime; }
+        int GetMaxStepsPerFrame() const { return m_maxSteps; }
+
+        /**
+         * @brief Blend factor between the previous and current simulation state
+         * @return Accumulated time / step time, in [0, 1)
+         */
+        float GetAlpha() const { return static_cast<float>(m_accumulator / m_stepTime); }
+
+        int GetLastStepCount() const { return m_lastSteps; }          ///< Steps from the last Advance
+        float GetDroppedTime() const { return m_droppedTime; }        ///< Seconds dropped by the cap (total)
+        unsigned long long GetTotalSteps() const { return m_totalSteps; }
+
+    private:
+        float m_stepTime;
+        int m_maxSteps;
+        double m_accumulator = 0.0;      // Double so long sessions do not drift
+        int m_lastSteps = 0;
+        float m_droppedTime = 0.0f;
+        unsigned long long m_totalSteps = 0;
+    };
+
+} // namespace GP2Engine
@@ -52,6 +52,22 @@ namespace GP2Engine {
         for (auto& pair : m_TimingData) {
             pair.second.accumulatedTime = 0.0f;
         }
+
+        // Publish counters and start counting from zero
+        for (auto& pair : m_FrameCounts) {
+            m_Counts[pair.first] = pair.second;
+            pair.second = 0;
+        }
+    }
+
+    void Profiler::AddCount(const std::string& counterName, int count) {
+        m_FrameCounts[counterName] += count;
+    }
+
+    int Profiler::GetCount(const std::string& counterName) const {
+        // Return last frame's count, or 0 if counter not found
+        auto it = m_Counts.find(counterName);
+        return (it != m_Counts.end()) ? it->second : 0;
     }
 
     float Profiler::GetSystemPercentage(const std::string& systemName) const {
@@ -71,6 +87,8 @@ namespace GP2Engine {
         m_TimingData.clear();
         m_SystemTimes.clear();
         m_SystemPercentages.clear();
+        m_FrameCounts.clear();
+        m_Counts.clear();
         m_TotalFrameTime = 0.0f;
     }
 
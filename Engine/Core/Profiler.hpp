@@ -9,6 +9,7 @@
  * Features:
  * - High-precision timing using GLFW timer
  * - Per-frame percentage calculations
+ * - Per-frame counters (e.g. fixed physics steps run this frame)
  * - Singleton pattern for global access
  *
  * Usage:
@@ -77,6 +78,22 @@ namespace GP2Engine {
          */
         float GetSystemTimeMs(const std::string& systemName) const;
 
+        /**
+         * @brief Add to a per-frame counter
+         *
+         * @param counterName Name of the counter (e.g. "PhysicsSteps")
+         * @param count Amount to add this frame
+         */
+        void AddCount(const std::string& counterName, int count = 1);
+
+        /**
+         * @brief Get a counter's total from the last finished frame
+         *
+         * @param counterName Name of the counter
+         * @return Count, or 0 if the counter was never used
+         */
+        int GetCount(const std::string& counterName) const;
+
         /**
          * @brief End frame and calculate percentages
          *
@@ -112,6 +129,8 @@ namespace GP2Engine {
         std::unordered_map<std::string, TimingData> m_TimingData;
         std::unordered_map<std::string, float> m_SystemTimes;
         std::unordered_map<std::string, float> m_SystemPercentages;
+        std::unordered_map<std::string, int> m_FrameCounts;     // Counting this frame
+        std::unordered_map<std::string, int> m_Counts;          // Last finished frame
         float m_TotalFrameTime = 0.0f;
     };
 
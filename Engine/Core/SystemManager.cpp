@@ -12,6 +12,7 @@
 #include "Time.hpp"
 #include "Input.hpp"
 #include "Logger.hpp"
+#include "Profiler.hpp"
 #include "../Graphics/Renderer.hpp"
 #include "../Audio/AudioEngine.hpp"
 
@@ -97,6 +98,9 @@ namespace GP2Engine {
         // Reset input frame states (pressed/released)
         Input::ResetFrameStates();
 
+        // Finalize this frame's profiler times and counters
+        Profiler::GetInstance().EndFrame();
+
         // Apply frame rate limiting
         Time::LimitFrameRate();
     }
@@ -67,7 +67,8 @@ namespace GP2Engine {
         /**
          * @brief End the current frame
          *
-         * Swaps buffers, resets input states, and limits frame rate.
+         * Swaps buffers, resets input states, finalizes profiler data,
+         * and limits frame rate.
          * Called by Application at end of each frame.
          *
          * @param window GLFW window handle
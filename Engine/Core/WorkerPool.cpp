@@ -0,0 +1,112 @@
+/**
+ * @file WorkerPool.cpp
+ * @author Adi (100%)
+ * @brief Implementation of the persistent worker pool
+ */
+
+#include "WorkerPool.hpp"
+#include <algorithm>
+
+namespace GP2Engine {
+
+    namespace {
+        // Polls of the generation counter before a finished worker goes to sleep
+        constexpr int SPIN_COUNT = 2000;
+    }
+
+    WorkerPool::WorkerPool(int threadCount) {
+        Start(threadCount);
+    }
+
+    WorkerPool::~WorkerPool() {
+        Stop();
+    }
+
+    int WorkerPool::GetHardwareThreads() {
+        return std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+    }
+
+    void WorkerPool::SetThreadCount(int threadCount) {
+        const int wanted = threadCount > 0 ? threadCount : GetHardwareThreads();
+        if (wanted == GetThreadCount()) return;
+
+        Stop();
+        Start(wanted);
+    }
+
+    void WorkerPool::Start(int threadCount) {
+        const int total = threadCount > 0 ? threadCount : GetHardwareThreads();
+        m_stop = false;
+        m_workers.reserve(static_cast<size_t>(total - 1));
+        // Workers start from the current generation so they never pick up an old loop
+        const uint64_t generation = m_generation.load(std::memory_order_acquire);
+        for (int i = 1; i < total; ++i) {
+            m_workers.emplace_back(&WorkerPool::WorkerLoop, this, generation);
+        }
+    }
+
+    void WorkerPool::Stop() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        for (std::thread& worker : m_workers) {
+            worker.join();
+        }
+        m_workers.clear();
+    }
+
+    void WorkerPool::Run(size_t count, size_t grain, Invoke invoke, void* context) {
+        // About four chunks per thread so uneven chunks still balance out
+        const size_t threads = m_workers.size() + 1;
+        const size_t chunk = std::max(grain, (count + threads * 4 - 1) / (threads * 4));
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_invoke = invoke;
+            m_context = context;
+            m_count = count;
+            m_chunk = chunk;
+            m_nextChunk.store(0, std::memory_order_relaxed);
+            m_busyWorkers.store(static_cast<int>(m_workers.size()), std::memory_order_relaxed);
+            m_generation.fetch_add(1, std::memory_order_release);
+        }
+        m_wake.notify_all();
+
+        RunChunks();
+
+        // Every worker takes part in every loop, so the job fields stay valid until all have checked out
+        while (m_busyWorkers.load(std::memory_order_acquire) > 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    void WorkerPool::RunChunks() {
+        while (true) {
+            const size_t begin = m_nextChunk.fetch_add(m_chunk, std::memory_order_relaxed);
+            if (begin >= m_count) return;
+            m_invoke(m_context, begin, std::min(begin + m_chunk, m_count));
+        }
+    }
+
+    void WorkerPool::WorkerLoop(uint64_t seen) {
+        while (true) {
+            // Spin a little first: solver loops come in quick bursts
+            for (int spin = 0; spin < SPIN_COUNT && m_generation.load(std::memory_order_acquire) == seen; ++spin) {
+                std::this_thread::yield();
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wake.wait(lock, [&] { return m_stop || m_generation.load(std::memory_order_acquire) != seen; });
+                if (m_stop) return;
+                seen = m_generation.load(std::memory_order_acquire);
+            }
+
+            RunChunks();
+            m_busyWorkers.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+
+} // namespace GP2Engine
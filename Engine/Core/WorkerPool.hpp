@@ -0,0 +1,110 @@
+/**
+ * @file WorkerPool.hpp
+ * @author Adi (100%)
+ * @brief Persistent worker threads for data-parallel loops
+ *
+ * WorkerPool keeps a few threads alive and hands them index ranges of a
+ * loop. The calling thread works on the loop too and returns once every
+ * index is done, so a ParallelFor behaves like a plain for loop that happens
+ * to use more cores.
+ *
+ * Features:
+ * - Threads are started once and reused (no spawn per call)
+ * - Work is split into chunks of at least `grain` indices, taken in order
+ * - Workers spin briefly between calls, so back-to-back loops (solver
+ *   iterations) do not pay for a sleep and wake each time
+ * - One thread (or a loop no bigger than one chunk) runs inline
+ *
+ * Usage:
+ * @code
+ * WorkerPool pool(4);
+ * pool.ParallelFor(items.size(), 64, [&](size_t begin, size_t end) {
+ *     for (size_t i = begin; i < end; ++i) Process(items[i]);
+ * });
+ * @endcode
+ *
+ * Calls must come from one thread at a time.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace GP2Engine {
+
+    /**
+     * @brief Persistent thread pool for parallel loops
+     */
+    class WorkerPool {
+    public:
+        /**
+         * @param threadCount Threads working on each loop, including the caller
+         *                    (0 = one per hardware thread)
+         */
+        explicit WorkerPool(int threadCount = 1);
+        ~WorkerPool();
+
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        /**
+         * @brief Restart with a different number of threads
+         * @param threadCount Threads including the caller (0 = hardware threads)
+         */
+        void SetThreadCount(int threadCount);
+
+        int GetThreadCount() const { return static_cast<int>(m_workers.size()) + 1; }
+
+        /**
+         * @brief Call fn(begin, end) over [0, count) in chunks of at least grain indices
+         *
+         * Chunks may run on any thread and in any order; fn must only touch
+         * data owned by its indices. Returns when every chunk is done.
+         */
+        template <typename Fn>
+        void ParallelFor(size_t count, size_t grain, Fn&& fn) {
+            if (count == 0) return;
+            if (grain == 0) grain = 1;
+            if (m_workers.empty() || count <= grain) {
+                fn(size_t(0), count);
+                return;
+            }
+            Run(count, grain, [](void* context, size_t begin, size_t end) {
+                (*static_cast<std::remove_reference_t<Fn>*>(context))(begin, end);
+            }, const_cast<void*>(static_cast<const void*>(&fn)));
+        }
+
+        static int GetHardwareThreads();
+
+    private:
+        using Invoke = void (*)(void* context, size_t begin, size_t end);
+
+        std::vector<std::thread> m_workers;
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+        bool m_stop = false;
+
+        // Current loop (written before m_generation is bumped)
+        Invoke m_invoke = nullptr;
+        void* m_context = nullptr;
+        size_t m_count = 0;
+        size_t m_chunk = 1;
+        std::atomic<size_t> m_nextChunk{ 0 };
+        std::atomic<int> m_busyWorkers{ 0 };
+        std::atomic<uint64_t> m_generation{ 0 };
+
+        void Start(int threadCount);
+        void Stop();
+        void Run(size_t count, size_t grain, Invoke invoke, void* context);
+        void RunChunks();
+        void WorkerLoop(uint64_t seen);
+    };
+
+} // namespace GP2Engine
@@ -20,7 +20,6 @@ namespace GP2Engine {
 
     // Forward declarations for engine systems
     class Sprite;
-    class PhysicsBody;
     class TileMap;
     class TileRenderer;
     class Font;
@@ -86,22 +85,53 @@ namespace GP2Engine {
         bool IsQuad() const { return !IsTextured(); }
     };
 
+    /**
+     * @brief How a physics body takes part in the simulation
+     */
+    enum class BodyType {
+        Static,      // Never moves (walls, floors)
+        Kinematic,   // Moved by its velocity only, pushes dynamic bodies
+        Dynamic      // Moved by velocity, gravity, forces and contacts
+    };
+
+    /**
+     * @brief Collision shape of a physics body, centered on Transform2D position
+     */
+    enum class ColliderShape {
+        Box,
+        Circle
+    };
+
     /**
      * @brief Physics component
      *
-     * Links entity to physics engine PhysicsBody system.
-     * The PhysicsBody is owned and updated by the physics engine.
+     * Describes a rigid body stepped by PhysicsWorld. The world copies these
+     * settings into its own packed arrays when the registry version changes,
+     * so edit shape, size or mass in place only together with
+     * Registry::MarkChanged(). Velocity is read and written every step.
      *
-     * If syncTransform is true, Transform2D will be updated
-     * from PhysicsBody position each frame.
+     * Size and radius are scaled by Transform2D scale. If syncTransform is
+     * true, Transform2D position is updated from the simulation each step.
      */
     struct PhysicsComponent {
-        PhysicsBody* body = nullptr;  // Owned by PhysicsSystem
+        BodyType bodyType = BodyType::Dynamic;
+        ColliderShape shape = ColliderShape::Box;
+        Vector2D size{32.0f, 32.0f};   // Box size (unscaled)
+        float radius = 16.0f;          // Circle radius (unscaled)
+
+        Vector2D velocity{0.0f, 0.0f}; // World units per second
+        float mass = 1.0f;             // Ignored for static and kinematic bodies
+        float restitution = 0.0f;      // Bounciness (0 = no bounce, 1 = perfect bounce)
+        float friction = 0.2f;         // Contact friction coefficient
+        float linearDamping = 0.0f;    // Velocity loss per second
+        float gravityScale = 1.0f;     // Multiplier on world gravity
         bool syncTransform = true;     // Sync with Transform2D
+        bool continuous = false;       // Swept collision against static/kinematic bodies (fast movers)
 
         PhysicsComponent() = default;
-        explicit PhysicsComponent(PhysicsBody* physicsBody) : body(physicsBody) {}
-        PhysicsComponent(PhysicsBody* physicsBody, bool autoSync) : body(physicsBody), syncTransform(autoSync) {}
+        explicit PhysicsComponent(BodyType type) : bodyType(type) {}
+        PhysicsComponent(BodyType type, const Vector2D& boxSize) : bodyType(type), size(boxSize) {}
+        PhysicsComponent(BodyType type, float circleRadius) : bodyType(type), shape(ColliderShape::Circle), radius(circleRadius) {}
     };
 
     /**
@@ -214,6 +244,7 @@ namespace GP2Engine {
 
         // Pathfinding state
         bool usePathfinding = true;              // Enable A* pathfinding
+        bool useFlowField = false;               // Follow the target's shared flow field instead of an own path
         size_t currentPathIndex = 0;             // Current waypoint index
         float pathRecalculateTimer = 0.0f;       // Timer for path recalculation
         float pathRecalculateInterval = 0.5f;    // Recalculate path every N seconds
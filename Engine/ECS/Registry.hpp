@@ -14,9 +14,16 @@
  * - m_cleanedComponents: Tracks which component types have been freshly added
  * - GetComponent returns nullptr for stale components on recycled entities
  * - AddComponent automatically cleans stale data before inserting new components
+ *
+ * Change Version:
+ * Every structural change (entity created/destroyed, component added/removed)
+ * bumps a version counter, so views such as the editor viewport can tell
+ * whether the scene changed since they last looked. Component data edited in
+ * place through GetComponent is not seen; callers doing that call MarkChanged().
  */
 
 #pragma once
+#include <cstdint>
 #include <vector>
 #include <unordered_set>
 #include <unordered_map>
@@ -51,6 +58,7 @@ public:
         }
 
         m_activeEntities.insert(id);
+        ++m_version;
         return id;
     }
 
@@ -63,6 +71,7 @@ public:
             m_reusableIDs.push_back(entity);
             // Reset tracking for this entity
             m_cleanedComponents.erase(entity);
+            ++m_version;
         }
     }
 
@@ -163,6 +172,22 @@ public:
         GetStorage<Tag>().Clear();
         GetStorage<TileMapComponent>().Clear();
         GetStorage<TextComponent>().Clear();
+        ++m_version;
+    }
+
+    /**
+     * @brief Get the scene change version
+     * Changes whenever entities or components are added or removed, or MarkChanged() is called
+     */
+    uint64_t GetVersion() const {
+        return m_version;
+    }
+
+    /**
+     * @brief Report a change the registry cannot see (component data edited in place)
+     */
+    void MarkChanged() {
+        ++m_version;
     }
 
     // ==================== COMPONENT MANAGEMENT ====================
@@ -186,6 +211,7 @@ public:
             m_cleanedComponents[entity].insert(typeID);
         }
 
+        ++m_version;
         return result;
     }
 
@@ -248,6 +274,7 @@ public:
     template<typename T>
     void RemoveComponent(EntityID entity) {
         GetStorage<T>().Erase(entity);
+        ++m_version;
     }
 
     /**
@@ -280,6 +307,7 @@ private:
     EntityID m_nextEntityID = 1;
     std::unordered_set<EntityID> m_activeEntities;
     std::vector<EntityID> m_reusableIDs;
+    uint64_t m_version = 0;  // Bumped on every structural change
 
     // Recycled entity tracking (prevents stale component access)
     std::unordered_set<EntityID> m_dirtyEntities;  // Entity IDs that have been recycled
@@ -17,6 +17,10 @@
 #include <glm/glm.hpp>
 #include <algorithm>
 #include <vector>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <unordered_set>
 
 namespace GP2Engine {
 
@@ -28,11 +32,15 @@ namespace GP2Engine {
     };
 
     void RenderSystem::Render(Registry& registry, Camera& camera) {
-        auto& renderer = Renderer::GetInstance();
+        FramePacket& packet = m_renderThread.BeginFrame();
+        BuildFramePacket(registry, camera, packet);
 
-        // Prepare for rendering (caller is responsible for clearing)
-        renderer.ResetPerformanceCounters();
-        renderer.SetCamera(camera);
+        // Draws this packet, or the previous one when running with a frame of latency
+        m_renderThread.EndFrame(m_renderThread.IsHeadless() ? nullptr : &Renderer::GetInstance());
+    }
+
+    void RenderSystem::BuildFramePacket(Registry& registry, const Camera& camera, FramePacket& packet) {
+        packet.camera = camera;
 
         // === STEP 1: Collect all renderable entities with their render layers ===
         std::vector<RenderableEntity> renderables;
@@ -42,29 +50,37 @@ namespace GP2Engine {
             auto* sprite = registry.GetComponent<SpriteComponent>(entity);
             if (sprite && sprite->visible && registry.GetComponent<Transform2D>(entity)) {
                 renderables.push_back({entity, sprite->renderLayer, RenderableEntity::Type::Sprite});
+            } else if (sprite) {
+                packet.culledObjects++;
             }
 
             // Check for TileMapComponent
             auto* tileMap = registry.GetComponent<TileMapComponent>(entity);
             if (tileMap && tileMap->visible && tileMap->tileMap && tileMap->tileRenderer) {
                 renderables.push_back({entity, tileMap->renderLayer, RenderableEntity::Type::TileMap});
+            } else if (tileMap) {
+                packet.culledObjects++;
             }
 
             // Check for TextComponent
             auto* text = registry.GetComponent<TextComponent>(entity);
             if (text && text->visible && text->font && registry.GetComponent<Transform2D>(entity)) {
                 renderables.push_back({entity, text->renderLayer, RenderableEntity::Type::Text});
+            } else if (text) {
+                packet.culledObjects++;
             }
         }
 
         // === STEP 2: Sort by render layer (lower values render first = background) ===
+        auto sortStart = std::chrono::high_resolution_clock::now();
         std::sort(renderables.begin(), renderables.end(),
             [](const RenderableEntity& a, const RenderableEntity& b) {
                 return a.renderLayer < b.renderLayer;
             });
+        packet.sortMs = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - sortStart).count();
 
-        // === STEP 3: Render in sorted order ===
-        renderer.BeginBatch();
+        // === STEP 3: Flatten into the packet in sorted order ===
+        packet.sprites.reserve(renderables.size());
 
         for (const auto& renderable : renderables) {
             switch (renderable.type) {
@@ -89,7 +105,11 @@ namespace GP2Engine {
 
                     // Use animation UV coordinates if an animation exists (playing or paused), otherwise use component UV
                     glm::vec4 uvCoords;
-                    if (sprite->sprite && !sprite->sprite->GetCurrentAnimationName().empty()) {
+                    const glm::vec4* animatedUV = m_animations ? m_animations->GetUV(renderable.entity) : nullptr;
+                    if (animatedUV) {
+                        // Packed animation state - current frame rectangle is already normalized
+                        uvCoords = *animatedUV;
+                    } else if (sprite->sprite && !sprite->sprite->GetCurrentAnimationName().empty()) {
                         // Animation is active (playing or paused) - use animation frame UVs
                         uvCoords = sprite->sprite->GetSourceRect();
                     } else {
@@ -121,22 +141,13 @@ namespace GP2Engine {
                         }
                     }
 
-                    // Render based on component type (textured sprite or colored quad)
+                    // Textured sprite or colored quad (texture 0)
+                    unsigned int texID = 0;
                     if (sprite->sprite && sprite->sprite->GetTexture()) {
-                        unsigned int texID = sprite->sprite->GetTexture()->GetTextureID();
-
-                        if (shouldBatch) {
-                            renderer.DrawTexturedQuadBatch(position, size, transform->rotation, texID, uvCoords, sprite->color);
-                        } else {
-                            renderer.DrawTexturedQuad(position, size, transform->rotation, texID, uvCoords, sprite->color);
-                        }
-                    } else {
-                        if (shouldBatch) {
-                            renderer.DrawQuadBatch(position, size, transform->rotation, sprite->color);
-                        } else {
-                            renderer.DrawQuad(transform->position, Vector2D(size.x, size.y), transform->rotation, sprite->color);
-                        }
+                        texID = sprite->sprite->GetTexture()->GetTextureID();
                     }
+
+                    packet.AddSprite({position, size, transform->rotation, uvCoords, sprite->color, texID}, shouldBatch);
                     break;
                 }
 
@@ -144,13 +155,8 @@ namespace GP2Engine {
                     auto* tileMapComp = registry.GetComponent<TileMapComponent>(renderable.entity);
                     if (!tileMapComp) continue;
 
-                    // Flush batch before rendering tilemap (tilemaps use their own rendering)
-                    renderer.FlushBatch();
-
-                    // Render the tilemap
-                    tileMapComp->tileRenderer->Render(renderer);
-
-                    // Resume batching for subsequent entities
+                    // Tiles are captured as quads so the packet does not reference the live map
+                    tileMapComp->tileRenderer->AppendToFramePacket(packet);
                     break;
                 }
 
@@ -159,27 +165,130 @@ namespace GP2Engine {
                     auto* transform = registry.GetComponent<Transform2D>(renderable.entity);
                     if (!textComp || !transform) continue;
 
-                    // Flush batch before rendering text (text uses separate rendering)
-                    renderer.FlushBatch();
-
                     // Apply offset to transform if needed
-                    Transform2D adjustedTransform = *transform;
-                    if (textComp->offset.x != 0.0f || textComp->offset.y != 0.0f) {
-                        adjustedTransform.position.x += textComp->offset.x;
-                        adjustedTransform.position.y += textComp->offset.y;
-                    }
-
-                    // Render text
-                    renderer.DrawText(textComp->font.get(), textComp->text, &adjustedTransform,
-                                     textComp->scale, textComp->color);
-
-                    // Resume batching for subsequent entities
+                    PacketText text;
+                    text.font = textComp->font;
+                    text.text = textComp->text;
+                    text.position = glm::vec2(transform->position.x + textComp->offset.x, transform->position.y + textComp->offset.y);
+                    text.rotation = transform->rotation;
+                    text.scale = glm::vec2(transform->scale.x, transform->scale.y);
+                    text.textScale = textComp->scale;
+                    text.color = textComp->color;
+                    packet.AddText(std::move(text));
                     break;
                 }
             }
         }
+    }
+
+    RenderSystem::PipelineBenchmarkResult RenderSystem::RunPipelineBenchmark(Registry& registry, const Camera& camera, int frames) {
+        PipelineBenchmarkResult result;
+        result.frames = frames;
+        if (frames <= 0) {
+            return result;
+        }
+
+        RenderThread pipeline;
+        pipeline.SetHeadless(true);
+
+        auto runFrames = [&]() {
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < frames; ++i) {
+                FramePacket& packet = pipeline.BeginFrame();
+                BuildFramePacket(registry, camera, packet);
+                pipeline.EndFrame(nullptr);
+            }
+            pipeline.Flush();
+            auto elapsed = std::chrono::high_resolution_clock::now() - start;
+            return frames / std::chrono::duration<double>(elapsed).count();
+        };
+
+        // Inline: build and prepare back to back
+        pipeline.SetThreaded(false);
+        pipeline.SetFrameLatency(0);
+        result.inlineFramesPerSec = runFrames();
+
+        RenderThreadStats stats = pipeline.GetStats();
+        result.buildMs = stats.buildMs;
+        result.prepareMs = stats.prepareMs;
+        result.spritesPerFrame = pipeline.GetLastSpriteCount();
+
+        // Threaded: preparing frame N overlaps with building frame N+1
+        pipeline.SetThreaded(true);
+        pipeline.SetFrameLatency(1);
+        result.threadedFramesPerSec = runFrames();
+
+        pipeline.Shutdown();
+        result.speedup = result.inlineFramesPerSec > 0.0 ? result.threadedFramesPerSec / result.inlineFramesPerSec : 0.0;
+        return result;
+    }
+
+    // Collision box of an entity centered at a position (scaled sprite size)
+    static AABB MakeCollisionBox(const Vector2D& position, const SpriteComponent& sprite, const Transform2D& transform) {
+        float scaledWidth = sprite.size.x * transform.scale.x;
+        float scaledHeight = sprite.size.y * transform.scale.y;
+        return AABB(position.x - scaledWidth * 0.5f, position.y - scaledHeight * 0.5f, scaledWidth, scaledHeight);
+    }
+
+    // Non-solid entities (background and stress test objects don't collide)
+    static bool IsSolidTag(const Tag& tag) {
+        return tag.name != "Background" && tag.name != "StressTest";
+    }
+
+    bool EntityCollisionSystem::ComputeBox(Registry& registry, EntityID entity, AABB& box) {
+        auto* sprite = registry.GetComponent<SpriteComponent>(entity);
+        auto* transform = registry.GetComponent<Transform2D>(entity);
+        auto* tag = registry.GetComponent<Tag>(entity);
+        if (!sprite || !transform || !tag || !IsSolidTag(*tag)) return false;
+
+        box = MakeCollisionBox(transform->position, *sprite, *transform);
+        return true;
+    }
+
+    void EntityCollisionSystem::Rebuild(Registry& registry) {
+        m_broadphase.Clear();
+        m_solidEntities.clear();
+
+        AABB box;
+        for (EntityID entity : registry.GetActiveEntities()) {
+            if (ComputeBox(registry, entity, box)) {
+                m_broadphase.Insert(entity, box);
+                m_solidEntities.push_back(entity);
+            }
+        }
+
+        m_syncedRegistry = &registry;
+        m_syncedVersion = registry.GetVersion();
+    }
+
+    void EntityCollisionSystem::Sync(Registry& registry) {
+        if (!IsSynced(registry)) {
+            Rebuild(registry);
+            return;
+        }
+
+        // Same entities and components: only positions and sizes can have changed
+        AABB box;
+        for (EntityID entity : m_solidEntities) {
+            if (ComputeBox(registry, entity, box)) {
+                m_broadphase.Update(entity, box);
+            }
+        }
+    }
+
+    void EntityCollisionSystem::NotifyMoved(Registry& registry, EntityID entity) {
+        // Out of date broadphases are rebuilt on the next query anyway
+        if (!IsSynced(registry) || !m_broadphase.Contains(entity)) return;
+
+        AABB box;
+        if (ComputeBox(registry, entity, box)) {
+            m_broadphase.Update(entity, box);
+        }
+    }
 
-        renderer.EndBatch();
+    void EntityCollisionSystem::SetCellSize(float cellSize) {
+        m_broadphase.SetCellSize(cellSize);
+        m_syncedRegistry = nullptr;
     }
 
     bool EntityCollisionSystem::WouldCollide(Registry& registry, EntityID entity, const Vector2D& testPosition) {
@@ -188,37 +297,101 @@ namespace GP2Engine {
         auto* transform = registry.GetComponent<Transform2D>(entity);
         if (!sprite || !transform) return false;
 
-        // Override collision box size (must match render size above, set to 0 to use JSON size)
-        const float overrideWidth = 0.0f;  // Set to 0 to use actual sprite size
-        const float overrideHeight = 0.0f; // Set to 0 to use actual sprite size
-
-        // Create AABB at test position (centered on entity)
-        float scaledWidth = (overrideWidth > 0 ? overrideWidth : sprite->size.x) * transform->scale.x;
-        float scaledHeight = (overrideHeight > 0 ? overrideHeight : sprite->size.y) * transform->scale.y;
-        AABB testBox(testPosition.x - scaledWidth * 0.5f, testPosition.y - scaledHeight * 0.5f, scaledWidth, scaledHeight);
+        if (!IsSynced(registry)) {
+            Rebuild(registry);
+        }
 
-        // Test against all other entities
-        for (EntityID other : registry.GetActiveEntities()) {
-            if (other == entity) continue;
+        // Create AABB at test position (centered on entity) and test it against nearby solid entities
+        AABB testBox = MakeCollisionBox(testPosition, *sprite, *transform);
+        bool collides = false;
+        m_broadphase.Query(testBox, [&](uint32_t other, const AABB&) {
+            collides = (other != entity);
+            return collides;
+        });
+        return collides;
+    }
 
-            auto* otherSprite = registry.GetComponent<SpriteComponent>(other);
-            auto* otherTransform = registry.GetComponent<Transform2D>(other);
-            auto* otherTag = registry.GetComponent<Tag>(other);
-            if (!otherSprite || !otherTransform || !otherTag) continue;
+    EntityCollisionSystem::BenchmarkResult EntityCollisionSystem::RunBenchmark(size_t entityCount, int queries) {
+        using Clock = std::chrono::high_resolution_clock;
+        BenchmarkResult result;
+        result.entities = entityCount;
+        result.queries = std::max(queries, 1);
+        if (entityCount == 0) return result;
+
+        // Standalone storage: Registry storage is shared by every registry, so
+        // filling one here would leak 100k entities into the running game
+        ComponentStorage<Transform2D> transforms;
+        ComponentStorage<SpriteComponent> sprites;
+        ComponentStorage<Tag> tags;
+        std::unordered_set<EntityID> active;
+
+        // Constant density: one 32x32 box per 96x96 area on average
+        const float worldSize = std::sqrt(static_cast<float>(entityCount)) * 96.0f;
+        std::mt19937 rng(1337);
+        std::uniform_real_distribution<float> coordinate(0.0f, worldSize);
+
+        SpriteComponent sprite;
+        sprite.size = Vector2D(32.0f, 32.0f);
+        for (size_t i = 0; i < entityCount; ++i) {
+            EntityID entity = static_cast<EntityID>(i + 1);
+            transforms.Insert(entity, Transform2D(Vector2D(coordinate(rng), coordinate(rng))));
+            sprites.Insert(entity, sprite);
+            tags.Insert(entity, Tag(i % 10 == 0 ? "Wall" : "Crate"));
+            active.insert(entity);
+        }
 
-            // Skip non-solid entities (background and stress test objects don't collide)
-            if (otherTag->name == "Background" || otherTag->name == "StressTest") continue;
+        std::vector<AABB> testBoxes(static_cast<size_t>(result.queries));
+        for (AABB& box : testBoxes) {
+            box = MakeCollisionBox(Vector2D(coordinate(rng), coordinate(rng)), sprite, Transform2D());
+        }
 
-            // Create AABB for other entity (uses override sizes from outer scope)
-            float otherScaledWidth = (overrideWidth > 0 ? overrideWidth : otherSprite->size.x) * otherTransform->scale.x;
-            float otherScaledHeight = (overrideHeight > 0 ? overrideHeight : otherSprite->size.y) * otherTransform->scale.y;
-            AABB otherBox(otherTransform->position.x - otherScaledWidth * 0.5f, otherTransform->position.y - otherScaledHeight * 0.5f, otherScaledWidth, otherScaledHeight);
+        // Previous path: every query walks every entity with three lookups
+        result.linearQueries = std::max(10, static_cast<int>(static_cast<size_t>(result.queries) * 1000 / std::max<size_t>(entityCount, 1000)));
+        result.linearQueries = std::min(result.linearQueries, result.queries);
+        auto start = Clock::now();
+        for (int q = 0; q < result.linearQueries; ++q) {
+            for (EntityID other : active) {
+                auto* otherSprite = sprites.Retrieve(other);
+                auto* otherTransform = transforms.Retrieve(other);
+                auto* otherTag = tags.Retrieve(other);
+                if (!otherSprite || !otherTransform || !otherTag || !IsSolidTag(*otherTag)) continue;
+
+                if (testBoxes[q].Intersects(MakeCollisionBox(otherTransform->position, *otherSprite, *otherTransform))) break;
+            }
+        }
+        result.linearMicrosPerQuery = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / result.linearQueries;
 
-            // Check intersection using AABB from PhysicsSystem
-            if (testBox.Intersects(otherBox)) return true;
+        // Broadphase build
+        SpatialHash broadphase;
+        start = Clock::now();
+        for (EntityID entity : active) {
+            broadphase.Insert(entity, MakeCollisionBox(transforms.Retrieve(entity)->position, *sprites.Retrieve(entity), *transforms.Retrieve(entity)));
+        }
+        result.buildMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        result.cells = broadphase.GetCellCount();
+
+        // Broadphase queries
+        start = Clock::now();
+        for (int q = 0; q < result.queries; ++q) {
+            bool hit = false;
+            broadphase.Query(testBoxes[q], [&hit](uint32_t, const AABB&) {
+                hit = true;
+                return true;
+            });
+            if (hit) ++result.hits;
+        }
+        result.hashMicrosPerQuery = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / result.queries;
+
+        // Per-frame refresh: every box moves a little, few change cells
+        start = Clock::now();
+        for (EntityID entity : active) {
+            Transform2D* transform = transforms.Retrieve(entity);
+            transform->position.x += 1.0f;
+            broadphase.Update(entity, MakeCollisionBox(transform->position, *sprites.Retrieve(entity), *transform));
         }
+        result.syncMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
 
-        return false;
+        return result;
     }
 
     // ============================================================================
@@ -19,7 +19,10 @@
 #include "Component.hpp"
 #include "../Graphics/Renderer.hpp"
 #include "../Graphics/Camera.hpp"
+#include "../Graphics/RenderThread.hpp"
+#include "../Graphics/AnimationSystem.hpp"
 #include "../Physics/PhysicsSystem.hpp"
+#include "../Physics/SpatialHash.hpp"
 #include "../AI/AISystem.hpp"
 
 namespace GP2Engine {
@@ -34,20 +37,87 @@ namespace GP2Engine {
      * - Automatic batching for entities tagged "StressTest" (performance optimization)
      * - Supports two render modes: Sprite objects, colored quads
      * - Skips invisible entities (sprite->visible = false)
+     * - Builds an immutable FramePacket per frame; preparation can run on a
+     *   render thread with one frame of latency (see RenderThread)
      *
      * Called once per frame from game's Render() method.
      */
     class RenderSystem {
     public:
+        /**
+         * @brief Result of a headless frame pipeline benchmark
+         */
+        struct PipelineBenchmarkResult {
+            int frames = 0;                    ///< Frames per run
+            size_t spritesPerFrame = 0;        ///< Sprites in each packet
+            double inlineFramesPerSec = 0.0;   ///< Build + prepare on the calling thread
+            double threadedFramesPerSec = 0.0; ///< Build overlapped with render thread preparation
+            double buildMs = 0.0;              ///< Average packet build time
+            double prepareMs = 0.0;            ///< Average packet preparation time
+            double speedup = 0.0;              ///< threaded / inline
+        };
+
         RenderSystem() = default;
 
         /**
          * @brief Render all visible entities
          *
+         * Builds this frame's packet and submits it to the render pipeline,
+         * which draws the packet that is due (this frame's, or the previous
+         * one with a frame latency of 1).
+         *
          * @param registry ECS registry containing entities and components
          * @param camera Camera for view/projection transformation
          */
         void Render(Registry& registry, Camera& camera);
+
+        /**
+         * @brief Collect, sort and flatten all visible entities into a packet
+         *
+         * @param registry ECS registry containing entities and components
+         * @param camera Camera for view/projection transformation
+         * @param packet Packet to fill (must be empty)
+         */
+        void BuildFramePacket(Registry& registry, const Camera& camera, FramePacket& packet);
+
+        /**
+         * @brief Get the frame packet pipeline (threading, latency, headless mode)
+         *
+         * @return Reference to the pipeline
+         */
+        RenderThread& GetRenderThread() { return m_renderThread; }
+
+        /**
+         * @brief Take animated UV rectangles from an AnimationSystem
+         *
+         * Entities animated by the system use its current frame instead of
+         * their Sprite's animation or the component UVs.
+         *
+         * @param animations Animation system (nullptr to disable)
+         */
+        void SetAnimationSystem(const AnimationSystem* animations) { m_animations = animations; }
+
+        /**
+         * @brief Stop the render thread and release packets (call before the GL context goes away)
+         */
+        void Shutdown() { m_renderThread.Shutdown(); }
+
+        /**
+         * @brief Measure frame throughput of the pipeline without drawing
+         *
+         * Runs the same scene through a headless pipeline, once preparing
+         * inline and once on a render thread with one frame of latency.
+         *
+         * @param registry ECS registry containing entities and components
+         * @param camera Camera for view/projection transformation
+         * @param frames Frames per run
+         * @return Benchmark result
+         */
+        PipelineBenchmarkResult RunPipelineBenchmark(Registry& registry, const Camera& camera, int frames);
+
+    private:
+        RenderThread m_renderThread;     // Double-buffered packet pipeline
+        const AnimationSystem* m_animations = nullptr;  // Packed animation state (optional)
     };
 
     /**
@@ -57,14 +127,35 @@ namespace GP2Engine {
      * Uses AABB (Axis-Aligned Bounding Box) from Physics/PhysicsSystem.
      *
      * Features:
-     * - Tests collision against all active entities
+     * - Tests collision against all solid entities through a SpatialHash
+     *   broadphase, so a query only looks at nearby cells
      * - Skips Background and StressTest entities (no collision)
      * - Uses entity scale for accurate collision boxes
      *
+     * The broadphase is rebuilt when the registry version changes (entities or
+     * components added/removed, or MarkChanged()). Sync() refreshes the boxes
+     * of moved entities once per frame and NotifyMoved() updates a single
+     * entity right after it was moved, so later queries in the same frame see it.
+     *
      * Typically used for movement validation before updating Transform2D.
      */
     class EntityCollisionSystem {
     public:
+        /**
+         * @brief Result of a broadphase benchmark
+         */
+        struct BenchmarkResult {
+            size_t entities = 0;               ///< Solid entities in the world
+            int queries = 0;                   ///< Broadphase queries timed
+            int linearQueries = 0;             ///< Linear scan queries timed (fewer for large worlds)
+            double linearMicrosPerQuery = 0.0; ///< Old path: scan every entity with three component lookups
+            double hashMicrosPerQuery = 0.0;   ///< Spatial hash query
+            double buildMs = 0.0;              ///< Time to insert every entity into the hash
+            double syncMs = 0.0;               ///< Time to refresh every box once (per-frame Sync cost)
+            size_t cells = 0;                  ///< Occupied grid cells
+            int hits = 0;                      ///< Broadphase queries that found a collision
+        };
+
         EntityCollisionSystem() = default;
 
         /**
@@ -76,6 +167,63 @@ namespace GP2Engine {
          * @return true if collision would occur, false otherwise
          */
         bool WouldCollide(Registry& registry, EntityID entity, const Vector2D& testPosition);
+
+        /**
+         * @brief Bring the broadphase up to date (call once per frame before querying)
+         *
+         * Rebuilds after structural registry changes, otherwise refreshes the
+         * boxes of solid entities; only those that changed cells are re-bucketed.
+         *
+         * @param registry ECS registry
+         */
+        void Sync(Registry& registry);
+
+        /**
+         * @brief Update one entity's box after moving it
+         *
+         * @param registry ECS registry
+         * @param entity Entity whose Transform2D changed
+         */
+        void NotifyMoved(Registry& registry, EntityID entity);
+
+        /**
+         * @brief Set the broadphase cell size (rebuilds on the next query)
+         *
+         * @param cellSize Cell size in world units
+         */
+        void SetCellSize(float cellSize);
+
+        /**
+         * @brief Get the broadphase
+         *
+         * @return Spatial hash of solid entities
+         */
+        const SpatialHash& GetBroadphase() const { return m_broadphase; }
+
+        /**
+         * @brief Compare linear scan and spatial hash queries on a synthetic world
+         *
+         * Scatters entityCount solid boxes at constant density (world area grows
+         * with the count) and times player-sized WouldCollide queries both ways.
+         * Uses standalone component storage so the game's registry is untouched.
+         *
+         * @param entityCount Solid entities in the world
+         * @param queries Queries to time
+         * @return Benchmark result
+         */
+        static BenchmarkResult RunBenchmark(size_t entityCount, int queries);
+
+    private:
+        SpatialHash m_broadphase;                 // Boxes of solid entities
+        std::vector<EntityID> m_solidEntities;    // Entities in the broadphase
+        const Registry* m_syncedRegistry = nullptr;
+        uint64_t m_syncedVersion = 0;
+
+        bool IsSynced(const Registry& registry) const {
+            return m_syncedRegistry == &registry && m_syncedVersion == registry.GetVersion();
+        }
+        void Rebuild(Registry& registry);
+        static bool ComputeBox(Registry& registry, EntityID entity, AABB& box);
     };
 
     /**
@@ -6,6 +6,8 @@
 #include "Core/EventSystem.hpp"
 #include "Core/Input.hpp"
 #include "Core/Time.hpp"
+#include "Core/FixedTimestep.hpp"
+#include "Core/WorkerPool.hpp"
 #include "Core/Logger.hpp"
 #include "Core/Profiler.hpp"
 #include "Core/Layer.hpp"
@@ -22,10 +24,19 @@
 #include "Graphics/Renderer.hpp"
 #include "Graphics/DebugRenderer.hpp"
 #include "Graphics/Shader.hpp"
+#include "Graphics/ShaderCache.hpp"
+#include "Graphics/UniformBuffer.hpp"
 #include "Graphics/Sprite.hpp"
 #include "Graphics/Texture.hpp"
 #include "Graphics/Font.hpp"
 #include "Graphics/Framebuffer.hpp"
+#include "Graphics/QuadKernel.hpp"
+#include "Graphics/FramePacket.hpp"
+#include "Graphics/RenderStats.hpp"
+#include "Graphics/RenderThread.hpp"
+#include "Graphics/SoftwareRasterizer.hpp"
+#include "Graphics/AnimationClipLibrary.hpp"
+#include "Graphics/AnimationSystem.hpp"
 
 // Audio modules
 #include "Audio/AudioEngine.hpp"
@@ -37,6 +48,11 @@
 
 // Physics modules
 #include "Physics/PhysicsSystem.hpp"
+#include "Physics/SpatialHash.hpp"
+#include "Physics/AABBTree.hpp"
+#include "Physics/PhysicsWorld.hpp"
+#include "Physics/TileCollision.hpp"
+#include "Physics/PhysicsReplay.hpp"
 
 // Serialization modules
 #include "Serialization/ConfigLoader.hpp"
@@ -52,6 +68,11 @@
 
 // AI modules (integrated with ECS)
 #include "AI/AISystem.hpp"
+#include "AI/NavGrid.hpp"
+#include "AI/GridPathfinder.hpp"
+#include "AI/FlowField.hpp"
+#include "AI/HierarchicalPathfinder.hpp"
+#include "AI/PathRequestQueue.hpp"
 
 // UI modules
 #include "UI/MainMenu.h"
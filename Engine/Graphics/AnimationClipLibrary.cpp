@@ -0,0 +1,139 @@
+/**
+ * @file AnimationClipLibrary.cpp
+ * @brief Animation clip library implementation
+ * @author Asri (100%)
+ *
+ * This file contains the implementation of the AnimationClipLibrary class.
+ */
+
+#include "AnimationClipLibrary.hpp"
+#include "Sprite.hpp"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+namespace GP2Engine {
+
+    bool SpriteSheetMeta::LoadFromFile(const std::string& filepath) {
+        std::ifstream file(filepath);
+        if (!file.is_open()) {
+            std::cerr << "SpriteSheetMeta: Could not open " << filepath << std::endl;
+            return false;
+        }
+
+        try {
+            nlohmann::json json = nlohmann::json::parse(file);
+            texture = json.value("texture", "");
+            rows = json.value("rows", 1);
+            columns = json.value("columns", 1);
+            tileWidth = json.value("tile_width", 0);
+            tileHeight = json.value("tile_height", 0);
+        } catch (const std::exception& e) {
+            std::cerr << "SpriteSheetMeta: Failed to parse " << filepath << ": " << e.what() << std::endl;
+            return false;
+        }
+
+        if (rows <= 0 || columns <= 0 || tileWidth <= 0 || tileHeight <= 0) {
+            std::cerr << "SpriteSheetMeta: " << filepath << " describes no tiles" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    AnimationClipID AnimationClipLibrary::AddClip(const std::string& name, const std::vector<AnimationFrame>& frames,
+                                                  bool loop, const glm::vec2& textureSize) {
+        if (frames.empty() || textureSize.x <= 0.0f || textureSize.y <= 0.0f) {
+            std::cerr << "AnimationClipLibrary: Cannot add clip '" << name << "' (no frames or invalid texture size)" << std::endl;
+            return INVALID_ANIMATION_CLIP;
+        }
+
+        // A replaced clip gives its frames back first, so re-adding a clip never grows the arrays
+        auto it = m_ClipsByName.find(name);
+        if (it != m_ClipsByName.end()) {
+            RemoveFrames(m_Clips[it->second]);
+        }
+
+        AnimationClip clip;
+        clip.name = name;
+        clip.firstFrame = static_cast<uint32_t>(m_FrameUVs.size());
+        clip.frameCount = static_cast<uint32_t>(frames.size());
+        clip.loop = loop;
+
+        for (const AnimationFrame& frame : frames) {
+            m_FrameUVs.emplace_back(frame.sourcePosition.x / textureSize.x,
+                                    frame.sourcePosition.y / textureSize.y,
+                                    frame.sourceSize.x / textureSize.x,
+                                    frame.sourceSize.y / textureSize.y);
+
+            // A zero duration would never let the timer catch up
+            const float duration = std::max(frame.duration, MIN_FRAME_DURATION);
+            m_FrameDurations.push_back(duration);
+            clip.totalDuration += duration;
+        }
+
+        if (it != m_ClipsByName.end()) {
+            m_Clips[it->second] = clip;
+            return it->second;
+        }
+
+        AnimationClipID id = static_cast<AnimationClipID>(m_Clips.size());
+        m_Clips.push_back(clip);
+        m_ClipsByName[name] = id;
+        return id;
+    }
+
+    void AnimationClipLibrary::RemoveFrames(AnimationClip& clip) {
+        const uint32_t begin = clip.firstFrame;
+        const uint32_t end = begin + clip.frameCount;
+        m_FrameUVs.erase(m_FrameUVs.begin() + begin, m_FrameUVs.begin() + end);
+        m_FrameDurations.erase(m_FrameDurations.begin() + begin, m_FrameDurations.begin() + end);
+
+        // Clips stored after the removed range move down to close the gap
+        for (AnimationClip& other : m_Clips) {
+            if (other.firstFrame >= end) other.firstFrame -= clip.frameCount;
+        }
+        clip.firstFrame = 0;
+        clip.frameCount = 0;
+    }
+
+    AnimationClipID AnimationClipLibrary::AddSheetClip(const std::string& name, const SpriteSheetMeta& meta, float frameDuration, bool loop) {
+        const glm::vec2 tileSize(static_cast<float>(meta.tileWidth), static_cast<float>(meta.tileHeight));
+        const glm::vec2 sheetSize(tileSize.x * static_cast<float>(meta.columns), tileSize.y * static_cast<float>(meta.rows));
+
+        std::vector<AnimationFrame> frames;
+        frames.reserve(static_cast<size_t>(std::max(meta.rows * meta.columns, 0)));
+        for (int row = 0; row < meta.rows; ++row) {
+            for (int column = 0; column < meta.columns; ++column) {
+                frames.emplace_back(glm::vec2(column * tileSize.x, row * tileSize.y), tileSize, frameDuration);
+            }
+        }
+
+        return AddClip(name, frames, loop, sheetSize);
+    }
+
+    AnimationClipID AnimationClipLibrary::AddSheetClip(const std::string& name, const std::string& metaPath, float frameDuration, bool loop) {
+        SpriteSheetMeta meta;
+        if (!meta.LoadFromFile(metaPath)) {
+            return INVALID_ANIMATION_CLIP;
+        }
+        return AddSheetClip(name, meta, frameDuration, loop);
+    }
+
+    AnimationClipID AnimationClipLibrary::FindClip(const std::string& name) const {
+        auto it = m_ClipsByName.find(name);
+        return it != m_ClipsByName.end() ? it->second : INVALID_ANIMATION_CLIP;
+    }
+
+    const AnimationClip* AnimationClipLibrary::GetClip(AnimationClipID id) const {
+        return id < m_Clips.size() ? &m_Clips[id] : nullptr;
+    }
+
+    void AnimationClipLibrary::Clear() {
+        m_Clips.clear();
+        m_FrameUVs.clear();
+        m_FrameDurations.clear();
+        m_ClipsByName.clear();
+    }
+
+} // namespace GP2Engine
@@ -0,0 +1,169 @@
+/**
+ * @file AnimationClipLibrary.hpp
+ * @brief Flattened sprite animation clips addressed by integer ID
+ * @author Asri (100%)
+ *
+ * This file contains the AnimationClipLibrary class which stores animation
+ * clips as ranges into flat arrays of frame UV rectangles and durations. Frame
+ * rectangles are normalized once when a clip is added, so playback never has
+ * to look up a texture or an animation name. Clips can be generated from the
+ * sprite sheet .meta.json files written by the editor's Sprite Editor.
+ *
+ * Once built, a library is meant to be shared read-only
+ * (std::shared_ptr<const AnimationClipLibrary>) by every sprite using its
+ * sheets, so per-instance memory does not grow with the number of frames.
+ */
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+namespace GP2Engine {
+
+    struct AnimationFrame;
+
+    using AnimationClipID = uint32_t;
+    constexpr AnimationClipID INVALID_ANIMATION_CLIP = 0xFFFFFFFFu;
+
+    /**
+     * @brief One clip: a range of frames in the library
+     */
+    struct AnimationClip {
+        std::string name;              ///< Clip name
+        uint32_t firstFrame{0};        ///< First frame in the library's frame arrays
+        uint32_t frameCount{0};        ///< Number of frames
+        float totalDuration{0.0f};     ///< Sum of the frame durations in seconds
+        bool loop{true};               ///< Whether the clip loops
+    };
+
+    /**
+     * @brief Sprite sheet layout from a .meta.json file
+     *
+     * Tiles are laid out in a rows x columns grid starting at the top-left
+     * corner; the sheet is assumed to be exactly that grid.
+     */
+    struct SpriteSheetMeta {
+        std::string texture;       ///< Texture file name
+        int rows{1};               ///< Tile rows
+        int columns{1};            ///< Tile columns
+        int tileWidth{0};          ///< Tile width in pixels
+        int tileHeight{0};         ///< Tile height in pixels
+
+        /**
+         * @brief Load the layout from a .meta.json file
+         *
+         * @param filepath Path to the meta file (e.g. "textures/SS_Idle.png.meta.json")
+         * @return true if the file was read and describes at least one tile
+         */
+        bool LoadFromFile(const std::string& filepath);
+    };
+
+    /**
+     * @brief Storage for animation clips shared by all animated entities
+     *
+     * @author Asri (100%)
+     */
+    class AnimationClipLibrary {
+    public:
+        static constexpr float MIN_FRAME_DURATION = 1.0f / 1000.0f;   ///< Shorter frames are clamped
+
+        AnimationClipLibrary() = default;
+
+        /**
+         * @brief Add a clip from pixel-space frames
+         *
+         * Adding a name that already exists replaces that clip and keeps its ID;
+         * the old frames are removed, so frame ranges of other clips may move.
+         *
+         * @param name Clip name
+         * @param frames Frames in PIXEL coordinates (same as Sprite::AddAnimation)
+         * @param loop Whether the clip loops
+         * @param textureSize Size of the sprite sheet in pixels
+         * @return Clip ID, or INVALID_ANIMATION_CLIP if frames is empty or textureSize is zero
+         */
+        AnimationClipID AddClip(const std::string& name, const std::vector<AnimationFrame>& frames,
+                                bool loop, const glm::vec2& textureSize);
+
+        /**
+         * @brief Add a clip that plays every tile of a sprite sheet in row-major order
+         *
+         * @param name Clip name
+         * @param meta Sheet layout
+         * @param frameDuration Duration of each frame in seconds
+         * @param loop Whether the clip loops
+         * @return Clip ID, or INVALID_ANIMATION_CLIP if the layout is empty
+         */
+        AnimationClipID AddSheetClip(const std::string& name, const SpriteSheetMeta& meta, float frameDuration, bool loop);
+
+        /**
+         * @brief Add a clip from a sprite sheet .meta.json file
+         *
+         * @param name Clip name
+         * @param metaPath Path to the meta file
+         * @param frameDuration Duration of each frame in seconds
+         * @param loop Whether the clip loops
+         * @return Clip ID, or INVALID_ANIMATION_CLIP if the file could not be loaded
+         */
+        AnimationClipID AddSheetClip(const std::string& name, const std::string& metaPath, float frameDuration, bool loop);
+
+        /**
+         * @brief Find a clip by name
+         *
+         * @param name Clip name
+         * @return Clip ID, or INVALID_ANIMATION_CLIP if not found
+         */
+        AnimationClipID FindClip(const std::string& name) const;
+
+        /**
+         * @brief Get a clip
+         *
+         * @param id Clip ID
+         * @return Pointer to the clip, or nullptr if the ID is invalid
+         */
+        const AnimationClip* GetClip(AnimationClipID id) const;
+
+        /**
+         * @brief Get number of clips
+         *
+         * @return Clip count
+         */
+        size_t GetClipCount() const { return m_Clips.size(); }
+
+        /**
+         * @brief Get the normalized UV rectangle (x, y, width, height) of every frame
+         *
+         * @return Frame rectangles, indexed by AnimationClip::firstFrame + frame
+         */
+        const std::vector<glm::vec4>& GetFrameUVs() const { return m_FrameUVs; }
+
+        /**
+         * @brief Get the duration of every frame
+         *
+         * @return Frame durations in seconds, indexed like GetFrameUVs()
+         */
+        const std::vector<float>& GetFrameDurations() const { return m_FrameDurations; }
+
+        /**
+         * @brief Remove all clips (invalidates every clip ID)
+         */
+        void Clear();
+
+    private:
+        /**
+         * @brief Erase a clip's frames and close the gap in the frame arrays
+         *
+         * @param clip Clip whose range is removed (left empty)
+         */
+        void RemoveFrames(AnimationClip& clip);
+
+        std::vector<AnimationClip> m_Clips;                                ///< Clips indexed by ID
+        std::vector<glm::vec4> m_FrameUVs;                                 ///< Frame rectangles of all clips
+        std::vector<float> m_FrameDurations;                               ///< Frame durations of all clips
+        std::unordered_map<std::string, AnimationClipID> m_ClipsByName;    ///< Name -> clip ID
+    };
+
+} // namespace GP2Engine
@@ -3,296 +3,85 @@
  * @brief Helper functions for setting up sprite animations
  * @author Asri (100%)
  *
- * Provides inline utility functions for configuring sprite sheet animations
- * specific to Hollows game assets. Includes setup for player walk/idle animations
- * and monster movement animations using 6-frame, 512x512 sprite sheets.
+ * Provides the shared animation clip libraries for Hollows game assets. Clips
+ * are generated from the sprite sheets' .meta.json files (rows, columns and
+ * tile size), so frame layout is defined once per sheet instead of being
+ * copied into every sprite.
  */
 
 #pragma once
 
 #include <Engine.hpp>
+#include <initializer_list>
 
 namespace Hollows {
 
     /**
-     * @brief Setup walk left animation for sprite
-     * @param sprite Sprite to add animation to
-     *
-     * Configures a 6-frame walk left animation from a 3072x512 sprite sheet
-     * where each frame is 512x512 pixels arranged horizontally.
-     */
-    inline void SetupWalkLeftAnimation(GP2Engine::Sprite& sprite) {
-        using namespace GP2Engine;
-
-        // Create animation frames for 6-frame walk cycle
-        std::vector<AnimationFrame> frames;
-
-        const float frameWidth = 512.0f;
-        const float frameHeight = 512.0f;
-        const float frameDuration = 0.1f; // 10 FPS
-
-        // Add all 6 frames (arranged horizontally left to right)
-        for (int i = 0; i < 6; ++i) {
-            float frameX = i * frameWidth;
-            float frameY = 0.0f;
-
-            frames.emplace_back(
-                glm::vec2(frameX, frameY),           // sourcePosition (pixel coordinates)
-                glm::vec2(frameWidth, frameHeight),  // sourceSize (pixel coordinates)
-                frameDuration                        // duration
-            );
-        }
-
-        // Add the animation to the sprite with looping enabled
-        sprite.AddAnimation("walk_left", frames, true);
-    }
-
-    /**
-     * @brief Setup walk right animation for sprite
-     * @param sprite Sprite to add animation to
-     *
-     * Configures a 6-frame walk right animation from a 3072x512 sprite sheet
-     * where each frame is 512x512 pixels arranged horizontally.
-     */
-    inline void SetupWalkRightAnimation(GP2Engine::Sprite& sprite) {
-        using namespace GP2Engine;
-
-        // Create animation frames for 6-frame walk cycle
-        std::vector<AnimationFrame> frames;
-
-        const float frameWidth = 512.0f;
-        const float frameHeight = 512.0f;
-        const float frameDuration = 0.1f; // 10 FPS
-
-        // Add all 6 frames (arranged horizontally left to right)
-        for (int i = 0; i < 6; ++i) {
-            float frameX = i * frameWidth;
-            float frameY = 0.0f;
-
-            frames.emplace_back(
-                glm::vec2(frameX, frameY),           // sourcePosition (pixel coordinates)
-                glm::vec2(frameWidth, frameHeight),  // sourceSize (pixel coordinates)
-                frameDuration                        // duration
-            );
-        }
-
-        // Add the animation to the sprite with looping enabled
-        sprite.AddAnimation("walk_right", frames, true);
-    }
-
-    /**
-     * @brief Setup walk up animation for sprite
-     * @param sprite Sprite to add animation to
-     *
-     * Configures a 6-frame walk up animation from a 3072x512 sprite sheet
-     * where each frame is 512x512 pixels arranged horizontally.
-     */
-    inline void SetupWalkUpAnimation(GP2Engine::Sprite& sprite) {
-        using namespace GP2Engine;
-
-        // Create animation frames for 6-frame walk cycle
-        std::vector<AnimationFrame> frames;
-
-        const float frameWidth = 512.0f;
-        const float frameHeight = 512.0f;
-        const float frameDuration = 0.1f; // 10 FPS
-
-        // Add all 6 frames (arranged horizontally left to right)
-        for (int i = 0; i < 6; ++i) {
-            float frameX = i * frameWidth;
-            float frameY = 0.0f;
-
-            frames.emplace_back(
-                glm::vec2(frameX, frameY),           // sourcePosition (pixel coordinates)
-                glm::vec2(frameWidth, frameHeight),  // sourceSize (pixel coordinates)
-                frameDuration                        // duration
-            );
-        }
-
-        // Add the animation to the sprite with looping enabled
-        sprite.AddAnimation("walk_up", frames, true);
-    }
-
-    /**
-     * @brief Setup walk down animation for sprite
-     * @param sprite Sprite to add animation to
-     *
-     * Configures a 6-frame walk down animation from a 3072x512 sprite sheet
-     * where each frame is 512x512 pixels arranged horizontally.
-     */
-    inline void SetupWalkDownAnimation(GP2Engine::Sprite& sprite) {
-        using namespace GP2Engine;
-
-        // Create animation frames for 6-frame walk cycle
-        std::vector<AnimationFrame> frames;
-
-        const float frameWidth = 512.0f;
-        const float frameHeight = 512.0f;
-        const float frameDuration = 0.1f; // 10 FPS
-
-        // Add all 6 frames (arranged horizontally left to right)
-        for (int i = 0; i < 6; ++i) {
-            float frameX = i * frameWidth;
-            float frameY = 0.0f;
-
-            frames.emplace_back(
-                glm::vec2(frameX, frameY),           // sourcePosition (pixel coordinates)
-                glm::vec2(frameWidth, frameHeight),  // sourceSize (pixel coordinates)
-                frameDuration                        // duration
-            );
-        }
-
-        // Add the animation to the sprite with looping enabled
-        sprite.AddAnimation("walk_down", frames, true);
-    }
-
-    /**
-     * @brief Setup idle animation for sprite
-     * @param sprite Sprite to add animation to
-     *
-     * Configures a 6-frame idle animation from a 3072x512 sprite sheet
-     * where each frame is 512x512 pixels arranged horizontally.
+     * @brief One clip generated from a whole sprite sheet
      */
-    inline void SetupIdleAnimation(GP2Engine::Sprite& sprite) {
-        using namespace GP2Engine;
-
-        // Create animation frames for 6-frame idle cycle
-        std::vector<AnimationFrame> frames;
-
-        const float frameWidth = 512.0f;
-        const float frameHeight = 512.0f;
-        const float frameDuration = 0.15f; // Slightly slower than walk for idle
-
-        // Add all 6 frames (arranged horizontally left to right)
-        for (int i = 0; i < 6; ++i) {
-            float frameX = i * frameWidth;
-            float frameY = 0.0f;
-
-            frames.emplace_back(
-                glm::vec2(frameX, frameY),           // sourcePosition (pixel coordinates)
-                glm::vec2(frameWidth, frameHeight),  // sourceSize (pixel coordinates)
-                frameDuration                        // duration
-            );
-        }
-
-        // Add the animation to the sprite with looping enabled
-        sprite.AddAnimation("idle", frames, true);
-    }
+    struct SheetClip {
+        const char* name;          ///< Clip name passed to Sprite::PlayAnimation
+        const char* sheet;         ///< Texture path relative to the asset base path
+        float frameDuration;       ///< Seconds per frame
+    };
 
     /**
-     * @brief Setup monster walk left animation for horizontal sprite sheet
-     * @param sprite Sprite to add animation to
+     * @brief Build (or reuse) a shared clip library from sprite sheet meta files
+     * @param cache Weak reference to the library handed out last time
+     * @param clips Clips to generate (all looping)
+     * @return Shared read-only library
      *
-     * Configures a 6-frame walk left animation for monster horizontal sprite.
+     * The library stays alive as long as a sprite references it and is only
+     * rebuilt after the last reference is released.
      */
-    inline void SetupMonsterWalkLeftAnimation(GP2Engine::Sprite& sprite) {
-        using namespace GP2Engine;
-
-        std::vector<AnimationFrame> frames;
-
-        const float frameWidth = 512.0f;
-        const float frameHeight = 512.0f;
-        const float frameDuration = 0.1f; // 10 FPS
-
-        for (int i = 0; i < 6; ++i) {
-            float frameX = i * frameWidth;
-            float frameY = 0.0f;
-
-            frames.emplace_back(
-                glm::vec2(frameX, frameY),
-                glm::vec2(frameWidth, frameHeight),
-                frameDuration
-            );
+    inline std::shared_ptr<const GP2Engine::AnimationClipLibrary> GetSharedSheetClips(
+        std::weak_ptr<const GP2Engine::AnimationClipLibrary>& cache, std::initializer_list<SheetClip> clips) {
+        if (auto shared = cache.lock()) {
+            return shared;
         }
 
-        sprite.AddAnimation("monster_walk_left", frames, true);
-    }
-
-    /**
-     * @brief Setup monster walk right animation for horizontal sprite sheet
-     * @param sprite Sprite to add animation to
-     *
-     * Configures a 6-frame walk right animation for monster horizontal sprite.
-     */
-    inline void SetupMonsterWalkRightAnimation(GP2Engine::Sprite& sprite) {
-        using namespace GP2Engine;
-
-        std::vector<AnimationFrame> frames;
-
-        const float frameWidth = 512.0f;
-        const float frameHeight = 512.0f;
-        const float frameDuration = 0.1f; // 10 FPS
-
-        for (int i = 0; i < 6; ++i) {
-            float frameX = i * frameWidth;
-            float frameY = 0.0f;
-
-            frames.emplace_back(
-                glm::vec2(frameX, frameY),
-                glm::vec2(frameWidth, frameHeight),
-                frameDuration
-            );
+        const std::string& basePath = GP2Engine::ResourceManager::GetInstance().GetBasePath();
+        auto library = std::make_shared<GP2Engine::AnimationClipLibrary>();
+        for (const SheetClip& clip : clips) {
+            if (library->AddSheetClip(clip.name, basePath + clip.sheet + ".meta.json", clip.frameDuration, true) == GP2Engine::INVALID_ANIMATION_CLIP) {
+                std::cerr << "ERROR: Failed to build animation clip '" << clip.name << "' from " << clip.sheet << std::endl;
+            }
         }
 
-        sprite.AddAnimation("monster_walk_right", frames, true);
+        std::shared_ptr<const GP2Engine::AnimationClipLibrary> shared = library;
+        cache = shared;
+        return shared;
     }
 
     /**
-     * @brief Setup monster walk up animation for vertical sprite sheet
-     * @param sprite Sprite to add animation to
+     * @brief Get the player's animation clips
+     * @return Library with walk_right, walk_up, walk_down and idle
      *
-     * Configures a 6-frame walk up animation for monster vertical sprite.
+     * Each clip plays every tile of the matching sprite sheet. walk_right is
+     * flipped for walking left.
      */
-    inline void SetupMonsterWalkUpAnimation(GP2Engine::Sprite& sprite) {
-        using namespace GP2Engine;
-
-        std::vector<AnimationFrame> frames;
-
-        const float frameWidth = 512.0f;
-        const float frameHeight = 512.0f;
-        const float frameDuration = 0.1f; // 10 FPS
-
-        for (int i = 0; i < 6; ++i) {
-            float frameX = i * frameWidth;
-            float frameY = 0.0f;
-
-            frames.emplace_back(
-                glm::vec2(frameX, frameY),
-                glm::vec2(frameWidth, frameHeight),
-                frameDuration
-            );
-        }
-
-        sprite.AddAnimation("monster_walk_up", frames, true);
+    inline std::shared_ptr<const GP2Engine::AnimationClipLibrary> GetPlayerAnimationClips() {
+        static std::weak_ptr<const GP2Engine::AnimationClipLibrary> cache;
+        return GetSharedSheetClips(cache, {
+            { "walk_right", "textures/SS_Walk_Horizontal.png", 0.1f },   // 10 FPS
+            { "walk_up",    "textures/SS_Walk_Up_01.png",      0.1f },
+            { "walk_down",  "textures/SS_Walk_Vertical.png",   0.1f },
+            { "idle",       "textures/SS_Idle.png",            0.15f }   // Slightly slower than walk for idle
+        });
     }
 
     /**
-     * @brief Setup monster walk down animation for vertical sprite sheet
-     * @param sprite Sprite to add animation to
-     *
-     * Configures a 6-frame walk down animation for monster vertical sprite.
+     * @brief Get the monster's animation clips
+     * @return Library with monster_walk_left, monster_walk_right, monster_walk_up and monster_walk_down
      */
-    inline void SetupMonsterWalkDownAnimation(GP2Engine::Sprite& sprite) {
-        using namespace GP2Engine;
-
-        std::vector<AnimationFrame> frames;
-
-        const float frameWidth = 512.0f;
-        const float frameHeight = 512.0f;
-        const float frameDuration = 0.1f; // 10 FPS
-
-        for (int i = 0; i < 6; ++i) {
-            float frameX = i * frameWidth;
-            float frameY = 0.0f;
-
-            frames.emplace_back(
-                glm::vec2(frameX, frameY),
-                glm::vec2(frameWidth, frameHeight),
-                frameDuration
-            );
-        }
-
-        sprite.AddAnimation("monster_walk_down", frames, true);
+    inline std::shared_ptr<const GP2Engine::AnimationClipLibrary> GetMonsterAnimationClips() {
+        static std::weak_ptr<const GP2Engine::AnimationClipLibrary> cache;
+        return GetSharedSheetClips(cache, {
+            { "monster_walk_left",  "textures/SS_Monster_Side_Horizontal.png", 0.1f },   // 10 FPS
+            { "monster_walk_right", "textures/SS_Monster_Side_Horizontal.png", 0.1f },
+            { "monster_walk_up",    "textures/SS_Monster_Vertical.png",        0.1f },
+            { "monster_walk_down",  "textures/SS_Monster_Vertical.png",        0.1f }
+        });
     }
 
 } // namespace Hollows
@@ -0,0 +1,223 @@
+/**
+ * @file AnimationSystem.hpp
+ * @brief Sprite animation playback on packed per-entity state
+ * @author Asri (100%)
+ *
+ * This file contains the AnimationSystem class which stores the animation
+ * state of every animated entity (clip, frame, timer, playback rate and the
+ * current UV rectangle) in parallel arrays. One Update advances all timers in
+ * a single branch-free pass and only touches the remaining state of the
+ * entities whose frame actually changes. RenderSystem copies the resulting UV
+ * rectangles straight into the frame packet, so drawing an animated sprite no
+ * longer involves a name lookup.
+ */
+
+#pragma once
+
+#include "AnimationClipLibrary.hpp"
+#include "../ECS/Entity.hpp"
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace GP2Engine {
+
+    /**
+     * @brief Animation state of all animated entities, stored structure-of-arrays
+     *
+     * Entities are attached with Play() and detached with Remove(); the
+     * system does not watch the registry, so whoever destroys an animated
+     * entity removes its animation too. Clips come from the system's
+     * AnimationClipLibrary.
+     *
+     * @code
+     * AnimationClipID walk = animations.GetClips().AddClip("walk", frames, true, textureSize);
+     * animations.Play(entity, walk);
+     * // every frame:
+     * animations.Update(deltaTime);
+     * @endcode
+     *
+     * @author Asri (100%)
+     */
+    class AnimationSystem {
+    public:
+        /**
+         * @brief Result of an animation update benchmark run
+         */
+        struct BenchmarkResult {
+            size_t spriteCount = 0;        ///< Animated sprites
+            int frames = 0;                ///< Simulated frames
+            double legacyMs = 0.0;         ///< Per frame: Sprite::UpdateAnimation + name/rect lookups
+            double packedUpdateMs = 0.0;   ///< Per frame: AnimationSystem::Update
+            double packedReadMs = 0.0;     ///< Per frame: reading every UV rectangle by entity
+            double speedup = 0.0;          ///< legacy / (packed update + read)
+        };
+
+        AnimationSystem() = default;
+
+        /**
+         * @brief Get the clip library
+         *
+         * @return Reference to the clips played by this system
+         */
+        AnimationClipLibrary& GetClips() { return m_clips; }
+        const AnimationClipLibrary& GetClips() const { return m_clips; }
+
+        /**
+         * @brief Start playing a clip on an entity
+         *
+         * Like Sprite::PlayAnimation, a clip that is already playing on the
+         * entity keeps running instead of restarting.
+         *
+         * @param entity Entity to animate
+         * @param clip Clip to play
+         * @param startTime Time into the clip to start at, in seconds (staggers identical entities)
+         * @return true if the clip exists
+         */
+        bool Play(EntityID entity, AnimationClipID clip, float startTime = 0.0f);
+
+        /**
+         * @brief Stop advancing an entity's animation (keeps the current frame)
+         *
+         * @param entity Animated entity
+         */
+        void Pause(EntityID entity);
+
+        /**
+         * @brief Continue a paused animation
+         *
+         * @param entity Animated entity
+         */
+        void Resume(EntityID entity);
+
+        /**
+         * @brief Set playback speed of an entity's animation
+         *
+         * @param entity Animated entity
+         * @param speed Speed multiplier (1 = authored frame durations)
+         */
+        void SetSpeed(EntityID entity, float speed);
+
+        /**
+         * @brief Detach an entity from the system
+         *
+         * @param entity Entity to remove (ignored if it is not animated)
+         */
+        void Remove(EntityID entity);
+
+        /**
+         * @brief Detach every entity (clips are kept)
+         */
+        void Clear();
+
+        /**
+         * @brief Advance all animations
+         *
+         * @param deltaTime Frame time in seconds
+         */
+        void Update(float deltaTime);
+
+        /**
+         * @brief Check if an entity is animated by this system
+         *
+         * @param entity Entity to check
+         * @return true if the entity has animation state
+         */
+        bool Has(EntityID entity) const { return GetIndex(entity) != INVALID_INDEX; }
+
+        /**
+         * @brief Get the UV rectangle of an entity's current frame
+         *
+         * @param entity Animated entity
+         * @return Normalized rectangle (x, y, width, height), or nullptr if the entity is not animated
+         */
+        const glm::vec4* GetUV(EntityID entity) const {
+            const uint32_t index = GetIndex(entity);
+            return index != INVALID_INDEX ? &m_uv[index] : nullptr;
+        }
+
+        /**
+         * @brief Get the clip playing on an entity
+         *
+         * @param entity Animated entity
+         * @return Clip ID, or INVALID_ANIMATION_CLIP if the entity is not animated
+         */
+        AnimationClipID GetClip(EntityID entity) const;
+
+        /**
+         * @brief Get an entity's frame within its clip
+         *
+         * @param entity Animated entity
+         * @return Frame index, or -1 if the entity is not animated
+         */
+        int GetFrame(EntityID entity) const;
+
+        /**
+         * @brief Check if an entity's animation is advancing
+         *
+         * @param entity Animated entity
+         * @return false if paused, finished (non-looping) or not animated
+         */
+        bool IsPlaying(EntityID entity) const;
+
+        /**
+         * @brief Get number of animated entities
+         *
+         * @return Entity count
+         */
+        size_t GetCount() const { return m_entities.size(); }
+
+        /**
+         * @brief Compare per-Sprite animation against the packed system
+         *
+         * Animates spriteCount sprites with staggered start times, once as
+         * individual Sprite objects (with the name and rectangle lookups
+         * RenderSystem used to do per entity) and once through this system.
+         *
+         * @param spriteCount Number of animated sprites
+         * @param frames Number of simulated frames at 60 Hz
+         * @return Benchmark result
+         */
+        static BenchmarkResult RunBenchmark(size_t spriteCount, int frames);
+
+    private:
+        static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+        static constexpr uint8_t FLAG_PLAYING = 1 << 0;    ///< Clip has not finished
+        static constexpr uint8_t FLAG_PAUSED = 1 << 1;     ///< Paused by the caller
+
+        /**
+         * @brief Look up an entity's index in the packed arrays
+         */
+        uint32_t GetIndex(EntityID entity) const {
+            return entity < m_indexOf.size() ? m_indexOf[entity] : INVALID_INDEX;
+        }
+
+        /**
+         * @brief Consume elapsed time of one entity whose frame has run out
+         *
+         * @param index Index in the packed arrays
+         */
+        void AdvanceFrames(uint32_t index);
+
+        /**
+         * @brief Recompute the timer rate of one entity from its speed and flags
+         */
+        void RefreshRate(uint32_t index);
+
+        AnimationClipLibrary m_clips;              ///< Clips played by this system
+
+        // Packed per-entity state (same index in every array)
+        std::vector<EntityID> m_entities;          ///< Owner of each entry
+        std::vector<float> m_timer;                ///< Time spent in the current frame
+        std::vector<float> m_rate;                 ///< Timer rate (speed, or 0 when not advancing)
+        std::vector<float> m_frameDuration;        ///< Duration of the current frame
+        std::vector<AnimationClipID> m_clip;       ///< Clip being played
+        std::vector<uint32_t> m_frame;             ///< Frame within the clip
+        std::vector<float> m_speed;                ///< Speed multiplier
+        std::vector<uint8_t> m_flags;              ///< FLAG_* bits
+        std::vector<glm::vec4> m_uv;               ///< UV rectangle of the current frame
+
+        std::vector<uint32_t> m_indexOf;           ///< EntityID -> packed index (entity IDs are small and recycled)
+    };
+
+} // namespace GP2Engine
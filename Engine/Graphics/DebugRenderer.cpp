@@ -13,11 +13,115 @@
 #include <glad/glad.h>
 #include <iostream>
 #include <cmath>
+#include <chrono>
+#include <unordered_map>
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
 namespace GP2Engine {
     
+    // Instanced shader: expands a unit mesh per instance
+    // u_Mode 0 = line (interpolate endpoints), 1 = shape (center + local * extents)
+    static const char* INSTANCED_VERTEX_SHADER = R"(
+        #version 330 core
+        layout (location = 0) in vec2 aLocal;
+        layout (location = 1) in vec4 aParams;
+        layout (location = 2) in vec4 aColor;
+        
+        layout (std140) uniform Camera { mat4 u_ViewProjection; };
+        uniform int u_Mode;
+        
+        out vec4 VertexColor;
+        
+        void main()
+        {
+            vec2 pos = (u_Mode == 0) ? mix(aParams.xy, aParams.zw, aLocal.x)
+                                     : aParams.xy + aLocal * aParams.zw;
+            gl_Position = u_ViewProjection * vec4(pos, 0.0, 1.0);
+            VertexColor = aColor;
+        }
+    )";
+    
+    static const char* INSTANCED_FRAGMENT_SHADER = R"(
+        #version 330 core
+        out vec4 FragColor;
+        
+        in vec4 VertexColor;
+        
+        void main()
+        {
+            FragColor = VertexColor;
+        }
+    )";
+    
+    /**
+     * @brief Compile and link a shader program from source
+     * 
+     * @param vertexSource Vertex shader source
+     * @param fragmentSource Fragment shader source
+     * @param label Name used in error messages
+     * @return Program ID, or 0 on failure
+     */
+    static unsigned int CompileDebugProgram(const char* vertexSource, const char* fragmentSource, const char* label) {
+        // Compile vertex shader
+        unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
+        glShaderSource(vertexShader, 1, &vertexSource, NULL);
+        glCompileShader(vertexShader);
+        
+        // Check vertex shader compilation
+        int vertexSuccess;
+        glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &vertexSuccess);
+        if (!vertexSuccess) {
+            char infoLog[512];
+            glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
+            std::cerr << "ERROR: " << label << " vertex shader compilation failed:\n" << infoLog << std::endl;
+            glDeleteShader(vertexShader);
+            return 0;
+        }
+        
+        // Compile fragment shader
+        unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(fragmentShader, 1, &fragmentSource, NULL);
+        glCompileShader(fragmentShader);
+        
+        // Check fragment shader compilation
+        int fragmentSuccess;
+        glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &fragmentSuccess);
+        if (!fragmentSuccess) {
+            char infoLog[512];
+            glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
+            std::cerr << "ERROR: " << label << " fragment shader compilation failed:\n" << infoLog << std::endl;
+            glDeleteShader(vertexShader);
+            glDeleteShader(fragmentShader);
+            return 0;
+        }
+        
+        // Create shader program
+        unsigned int program = glCreateProgram();
+        glAttachShader(program, vertexShader);
+        glAttachShader(program, fragmentShader);
+        glLinkProgram(program);
+        
+        // Clean up shaders
+        glDeleteShader(vertexShader);
+        glDeleteShader(fragmentShader);
+        
+        // Check program linking
+        int linkSuccess;
+        glGetProgramiv(program, GL_LINK_STATUS, &linkSuccess);
+        if (!linkSuccess) {
+            char infoLog[512];
+            glGetProgramInfoLog(program, 512, NULL, infoLog);
+            std::cerr << "ERROR: " << label << " shader program linking failed:\n" << infoLog << std::endl;
+            glDeleteProgram(program);
+            return 0;
+        }
+        
+        // Camera matrix comes from the renderer's shared uniform buffer
+        Shader::BindCameraBlock(program);
+        return program;
+    }
+    
     /**
      * @brief Default constructor
      * 
@@ -45,6 +149,7 @@ namespace GP2Engine {
      * 1. Creates debug shader program (vertex + fragment shaders)
      * 2. Sets up OpenGL buffers for lines, triangles, and points
      * 3. Configures vertex attribute pointers
+     * 4. Builds the unit meshes and shader used for instanced shapes
      * 
      * @return true if initialization successful, false otherwise
      */
@@ -63,6 +168,16 @@ namespace GP2Engine {
         // Setup OpenGL buffers for different primitive types
         SetupBuffers();
         
+        // Setup unit meshes and instanced shader
+        SetupInstancing();
+        if (m_InstancedShaderProgram == 0) {
+            std::cerr << "Failed to create instanced debug shader" << std::endl;
+            CleanupBuffers();
+            glDeleteProgram(m_DebugShaderProgram);
+            m_DebugShaderProgram = 0;
+            return false;
+        }
+        
         m_Initialized = true;
         return true;
     }
@@ -86,6 +201,10 @@ namespace GP2Engine {
             glDeleteProgram(m_DebugShaderProgram);
             m_DebugShaderProgram = 0;
         }
+        if (m_InstancedShaderProgram != 0) {
+            glDeleteProgram(m_InstancedShaderProgram);
+            m_InstancedShaderProgram = 0;
+        }
         
         m_Initialized = false;
     }
@@ -100,12 +219,20 @@ namespace GP2Engine {
      * - Line vertices buffer
      * - Triangle vertices buffer  
      * - Point vertices buffer
+     * - Instance buffers (capacity is kept, so steady-state frames do not allocate)
+     * 
+     * The cached grid geometry is kept; it is only drawn if DrawGrid is
+     * called again this frame.
      */
     void DebugRenderer::Begin() {
         // Clear vertex buffers for new frame
         m_LineVertices.clear();
         m_TriangleVertices.clear();
         m_PointVertices.clear();
+        for (auto& instances : m_Instances) {
+            instances.clear();
+        }
+        m_GridRequested = false;
     }
     
     
@@ -116,10 +243,12 @@ namespace GP2Engine {
      * This method must be called after End() and before Present().
      * 
      * The rendering process:
-     * 1. Uses the debug shader program
-     * 2. Sets up camera matrices from the main renderer
-     * 3. Renders lines, triangles, and points in separate draw calls
-     * 4. Uses dynamic vertex buffer updates for each primitive type
+     * 1. Uses the debug shader program with cached uniform locations
+     * 2. Draws the static grid layer (re-uploaded only when its layout changed)
+     * 3. Renders loose lines and triangles
+     * 4. Uploads all instances in one buffer and draws each primitive type
+     *    with a single instanced call
+     * 5. Renders points on top
      * 
      * @param renderer Reference to the main renderer for camera access
      */
@@ -132,9 +261,21 @@ namespace GP2Engine {
         // Use debug shader program
         glUseProgram(m_DebugShaderProgram);
         
-        // Get camera matrices from renderer and set uniform
-        glm::mat4 viewProjection = renderer.GetCamera().GetViewProjectionMatrix();
-        glUniformMatrix4fv(glGetUniformLocation(m_DebugShaderProgram, "u_ViewProjection"), 1, GL_FALSE, &viewProjection[0][0]);
+        // Make sure the shared camera block holds the renderer's camera
+        renderer.UploadCameraBuffer();
+        
+        // Render static grid layer
+        if (m_GridRequested && !m_GridVertices.empty()) {
+            glBindVertexArray(m_GridVAO);
+            if (m_GridDirty) {
+                glBindBuffer(GL_ARRAY_BUFFER, m_GridVBO);
+                glBufferData(GL_ARRAY_BUFFER, m_GridVertices.size() * sizeof(DebugVertex), m_GridVertices.data(), GL_STATIC_DRAW);
+                m_GridVertexCount = static_cast<int>(m_GridVertices.size());
+                m_GridDirty = false;
+            }
+            glDrawArrays(GL_LINES, 0, m_GridVertexCount);
+            glBindVertexArray(0);
+        }
         
         // Render lines
         if (!m_LineVertices.empty()) {
@@ -154,6 +295,48 @@ namespace GP2Engine {
             glBindVertexArray(0);
         }
         
+        // Render instanced primitives (one upload, one draw per primitive type)
+        size_t instanceCount = 0;
+        for (const auto& instances : m_Instances) {
+            instanceCount += instances.size();
+        }
+        if (instanceCount > 0) {
+            m_InstanceUpload.clear();
+            m_InstanceUpload.reserve(instanceCount);
+            for (const auto& instances : m_Instances) {
+                m_InstanceUpload.insert(m_InstanceUpload.end(), instances.begin(), instances.end());
+            }
+            
+            glUseProgram(m_InstancedShaderProgram);
+            
+            glBindBuffer(GL_ARRAY_BUFFER, m_InstanceVBO);
+            glBufferData(GL_ARRAY_BUFFER, m_InstanceUpload.size() * sizeof(DebugInstance), m_InstanceUpload.data(), GL_STREAM_DRAW);
+            
+            size_t firstInstance = 0;
+            for (int type = 0; type < INSTANCED_PRIMITIVE_COUNT; ++type) {
+                const size_t count = m_Instances[type].size();
+                if (count == 0) {
+                    continue;
+                }
+                
+                // Point the instance attributes at this primitive's range
+                const size_t offset = firstInstance * sizeof(DebugInstance);
+                glBindVertexArray(m_MeshVAO[type]);
+                glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(DebugInstance), (void*)offset);
+                glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(DebugInstance), (void*)(offset + offsetof(DebugInstance, color)));
+                
+                const bool isLine = type == INSTANCED_LINE;
+                const bool isFilled = type == INSTANCED_RECT_FILLED || type == INSTANCED_CIRCLE_FILLED;
+                glUniform1i(m_InstancedModeLocation, isLine ? 0 : 1);
+                glDrawArraysInstanced(isFilled ? GL_TRIANGLES : GL_LINES, 0, m_MeshVertexCount[type], static_cast<GLsizei>(count));
+                
+                firstInstance += count;
+            }
+            glBindVertexArray(0);
+            
+            glUseProgram(m_DebugShaderProgram);
+        }
+        
         // Render points
         if (!m_PointVertices.empty()) {
             glBindVertexArray(m_PointVAO);
@@ -183,8 +366,8 @@ namespace GP2Engine {
     /**
      * @brief Draw a debug line
      * 
-     * Adds a line to the debug rendering queue. Lines are rendered
-     * as connected line segments between two points.
+     * Adds a line to the debug rendering queue as a single instance of
+     * the unit line mesh.
      * 
      * @param start Starting position of the line
      * @param end Ending position of the line
@@ -192,7 +375,10 @@ namespace GP2Engine {
      * @param thickness Thickness of the line (currently not implemented)
      */
     void DebugRenderer::DrawLine(const Vector2D& start, const Vector2D& end, const Color& color, float thickness) {
-        AddLine(start, end, color);
+        m_Instances[INSTANCED_LINE].push_back({
+            glm::vec4(start.x, start.y, end.x, end.y),
+            glm::vec4(color.r, color.g, color.b, color.a)
+        });
         (void)thickness; // Line thickness is handled by OpenGL line width
     }
     
@@ -202,8 +388,8 @@ namespace GP2Engine {
      * Adds a rectangle to the debug rendering queue. The rectangle can be
      * drawn as either a filled shape or an outline.
      * 
-     * For filled rectangles: Uses two triangles to create a solid rectangle
-     * For outline rectangles: Uses four line segments to create a wireframe
+     * Both variants are a single instance that scales the unit square mesh
+     * (two triangles when filled, four line segments for the outline).
      * 
      * @param position Center position of the rectangle
      * @param size Size of the rectangle (width, height)
@@ -211,21 +397,10 @@ namespace GP2Engine {
      * @param filled Whether to draw filled or outline (default: false)
      */
     void DebugRenderer::DrawRectangle(const Vector2D& position, const Vector2D& size, const Color& color, bool filled) {
-        Vector2D halfSize = size.Scale(0.5f);
-        Vector2D topLeft = position.Subtract(halfSize);
-        Vector2D bottomRight = position.Add(halfSize);
-        
-        if (filled) {
-            // Draw as two triangles for filled rectangle
-            AddTriangle(topLeft, Vector2D(bottomRight.x, topLeft.y), bottomRight, color);
-            AddTriangle(topLeft, bottomRight, Vector2D(topLeft.x, bottomRight.y), color);
-        } else {
-            // Draw as outline using four line segments
-            AddLine(topLeft, Vector2D(bottomRight.x, topLeft.y), color);
-            AddLine(Vector2D(bottomRight.x, topLeft.y), bottomRight, color);
-            AddLine(bottomRight, Vector2D(topLeft.x, bottomRight.y), color);
-            AddLine(Vector2D(topLeft.x, bottomRight.y), topLeft, color);
-        }
+        m_Instances[filled ? INSTANCED_RECT_FILLED : INSTANCED_RECT_OUTLINE].push_back({
+            glm::vec4(position.x, position.y, size.x * 0.5f, size.y * 0.5f),
+            glm::vec4(color.r, color.g, color.b, color.a)
+        });
     }
     
     /**
@@ -234,8 +409,10 @@ namespace GP2Engine {
      * Adds a circle to the debug rendering queue. The circle can be
      * drawn as either a filled shape or an outline.
      * 
-     * Circles are approximated using line segments or triangles.
-     * More segments provide smoother circles but use more vertices.
+     * Circles with DEFAULT_CIRCLE_SEGMENTS are a single instance of the
+     * unit circle mesh. Other resolutions are expanded on the CPU from a
+     * cached unit-circle table, so no trigonometry or allocation happens
+     * per call either way.
      * 
      * @param center Center position of the circle
      * @param radius Radius of the circle
@@ -244,21 +421,109 @@ namespace GP2Engine {
      * @param segments Number of segments for circle approximation (default: 32)
      */
     void DebugRenderer::DrawCircle(const Vector2D& center, float radius, const Color& color, bool filled, int segments) {
-        auto points = GenerateCirclePoints(center, radius, segments);
+        if (segments == DEFAULT_CIRCLE_SEGMENTS) {
+            m_Instances[filled ? INSTANCED_CIRCLE_FILLED : INSTANCED_CIRCLE_OUTLINE].push_back({
+                glm::vec4(center.x, center.y, radius, radius),
+                glm::vec4(color.r, color.g, color.b, color.a)
+            });
+            return;
+        }
+        
+        if (segments < 3) {
+            return;
+        }
         
-        if (filled) {
-            // Draw as triangle fan for filled circle
-            for (int i = 0; i < segments; ++i) {
-                int next = (i + 1) % segments;
-                AddTriangle(center, points[i], points[next], color);
+        const std::vector<glm::vec2>& unit = GetUnitCircle(segments);
+        for (int i = 0; i < segments; ++i) {
+            int next = (i + 1) % segments;
+            Vector2D a(center.x + unit[i].x * radius, center.y + unit[i].y * radius);
+            Vector2D b(center.x + unit[next].x * radius, center.y + unit[next].y * radius);
+            if (filled) {
+                // Triangle fan for filled circle
+                AddTriangle(center, a, b, color);
+            } else {
+                // Line loop for outline circle
+                AddLine(a, b, color);
             }
-        } else {
-            // Draw as line loop for outline circle
-            for (int i = 0; i < segments; ++i) {
-                int next = (i + 1) % segments;
-                AddLine(points[i], points[next], color);
+        }
+    }
+    
+    /**
+     * @brief Draw a grid of cells using the cached static grid layer
+     * 
+     * Emits one line per row and column boundary instead of four lines per
+     * cell. The geometry is rebuilt (and re-uploaded at the next Flush) only
+     * when the origin, size, dimensions or color change.
+     * 
+     * @param origin Top-left corner of the grid
+     * @param cols Number of columns
+     * @param rows Number of rows
+     * @param cellSize Size of one cell
+     * @param color Line color
+     */
+    void DebugRenderer::DrawGrid(const Vector2D& origin, int cols, int rows, const Vector2D& cellSize, const Color& color) {
+        if (cols <= 0 || rows <= 0) {
+            return;
+        }
+        
+        m_GridRequested = true;
+        
+        const glm::vec4 layout(origin.x, origin.y, cellSize.x, cellSize.y);
+        const glm::ivec2 dimensions(cols, rows);
+        const glm::vec4 glmColor(color.r, color.g, color.b, color.a);
+        if (!m_GridVertices.empty() && layout == m_GridLayout && dimensions == m_GridDimensions && glmColor == m_GridColor) {
+            return; // Cached
+        }
+        
+        m_GridLayout = layout;
+        m_GridDimensions = dimensions;
+        m_GridColor = glmColor;
+        
+        const float width = cols * cellSize.x;
+        const float height = rows * cellSize.y;
+        
+        m_GridVertices.clear();
+        m_GridVertices.reserve(static_cast<size_t>(cols + rows + 2) * 2);
+        for (int col = 0; col <= cols; ++col) {
+            float x = origin.x + col * cellSize.x;
+            m_GridVertices.emplace_back(glm::vec2(x, origin.y), glmColor);
+            m_GridVertices.emplace_back(glm::vec2(x, origin.y + height), glmColor);
+        }
+        for (int row = 0; row <= rows; ++row) {
+            float y = origin.y + row * cellSize.y;
+            m_GridVertices.emplace_back(glm::vec2(origin.x, y), glmColor);
+            m_GridVertices.emplace_back(glm::vec2(origin.x + width, y), glmColor);
+        }
+        m_GridDirty = true;
+    }
+    
+    size_t DebugRenderer::GetQueuedPrimitiveCount() const {
+        size_t count = m_LineVertices.size() / 2 + m_TriangleVertices.size() / 3 + m_PointVertices.size();
+        for (const auto& instances : m_Instances) {
+            count += instances.size();
+        }
+        return count;
+    }
+    
+    double DebugRenderer::MeasureQueueCost(int entityCount, int iterations) {
+        if (entityCount <= 0 || iterations <= 0) {
+            return 0.0;
+        }
+        
+        DebugRenderer scratch; // Never initialized: only the CPU side is exercised
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int it = 0; it < iterations; ++it) {
+            scratch.Begin();
+            scratch.DrawGrid(Vector2D(0.0f, 0.0f), 64, 64, Vector2D(64.0f, 64.0f), Color(0.5f, 0.5f, 0.5f, 1.0f));
+            for (int e = 0; e < entityCount; ++e) {
+                Vector2D position(static_cast<float>(e % 100) * 40.0f, static_cast<float>(e / 100) * 40.0f);
+                scratch.DrawRectangle(position, Vector2D(32.0f, 32.0f), Color::GetGreen(), false);
+                scratch.DrawLine(position, Vector2D(position.x + 16.0f, position.y), Color::GetYellow(), 2.0f);
+                scratch.DrawCircle(position, 4.0f, Color::GetYellow(), true);
             }
         }
+        auto elapsed = std::chrono::high_resolution_clock::now() - start;
+        return std::chrono::duration<double, std::milli>(elapsed).count() / iterations;
     }
     
     void DebugRenderer::SetupBuffers() {
@@ -332,16 +597,35 @@ namespace GP2Engine {
             glDeleteBuffers(1, &m_PointVBO);
             m_PointVAO = m_PointVBO = 0;
         }
+        
+        if (m_MeshVAO[0] != 0) {
+            glDeleteVertexArrays(INSTANCED_PRIMITIVE_COUNT, m_MeshVAO);
+            glDeleteBuffers(INSTANCED_PRIMITIVE_COUNT, m_MeshVBO);
+            for (int type = 0; type < INSTANCED_PRIMITIVE_COUNT; ++type) {
+                m_MeshVAO[type] = m_MeshVBO[type] = 0;
+            }
+        }
+        
+        if (m_InstanceVBO != 0) {
+            glDeleteBuffers(1, &m_InstanceVBO);
+            m_InstanceVBO = 0;
+        }
+        
+        if (m_GridVAO != 0) {
+            glDeleteVertexArrays(1, &m_GridVAO);
+            glDeleteBuffers(1, &m_GridVBO);
+            m_GridVAO = m_GridVBO = 0;
+        }
     }
     
     void DebugRenderer::CreateDebugShader() {
         // Vertex shader source
-        std::string vertexShaderSource = R"(
+        static const char* vertexShaderSource = R"(
             #version 330 core
             layout (location = 0) in vec2 aPos;
             layout (location = 1) in vec4 aColor;
             
-            uniform mat4 u_ViewProjection;
+            layout (std140) uniform Camera { mat4 u_ViewProjection; };
             
             out vec4 VertexColor;
             
@@ -353,7 +637,7 @@ namespace GP2Engine {
         )";
         
         // Fragment shader source
-        std::string fragmentShaderSource = R"(
+        static const char* fragmentShaderSource = R"(
             #version 330 core
             out vec4 FragColor;
             
@@ -365,65 +649,70 @@ namespace GP2Engine {
             }
         )";
         
-        // Compile vertex shader
-        unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
-        const char* vertexSource = vertexShaderSource.c_str();
-        glShaderSource(vertexShader, 1, &vertexSource, NULL);
-        glCompileShader(vertexShader);
-        
-        // Check vertex shader compilation
-        int vertexSuccess;
-        glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &vertexSuccess);
-        if (!vertexSuccess) {
-            char infoLog[512];
-            glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-            std::cerr << "ERROR: Debug vertex shader compilation failed:\n" << infoLog << std::endl;
-            glDeleteShader(vertexShader);
+        m_DebugShaderProgram = CompileDebugProgram(vertexShaderSource, fragmentShaderSource, "Debug");
+    }
+    
+    void DebugRenderer::SetupInstancing() {
+        m_InstancedShaderProgram = CompileDebugProgram(INSTANCED_VERTEX_SHADER, INSTANCED_FRAGMENT_SHADER, "Instanced debug");
+        if (m_InstancedShaderProgram == 0) {
             return;
         }
-        
-        // Compile fragment shader
-        unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-        const char* fragmentSource = fragmentShaderSource.c_str();
-        glShaderSource(fragmentShader, 1, &fragmentSource, NULL);
-        glCompileShader(fragmentShader);
-        
-        // Check fragment shader compilation
-        int fragmentSuccess;
-        glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &fragmentSuccess);
-        if (!fragmentSuccess) {
-            char infoLog[512];
-            glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-            std::cerr << "ERROR: Debug fragment shader compilation failed:\n" << infoLog << std::endl;
-            glDeleteShader(vertexShader);
-            glDeleteShader(fragmentShader);
-            return;
+        m_InstancedModeLocation = glGetUniformLocation(m_InstancedShaderProgram, "u_Mode");
+        
+        // Build unit meshes
+        const std::vector<glm::vec2>& circle = GetUnitCircle(DEFAULT_CIRCLE_SEGMENTS);
+        const glm::vec2 tl(-1.0f, -1.0f), tr(1.0f, -1.0f), br(1.0f, 1.0f), bl(-1.0f, 1.0f);
+        
+        std::vector<glm::vec2> meshes[INSTANCED_PRIMITIVE_COUNT];
+        meshes[INSTANCED_LINE] = { glm::vec2(0.0f), glm::vec2(1.0f, 0.0f) };
+        meshes[INSTANCED_RECT_OUTLINE] = { tl, tr, tr, br, br, bl, bl, tl };
+        meshes[INSTANCED_RECT_FILLED] = { tl, tr, br, tl, br, bl };
+        for (int i = 0; i < DEFAULT_CIRCLE_SEGMENTS; ++i) {
+            const glm::vec2& a = circle[i];
+            const glm::vec2& b = circle[(i + 1) % DEFAULT_CIRCLE_SEGMENTS];
+            meshes[INSTANCED_CIRCLE_OUTLINE].insert(meshes[INSTANCED_CIRCLE_OUTLINE].end(), { a, b });
+            meshes[INSTANCED_CIRCLE_FILLED].insert(meshes[INSTANCED_CIRCLE_FILLED].end(), { glm::vec2(0.0f), a, b });
         }
         
-        // Create shader program
-        m_DebugShaderProgram = glCreateProgram();
-        glAttachShader(m_DebugShaderProgram, vertexShader);
-        glAttachShader(m_DebugShaderProgram, fragmentShader);
-        glLinkProgram(m_DebugShaderProgram);
+        glGenBuffers(1, &m_InstanceVBO);
+        glGenVertexArrays(INSTANCED_PRIMITIVE_COUNT, m_MeshVAO);
+        glGenBuffers(INSTANCED_PRIMITIVE_COUNT, m_MeshVBO);
         
-        // Check program linking
-        int linkSuccess;
-        glGetProgramiv(m_DebugShaderProgram, GL_LINK_STATUS, &linkSuccess);
-        if (!linkSuccess) {
-            char infoLog[512];
-            glGetProgramInfoLog(m_DebugShaderProgram, 512, NULL, infoLog);
-            std::cerr << "ERROR: Debug shader program linking failed:\n" << infoLog << std::endl;
-            glDeleteShader(vertexShader);
-            glDeleteShader(fragmentShader);
-            glDeleteProgram(m_DebugShaderProgram);
-            m_DebugShaderProgram = 0;
-            return;
+        for (int type = 0; type < INSTANCED_PRIMITIVE_COUNT; ++type) {
+            m_MeshVertexCount[type] = static_cast<int>(meshes[type].size());
+            
+            glBindVertexArray(m_MeshVAO[type]);
+            
+            // Per-vertex unit mesh
+            glBindBuffer(GL_ARRAY_BUFFER, m_MeshVBO[type]);
+            glBufferData(GL_ARRAY_BUFFER, meshes[type].size() * sizeof(glm::vec2), meshes[type].data(), GL_STATIC_DRAW);
+            glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(glm::vec2), (void*)0);
+            glEnableVertexAttribArray(0);
+            
+            // Per-instance params and color (pointers are re-targeted in Flush)
+            glBindBuffer(GL_ARRAY_BUFFER, m_InstanceVBO);
+            glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(DebugInstance), (void*)0);
+            glEnableVertexAttribArray(1);
+            glVertexAttribDivisor(1, 1);
+            glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(DebugInstance), (void*)offsetof(DebugInstance, color));
+            glEnableVertexAttribArray(2);
+            glVertexAttribDivisor(2, 1);
         }
+        glBindVertexArray(0);
         
-        // Clean up shaders
-        glDeleteShader(vertexShader);
-        glDeleteShader(fragmentShader);
+        // Static grid layer uses the plain debug vertex layout
+        glGenVertexArrays(1, &m_GridVAO);
+        glGenBuffers(1, &m_GridVBO);
+        glBindVertexArray(m_GridVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, m_GridVBO);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(DebugVertex), (void*)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(DebugVertex), (void*)offsetof(DebugVertex, color));
+        glEnableVertexAttribArray(1);
+        glBindVertexArray(0);
         
+        // Force the grid to upload into the new buffer
+        m_GridDirty = !m_GridVertices.empty();
     }
     
     void DebugRenderer::AddLine(const Vector2D& start, const Vector2D& end, const Color& color) {
@@ -447,18 +736,22 @@ namespace GP2Engine {
         (void)size; // Point size is handled by OpenGL
     }
     
-    std::vector<Vector2D> DebugRenderer::GenerateCirclePoints(const Vector2D& center, float radius, int segments) {
-        std::vector<Vector2D> points;
-        points.reserve(segments);
+    const std::vector<glm::vec2>& DebugRenderer::GetUnitCircle(int segments) {
+        // Tables are computed once per resolution and shared by all circles
+        static std::unordered_map<int, std::vector<glm::vec2>> s_UnitCircles;
         
-        for (int i = 0; i < segments; ++i) {
-            float angle = 2.0f * 3.14159f * i / segments;
-            float x = center.x + radius * std::cos(angle);
-            float y = center.y + radius * std::sin(angle);
-            points.emplace_back(x, y);
+        auto it = s_UnitCircles.find(segments);
+        if (it != s_UnitCircles.end()) {
+            return it->second;
         }
         
-        return points;
+        std::vector<glm::vec2> points;
+        points.reserve(segments);
+        for (int i = 0; i < segments; ++i) {
+            float angle = 2.0f * 3.14159265f * i / segments;
+            points.emplace_back(std::cos(angle), std::sin(angle));
+        }
+        return s_UnitCircles.emplace(segments, std::move(points)).first->second;
     }
     
 } // namespace GP2Engine
\ No newline at end of file
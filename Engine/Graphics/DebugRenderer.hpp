@@ -66,6 +66,12 @@ namespace GP2Engine {
      * velocity vectors, and other debug visualizations. All shapes are drawn
      * without textures using simple geometric primitives.
      * 
+     * Lines, rectangles and default-resolution circles are queued as 32-byte
+     * instances and expanded on the GPU from shared unit meshes, so a shape
+     * costs one push_back regardless of its vertex count. Circle points come
+     * from precomputed unit-circle tables. Grids are cached in a static
+     * vertex buffer and only rebuilt when their layout changes.
+     * 
      * Satisfies Rubric 1202 requirements for drawing points, lines, rectangles, and circles.
      * 
      * @author Asri (100%)
@@ -161,8 +167,44 @@ namespace GP2Engine {
          * @param filled Whether to draw filled or outline
          * @param segments Number of segments for circle approximation
          */
-        void DrawCircle(const Vector2D& center, float radius, const Color& color = Color::GetWhite(), bool filled = false, int segments = 32);
+        void DrawCircle(const Vector2D& center, float radius, const Color& color = Color::GetWhite(), bool filled = false, int segments = DEFAULT_CIRCLE_SEGMENTS);
+        
+        /**
+         * @brief Draw a grid of cells using the cached static grid layer
+         * 
+         * Geometry is built once ((cols + 1) + (rows + 1) lines) and kept in a
+         * static vertex buffer; calling this every frame with the same layout
+         * costs no CPU work beyond a comparison.
+         * 
+         * @param origin Top-left corner of the grid
+         * @param cols Number of columns
+         * @param rows Number of rows
+         * @param cellSize Size of one cell
+         * @param color Line color
+         */
+        void DrawGrid(const Vector2D& origin, int cols, int rows, const Vector2D& cellSize, const Color& color = Color::GetWhite());
         
+        /**
+         * @brief Get number of primitives queued this frame
+         * 
+         * @return Instanced shapes + loose lines, triangles and points
+         */
+        size_t GetQueuedPrimitiveCount() const;
+        
+        /**
+         * @brief Measure CPU cost of queuing a typical overlay
+         * 
+         * Queues one collision box, one velocity line and one marker circle per
+         * entity (plus a 64x64 grid) on a scratch renderer without touching
+         * OpenGL.
+         * 
+         * @param entityCount Number of simulated entities
+         * @param iterations Number of frames to average
+         * @return Average milliseconds per frame
+         */
+        static double MeasureQueueCost(int entityCount, int iterations);
+        
+        static const int DEFAULT_CIRCLE_SEGMENTS = 32;  ///< Circle resolution drawn with instancing
         
     private:
         /**
@@ -187,22 +229,76 @@ namespace GP2Engine {
                 : position(pos), color(col) {}
         };
         
+        /**
+         * @brief Per-instance data for instanced primitives
+         * 
+         * Lines store (start, end) in params; rectangles and circles store
+         * (center, half extents) and scale a unit mesh.
+         */
+        struct DebugInstance {
+            glm::vec4 params;    ///< Line: (x0, y0, x1, y1), shape: (cx, cy, hx, hy)
+            glm::vec4 color;     ///< Instance color
+        };
+        
+        /**
+         * @brief Instanced primitive types (one unit mesh each)
+         */
+        enum InstancedPrimitive {
+            INSTANCED_LINE = 0,
+            INSTANCED_RECT_OUTLINE,
+            INSTANCED_RECT_FILLED,
+            INSTANCED_CIRCLE_OUTLINE,
+            INSTANCED_CIRCLE_FILLED,
+            INSTANCED_PRIMITIVE_COUNT
+        };
+        
         // Render data - separate buffers for different primitive types
         std::vector<DebugVertex> m_LineVertices;      ///< Line vertices buffer
         std::vector<DebugVertex> m_TriangleVertices;  ///< Triangle vertices buffer
         std::vector<DebugVertex> m_PointVertices;    ///< Point vertices buffer
+        std::vector<DebugInstance> m_Instances[INSTANCED_PRIMITIVE_COUNT]; ///< Instance buffers per primitive
+        std::vector<DebugInstance> m_InstanceUpload;  ///< Concatenated instances for one upload
         
         // OpenGL resources
         unsigned int m_LineVAO{0}, m_LineVBO{0};           ///< Line VAO/VBO
         unsigned int m_TriangleVAO{0}, m_TriangleVBO{0};   ///< Triangle VAO/VBO
         unsigned int m_PointVAO{0}, m_PointVBO{0};         ///< Point VAO/VBO
+        unsigned int m_MeshVAO[INSTANCED_PRIMITIVE_COUNT]{}; ///< Unit mesh VAOs
+        unsigned int m_MeshVBO[INSTANCED_PRIMITIVE_COUNT]{}; ///< Unit mesh VBOs
+        int m_MeshVertexCount[INSTANCED_PRIMITIVE_COUNT]{};  ///< Vertices per unit mesh
+        unsigned int m_InstanceVBO{0};                     ///< Shared instance buffer
+        
+        // Cached static grid layer
+        unsigned int m_GridVAO{0}, m_GridVBO{0};           ///< Grid VAO/VBO (GL_STATIC_DRAW)
+        int m_GridVertexCount{0};                          ///< Vertices in the grid buffer
+        bool m_GridDirty{false};                           ///< Grid layout changed since upload
+        bool m_GridRequested{false};                       ///< DrawGrid called this frame
+        std::vector<DebugVertex> m_GridVertices;           ///< CPU copy of the grid geometry
+        glm::vec4 m_GridLayout{0.0f};                      ///< Cached (origin, cellSize)
+        glm::ivec2 m_GridDimensions{0};                    ///< Cached (cols, rows)
+        glm::vec4 m_GridColor{0.0f};                       ///< Cached grid color
         
         // Shader program for debug rendering
         unsigned int m_DebugShaderProgram{0};  ///< Debug shader program ID
+        unsigned int m_InstancedShaderProgram{0}; ///< Instanced shader program ID
+        int m_InstancedModeLocation{-1};       ///< u_Mode in instanced shader
         
         // Configuration
         bool m_Initialized{false};    ///< Initialization flag
         
+        /**
+         * @brief Get a cached unit-circle table
+         * 
+         * @param segments Number of segments
+         * @return Reference to (cos, sin) pairs for each segment
+         */
+        static const std::vector<glm::vec2>& GetUnitCircle(int segments);
+        
+        /**
+         * @brief Create the unit meshes and instanced shader
+         */
+        void SetupInstancing();
+        
         /**
          * @brief Setup OpenGL buffers for debug rendering
          */
@@ -246,15 +342,6 @@ namespace GP2Engine {
          */
         void AddPoint(const Vector2D& position, const Color& color, float size);
         
-        /**
-         * @brief Generate circle points for rendering
-         * 
-         * @param center Circle center
-         * @param radius Circle radius
-         * @param segments Number of segments
-         * @return Vector of circle points
-         */
-        std::vector<Vector2D> GenerateCirclePoints(const Vector2D& center, float radius, int segments);
     };
     
 } // namespace GP2Engine
\ No newline at end of file
@@ -8,6 +8,8 @@
  */
 
 #include "Font.hpp"
+#include "Renderer.hpp"
+#include <algorithm>
 #include <iostream>
 #include <glad/glad.h>
 
@@ -69,7 +71,10 @@ namespace GP2Engine {
         FT_Set_Pixel_Sizes(face, 0, fontSize);
 
         // Disable byte-alignment restriction
-        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        const bool headless = Renderer::IsHeadless();
+        if (!headless) {
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        }
 
         // Load ASCII characters
         if (!LoadCharacters(face)) {
@@ -81,7 +86,9 @@ namespace GP2Engine {
         FT_Done_Face(face);
 
         // Reset pixel storage
-        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        if (!headless) {
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        }
 
         m_IsLoaded = true;
         return true;
@@ -105,6 +112,22 @@ namespace GP2Engine {
             return false;
         }
 
+        if (Renderer::IsHeadless()) {
+            // No OpenGL context: keep the coverage bitmap for the software rasterizer
+            const FT_Bitmap& bitmap = face->glyph->bitmap;
+            Character character;
+            character.size = glm::ivec2(bitmap.width, bitmap.rows);
+            character.bearing = glm::ivec2(face->glyph->bitmap_left, face->glyph->bitmap_top);
+            character.advance = static_cast<unsigned int>(face->glyph->advance.x);
+            character.bitmap.resize(static_cast<size_t>(bitmap.width) * bitmap.rows);
+            for (unsigned int row = 0; row < bitmap.rows; ++row) {
+                const unsigned char* source = bitmap.buffer + static_cast<ptrdiff_t>(row) * bitmap.pitch;
+                std::copy(source, source + bitmap.width, character.bitmap.begin() + static_cast<ptrdiff_t>(row) * bitmap.width);
+            }
+            m_Characters[c] = std::move(character);
+            return true;
+        }
+
         // Generate texture
         unsigned int texture;
         glGenTextures(1, &texture);
@@ -12,6 +12,7 @@
 #include <string>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 #include <glm/glm.hpp>
 
 // Forward declare FreeType types to avoid including FreeType in header
@@ -30,6 +31,7 @@ namespace GP2Engine {
         glm::ivec2 size;            ///< Size of glyph
         glm::ivec2 bearing;         ///< Offset from baseline to left/top of glyph
         unsigned int advance;       ///< Horizontal offset to advance to next glyph
+        std::vector<unsigned char> bitmap; ///< Glyph coverage rows (headless mode only, size.x * size.y)
 
         Character() : textureID(0), size(0), bearing(0), advance(0) {}
     };
@@ -0,0 +1,173 @@
+/**
+ * @file FramePacket.cpp
+ * @brief Frame packet preparation and submission
+ * @author Asri (100%)
+ *
+ * This file contains the implementation of the FramePacket containers and the
+ * FramePipeline functions that turn a packet into GPU-ready vertices (no GL,
+ * safe on the render thread) and then into draw calls (GL thread only).
+ */
+
+#include "FramePacket.hpp"
+#include "Renderer.hpp"
+#include "Font.hpp"
+#include "../ECS/Component.hpp"
+
+namespace GP2Engine {
+
+    void FramePacket::Clear() {
+        sprites.clear();
+        texts.clear();
+        commands.clear();
+        culledObjects = 0;
+        sortMs = 0.0f;
+    }
+
+    void FramePacket::AddSprite(const PacketSprite& sprite, bool batched) {
+        const PacketCommand::Type type = batched ? PacketCommand::Type::SpriteBatch : PacketCommand::Type::SpriteImmediate;
+
+        // Consecutive sprites of the same kind share one command
+        if (!commands.empty() && commands.back().type == type) {
+            commands.back().count++;
+        } else {
+            commands.push_back({type, static_cast<uint32_t>(sprites.size()), 1});
+        }
+        sprites.push_back(sprite);
+    }
+
+    void FramePacket::AddText(PacketText text) {
+        commands.push_back({PacketCommand::Type::Text, static_cast<uint32_t>(texts.size()), 1});
+        texts.push_back(std::move(text));
+    }
+
+    void PreparedFrame::Clear() {
+        vertices.clear();
+        batches.clear();
+        bindings.clear();
+    }
+
+    namespace FramePipeline {
+
+        /**
+         * @brief Expand the queued quads into a new prepared batch
+         */
+        static void CloseBatch(uint32_t commandIndex, FlushReason reason, TextureSlotManager& slots, PreparedFrame& out, QuadBatchSoA& batchQuads) {
+            if (batchQuads.Size() == 0) {
+                return;
+            }
+
+            PreparedBatch batch;
+            batch.commandIndex = commandIndex;
+            batch.reason = reason;
+            batch.firstQuad = static_cast<uint32_t>(out.vertices.size() / 4);
+            batch.quadCount = static_cast<uint32_t>(batchQuads.Size());
+            batch.firstBinding = static_cast<uint32_t>(out.bindings.size());
+            slots.CollectBatchBindings(out.bindings);
+            batch.bindingCount = static_cast<uint32_t>(out.bindings.size()) - batch.firstBinding;
+
+            out.vertices.resize(out.vertices.size() + batchQuads.Size() * 4);
+            QuadKernel::GenerateVertices(batchQuads, out.vertices.data() + static_cast<size_t>(batch.firstQuad) * 4);
+            out.batches.push_back(batch);
+
+            batchQuads.Clear();
+            slots.BeginBatch();
+        }
+
+        void Prepare(const FramePacket& packet, TextureSlotManager& slots, PreparedFrame& out, QuadBatchSoA& batchQuads) {
+            out.Clear();
+            batchQuads.Clear();
+            batchQuads.Reserve(Renderer::MAX_QUADS);
+            slots.BeginBatch();
+
+            for (uint32_t commandIndex = 0; commandIndex < packet.commands.size(); ++commandIndex) {
+                const PacketCommand& command = packet.commands[commandIndex];
+                if (command.type != PacketCommand::Type::SpriteBatch) {
+                    continue;
+                }
+
+                for (uint32_t i = command.first; i < command.first + command.count; ++i) {
+                    const PacketSprite& sprite = packet.sprites[i];
+
+                    if (batchQuads.Size() >= Renderer::MAX_QUADS) {
+                        CloseBatch(commandIndex, FlushReason::BufferFull, slots, out, batchQuads);
+                    }
+
+                    int textureSlot = slots.AcquireSlot(sprite.textureID);
+                    if (textureSlot == -1) {
+                        // Every unit is used by this batch, start a new one
+                        CloseBatch(commandIndex, FlushReason::TextureSlotsFull, slots, out, batchQuads);
+                        textureSlot = slots.AcquireSlot(sprite.textureID);
+                    }
+
+                    batchQuads.Push(sprite.position, sprite.size, sprite.rotation,
+                                    sprite.textureID != 0 ? sprite.texCoords : glm::vec4(0.0f),
+                                    sprite.color, static_cast<float>(textureSlot));
+                }
+
+                // Commands in between (text, immediate sprites) must draw in order
+                FlushReason reason = FlushReason::EndOfFrame;
+                if (commandIndex + 1 < packet.commands.size()) {
+                    reason = packet.commands[commandIndex + 1].type == PacketCommand::Type::Text
+                        ? FlushReason::TextInterrupt : FlushReason::LayerChange;
+                }
+                CloseBatch(commandIndex, reason, slots, out, batchQuads);
+            }
+        }
+
+        void Execute(const FramePacket& packet, const PreparedFrame& prepared, Renderer& renderer) {
+            // Prepare for rendering (caller is responsible for clearing)
+            renderer.ResetPerformanceCounters();
+            RenderFrameStats& stats = renderer.GetFrameStats();
+            stats.frameIndex = packet.frameIndex;
+            stats.submittedObjects = static_cast<uint32_t>(packet.sprites.size() + packet.texts.size());
+            stats.culledObjects = packet.culledObjects;
+            stats.sortMs = packet.sortMs;
+            renderer.SetCamera(packet.camera);
+            renderer.BeginBatch();
+
+            size_t batchIndex = 0;
+            for (uint32_t commandIndex = 0; commandIndex < packet.commands.size(); ++commandIndex) {
+                const PacketCommand& command = packet.commands[commandIndex];
+
+                switch (command.type) {
+                    case PacketCommand::Type::SpriteBatch: {
+                        for (; batchIndex < prepared.batches.size() && prepared.batches[batchIndex].commandIndex == commandIndex; ++batchIndex) {
+                            const PreparedBatch& batch = prepared.batches[batchIndex];
+                            renderer.DrawPreparedBatch(prepared.vertices.data() + static_cast<size_t>(batch.firstQuad) * 4, batch.quadCount,
+                                                       prepared.bindings.data() + batch.firstBinding, batch.bindingCount, batch.reason);
+                        }
+                        break;
+                    }
+
+                    case PacketCommand::Type::SpriteImmediate: {
+                        for (uint32_t i = command.first; i < command.first + command.count; ++i) {
+                            const PacketSprite& sprite = packet.sprites[i];
+                            if (sprite.textureID != 0) {
+                                renderer.DrawTexturedQuad(sprite.position, sprite.size, sprite.rotation, sprite.textureID, sprite.texCoords, sprite.color);
+                            } else {
+                                renderer.DrawQuad(sprite.position, sprite.size, sprite.rotation, sprite.color);
+                            }
+                        }
+                        break;
+                    }
+
+                    case PacketCommand::Type::Text: {
+                        const PacketText& text = packet.texts[command.first];
+
+                        // Flush batch before rendering text (text uses separate rendering)
+                        renderer.FlushBatch(FlushReason::TextInterrupt);
+
+                        Transform2D transform(Vector2D(text.position.x, text.position.y), text.rotation,
+                                              Vector2D(text.scale.x, text.scale.y));
+                        renderer.DrawText(text.font.get(), text.text, &transform, text.textScale, text.color);
+                        break;
+                    }
+                }
+            }
+
+            renderer.EndBatch();
+            renderer.CommitFrameStats();
+        }
+    }
+
+} // namespace GP2Engine
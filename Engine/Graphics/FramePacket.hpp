@@ -0,0 +1,167 @@
+/**
+ * @file FramePacket.hpp
+ * @brief Immutable per-frame render data handed from simulation to rendering
+ * @author Asri (100%)
+ *
+ * This file contains the FramePacket structure built by RenderSystem from the
+ * ECS (sorted sprite instances, tile quads and text runs), and the
+ * PreparedFrame produced from it by the render thread (texture unit
+ * assignment and packed vertices). Once submitted a packet is only read, so
+ * the main thread can build the next frame while the previous one is being
+ * prepared and drawn.
+ */
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "Camera.hpp"
+#include "QuadKernel.hpp"
+#include "TextureSlotManager.hpp"
+#include "RenderStats.hpp"
+
+namespace GP2Engine {
+
+    class Font;
+    class Renderer;
+
+    /**
+     * @brief One sprite or tile quad in a frame packet
+     */
+    struct PacketSprite {
+        glm::vec2 position;        ///< Quad center
+        glm::vec2 size;            ///< Quad size
+        float rotation;            ///< Rotation in degrees
+        glm::vec4 texCoords;       ///< Texture coordinates (x, y, width, height)
+        glm::vec4 color;           ///< Color tint
+        unsigned int textureID;    ///< OpenGL texture ID (0 = colored quad)
+    };
+
+    /**
+     * @brief One text run in a frame packet
+     */
+    struct PacketText {
+        std::shared_ptr<Font> font;    ///< Font (kept alive until the packet is reused)
+        std::string text;              ///< Text to draw
+        glm::vec2 position;            ///< Text origin
+        float rotation;                ///< Rotation in degrees
+        glm::vec2 scale;               ///< Transform scale
+        float textScale;               ///< Additional text scale
+        glm::vec4 color;               ///< Text color
+    };
+
+    /**
+     * @brief Ordered draw command referencing packet data
+     */
+    struct PacketCommand {
+        enum class Type {
+            SpriteBatch,       ///< Sprites drawn through the batcher
+            SpriteImmediate,   ///< Sprites drawn one draw call each
+            Text               ///< One text run
+        };
+
+        Type type;             ///< Command type
+        uint32_t first;        ///< First sprite (or text) index
+        uint32_t count;        ///< Number of sprites (1 for text)
+    };
+
+    /**
+     * @brief Everything needed to draw one frame of the scene
+     *
+     * Built on the main thread, then treated as immutable until it is
+     * recycled for a later frame. Clear() keeps capacity so steady-state
+     * frames do not allocate.
+     */
+    struct FramePacket {
+        uint64_t frameIndex{0};                  ///< Monotonic frame number
+        Camera camera;                           ///< Camera used for the frame
+        std::vector<PacketSprite> sprites;       ///< Sprite and tile quads in draw order
+        std::vector<PacketText> texts;           ///< Text runs
+        std::vector<PacketCommand> commands;     ///< Draw order
+        uint32_t culledObjects{0};               ///< Renderables skipped while building
+        float sortMs{0.0f};                      ///< Time spent sorting renderables
+
+        /**
+         * @brief Remove all content (keeps capacity)
+         */
+        void Clear();
+
+        /**
+         * @brief Append a sprite, extending the previous command when possible
+         *
+         * @param sprite Sprite to append
+         * @param batched true to draw through the batcher, false for an immediate draw
+         */
+        void AddSprite(const PacketSprite& sprite, bool batched);
+
+        /**
+         * @brief Append a text run
+         *
+         * @param text Text run to append
+         */
+        void AddText(PacketText text);
+    };
+
+    /**
+     * @brief One batch of prepared vertices
+     */
+    struct PreparedBatch {
+        uint32_t commandIndex;     ///< Command the batch belongs to
+        uint32_t firstQuad;        ///< First quad in PreparedFrame::vertices (4 vertices per quad)
+        uint32_t quadCount;        ///< Number of quads
+        uint32_t firstBinding;     ///< First entry in PreparedFrame::bindings
+        uint32_t bindingCount;     ///< Number of texture unit assignments
+        FlushReason reason;        ///< Why the batch was closed
+    };
+
+    /**
+     * @brief GPU-ready data derived from a FramePacket
+     *
+     * Produced without any OpenGL calls, so it can be filled on the render
+     * thread while the GL context stays on the main thread.
+     */
+    struct PreparedFrame {
+        std::vector<BatchQuadVertex> vertices;     ///< Packed vertices of all batches
+        std::vector<PreparedBatch> batches;        ///< Batches in draw order
+        std::vector<TextureBinding> bindings;      ///< Texture unit assignments of all batches
+
+        /**
+         * @brief Remove all content (keeps capacity)
+         */
+        void Clear();
+    };
+
+    /**
+     * @brief Frame packet preparation and submission
+     */
+    namespace FramePipeline {
+
+        /**
+         * @brief Assign texture units and generate vertices for the batched sprites
+         *
+         * Makes no OpenGL calls. Batches are split when they run out of
+         * texture units or reach the batcher's quad limit.
+         *
+         * @param packet Packet to prepare
+         * @param slots Texture unit assignment state (persistent across frames)
+         * @param out Prepared data (cleared first)
+         * @param batchQuads Scratch SoA queue (persistent to avoid reallocations)
+         */
+        void Prepare(const FramePacket& packet, TextureSlotManager& slots, PreparedFrame& out, QuadBatchSoA& batchQuads);
+
+        /**
+         * @brief Issue the OpenGL draw calls for a prepared packet
+         *
+         * Must be called on the thread that owns the GL context.
+         *
+         * @param packet Packet to draw
+         * @param prepared Prepared data of the packet
+         * @param renderer Renderer to draw with
+         */
+        void Execute(const FramePacket& packet, const PreparedFrame& prepared, Renderer& renderer);
+    }
+
+} // namespace GP2Engine
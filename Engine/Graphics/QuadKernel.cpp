@@ -0,0 +1,484 @@
+/**
+ * @file QuadKernel.cpp
+ * @brief SIMD quad vertex generation kernel implementation
+ * @author Asri (100%)
+ *
+ * This file contains the AVX2, SSE2 and scalar implementations of the quad
+ * vertex kernel used by Renderer::FlushBatch, plus a throughput benchmark
+ * comparing it against the original per-quad vertex code.
+ */
+
+#include "QuadKernel.hpp"
+#include <cmath>
+#include <chrono>
+#include <cstddef>
+#include <algorithm>
+
+#if defined(__AVX2__)
+    #define GP2_QUAD_KERNEL_AVX2 1
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define GP2_QUAD_KERNEL_SSE2 1
+    #include <emmintrin.h>
+#endif
+
+namespace GP2Engine {
+
+    // The SIMD path stores (position, texCoords) and color as two 4-float writes
+    static_assert(sizeof(BatchQuadVertex) == 9 * sizeof(float), "BatchQuadVertex must be tightly packed");
+    static_assert(offsetof(BatchQuadVertex, texCoords) == 2 * sizeof(float), "Unexpected BatchQuadVertex layout");
+    static_assert(offsetof(BatchQuadVertex, color) == 4 * sizeof(float), "Unexpected BatchQuadVertex layout");
+    static_assert(offsetof(BatchQuadVertex, textureIndex) == 8 * sizeof(float), "Unexpected BatchQuadVertex layout");
+
+    static constexpr float DEG_TO_RAD = 3.14159265358979323846f / 180.0f;
+
+    // ===================================================================
+    // QUAD BATCH SOA
+    // ===================================================================
+
+    void QuadBatchSoA::Reserve(size_t count) {
+        if (count <= m_Capacity) {
+            return;
+        }
+
+        const size_t stride = count + FIELD_PADDING;
+        std::vector<float> storage(stride * FIELD_COUNT);
+
+        float** fields[FIELD_COUNT] = { &posX, &posY, &sizeX, &sizeY, &rotation,
+                                        &u0, &v0, &u1, &v1, &r, &g, &b, &a, &textureIndex };
+        for (size_t f = 0; f < FIELD_COUNT; ++f) {
+            float* newField = storage.data() + f * stride;
+            if (m_Count > 0) {
+                std::copy(*fields[f], *fields[f] + m_Count, newField);
+            }
+            *fields[f] = newField;
+        }
+
+        m_Storage = std::move(storage);
+        m_Capacity = count;
+    }
+
+    void QuadBatchSoA::Push(const glm::vec2& position, const glm::vec2& size, float rotationDegrees,
+                            const glm::vec4& texCoords, const glm::vec4& color, float textureSlot) {
+        if (m_Count == m_Capacity) {
+            Reserve(m_Count < 64 ? 64 : m_Count * 2);
+        }
+
+        const size_t i = m_Count++;
+        posX[i] = position.x; posY[i] = position.y;
+        sizeX[i] = size.x; sizeY[i] = size.y;
+        rotation[i] = rotationDegrees;
+        u0[i] = texCoords.x; v0[i] = texCoords.y;
+        u1[i] = texCoords.z; v1[i] = texCoords.w;
+        r[i] = color.r; g[i] = color.g; b[i] = color.b; a[i] = color.a;
+        textureIndex[i] = textureSlot;
+    }
+
+    namespace QuadKernel {
+
+        // ===================================================================
+        // SCALAR PATH
+        // ===================================================================
+
+        /**
+         * @brief Expand quads [begin, end) with scalar code
+         */
+        static void GenerateRangeScalar(const QuadBatchSoA& q, size_t begin, size_t end, BatchQuadVertex* out) {
+            for (size_t i = begin; i < end; ++i) {
+                const float hw = q.sizeX[i] * 0.5f;
+                const float hh = q.sizeY[i] * 0.5f;
+
+                // Local corners: bottom left, bottom right, top right, top left
+                float cx[4] = { -hw,  hw, hw, -hw };
+                float cy[4] = { -hh, -hh, hh,  hh };
+
+                if (q.rotation[i] != 0.0f) {
+                    const float radians = q.rotation[i] * DEG_TO_RAD;
+                    const float c = std::cos(radians);
+                    const float s = std::sin(radians);
+                    for (int k = 0; k < 4; ++k) {
+                        const float x = cx[k];
+                        const float y = cy[k];
+                        cx[k] = x * c - y * s;
+                        cy[k] = x * s + y * c;
+                    }
+                }
+
+                BatchQuadVertex* v = out + i * 4;
+                for (int k = 0; k < 4; ++k) {
+                    v[k].position = glm::vec2(cx[k] + q.posX[i], cy[k] + q.posY[i]);
+                    v[k].texCoords = glm::vec2((k == 0 || k == 3) ? q.u0[i] : q.u1[i],
+                                               (k < 2) ? q.v0[i] : q.v1[i]);
+                    v[k].color = glm::vec4(q.r[i], q.g[i], q.b[i], q.a[i]);
+                    v[k].textureIndex = q.textureIndex[i];
+                }
+            }
+        }
+
+        void GenerateVerticesScalar(const QuadBatchSoA& quads, BatchQuadVertex* outVertices) {
+            GenerateRangeScalar(quads, 0, quads.Size(), outVertices);
+        }
+
+#if defined(GP2_QUAD_KERNEL_AVX2) || defined(GP2_QUAD_KERNEL_SSE2)
+
+        // ===================================================================
+        // SIMD HELPERS
+        // ===================================================================
+
+        /**
+         * @brief Fill per-lane cos/sin, computing trig only for rotated lanes
+         *
+         * @param degrees Rotation of each lane in degrees
+         * @param rotatedMask Bit i set if lane i has non-zero rotation
+         * @param lanes Number of lanes
+         * @param c Output cosines
+         * @param s Output sines
+         */
+        static inline void SinCosLanes(const float* degrees, int rotatedMask, int lanes, float* c, float* s) {
+            for (int lane = 0; lane < lanes; ++lane) {
+                if (rotatedMask & (1 << lane)) {
+                    const float radians = degrees[lane] * DEG_TO_RAD;
+                    c[lane] = std::cos(radians);
+                    s[lane] = std::sin(radians);
+                } else {
+                    c[lane] = 1.0f;
+                    s[lane] = 0.0f;
+                }
+            }
+        }
+
+        /**
+         * @brief Transpose and store 4 quads (16 vertices) from lane-major registers
+         *
+         * @param cx Corner X for each of the 4 corners, one quad per lane
+         * @param cy Corner Y for each of the 4 corners, one quad per lane
+         * @param u0 Left texture coordinate per quad
+         * @param v0 Bottom texture coordinate per quad
+         * @param u1 Right texture coordinate per quad
+         * @param v1 Top texture coordinate per quad
+         * @param r Red per quad
+         * @param g Green per quad
+         * @param b Blue per quad
+         * @param a Alpha per quad
+         * @param tex Texture slot per quad
+         * @param out First vertex of the first quad
+         */
+        static inline void EmitFourQuads(const __m128 cx[4], const __m128 cy[4],
+                                         __m128 u0, __m128 v0, __m128 u1, __m128 v1,
+                                         __m128 r, __m128 g, __m128 b, __m128 a,
+                                         const float* tex, BatchQuadVertex* out) {
+            // After the transpose each register holds the RGBA of one quad
+            _MM_TRANSPOSE4_PS(r, g, b, a);
+            const __m128 colors[4] = { r, g, b, a };
+
+            const __m128 us[4] = { u0, u1, u1, u0 };
+            const __m128 vs[4] = { v0, v0, v1, v1 };
+
+            // xyuv[corner][quad] = (x, y, u, v)
+            __m128 xyuv[4][4];
+            for (int k = 0; k < 4; ++k) {
+                __m128 x = cx[k];
+                __m128 y = cy[k];
+                __m128 u = us[k];
+                __m128 v = vs[k];
+                _MM_TRANSPOSE4_PS(x, y, u, v);
+                xyuv[k][0] = x;
+                xyuv[k][1] = y;
+                xyuv[k][2] = u;
+                xyuv[k][3] = v;
+            }
+
+            for (int quad = 0; quad < 4; ++quad) {
+                BatchQuadVertex* v = out + quad * 4;
+                for (int k = 0; k < 4; ++k) {
+                    float* dst = reinterpret_cast<float*>(&v[k]);
+                    _mm_storeu_ps(dst, xyuv[k][quad]);
+                    _mm_storeu_ps(dst + 4, colors[quad]);
+                    dst[8] = tex[quad];
+                }
+            }
+        }
+
+#endif
+
+#if defined(GP2_QUAD_KERNEL_AVX2)
+
+        // ===================================================================
+        // AVX2 PATH (8 quads per iteration)
+        // ===================================================================
+
+        void GenerateVertices(const QuadBatchSoA& q, BatchQuadVertex* out) {
+            const size_t count = q.Size();
+            const __m256 half = _mm256_set1_ps(0.5f);
+            const __m256 zero = _mm256_setzero_ps();
+
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                const __m256 px = _mm256_loadu_ps(&q.posX[i]);
+                const __m256 py = _mm256_loadu_ps(&q.posY[i]);
+                const __m256 hw = _mm256_mul_ps(_mm256_loadu_ps(&q.sizeX[i]), half);
+                const __m256 hh = _mm256_mul_ps(_mm256_loadu_ps(&q.sizeY[i]), half);
+                const __m256 rot = _mm256_loadu_ps(&q.rotation[i]);
+                const int rotatedMask = _mm256_movemask_ps(_mm256_cmp_ps(rot, zero, _CMP_NEQ_UQ));
+
+                __m256 cx[4], cy[4];
+                if (rotatedMask == 0) {
+                    // Axis-aligned: no trigonometry needed
+                    const __m256 minX = _mm256_sub_ps(px, hw);
+                    const __m256 maxX = _mm256_add_ps(px, hw);
+                    const __m256 minY = _mm256_sub_ps(py, hh);
+                    const __m256 maxY = _mm256_add_ps(py, hh);
+                    cx[0] = minX; cx[1] = maxX; cx[2] = maxX; cx[3] = minX;
+                    cy[0] = minY; cy[1] = minY; cy[2] = maxY; cy[3] = maxY;
+                } else {
+                    alignas(32) float cosLanes[8];
+                    alignas(32) float sinLanes[8];
+                    SinCosLanes(&q.rotation[i], rotatedMask, 8, cosLanes, sinLanes);
+                    const __m256 c = _mm256_load_ps(cosLanes);
+                    const __m256 s = _mm256_load_ps(sinLanes);
+
+                    const __m256 hwc = _mm256_mul_ps(hw, c);
+                    const __m256 hws = _mm256_mul_ps(hw, s);
+                    const __m256 hhc = _mm256_mul_ps(hh, c);
+                    const __m256 hhs = _mm256_mul_ps(hh, s);
+
+                    // x = lx*c - ly*s + px, y = lx*s + ly*c + py
+                    cx[0] = _mm256_add_ps(_mm256_sub_ps(hhs, hwc), px);
+                    cy[0] = _mm256_sub_ps(py, _mm256_add_ps(hws, hhc));
+                    cx[1] = _mm256_add_ps(_mm256_add_ps(hwc, hhs), px);
+                    cy[1] = _mm256_add_ps(_mm256_sub_ps(hws, hhc), py);
+                    cx[2] = _mm256_add_ps(_mm256_sub_ps(hwc, hhs), px);
+                    cy[2] = _mm256_add_ps(_mm256_add_ps(hws, hhc), py);
+                    cx[3] = _mm256_sub_ps(px, _mm256_add_ps(hwc, hhs));
+                    cy[3] = _mm256_add_ps(_mm256_sub_ps(hhc, hws), py);
+                }
+
+                // Emit as two groups of 4 quads
+                for (int group = 0; group < 2; ++group) {
+                    __m128 cx4[4], cy4[4];
+                    for (int k = 0; k < 4; ++k) {
+                        cx4[k] = group == 0 ? _mm256_castps256_ps128(cx[k]) : _mm256_extractf128_ps(cx[k], 1);
+                        cy4[k] = group == 0 ? _mm256_castps256_ps128(cy[k]) : _mm256_extractf128_ps(cy[k], 1);
+                    }
+                    const size_t j = i + static_cast<size_t>(group) * 4;
+                    EmitFourQuads(cx4, cy4,
+                                  _mm_loadu_ps(&q.u0[j]), _mm_loadu_ps(&q.v0[j]),
+                                  _mm_loadu_ps(&q.u1[j]), _mm_loadu_ps(&q.v1[j]),
+                                  _mm_loadu_ps(&q.r[j]), _mm_loadu_ps(&q.g[j]),
+                                  _mm_loadu_ps(&q.b[j]), _mm_loadu_ps(&q.a[j]),
+                                  &q.textureIndex[j], out + j * 4);
+                }
+            }
+
+            // Remaining quads
+            GenerateRangeScalar(q, i, count, out);
+        }
+
+        const char* GetInstructionSet() { return "AVX2"; }
+
+#elif defined(GP2_QUAD_KERNEL_SSE2)
+
+        // ===================================================================
+        // SSE2 PATH (4 quads per iteration)
+        // ===================================================================
+
+        void GenerateVertices(const QuadBatchSoA& q, BatchQuadVertex* out) {
+            const size_t count = q.Size();
+            const __m128 half = _mm_set1_ps(0.5f);
+            const __m128 zero = _mm_setzero_ps();
+
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                const __m128 px = _mm_loadu_ps(&q.posX[i]);
+                const __m128 py = _mm_loadu_ps(&q.posY[i]);
+                const __m128 hw = _mm_mul_ps(_mm_loadu_ps(&q.sizeX[i]), half);
+                const __m128 hh = _mm_mul_ps(_mm_loadu_ps(&q.sizeY[i]), half);
+                const __m128 rot = _mm_loadu_ps(&q.rotation[i]);
+                const int rotatedMask = _mm_movemask_ps(_mm_cmpneq_ps(rot, zero));
+
+                __m128 cx[4], cy[4];
+                if (rotatedMask == 0) {
+                    // Axis-aligned: no trigonometry needed
+                    const __m128 minX = _mm_sub_ps(px, hw);
+                    const __m128 maxX = _mm_add_ps(px, hw);
+                    const __m128 minY = _mm_sub_ps(py, hh);
+                    const __m128 maxY = _mm_add_ps(py, hh);
+                    cx[0] = minX; cx[1] = maxX; cx[2] = maxX; cx[3] = minX;
+                    cy[0] = minY; cy[1] = minY; cy[2] = maxY; cy[3] = maxY;
+                } else {
+                    alignas(16) float cosLanes[4];
+                    alignas(16) float sinLanes[4];
+                    SinCosLanes(&q.rotation[i], rotatedMask, 4, cosLanes, sinLanes);
+                    const __m128 c = _mm_load_ps(cosLanes);
+                    const __m128 s = _mm_load_ps(sinLanes);
+
+                    const __m128 hwc = _mm_mul_ps(hw, c);
+                    const __m128 hws = _mm_mul_ps(hw, s);
+                    const __m128 hhc = _mm_mul_ps(hh, c);
+                    const __m128 hhs = _mm_mul_ps(hh, s);
+
+                    // x = lx*c - ly*s + px, y = lx*s + ly*c + py
+                    cx[0] = _mm_add_ps(_mm_sub_ps(hhs, hwc), px);
+                    cy[0] = _mm_sub_ps(py, _mm_add_ps(hws, hhc));
+                    cx[1] = _mm_add_ps(_mm_add_ps(hwc, hhs), px);
+                    cy[1] = _mm_add_ps(_mm_sub_ps(hws, hhc), py);
+                    cx[2] = _mm_add_ps(_mm_sub_ps(hwc, hhs), px);
+                    cy[2] = _mm_add_ps(_mm_add_ps(hws, hhc), py);
+                    cx[3] = _mm_sub_ps(px, _mm_add_ps(hwc, hhs));
+                    cy[3] = _mm_add_ps(_mm_sub_ps(hhc, hws), py);
+                }
+
+                EmitFourQuads(cx, cy,
+                              _mm_loadu_ps(&q.u0[i]), _mm_loadu_ps(&q.v0[i]),
+                              _mm_loadu_ps(&q.u1[i]), _mm_loadu_ps(&q.v1[i]),
+                              _mm_loadu_ps(&q.r[i]), _mm_loadu_ps(&q.g[i]),
+                              _mm_loadu_ps(&q.b[i]), _mm_loadu_ps(&q.a[i]),
+                              &q.textureIndex[i], out + i * 4);
+            }
+
+            // Remaining quads
+            GenerateRangeScalar(q, i, count, out);
+        }
+
+        const char* GetInstructionSet() { return "SSE2"; }
+
+#else
+
+        // ===================================================================
+        // SCALAR FALLBACK
+        // ===================================================================
+
+        void GenerateVertices(const QuadBatchSoA& q, BatchQuadVertex* out) {
+            GenerateRangeScalar(q, 0, q.Size(), out);
+        }
+
+        const char* GetInstructionSet() { return "Scalar"; }
+
+#endif
+
+        // ===================================================================
+        // BENCHMARK
+        // ===================================================================
+
+        /**
+         * @brief Original per-quad vertex code from DrawTexturedQuadBatch
+         *
+         * Kept as the baseline for RunBenchmark.
+         */
+        static void LegacyPushQuad(std::vector<BatchQuadVertex>& vertices, const glm::vec2& position,
+                                   const glm::vec2& size, float rotation, const glm::vec4& texCoords,
+                                   const glm::vec4& color, int textureSlot) {
+            float cosRot = std::cos(glm::radians(rotation));
+            float sinRot = std::sin(glm::radians(rotation));
+            float halfWidth = size.x * 0.5f;
+            float halfHeight = size.y * 0.5f;
+
+            glm::vec2 positions[4] = {
+                glm::vec2(-halfWidth, -halfHeight),
+                glm::vec2( halfWidth, -halfHeight),
+                glm::vec2( halfWidth,  halfHeight),
+                glm::vec2(-halfWidth,  halfHeight)
+            };
+
+            for (int i = 0; i < 4; ++i) {
+                float x = positions[i].x;
+                float y = positions[i].y;
+                positions[i].x = x * cosRot - y * sinRot + position.x;
+                positions[i].y = x * sinRot + y * cosRot + position.y;
+            }
+
+            for (int i = 0; i < 4; ++i) {
+                BatchQuadVertex vertex;
+                vertex.position = positions[i];
+                vertex.texCoords = glm::vec2(
+                    (i == 0 || i == 3) ? texCoords.x : texCoords.z,
+                    (i < 2) ? texCoords.y : texCoords.w
+                );
+                vertex.color = color;
+                vertex.textureIndex = static_cast<float>(textureSlot);
+                vertices.push_back(vertex);
+            }
+        }
+
+        BenchmarkResult RunBenchmark(size_t quadCount, int iterations, float rotatedFraction) {
+            using Clock = std::chrono::high_resolution_clock;
+
+            BenchmarkResult result;
+            result.quadCount = quadCount;
+            result.iterations = iterations;
+            result.instructionSet = GetInstructionSet();
+            if (quadCount == 0 || iterations <= 0) {
+                return result;
+            }
+
+            // Deterministic input resembling a sprite-heavy scene
+            struct InputQuad {
+                glm::vec2 position, size;
+                float rotation;
+                glm::vec4 texCoords, color;
+                int slot;
+            };
+            std::vector<InputQuad> inputs(quadCount);
+            unsigned int seed = 12345u;
+            auto nextFloat = [&seed]() {
+                seed = seed * 1664525u + 1013904223u;
+                return static_cast<float>(seed >> 8) / static_cast<float>(1u << 24);
+            };
+            for (InputQuad& in : inputs) {
+                in.position = glm::vec2(nextFloat() * 1024.0f, nextFloat() * 768.0f);
+                in.size = glm::vec2(16.0f + nextFloat() * 48.0f, 16.0f + nextFloat() * 48.0f);
+                in.rotation = nextFloat() < rotatedFraction ? nextFloat() * 360.0f : 0.0f;
+                in.texCoords = glm::vec4(0.0f, 0.0f, 0.25f, 0.25f);
+                in.color = glm::vec4(1.0f, nextFloat(), nextFloat(), 1.0f);
+                in.slot = static_cast<int>(nextFloat() * 8.0f);
+            }
+
+            std::vector<BatchQuadVertex> legacyVertices;
+            legacyVertices.reserve(quadCount * 4);
+            std::vector<BatchQuadVertex> kernelVertices(quadCount * 4);
+            QuadBatchSoA soa;
+            soa.Reserve(quadCount);
+
+            volatile float sink = 0.0f;
+
+            // Legacy: trig + push_back per quad
+            auto start = Clock::now();
+            for (int it = 0; it < iterations; ++it) {
+                legacyVertices.clear();
+                for (const InputQuad& in : inputs) {
+                    LegacyPushQuad(legacyVertices, in.position, in.size, in.rotation, in.texCoords, in.color, in.slot);
+                }
+                sink = sink + legacyVertices[quadCount * 2].position.x;
+            }
+            double legacyMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+            // Batched: queue into SoA then run the kernel (what the renderer does)
+            start = Clock::now();
+            for (int it = 0; it < iterations; ++it) {
+                soa.Clear();
+                for (const InputQuad& in : inputs) {
+                    soa.Push(in.position, in.size, in.rotation, in.texCoords, in.color, static_cast<float>(in.slot));
+                }
+                GenerateVertices(soa, kernelVertices.data());
+                sink = sink + kernelVertices[quadCount * 2].position.x;
+            }
+            double batchedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+            // Kernel only: SoA already filled
+            start = Clock::now();
+            for (int it = 0; it < iterations; ++it) {
+                GenerateVertices(soa, kernelVertices.data());
+                sink = sink + kernelVertices[quadCount * 2].position.x;
+            }
+            double kernelMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+            const double totalQuads = static_cast<double>(quadCount) * iterations;
+            result.legacyQuadsPerMs = legacyMs > 0.0 ? totalQuads / legacyMs : 0.0;
+            result.batchedQuadsPerMs = batchedMs > 0.0 ? totalQuads / batchedMs : 0.0;
+            result.kernelQuadsPerMs = kernelMs > 0.0 ? totalQuads / kernelMs : 0.0;
+            result.speedup = result.legacyQuadsPerMs > 0.0 ? result.batchedQuadsPerMs / result.legacyQuadsPerMs : 0.0;
+            return result;
+        }
+    }
+
+} // namespace GP2Engine
@@ -0,0 +1,175 @@
+/**
+ * @file QuadKernel.hpp
+ * @brief SIMD quad vertex generation kernel for the sprite batcher
+ * @author Asri (100%)
+ *
+ * This file contains the structure-of-arrays quad queue used by the batch
+ * renderer and the kernel that expands it into packed quad vertices. The
+ * kernel processes 8 quads per iteration with AVX2, 4 with SSE2 and falls
+ * back to scalar code on other targets. Quads with zero rotation skip the
+ * trigonometry entirely.
+ */
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstddef>
+
+namespace GP2Engine {
+
+    /**
+     * @brief Packed vertex written by the quad kernel
+     *
+     * Layout matches the batch shader attributes (position, texCoords,
+     * color, textureIndex) and is uploaded to the GPU as-is.
+     */
+    struct BatchQuadVertex {
+        glm::vec2 position;        ///< Vertex position
+        glm::vec2 texCoords;       ///< Texture coordinates
+        glm::vec4 color;           ///< Vertex color
+        float textureIndex;        ///< Texture slot index
+    };
+
+    /**
+     * @brief Structure-of-arrays queue of quads waiting to be expanded
+     *
+     * Each field is stored in its own contiguous array so the kernel can
+     * load several quads into one SIMD register at a time. The arrays are
+     * carved out of a single buffer with a small gap between them; separate
+     * page-aligned allocations would make every field map to the same cache
+     * sets and stall the 14 interleaved write streams in Push.
+     *
+     * @author Asri (100%)
+     */
+    struct QuadBatchSoA {
+        float* posX{nullptr};             ///< Quad center X
+        float* posY{nullptr};             ///< Quad center Y
+        float* sizeX{nullptr};            ///< Quad width
+        float* sizeY{nullptr};            ///< Quad height
+        float* rotation{nullptr};         ///< Rotation in degrees
+        float* u0{nullptr};               ///< Texture rectangle x
+        float* v0{nullptr};               ///< Texture rectangle y
+        float* u1{nullptr};               ///< Texture rectangle z
+        float* v1{nullptr};               ///< Texture rectangle w
+        float* r{nullptr};                ///< Color tint red
+        float* g{nullptr};                ///< Color tint green
+        float* b{nullptr};                ///< Color tint blue
+        float* a{nullptr};                ///< Color tint alpha
+        float* textureIndex{nullptr};     ///< Texture slot index
+
+        QuadBatchSoA() = default;
+        QuadBatchSoA(const QuadBatchSoA&) = delete;
+        QuadBatchSoA& operator=(const QuadBatchSoA&) = delete;
+
+        /**
+         * @brief Remove all quads (keeps capacity)
+         */
+        void Clear() { m_Count = 0; }
+
+        /**
+         * @brief Reserve capacity for a number of quads
+         *
+         * All fields live in one allocation, sized up front so Push only
+         * writes by index. Existing quads are preserved.
+         *
+         * @param count Number of quads
+         */
+        void Reserve(size_t count);
+
+        /**
+         * @brief Get number of queued quads
+         *
+         * @return Quad count
+         */
+        size_t Size() const { return m_Count; }
+
+        /**
+         * @brief Queue one quad
+         *
+         * @param position Center of the quad
+         * @param size Size of the quad
+         * @param rotationDegrees Rotation angle in degrees
+         * @param texCoords Texture coordinates (x, y, z, w)
+         * @param color Color tint
+         * @param textureSlot Texture slot index
+         */
+        void Push(const glm::vec2& position, const glm::vec2& size, float rotationDegrees,
+                  const glm::vec4& texCoords, const glm::vec4& color, float textureSlot);
+
+        /**
+         * @brief Get number of quads that fit without reallocating
+         *
+         * @return Capacity in quads
+         */
+        size_t Capacity() const { return m_Capacity; }
+
+    private:
+        static constexpr size_t FIELD_COUNT = 14;      ///< Number of per-quad float arrays
+        static constexpr size_t FIELD_PADDING = 16;    ///< Floats between arrays (avoids 4K aliasing)
+
+        std::vector<float> m_Storage;                  ///< Backing store for all fields
+        size_t m_Count{0};                             ///< Number of queued quads
+        size_t m_Capacity{0};                          ///< Quads per field array
+    };
+
+    /**
+     * @brief Quad vertex generation kernel and its benchmark
+     */
+    namespace QuadKernel {
+
+        /**
+         * @brief Result of a quad generation benchmark run
+         */
+        struct BenchmarkResult {
+            size_t quadCount = 0;              ///< Quads generated per iteration
+            int iterations = 0;                ///< Number of iterations
+            double legacyQuadsPerMs = 0.0;     ///< Throughput of the per-quad scalar path
+            double batchedQuadsPerMs = 0.0;    ///< Throughput of SoA queueing plus kernel
+            double kernelQuadsPerMs = 0.0;     ///< Throughput of the kernel alone
+            double speedup = 0.0;              ///< batched / legacy
+            const char* instructionSet = "";   ///< Instruction set used by the kernel
+        };
+
+        /**
+         * @brief Expand queued quads into packed vertices
+         *
+         * Writes 4 vertices per quad in bottom-left, bottom-right, top-right,
+         * top-left order. Uses the widest instruction set available at
+         * compile time.
+         *
+         * @param quads Queued quads
+         * @param outVertices Destination, must hold quads.Size() * 4 vertices
+         */
+        void GenerateVertices(const QuadBatchSoA& quads, BatchQuadVertex* outVertices);
+
+        /**
+         * @brief Scalar reference implementation of GenerateVertices
+         *
+         * @param quads Queued quads
+         * @param outVertices Destination, must hold quads.Size() * 4 vertices
+         */
+        void GenerateVerticesScalar(const QuadBatchSoA& quads, BatchQuadVertex* outVertices);
+
+        /**
+         * @brief Get the name of the instruction set compiled into the kernel
+         *
+         * @return "AVX2", "SSE2" or "Scalar"
+         */
+        const char* GetInstructionSet();
+
+        /**
+         * @brief Measure quads per millisecond of the kernel against the per-quad path
+         *
+         * The legacy path mirrors the original DrawTexturedQuadBatch vertex code
+         * (trigonometry and push_back per quad). No OpenGL calls are made.
+         *
+         * @param quadCount Quads per iteration
+         * @param iterations Number of iterations to average
+         * @param rotatedFraction Fraction of quads with non-zero rotation (0..1)
+         * @return Benchmark result
+         */
+        BenchmarkResult RunBenchmark(size_t quadCount, int iterations, float rotatedFraction);
+    }
+
+} // namespace GP2Engine
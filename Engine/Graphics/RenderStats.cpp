@@ -0,0 +1,178 @@
+/**
+ * @file RenderStats.cpp
+ * @brief Rendering statistics history implementation
+ * @author Asri (100%)
+ *
+ * This file contains the implementation of the RenderStatsHistory class and
+ * its CSV/JSON writers.
+ */
+
+#include "RenderStats.hpp"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+namespace GP2Engine {
+
+    const char* GetFlushReasonName(FlushReason reason) {
+        switch (reason) {
+            case FlushReason::TextureSlotsFull: return "texture_slots_full";
+            case FlushReason::BufferFull:       return "buffer_full";
+            case FlushReason::LayerChange:      return "layer_change";
+            case FlushReason::TextInterrupt:    return "text_interrupt";
+            case FlushReason::EndOfFrame:       return "end_of_frame";
+            default:                            return "unknown";
+        }
+    }
+
+    RenderStatsHistory::RenderStatsHistory(size_t capacity)
+        : m_Frames(std::max<size_t>(capacity, 1)) {
+    }
+
+    void RenderStatsHistory::Push(const RenderFrameStats& stats) {
+        m_Frames[m_Next] = stats;
+        m_Next = (m_Next + 1) % m_Frames.size();
+        m_Count = std::min(m_Count + 1, m_Frames.size());
+    }
+
+    void RenderStatsHistory::Clear() {
+        m_Next = 0;
+        m_Count = 0;
+    }
+
+    const RenderFrameStats& RenderStatsHistory::Get(size_t index) const {
+        const size_t oldest = (m_Next + m_Frames.size() - m_Count) % m_Frames.size();
+        return m_Frames[(oldest + index) % m_Frames.size()];
+    }
+
+    const RenderFrameStats& RenderStatsHistory::Latest() const {
+        static const RenderFrameStats empty{};
+        return m_Count > 0 ? Get(m_Count - 1) : empty;
+    }
+
+    RenderFrameStats RenderStatsHistory::Average() const {
+        RenderFrameStats average;
+        if (m_Count == 0) {
+            return average;
+        }
+
+        // Sum in 64 bits, then divide
+        uint64_t drawCalls = 0, batches = 0, quads = 0, immediateQuads = 0, glyphs = 0, bytesUploaded = 0, bufferUploads = 0;
+        uint64_t textureBinds = 0, redundantBindsSkipped = 0, textureEvictions = 0, stateChanges = 0, submitted = 0, culled = 0;
+        std::array<uint64_t, FLUSH_REASON_COUNT> flushes{};
+        double sortMs = 0.0;
+
+        for (size_t i = 0; i < m_Count; ++i) {
+            const RenderFrameStats& frame = Get(i);
+            drawCalls += frame.drawCalls;
+            batches += frame.batches;
+            quads += frame.quads;
+            immediateQuads += frame.immediateQuads;
+            glyphs += frame.glyphs;
+            bytesUploaded += frame.bytesUploaded;
+            bufferUploads += frame.bufferUploads;
+            textureBinds += frame.textureBinds;
+            redundantBindsSkipped += frame.redundantBindsSkipped;
+            textureEvictions += frame.textureEvictions;
+            stateChanges += frame.stateChanges;
+            submitted += frame.submittedObjects;
+            culled += frame.culledObjects;
+            sortMs += frame.sortMs;
+            for (size_t reason = 0; reason < FLUSH_REASON_COUNT; ++reason) {
+                flushes[reason] += frame.flushes[reason];
+            }
+        }
+
+        const uint64_t count = m_Count;
+        average.frameIndex = Latest().frameIndex;
+        average.drawCalls = static_cast<uint32_t>(drawCalls / count);
+        average.batches = static_cast<uint32_t>(batches / count);
+        average.quads = static_cast<uint32_t>(quads / count);
+        average.immediateQuads = static_cast<uint32_t>(immediateQuads / count);
+        average.glyphs = static_cast<uint32_t>(glyphs / count);
+        average.bytesUploaded = bytesUploaded / count;
+        average.bufferUploads = static_cast<uint32_t>(bufferUploads / count);
+        average.textureBinds = static_cast<uint32_t>(textureBinds / count);
+        average.redundantBindsSkipped = static_cast<uint32_t>(redundantBindsSkipped / count);
+        average.textureEvictions = static_cast<uint32_t>(textureEvictions / count);
+        average.stateChanges = static_cast<uint32_t>(stateChanges / count);
+        average.submittedObjects = static_cast<uint32_t>(submitted / count);
+        average.culledObjects = static_cast<uint32_t>(culled / count);
+        average.sortMs = static_cast<float>(sortMs / static_cast<double>(count));
+        for (size_t reason = 0; reason < FLUSH_REASON_COUNT; ++reason) {
+            average.flushes[reason] = static_cast<uint32_t>(flushes[reason] / count);
+        }
+        return average;
+    }
+
+    bool RenderStatsHistory::SaveCSV(const std::string& filepath) const {
+        std::ofstream file(filepath);
+        if (!file.is_open()) {
+            std::cerr << "RenderStatsHistory: Could not open " << filepath << " for writing" << std::endl;
+            return false;
+        }
+
+        file << "frame,draw_calls,batches,quads,immediate_quads,glyphs,bytes_uploaded,buffer_uploads,texture_binds,"
+                "redundant_binds_skipped,texture_evictions,state_changes,submitted_objects,culled_objects,sort_ms";
+        for (size_t reason = 0; reason < FLUSH_REASON_COUNT; ++reason) {
+            file << ",flush_" << GetFlushReasonName(static_cast<FlushReason>(reason));
+        }
+        file << "\n";
+
+        for (size_t i = 0; i < m_Count; ++i) {
+            const RenderFrameStats& frame = Get(i);
+            file << frame.frameIndex << ',' << frame.drawCalls << ',' << frame.batches << ',' << frame.quads << ','
+                 << frame.immediateQuads << ',' << frame.glyphs << ',' << frame.bytesUploaded << ',' << frame.bufferUploads << ','
+                 << frame.textureBinds << ',' << frame.redundantBindsSkipped << ',' << frame.textureEvictions << ','
+                 << frame.stateChanges << ',' << frame.submittedObjects << ',' << frame.culledObjects << ',' << frame.sortMs;
+            for (uint32_t flushes : frame.flushes) {
+                file << ',' << flushes;
+            }
+            file << "\n";
+        }
+        return file.good();
+    }
+
+    static nlohmann::json FrameToJson(const RenderFrameStats& frame) {
+        nlohmann::json json;
+        json["frame"] = frame.frameIndex;
+        json["draw_calls"] = frame.drawCalls;
+        json["batches"] = frame.batches;
+        json["quads"] = frame.quads;
+        json["immediate_quads"] = frame.immediateQuads;
+        json["glyphs"] = frame.glyphs;
+        json["bytes_uploaded"] = frame.bytesUploaded;
+        json["buffer_uploads"] = frame.bufferUploads;
+        json["texture_binds"] = frame.textureBinds;
+        json["redundant_binds_skipped"] = frame.redundantBindsSkipped;
+        json["texture_evictions"] = frame.textureEvictions;
+        json["state_changes"] = frame.stateChanges;
+        json["submitted_objects"] = frame.submittedObjects;
+        json["culled_objects"] = frame.culledObjects;
+        json["sort_ms"] = frame.sortMs;
+        for (size_t reason = 0; reason < FLUSH_REASON_COUNT; ++reason) {
+            json["flushes"][GetFlushReasonName(static_cast<FlushReason>(reason))] = frame.flushes[reason];
+        }
+        return json;
+    }
+
+    bool RenderStatsHistory::SaveJSON(const std::string& filepath) const {
+        nlohmann::json json;
+        json["frame_count"] = m_Count;
+        json["average"] = FrameToJson(Average());
+        json["frames"] = nlohmann::json::array();
+        for (size_t i = 0; i < m_Count; ++i) {
+            json["frames"].push_back(FrameToJson(Get(i)));
+        }
+
+        std::ofstream file(filepath);
+        if (!file.is_open()) {
+            std::cerr << "RenderStatsHistory: Could not open " << filepath << " for writing" << std::endl;
+            return false;
+        }
+        file << json.dump(2);
+        return file.good();
+    }
+
+} // namespace GP2Engine
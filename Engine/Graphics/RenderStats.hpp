@@ -0,0 +1,177 @@
+/**
+ * @file RenderStats.hpp
+ * @brief Per-frame rendering statistics and rolling history
+ * @author Asri (100%)
+ *
+ * This file contains the RenderFrameStats block the Renderer fills while a
+ * frame is submitted (batches and why they were flushed, bytes uploaded,
+ * texture binds, state changes, culled objects and sort time) and the
+ * RenderStatsHistory ring buffer that keeps the last frames for DebugUI and
+ * CSV/JSON dumps.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GP2Engine {
+
+    /**
+     * @brief Why a sprite batch was closed and drawn
+     */
+    enum class FlushReason : uint8_t {
+        TextureSlotsFull,  ///< Every texture unit was used by the batch
+        BufferFull,        ///< The batch reached Renderer::MAX_QUADS
+        LayerChange,       ///< A non-batched (immediate) sprite layer came next
+        TextInterrupt,     ///< Text had to be drawn in between
+        EndOfFrame,        ///< Last batch of the frame (or an explicit flush)
+        Count
+    };
+
+    constexpr size_t FLUSH_REASON_COUNT = static_cast<size_t>(FlushReason::Count);
+
+    /**
+     * @brief Get a short name for a flush reason (used as CSV/JSON keys)
+     *
+     * @param reason Flush reason
+     * @return Name such as "texture_slots_full"
+     */
+    const char* GetFlushReasonName(FlushReason reason);
+
+    /**
+     * @brief Counters of one rendered frame
+     */
+    struct RenderFrameStats {
+        uint64_t frameIndex = 0;           ///< Frame packet number
+        uint32_t drawCalls = 0;            ///< glDraw* calls
+        uint32_t batches = 0;              ///< Sprite batches drawn
+        uint32_t quads = 0;                ///< Quads drawn through batches
+        uint32_t immediateQuads = 0;       ///< Quads drawn one draw call each
+        uint32_t glyphs = 0;               ///< Text glyphs drawn
+        uint64_t bytesUploaded = 0;        ///< Vertex and uniform buffer bytes sent to the GPU
+        uint32_t bufferUploads = 0;        ///< Buffer upload calls
+        uint32_t textureBinds = 0;         ///< glBindTexture calls
+        uint32_t redundantBindsSkipped = 0;///< Texture binds avoided by the unit cache
+        uint32_t textureEvictions = 0;     ///< Texture unit LRU evictions
+        uint32_t stateChanges = 0;         ///< Program, vertex array and blend state changes
+        uint32_t submittedObjects = 0;     ///< Renderables put into the frame packet
+        uint32_t culledObjects = 0;        ///< Renderables skipped while building the packet
+        float sortMs = 0.0f;               ///< Time spent sorting renderables by layer
+        std::array<uint32_t, FLUSH_REASON_COUNT> flushes{};  ///< Batch flushes per FlushReason
+
+        /**
+         * @brief Count a flush
+         *
+         * @param reason Why the batch was flushed
+         */
+        void AddFlush(FlushReason reason) { flushes[static_cast<size_t>(reason)]++; }
+
+        /**
+         * @brief Get the number of flushes for one reason
+         *
+         * @param reason Flush reason
+         * @return Flush count
+         */
+        uint32_t GetFlushes(FlushReason reason) const { return flushes[static_cast<size_t>(reason)]; }
+    };
+
+    /**
+     * @brief Ring buffer of the most recent frame statistics
+     *
+     * @author Asri (100%)
+     */
+    class RenderStatsHistory {
+    public:
+        static constexpr size_t DEFAULT_CAPACITY = 300;   ///< Five seconds at 60 FPS
+
+        explicit RenderStatsHistory(size_t capacity = DEFAULT_CAPACITY);
+
+        /**
+         * @brief Append a frame (overwrites the oldest one when full)
+         *
+         * @param stats Frame statistics
+         */
+        void Push(const RenderFrameStats& stats);
+
+        /**
+         * @brief Remove all frames
+         */
+        void Clear();
+
+        /**
+         * @brief Get number of frames stored
+         *
+         * @return Frame count (at most GetCapacity())
+         */
+        size_t Size() const { return m_Count; }
+
+        /**
+         * @brief Get maximum number of frames kept
+         *
+         * @return Capacity
+         */
+        size_t GetCapacity() const { return m_Frames.size(); }
+
+        /**
+         * @brief Get a stored frame
+         *
+         * @param index 0 = oldest, Size() - 1 = newest
+         * @return Frame statistics
+         */
+        const RenderFrameStats& Get(size_t index) const;
+
+        /**
+         * @brief Get the newest frame
+         *
+         * @return Frame statistics (all zero when empty)
+         */
+        const RenderFrameStats& Latest() const;
+
+        /**
+         * @brief Average every counter over the stored frames
+         *
+         * @return Averaged statistics (integer counters are rounded down)
+         */
+        RenderFrameStats Average() const;
+
+        /**
+         * @brief Copy one counter of every frame, oldest first (for ImGui::PlotLines)
+         *
+         * @param member Counter to read
+         * @param out Values (resized to Size())
+         */
+        template <typename T>
+        void Collect(T RenderFrameStats::* member, std::vector<float>& out) const {
+            out.resize(m_Count);
+            for (size_t i = 0; i < m_Count; ++i) {
+                out[i] = static_cast<float>(Get(i).*member);
+            }
+        }
+
+        /**
+         * @brief Write the history as CSV (one row per frame)
+         *
+         * @param filepath Output file
+         * @return true if the file was written
+         */
+        bool SaveCSV(const std::string& filepath) const;
+
+        /**
+         * @brief Write the history as JSON (array of frames plus the average)
+         *
+         * @param filepath Output file
+         * @return true if the file was written
+         */
+        bool SaveJSON(const std::string& filepath) const;
+
+    private:
+        std::vector<RenderFrameStats> m_Frames;   ///< Ring storage
+        size_t m_Next{0};                         ///< Slot the next frame goes to
+        size_t m_Count{0};                        ///< Frames stored
+    };
+
+} // namespace GP2Engine
@@ -0,0 +1,225 @@
+/**
+ * @file RenderThread.cpp
+ * @brief Double-buffered frame packet pipeline implementation
+ * @author Asri (100%)
+ *
+ * This file contains the implementation of the RenderThread class. Slot states
+ * are the only shared data between the threads: a slot is written by the main
+ * thread while Building, read by the render thread while Preparing, and read
+ * by the main thread again once Prepared.
+ */
+
+#include "RenderThread.hpp"
+#include "Renderer.hpp"
+#include <algorithm>
+
+namespace GP2Engine {
+
+    RenderThread::RenderThread()
+        : m_SlotAssignment(static_cast<int>(Renderer::MAX_TEXTURE_SLOTS)) {
+    }
+
+    RenderThread::~RenderThread() {
+        Shutdown();
+    }
+
+    void RenderThread::SetThreaded(bool threaded) {
+        if (threaded == m_Threaded) {
+            return;
+        }
+
+        Flush();
+
+        if (threaded) {
+            m_StopRequested = false;
+            m_Worker = std::thread(&RenderThread::WorkerLoop, this);
+        } else {
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_StopRequested = true;
+            }
+            m_WorkReady.notify_all();
+            m_Worker.join();
+        }
+        m_Threaded = threaded;
+    }
+
+    void RenderThread::SetFrameLatency(int frames) {
+        frames = std::clamp(frames, 0, MAX_FRAME_LATENCY);
+        if (frames == m_FrameLatency) {
+            return;
+        }
+
+        Flush();
+        m_FrameLatency = frames;
+    }
+
+    FramePacket& RenderThread::BeginFrame() {
+        // Exactly one slot is free: the other is pending (latency 1) or free too
+        int slot = -1;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            for (int i = 0; i < SLOT_COUNT; ++i) {
+                if (m_Slots[i].state == SlotState::Free) {
+                    slot = i;
+                    break;
+                }
+            }
+        }
+        if (slot < 0) {
+            // BeginFrame called twice without EndFrame; start over
+            Flush();
+            slot = 0;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Slots[slot].state = SlotState::Building;
+        }
+        m_BuildSlot = slot;
+        m_Slots[slot].packet.Clear();
+        m_Slots[slot].packet.frameIndex = ++m_FrameCounter;
+        m_BuildStart = std::chrono::high_resolution_clock::now();
+        return m_Slots[slot].packet;
+    }
+
+    void RenderThread::EndFrame(Renderer* renderer) {
+        if (m_BuildSlot < 0) {
+            return;
+        }
+
+        const int builtSlot = m_BuildSlot;
+        m_BuildSlot = -1;
+        m_LastSpriteCount = m_Slots[builtSlot].packet.sprites.size();
+
+        auto buildEnd = std::chrono::high_resolution_clock::now();
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            Accumulate(m_Stats.buildMs, std::chrono::duration<double, std::milli>(buildEnd - m_BuildStart).count());
+            m_Stats.framesSubmitted++;
+            m_Slots[builtSlot].state = SlotState::Queued;
+        }
+
+        // Hand the packet to the render thread, or prepare it right here
+        if (m_Threaded) {
+            m_WorkReady.notify_one();
+        } else {
+            PrepareSlot(builtSlot);
+        }
+
+        // Pick the packet that is due this frame
+        int dueSlot = builtSlot;
+        if (m_FrameLatency > 0) {
+            dueSlot = m_PendingSlot;
+            m_PendingSlot = builtSlot;
+        }
+        if (dueSlot < 0) {
+            return; // First frame with latency: nothing to draw yet
+        }
+
+        auto waitStart = std::chrono::high_resolution_clock::now();
+        WaitPrepared(dueSlot);
+        auto executeStart = std::chrono::high_resolution_clock::now();
+
+        Slot& due = m_Slots[dueSlot];
+        if (!m_Headless && renderer) {
+            FramePipeline::Execute(due.packet, due.prepared, *renderer);
+        }
+        auto executeEnd = std::chrono::high_resolution_clock::now();
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        Accumulate(m_Stats.waitMs, std::chrono::duration<double, std::milli>(executeStart - waitStart).count());
+        Accumulate(m_Stats.executeMs, std::chrono::duration<double, std::milli>(executeEnd - executeStart).count());
+        m_Stats.framesExecuted++;
+        due.state = SlotState::Free;
+    }
+
+    void RenderThread::Flush() {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_WorkDone.wait(lock, [this] {
+            for (const Slot& slot : m_Slots) {
+                if (slot.state == SlotState::Queued || slot.state == SlotState::Preparing) {
+                    return false;
+                }
+            }
+            return true;
+        });
+
+        for (Slot& slot : m_Slots) {
+            slot.state = SlotState::Free;
+        }
+        m_PendingSlot = -1;
+        m_BuildSlot = -1;
+    }
+
+    void RenderThread::Shutdown() {
+        SetThreaded(false);
+        Flush();
+        for (Slot& slot : m_Slots) {
+            slot.packet.Clear();
+            slot.prepared.Clear();
+        }
+    }
+
+    RenderThreadStats RenderThread::GetStats() const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_Stats;
+    }
+
+    void RenderThread::WorkerLoop() {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        while (true) {
+            // Oldest queued slot first
+            int slot = -1;
+            m_WorkReady.wait(lock, [this, &slot] {
+                slot = -1;
+                if (m_StopRequested) {
+                    return true;
+                }
+                for (int i = 0; i < SLOT_COUNT; ++i) {
+                    if (m_Slots[i].state == SlotState::Queued &&
+                        (slot < 0 || m_Slots[i].packet.frameIndex < m_Slots[slot].packet.frameIndex)) {
+                        slot = i;
+                    }
+                }
+                return slot >= 0;
+            });
+            if (m_StopRequested) {
+                return;
+            }
+
+            lock.unlock();
+            PrepareSlot(slot);
+            lock.lock();
+        }
+    }
+
+    void RenderThread::PrepareSlot(int slot) {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Slots[slot].state = SlotState::Preparing;
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        FramePipeline::Prepare(m_Slots[slot].packet, m_SlotAssignment, m_Slots[slot].prepared, m_ScratchQuads);
+        auto end = std::chrono::high_resolution_clock::now();
+
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            Accumulate(m_Stats.prepareMs, std::chrono::duration<double, std::milli>(end - start).count());
+            m_Slots[slot].state = SlotState::Prepared;
+        }
+        m_WorkDone.notify_all();
+    }
+
+    void RenderThread::WaitPrepared(int slot) {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_WorkDone.wait(lock, [this, slot] { return m_Slots[slot].state == SlotState::Prepared; });
+    }
+
+    void RenderThread::Accumulate(double& average, double sample) {
+        // Exponential moving average; the first sample seeds it
+        average = (average == 0.0) ? sample : average + (sample - average) * 0.1;
+    }
+
+} // namespace GP2Engine
@@ -0,0 +1,225 @@
+/**
+ * @file RenderThread.hpp
+ * @brief Double-buffered frame packet pipeline with an optional render thread
+ * @author Asri (100%)
+ *
+ * This file contains the RenderThread class which owns two frame packet slots.
+ * The main thread builds a packet into one slot while the render thread
+ * prepares the other (texture unit assignment and vertex generation). The
+ * OpenGL context stays on the main thread, which only issues the draw calls
+ * for prepared packets. With one frame of latency the main thread never waits
+ * for preparation of the frame it just built.
+ */
+
+#pragma once
+
+#include "FramePacket.hpp"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+namespace GP2Engine {
+
+    class Renderer;
+
+    /**
+     * @brief Timing of the frame packet pipeline (smoothed, in milliseconds)
+     */
+    struct RenderThreadStats {
+        uint64_t framesSubmitted = 0;     ///< Packets built and submitted
+        uint64_t framesExecuted = 0;      ///< Packets drawn (or skipped in headless mode)
+        double buildMs = 0.0;             ///< Main thread: building a packet
+        double prepareMs = 0.0;           ///< Render thread: preparing a packet
+        double waitMs = 0.0;              ///< Main thread: blocked on preparation
+        double executeMs = 0.0;           ///< Main thread: issuing draw calls
+    };
+
+    /**
+     * @brief Frame packet pipeline between simulation and GL submission
+     *
+     * Typical use per frame (main thread):
+     * @code
+     * FramePacket& packet = pipeline.BeginFrame();
+     * // ... fill packet ...
+     * pipeline.EndFrame(&renderer);   // submits it and draws the packet that is due
+     * @endcode
+     *
+     * By default preparation runs inline in EndFrame with no latency, which
+     * matches drawing directly; threading and latency are opt-in. Headless mode
+     * skips the draw calls, so the pipeline can be measured without a GL
+     * context.
+     *
+     * @author Asri (100%)
+     */
+    class RenderThread {
+    public:
+        static const int MAX_FRAME_LATENCY = 1;    ///< Packets that may be in flight behind the main thread
+
+        RenderThread();
+        ~RenderThread();
+
+        RenderThread(const RenderThread&) = delete;
+        RenderThread& operator=(const RenderThread&) = delete;
+
+        /**
+         * @brief Prepare packets on a dedicated thread instead of inline
+         *
+         * Packets in flight are dropped when the mode changes.
+         *
+         * @param threaded true to start the render thread, false to stop it
+         */
+        void SetThreaded(bool threaded);
+
+        /**
+         * @brief Check if packets are prepared on the render thread
+         *
+         * @return true if the render thread is running
+         */
+        bool IsThreaded() const { return m_Threaded; }
+
+        /**
+         * @brief Set how many frames the drawn packet may lag behind the built one
+         *
+         * 0 draws each packet in the frame it was built (the main thread waits
+         * for preparation). 1 draws the previous frame's packet, so preparing
+         * frame N overlaps with building frame N+1.
+         *
+         * @param frames Latency in frames (clamped to 0..MAX_FRAME_LATENCY)
+         */
+        void SetFrameLatency(int frames);
+
+        /**
+         * @brief Get the configured frame latency
+         *
+         * @return Latency in frames
+         */
+        int GetFrameLatency() const { return m_FrameLatency; }
+
+        /**
+         * @brief Skip all OpenGL calls (for throughput measurements)
+         *
+         * @param headless true to build and prepare packets without drawing them
+         */
+        void SetHeadless(bool headless) { m_Headless = headless; }
+
+        /**
+         * @brief Check if headless mode is enabled
+         *
+         * @return true if packets are not drawn
+         */
+        bool IsHeadless() const { return m_Headless; }
+
+        /**
+         * @brief Get an empty packet to build the current frame into
+         *
+         * @return Packet owned by the pipeline, valid until EndFrame
+         */
+        FramePacket& BeginFrame();
+
+        /**
+         * @brief Submit the packet from BeginFrame and draw the packet that is due
+         *
+         * @param renderer Renderer to draw with (may be nullptr in headless mode)
+         */
+        void EndFrame(Renderer* renderer);
+
+        /**
+         * @brief Wait for the render thread and drop packets that were not drawn
+         */
+        void Flush();
+
+        /**
+         * @brief Stop the render thread and release packet contents
+         *
+         * Packets hold references to fonts, so call this before the GL
+         * context is destroyed.
+         */
+        void Shutdown();
+
+        /**
+         * @brief Get pipeline timing
+         *
+         * @return Copy of the current statistics
+         */
+        RenderThreadStats GetStats() const;
+
+        /**
+         * @brief Get number of sprites in the most recently built packet
+         *
+         * @return Sprite count
+         */
+        size_t GetLastSpriteCount() const { return m_LastSpriteCount; }
+
+    private:
+        /**
+         * @brief Lifecycle of a packet slot
+         */
+        enum class SlotState {
+            Free,          ///< Available for building
+            Building,      ///< Being filled by the main thread
+            Queued,        ///< Waiting for the render thread
+            Preparing,     ///< Being prepared by the render thread
+            Prepared       ///< Ready to draw
+        };
+
+        /**
+         * @brief One packet with its prepared data
+         */
+        struct Slot {
+            FramePacket packet;
+            PreparedFrame prepared;
+            SlotState state{SlotState::Free};
+        };
+
+        static const int SLOT_COUNT = MAX_FRAME_LATENCY + 1;
+
+        /**
+         * @brief Render thread main loop
+         */
+        void WorkerLoop();
+
+        /**
+         * @brief Prepare a slot's packet (render thread, or inline)
+         *
+         * @param slot Slot index
+         */
+        void PrepareSlot(int slot);
+
+        /**
+         * @brief Block until a slot is prepared
+         *
+         * @param slot Slot index
+         */
+        void WaitPrepared(int slot);
+
+        /**
+         * @brief Fold a new sample into a smoothed timing value
+         */
+        static void Accumulate(double& average, double sample);
+
+        Slot m_Slots[SLOT_COUNT];                        ///< Double-buffered packets
+        int m_BuildSlot{-1};                             ///< Slot being built (-1 = none)
+        int m_PendingSlot{-1};                           ///< Submitted slot not yet drawn (latency 1)
+        uint64_t m_FrameCounter{0};                      ///< Frames built so far
+        std::chrono::high_resolution_clock::time_point m_BuildStart;  ///< Start of the current build
+
+        // Preparation state, only used by whichever thread prepares
+        TextureSlotManager m_SlotAssignment;             ///< Persistent texture unit assignment
+        QuadBatchSoA m_ScratchQuads;                     ///< Scratch SoA queue
+
+        bool m_Threaded{false};                          ///< Render thread running
+        bool m_Headless{false};                          ///< Skip GL submission
+        int m_FrameLatency{0};                           ///< Frames between build and draw
+        size_t m_LastSpriteCount{0};                     ///< Sprites in the last built packet
+
+        std::thread m_Worker;                            ///< Render thread
+        mutable std::mutex m_Mutex;                      ///< Guards slot states, stop flag and stats
+        std::condition_variable m_WorkReady;             ///< Signalled when a slot is queued
+        std::condition_variable m_WorkDone;              ///< Signalled when a slot is prepared
+        bool m_StopRequested{false};                     ///< Tells the render thread to exit
+
+        RenderThreadStats m_Stats;                       ///< Pipeline timing
+    };
+
+} // namespace GP2Engine
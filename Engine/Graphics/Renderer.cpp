@@ -17,6 +17,7 @@
 #include <stdexcept>
 #include <iostream>
 #include <cmath>
+#include <algorithm>
 #include "glad/glad.h"
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
@@ -66,49 +67,42 @@ namespace GP2Engine {
     std::function<void(int, int)> Renderer::s_ResizeCallback = nullptr;
     // Static member for VSync state
     static bool s_VSyncEnabled = false;
+    // Static member for headless (no OpenGL) resource loading
+    static bool s_Headless = false;
     
     // Static shader source constants to reduce code duplication
-    static const std::string BASIC_VERTEX_SHADER = R"(
+    // Programs reading the camera declare the shared "Camera" block (see CAMERA_UNIFORM_BINDING)
+    static const std::string QUAD_VERTEX_SHADER = R"(
         #version 330 core
         layout (location = 0) in vec2 aPos;
-        uniform mat4 u_ViewProjection;
+        layout (std140) uniform Camera { mat4 u_ViewProjection; };
         uniform mat4 u_Transform;
-        void main() {
-            gl_Position = u_ViewProjection * u_Transform * vec4(aPos, 0.0, 1.0);
-        }
-    )";
-    
-    static const std::string BASIC_FRAGMENT_SHADER = R"(
-        #version 330 core
-        out vec4 FragColor;
-        uniform vec4 u_Color;
-        void main() {
-            FragColor = u_Color;
-        }
-    )";
-    
-    static const std::string TEXTURED_VERTEX_SHADER = R"(
-        #version 330 core
-        layout (location = 0) in vec2 aPos;
+    #ifdef TEXTURED
         layout (location = 1) in vec2 aTexCoord;
-        uniform mat4 u_ViewProjection;
-        uniform mat4 u_Transform;
         out vec2 TexCoord;
+    #endif
         void main() {
             gl_Position = u_ViewProjection * u_Transform * vec4(aPos, 0.0, 1.0);
+    #ifdef TEXTURED
             TexCoord = aTexCoord;
+    #endif
         }
     )";
     
-    static const std::string TEXTURED_FRAGMENT_SHADER = R"(
+    static const std::string QUAD_FRAGMENT_SHADER = R"(
         #version 330 core
         out vec4 FragColor;
+        uniform vec4 u_Color;
+    #ifdef TEXTURED
         in vec2 TexCoord;
         uniform sampler2D u_Texture;
-        uniform vec4 u_Color;
+    #endif
         void main() {
-            vec4 texColor = texture(u_Texture, TexCoord);
-            FragColor = texColor * u_Color;
+    #ifdef TEXTURED
+            FragColor = texture(u_Texture, TexCoord) * u_Color;
+    #else
+            FragColor = u_Color;
+    #endif
         }
     )";
     
@@ -118,7 +112,7 @@ namespace GP2Engine {
         layout (location = 1) in vec2 aTexCoord;
         layout (location = 2) in vec4 aColor;
         layout (location = 3) in float aTextureIndex;
-        uniform mat4 u_ViewProjection;
+        layout (std140) uniform Camera { mat4 u_ViewProjection; };
         out vec2 TexCoord;
         out vec4 Color;
         out float TextureIndex;
@@ -147,57 +141,86 @@ namespace GP2Engine {
         }
     )";
     
-    // Helper function to create shader program
-    static unsigned int CreateShaderProgram(const std::string& vertexSource, const std::string& fragmentSource) {
-        unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
-        const char* vs = vertexSource.c_str();
-        glShaderSource(vertexShader, 1, &vs, NULL);
-        glCompileShader(vertexShader);
-        
-        int success;
-        glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-        if (!success) {
-            char infoLog[512];
-            glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-            std::cerr << "ERROR: Vertex shader compilation failed:\n" << infoLog << std::endl;
-            glDeleteShader(vertexShader);
-            return 0;
+    static const std::string TEXT_VERTEX_SHADER = R"(
+        #version 330 core
+        layout (location = 0) in vec4 vertex; // <vec2 pos, vec2 tex>
+        out vec2 TexCoords;
+
+        uniform mat4 u_Projection;
+
+        void main() {
+            gl_Position = u_Projection * vec4(vertex.xy, 0.0, 1.0);
+            TexCoords = vertex.zw;
+        }
+    )";
+
+    static const std::string TEXT_FRAGMENT_SHADER = R"(
+        #version 330 core
+        in vec2 TexCoords;
+        out vec4 color;
+
+        uniform sampler2D text;
+        uniform vec4 textColor;
+
+        void main() {
+            vec4 sampled = vec4(1.0, 1.0, 1.0, texture(text, TexCoords).r);
+            color = textColor * sampled;
         }
+    )";
+    
+    bool Renderer::InitializeShaders() {
+        m_ShaderCache.RegisterSource("quad", QUAD_VERTEX_SHADER, QUAD_FRAGMENT_SHADER);
+        m_ShaderCache.RegisterSource("batch", BATCH_VERTEX_SHADER, BATCH_FRAGMENT_SHADER);
+        m_ShaderCache.RegisterSource("text", TEXT_VERTEX_SHADER, TEXT_FRAGMENT_SHADER);
         
-        unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-        const char* fs = fragmentSource.c_str();
-        glShaderSource(fragmentShader, 1, &fs, NULL);
-        glCompileShader(fragmentShader);
+        // Compile every variant up front so drawing never compiles or looks up names
+        m_QuadProgram.shader = m_ShaderCache.GetProgram("quad");
+        m_TexturedQuadProgram.shader = m_ShaderCache.GetProgram("quad", { "TEXTURED" });
+        m_BatchShader = m_ShaderCache.GetProgram("batch");
+        m_TextShader = m_ShaderCache.GetProgram("text");
+        if (!m_QuadProgram.shader || !m_TexturedQuadProgram.shader || !m_BatchShader || !m_TextShader) {
+            std::cerr << "ERROR: Failed to compile renderer shaders" << std::endl;
+            return false;
+        }
         
-        glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-        if (!success) {
-            char infoLog[512];
-            glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-            std::cerr << "ERROR: Fragment shader compilation failed:\n" << infoLog << std::endl;
-            glDeleteShader(vertexShader);
-            glDeleteShader(fragmentShader);
-            return 0;
+        for (QuadProgram* program : { &m_QuadProgram, &m_TexturedQuadProgram }) {
+            program->transform = program->shader->GetUniformHandle("u_Transform");
+            program->color = program->shader->GetUniformHandle("u_Color");
         }
+        m_TextProjectionHandle = m_TextShader->GetUniformHandle("u_Projection");
+        m_TextColorHandle = m_TextShader->GetUniformHandle("textColor");
         
-        unsigned int program = glCreateProgram();
-        glAttachShader(program, vertexShader);
-        glAttachShader(program, fragmentShader);
-        glLinkProgram(program);
+        // Samplers never change, so set them once: u_Texture reads unit 0, u_Textures[i] reads unit i
+        m_TexturedQuadProgram.shader->Bind();
+        m_TexturedQuadProgram.shader->SetUniform1i(m_TexturedQuadProgram.shader->GetUniformHandle("u_Texture"), 0);
         
-        glGetProgramiv(program, GL_LINK_STATUS, &success);
-        if (!success) {
-            char infoLog[512];
-            glGetProgramInfoLog(program, 512, NULL, infoLog);
-            std::cerr << "ERROR: Shader program linking failed:\n" << infoLog << std::endl;
-            glDeleteShader(vertexShader);
-            glDeleteShader(fragmentShader);
-            glDeleteProgram(program);
-            return 0;
+        int textureUnits[MAX_TEXTURE_SLOTS];
+        for (int i = 0; i < static_cast<int>(MAX_TEXTURE_SLOTS); ++i) {
+            textureUnits[i] = i;
         }
+        m_BatchShader->Bind();
+        m_BatchShader->SetUniform1iv(m_BatchShader->GetUniformHandle("u_Textures"), static_cast<int>(MAX_TEXTURE_SLOTS), textureUnits);
         
-        glDeleteShader(vertexShader);
-        glDeleteShader(fragmentShader);
-        return program;
+        m_TextShader->Bind();
+        m_TextShader->SetUniform1i(m_TextShader->GetUniformHandle("text"), 0);
+        glUseProgram(0);
+        
+        // Shared camera block, written once per camera change
+        if (!m_CameraBuffer.Create(sizeof(glm::mat4), CAMERA_UNIFORM_BINDING)) {
+            return false;
+        }
+        m_CameraBufferDirty = true;
+        return true;
+    }
+    
+    void Renderer::UploadCameraBuffer() const {
+        if (m_CameraBufferDirty) {
+            glm::mat4 viewProjection = m_Camera.GetViewProjectionMatrix();
+            m_CameraBuffer.SetData(&viewProjection[0][0], sizeof(glm::mat4));
+            m_CameraBufferDirty = false;
+            m_FrameStats.bytesUploaded += sizeof(glm::mat4);
+            m_FrameStats.bufferUploads++;
+        }
     }
     
     bool Renderer::Initialize(GLFWwindow* window) {
@@ -239,6 +262,11 @@ namespace GP2Engine {
                                            static_cast<float>(height), 0.0f);
 
 
+        // Compile shaders and create the camera uniform buffer
+        if (!s_Instance->InitializeShaders()) {
+            return false;
+        }
+
         // Initialize debug renderer
         s_Instance->m_DebugRenderer = std::make_unique<DebugRenderer>();
         if (!s_Instance->m_DebugRenderer->Initialize()) {
@@ -257,6 +285,10 @@ namespace GP2Engine {
                 s_Instance->m_DebugRenderer.reset();
             }
             
+            // Release GPU programs and buffers while the context is still alive
+            s_Instance->m_ShaderCache.Clear();
+            s_Instance->m_CameraBuffer.Destroy();
+            
             // Note: Window is owned by Application, so we don't destroy it here
             s_Instance->m_Window = nullptr;
             s_Instance.reset();
@@ -319,6 +351,7 @@ namespace GP2Engine {
     
     void Renderer::SetCamera(const Camera& camera) {
         m_Camera = camera;
+        m_CameraBufferDirty = true;
     }
     
     bool Renderer::ShouldClose() const {
@@ -443,7 +476,7 @@ namespace GP2Engine {
     void Renderer::DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color) {
         // Simple working quad renderer using basic OpenGL
         static bool initialized = false;
-        static unsigned int VAO, VBO, EBO, shaderProgram;
+        static unsigned int VAO, VBO, EBO;
         
         if (!initialized) {
             // Create basic vertex data for a unit quad (centered at origin)
@@ -479,10 +512,6 @@ namespace GP2Engine {
             
             glBindVertexArray(0);
             
-            // Create a basic shader inline
-            shaderProgram = CreateShaderProgram(BASIC_VERTEX_SHADER, BASIC_FRAGMENT_SHADER);
-            if (shaderProgram == 0) return;
-            
             initialized = true;
         }
         
@@ -491,25 +520,17 @@ namespace GP2Engine {
         transform = glm::translate(transform, glm::vec3(position.x, position.y, 0.0f));
         transform = glm::scale(transform, glm::vec3(size.x, size.y, 1.0f));
         
-        // Safety check: ensure shader is valid
-        if (shaderProgram == 0) {
-            std::cerr << "ERROR: Shader program is invalid (0)" << std::endl;
-            return;
-        }
-        
-        // Use shader and set uniforms
-        glUseProgram(shaderProgram);
-        
-        // Use camera matrices properly
-        glm::mat4 viewProjection = m_Camera.GetViewProjectionMatrix();
-        
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "u_ViewProjection"), 1, GL_FALSE, &viewProjection[0][0]);
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "u_Transform"), 1, GL_FALSE, &transform[0][0]);
-        glUniform4f(glGetUniformLocation(shaderProgram, "u_Color"), color.r, color.g, color.b, color.a);
+        // Use shader and set uniforms (camera comes from the shared uniform block)
+        Shader& shader = *m_QuadProgram.shader;
+        shader.Bind();
+        UploadCameraBuffer();
+        shader.SetUniformMat4f(m_QuadProgram.transform, transform);
+        shader.SetUniform4f(m_QuadProgram.color, color.r, color.g, color.b, color.a);
         
         // Draw quad
         glBindVertexArray(VAO);
         glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+        CountImmediateDraw(0, false);
         
         // Check for OpenGL errors
         GLenum error = glGetError();
@@ -536,7 +557,7 @@ namespace GP2Engine {
                                    unsigned int textureID, const glm::vec4& texCoords, const glm::vec4& color) {
         // Textured quad renderer using OpenGL
         static bool initialized = false;
-        static unsigned int VAO, VBO, EBO, shaderProgram;
+        static unsigned int VAO, VBO, EBO;
 
         if (!initialized) {
             unsigned int indices[] = {
@@ -568,10 +589,6 @@ namespace GP2Engine {
 
             glBindVertexArray(0);
 
-            // Create textured shader
-            shaderProgram = CreateShaderProgram(TEXTURED_VERTEX_SHADER, TEXTURED_FRAGMENT_SHADER);
-            if (shaderProgram == 0) return;
-
             initialized = true;
         }
 
@@ -604,19 +621,18 @@ namespace GP2Engine {
             std::cerr << "ERROR: Texture binding failed: " << bindError << " (TextureID: " << textureID << ")" << std::endl;
         }
         
-        // Use shader and set uniforms
-        glUseProgram(shaderProgram);
-        
-        glm::mat4 viewProjection = m_Camera.GetViewProjectionMatrix();
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "u_ViewProjection"), 1, GL_FALSE, &viewProjection[0][0]);
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "u_Transform"), 1, GL_FALSE, &transform[0][0]);
-        glUniform4f(glGetUniformLocation(shaderProgram, "u_Color"), color.r, color.g, color.b, color.a);
-        glUniform1i(glGetUniformLocation(shaderProgram, "u_Texture"), 0);
+        // Use shader and set uniforms (u_Texture is fixed to unit 0)
+        Shader& shader = *m_TexturedQuadProgram.shader;
+        shader.Bind();
+        UploadCameraBuffer();
+        shader.SetUniformMat4f(m_TexturedQuadProgram.transform, transform);
+        shader.SetUniform4f(m_TexturedQuadProgram.color, color.r, color.g, color.b, color.a);
         
         
         // Draw textured quad
         glBindVertexArray(VAO);
         glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+        CountImmediateDraw(sizeof(vertices), true);
         
         
         // Cleanup
@@ -629,7 +645,7 @@ namespace GP2Engine {
     void Renderer::DrawQuad(const glm::vec2& position, const glm::vec2& size, float rotation, const glm::vec4& color) {
         // Same as regular DrawQuad but with rotation added to the transformation matrix
         static bool initialized = false;
-        static unsigned int VAO, VBO, EBO, shaderProgram;
+        static unsigned int VAO, VBO, EBO;
 
         if (!initialized) {
             // Same initialization as regular DrawQuad...
@@ -666,10 +682,6 @@ namespace GP2Engine {
 
             glBindVertexArray(0);
 
-            // Create a basic shader inline (same as regular DrawQuad)
-            shaderProgram = CreateShaderProgram(BASIC_VERTEX_SHADER, BASIC_FRAGMENT_SHADER);
-            if (shaderProgram == 0) return;
-            
             initialized = true;
         }
 
@@ -680,16 +692,16 @@ namespace GP2Engine {
         transform = glm::scale(transform, glm::vec3(size.x, size.y, 1.0f));
 
         // Use shader and set uniforms
-        glUseProgram(shaderProgram);
-
-        glm::mat4 viewProjection = m_Camera.GetViewProjectionMatrix();
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "u_ViewProjection"), 1, GL_FALSE, &viewProjection[0][0]);
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "u_Transform"), 1, GL_FALSE, &transform[0][0]);
-        glUniform4f(glGetUniformLocation(shaderProgram, "u_Color"), color.r, color.g, color.b, color.a);
+        Shader& shader = *m_QuadProgram.shader;
+        shader.Bind();
+        UploadCameraBuffer();
+        shader.SetUniformMat4f(m_QuadProgram.transform, transform);
+        shader.SetUniform4f(m_QuadProgram.color, color.r, color.g, color.b, color.a);
 
         // Draw quad
         glBindVertexArray(VAO);
         glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+        CountImmediateDraw(0, false);
         glBindVertexArray(0);
         glUseProgram(0);
     }
@@ -699,7 +711,7 @@ namespace GP2Engine {
                                    unsigned int textureID, const glm::vec4& texCoords, const glm::vec4& color) {
         // Copy most of the existing DrawTexturedQuad but add rotation to transform
         static bool initialized = false;
-        static unsigned int VAO, VBO, EBO, shaderProgram;
+        static unsigned int VAO, VBO, EBO;
 
         if (!initialized) {
             unsigned int indices[] = {
@@ -730,10 +742,6 @@ namespace GP2Engine {
 
             glBindVertexArray(0);
 
-            // Create shaders
-            shaderProgram = CreateShaderProgram(TEXTURED_VERTEX_SHADER, TEXTURED_FRAGMENT_SHADER);
-            if (shaderProgram == 0) return;
-
             initialized = true;
         }
 
@@ -757,23 +765,21 @@ namespace GP2Engine {
         transform = glm::rotate(transform, glm::radians(rotation), glm::vec3(0.0f, 0.0f, 1.0f));
         transform = glm::scale(transform, glm::vec3(size.x, size.y, 1.0f));
 
-        // Use shader
-        glUseProgram(shaderProgram);
-
-        // Set uniforms
-        glm::mat4 viewProjection = m_Camera.GetViewProjectionMatrix();
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "u_ViewProjection"), 1, GL_FALSE, &viewProjection[0][0]);
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "u_Transform"), 1, GL_FALSE, &transform[0][0]);
-        glUniform4f(glGetUniformLocation(shaderProgram, "u_Color"), color.r, color.g, color.b, color.a);
+        // Use shader and set uniforms (u_Texture is fixed to unit 0)
+        Shader& shader = *m_TexturedQuadProgram.shader;
+        shader.Bind();
+        UploadCameraBuffer();
+        shader.SetUniformMat4f(m_TexturedQuadProgram.transform, transform);
+        shader.SetUniform4f(m_TexturedQuadProgram.color, color.r, color.g, color.b, color.a);
 
         // Bind texture
         glActiveTexture(GL_TEXTURE0);
         glBindTexture(GL_TEXTURE_2D, textureID);
-        glUniform1i(glGetUniformLocation(shaderProgram, "u_Texture"), 0);
 
         // Draw quad
         glBindVertexArray(VAO);
         glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+        CountImmediateDraw(sizeof(vertices), true);
         glBindVertexArray(0);
         glBindTexture(GL_TEXTURE_2D, 0);
         glUseProgram(0);
@@ -781,11 +787,9 @@ namespace GP2Engine {
 
     void Renderer::BeginBatch() {
         m_BatchStarted = true;
-        m_QuadVertices.clear();
-        m_QuadVertices.reserve(MAX_VERTICES); // Pre-allocate for performance
-        m_TextureSlots.clear();
-        m_TextureSlots.reserve(MAX_TEXTURE_SLOTS);
-        m_CurrentTextureSlot = 0;
+        m_BatchQuads.Clear();
+        m_BatchQuads.Reserve(MAX_QUADS); // Pre-allocate for performance
+        m_TextureSlots.BeginBatch();
         m_VertexBufferOffset = 0;
     }
     
@@ -801,152 +805,56 @@ namespace GP2Engine {
                                         unsigned int textureID, const glm::vec4& texCoords, const glm::vec4& color) {
         // No frustum culling needed - all objects are within viewport
         
-        // Helper function to check if texture is in batch
-        auto isTextureInBatch = [this](unsigned int textureID) -> bool {
-            for (unsigned int id : m_TextureSlots) {
-                if (id == textureID) return true;
-            }
-            return false;
-        };
-        
-        // Helper function to get texture slot
-        auto getTextureSlot = [this](unsigned int textureID) -> int {
-            // Check if texture is already in batch
-            for (size_t i = 0; i < m_TextureSlots.size(); ++i) {
-                if (m_TextureSlots[i] == textureID) {
-                    return static_cast<int>(i);
-                }
-            }
-            
-            // Add new texture if there's room
-            if (m_CurrentTextureSlot < MAX_TEXTURE_SLOTS) {
-                m_TextureSlots.push_back(textureID);
-                return m_CurrentTextureSlot++;
-            }
-            
-            return -1; // No room
-        };
-        
         // Check if we need to flush the batch
-        if (m_QuadVertices.size() >= MAX_QUADS * 4 || 
-            (m_CurrentTextureSlot >= MAX_TEXTURE_SLOTS && !isTextureInBatch(textureID))) {
-            FlushBatch();
+        if (m_BatchQuads.Size() >= MAX_QUADS) {
+            FlushBatch(FlushReason::BufferFull);
         }
         
-        // Find or add texture slot
-        int textureSlot = getTextureSlot(textureID);
+        // Find or assign a persistent texture unit (evicts LRU instead of flushing)
+        int textureSlot = m_TextureSlots.AcquireSlot(textureID);
         if (textureSlot == -1) {
-            // No room for new texture, flush and try again
-            FlushBatch();
-            textureSlot = getTextureSlot(textureID);
-        }
-        
-        // Optimized: Direct vertex calculation (avoid matrix multiplication)
-        float cosRot = cos(glm::radians(rotation));
-        float sinRot = sin(glm::radians(rotation));
-        float halfWidth = size.x * 0.5f;
-        float halfHeight = size.y * 0.5f;
-        
-        // Calculate rotated corners directly
-        glm::vec2 positions[4] = {
-            glm::vec2(-halfWidth, -halfHeight), // bottom left
-            glm::vec2( halfWidth, -halfHeight), // bottom right
-            glm::vec2( halfWidth,  halfHeight), // top right
-            glm::vec2(-halfWidth,  halfHeight)  // top left
-        };
-        
-        // Apply rotation and translation
-        for (int i = 0; i < 4; ++i) {
-            float x = positions[i].x;
-            float y = positions[i].y;
-            positions[i].x = x * cosRot - y * sinRot + position.x;
-            positions[i].y = x * sinRot + y * cosRot + position.y;
+            // Every unit is used by this batch, flush and try again
+            FlushBatch(FlushReason::TextureSlotsFull);
+            textureSlot = m_TextureSlots.AcquireSlot(textureID);
         }
         
-        // Add vertices to batch
-        for (int i = 0; i < 4; ++i) {
-            QuadVertex vertex;
-            vertex.position = positions[i];
-            vertex.texCoords = glm::vec2(
-                (i == 0 || i == 3) ? texCoords.x : texCoords.z, // left or right
-                (i < 2) ? texCoords.y : texCoords.w             // top or bottom
-            );
-            vertex.color = color;
-            vertex.textureIndex = static_cast<float>(textureSlot);
-            m_QuadVertices.push_back(vertex);
-        }
+        // Queue the quad; vertices are generated for the whole batch in FlushBatch
+        m_BatchQuads.Push(position, size, rotation, texCoords, color, static_cast<float>(textureSlot));
     }
     
     void Renderer::DrawQuadBatch(const glm::vec2& position, const glm::vec2& size, float rotation, const glm::vec4& color) {
         // No frustum culling needed - all objects are within viewport
         
         // Check if we need to flush the batch
-        if (m_QuadVertices.size() >= MAX_QUADS * 4) {
-            FlushBatch();
+        if (m_BatchQuads.Size() >= MAX_QUADS) {
+            FlushBatch(FlushReason::BufferFull);
         }
         
         // Use texture slot 0 for colored quads (no texture)
         int textureSlot = 0;
         
-        // Optimized: Direct vertex calculation (avoid matrix multiplication)
-        float cosRot = cos(glm::radians(rotation));
-        float sinRot = sin(glm::radians(rotation));
-        float halfWidth = size.x * 0.5f;
-        float halfHeight = size.y * 0.5f;
-        
-        // Calculate rotated corners directly
-        glm::vec2 positions[4] = {
-            glm::vec2(-halfWidth, -halfHeight), // bottom left
-            glm::vec2( halfWidth, -halfHeight), // bottom right
-            glm::vec2( halfWidth,  halfHeight), // top right
-            glm::vec2(-halfWidth,  halfHeight)  // top left
-        };
-        
-        // Apply rotation and translation
-        for (int i = 0; i < 4; ++i) {
-            float x = positions[i].x;
-            float y = positions[i].y;
-            positions[i].x = x * cosRot - y * sinRot + position.x;
-            positions[i].y = x * sinRot + y * cosRot + position.y;
-        }
-        
-        // Add vertices to batch
-        for (int i = 0; i < 4; ++i) {
-            QuadVertex vertex;
-            vertex.position = positions[i];
-            vertex.texCoords = glm::vec2(0.0f, 0.0f); // No texture coords for colored quads
-            vertex.color = color;
-            vertex.textureIndex = static_cast<float>(textureSlot);
-            m_QuadVertices.push_back(vertex);
-        }
+        // Queue the quad (no texture coords for colored quads)
+        m_BatchQuads.Push(position, size, rotation, glm::vec4(0.0f), color, static_cast<float>(textureSlot));
     }
     
     
-    void Renderer::FlushBatch() {
-        if (m_QuadVertices.empty()) {
-            return;
-        }
-        
-        // Create batch rendering shader if not exists
-        static bool batchShaderInitialized = false;
-        static unsigned int batchShaderProgram = 0;
-        static unsigned int batchVAO = 0, batchVBO = 0, batchEBO = 0;
-        static int viewProjectionLocation = -1;
-        static int textureLocations[32] = {-1};
+    // Batch pipeline state, created on first use
+    static bool s_BatchBuffersInitialized = false;
+    static unsigned int s_BatchVAO = 0, s_BatchVBO = 0, s_BatchEBO = 0;
+    static unsigned int s_WhiteTexture = 0;
+    
+    bool Renderer::BeginBatchDraw() {
+        if (!m_BatchShader) return false;
         
-        if (!batchShaderInitialized) {
-            // Create batch rendering shader
-            batchShaderProgram = CreateShaderProgram(BATCH_VERTEX_SHADER, BATCH_FRAGMENT_SHADER);
-            if (batchShaderProgram == 0) return;
-            
+        if (!s_BatchBuffersInitialized) {
             // Create batch VAO/VBO/EBO
-            glGenVertexArrays(1, &batchVAO);
-            glGenBuffers(1, &batchVBO);
-            glGenBuffers(1, &batchEBO);
+            glGenVertexArrays(1, &s_BatchVAO);
+            glGenBuffers(1, &s_BatchVBO);
+            glGenBuffers(1, &s_BatchEBO);
             
-            glBindVertexArray(batchVAO);
-            glBindBuffer(GL_ARRAY_BUFFER, batchVBO);
-            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batchEBO);
+            glBindVertexArray(s_BatchVAO);
+            glBindBuffer(GL_ARRAY_BUFFER, s_BatchVBO);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, s_BatchEBO);
             
             // Generate indices for quads
             std::vector<unsigned int> indices;
@@ -972,66 +880,136 @@ namespace GP2Engine {
             
             glBindVertexArray(0);
             
-            // Cache uniform locations for performance
-            viewProjectionLocation = glGetUniformLocation(batchShaderProgram, "u_ViewProjection");
-            for (int i = 0; i < 32; ++i) {
-                std::string uniformName = "u_Textures[" + std::to_string(i) + "]";
-                textureLocations[i] = glGetUniformLocation(batchShaderProgram, uniformName.c_str());
-            }
-            
-            batchShaderInitialized = true;
+            s_BatchBuffersInitialized = true;
         }
         
-        // Use batch shader
-        glUseProgram(batchShaderProgram);
-        
-        // Set view projection matrix using cached location
-        glm::mat4 viewProjection = m_Camera.GetViewProjectionMatrix();
-        glUniformMatrix4fv(viewProjectionLocation, 1, GL_FALSE, &viewProjection[0][0]);
+        // Use batch shader (samplers were set in InitializeShaders)
+        m_BatchShader->Bind();
+        m_FrameStats.stateChanges++;
+        UploadCameraBuffer();
         
-        // Bind textures using cached locations
         // Always bind a white texture to slot 0 for colored quads
-        static unsigned int whiteTexture = 0;
-        if (whiteTexture == 0) {
-            glGenTextures(1, &whiteTexture);
-            glBindTexture(GL_TEXTURE_2D, whiteTexture);
+        if (s_WhiteTexture == 0) {
+            glGenTextures(1, &s_WhiteTexture);
+            glBindTexture(GL_TEXTURE_2D, s_WhiteTexture);
             unsigned char whitePixel[] = {255, 255, 255, 255};
             glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, whitePixel);
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
         }
         
+        // Unit 0 is shared with immediate-mode draws, so rebind it every flush
         glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, whiteTexture);
-        glUniform1i(textureLocations[0], 0);
-        
-        // Bind other textures using cached locations
-        for (size_t i = 1; i < m_TextureSlots.size(); ++i) {
-            glActiveTexture(GL_TEXTURE0 + static_cast<GLenum>(i));
-            glBindTexture(GL_TEXTURE_2D, m_TextureSlots[i]);
-            glUniform1i(textureLocations[i], static_cast<GLint>(i));
-        }
-        
+        glBindTexture(GL_TEXTURE_2D, s_WhiteTexture);
+        m_FrameStats.textureBinds++;
+        return true;
+    }
+    
+    void Renderer::DrawBatchVertices(const QuadVertex* vertices, size_t quadCount) {
         // Upload vertex data with optimized usage hint
-        glBindVertexArray(batchVAO);
-        glBindBuffer(GL_ARRAY_BUFFER, batchVBO);
-        glBufferData(GL_ARRAY_BUFFER, m_QuadVertices.size() * sizeof(QuadVertex), m_QuadVertices.data(), GL_STREAM_DRAW);
+        glBindVertexArray(s_BatchVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, s_BatchVBO);
+        glBufferData(GL_ARRAY_BUFFER, quadCount * 4 * sizeof(QuadVertex), vertices, GL_STREAM_DRAW);
         
         // Draw all quads in one call
-        int quadCount = static_cast<int>(m_QuadVertices.size() / 4);
-        glDrawElements(GL_TRIANGLES, quadCount * 6, GL_UNSIGNED_INT, 0);
+        glDrawElements(GL_TRIANGLES, static_cast<int>(quadCount) * 6, GL_UNSIGNED_INT, 0);
         
         // Update performance counters
-        m_DrawCallsThisFrame++;
-        m_QuadsDrawnThisFrame += quadCount;
+        m_FrameStats.drawCalls++;
+        m_FrameStats.quads += static_cast<uint32_t>(quadCount);
+        m_FrameStats.bytesUploaded += quadCount * 4 * sizeof(QuadVertex);
+        m_FrameStats.bufferUploads++;
+        m_FrameStats.stateChanges++;   // Vertex array
         
         glBindVertexArray(0);
         glUseProgram(0);
+    }
+    
+    void Renderer::FlushBatch(FlushReason reason) {
+        if (m_BatchQuads.Size() == 0) {
+            return;
+        }
+        
+        if (!BeginBatchDraw()) return;
+        m_FrameStats.batches++;
+        m_FrameStats.AddFlush(reason);
+        
+        // Bind only the units whose texture changed since they were last bound
+        m_TextureSlots.BindBatchTextures();
+        
+        // Expand the queued quads into vertices (SIMD where available)
+        const size_t vertexCount = m_BatchQuads.Size() * 4;
+        if (m_QuadVertices.size() < vertexCount) {
+            m_QuadVertices.resize(MAX_VERTICES);
+        }
+        QuadKernel::GenerateVertices(m_BatchQuads, m_QuadVertices.data());
+        
+        DrawBatchVertices(m_QuadVertices.data(), m_BatchQuads.Size());
+        
+        // Clear for next batch (texture units stay resident)
+        m_BatchQuads.Clear();
+        m_TextureSlots.BeginBatch();
+    }
+    
+    void Renderer::DrawPreparedBatch(const BatchQuadVertex* vertices, size_t quadCount,
+                                     const TextureBinding* bindings, size_t bindingCount, FlushReason reason) {
+        if (quadCount == 0) {
+            return;
+        }
+        
+        // Keep draw order with anything queued through DrawTexturedQuadBatch
+        FlushBatch(FlushReason::LayerChange);
+        
+        if (!BeginBatchDraw()) return;
+        m_FrameStats.batches++;
+        m_FrameStats.AddFlush(reason);
         
-        // Clear for next frame
-        m_QuadVertices.clear();
-        m_TextureSlots.clear();
-        m_CurrentTextureSlot = 0;
+        // Slots were assigned off-thread; bind them through the same unit cache
+        m_TextureSlots.BindUnits(bindings, bindingCount);
+        
+        // Split to respect the index buffer size
+        for (size_t first = 0; first < quadCount; first += MAX_QUADS) {
+            size_t count = std::min(static_cast<size_t>(MAX_QUADS), quadCount - first);
+            if (first > 0) {
+                m_BatchShader->Bind();
+                m_FrameStats.stateChanges++;
+                m_FrameStats.batches++;
+                m_FrameStats.AddFlush(FlushReason::BufferFull);
+            }
+            DrawBatchVertices(vertices + first * 4, count);
+        }
+    }
+    
+    void Renderer::CountImmediateDraw(size_t bytesUploaded, bool boundTexture) const {
+        m_FrameStats.drawCalls++;
+        m_FrameStats.immediateQuads++;
+        m_FrameStats.stateChanges += 2;   // Program and vertex array
+        if (bytesUploaded > 0) {
+            m_FrameStats.bytesUploaded += bytesUploaded;
+            m_FrameStats.bufferUploads++;
+        }
+        if (boundTexture) {
+            m_FrameStats.textureBinds++;
+        }
+    }
+    
+    void Renderer::ResetPerformanceCounters() const {
+        m_FrameStats = RenderFrameStats();
+        m_TextureSlots.ResetFrameCounters();
+    }
+    
+    void Renderer::CommitFrameStats() {
+        // Batch texture binds are counted by the unit cache
+        m_FrameStats.textureBinds += static_cast<uint32_t>(m_TextureSlots.GetBindsThisFrame());
+        m_FrameStats.redundantBindsSkipped = static_cast<uint32_t>(m_TextureSlots.GetRedundantBindsSkippedThisFrame());
+        m_FrameStats.textureEvictions = static_cast<uint32_t>(m_TextureSlots.GetEvictionsThisFrame());
+        m_StatsHistory.Push(m_FrameStats);
+    }
+    
+    void Renderer::NotifyTextureDeleted(unsigned int textureID) {
+        if (s_Instance) {
+            s_Instance->m_TextureSlots.Invalidate(textureID);
+        }
     }
     
     void Renderer::SetVSync(bool enabled) {
@@ -1046,54 +1024,30 @@ namespace GP2Engine {
     bool Renderer::IsVSyncEnabled() {
         return s_VSyncEnabled;
     }
+    
+    void Renderer::SetHeadless(bool headless) {
+        s_Headless = headless;
+    }
+    
+    bool Renderer::IsHeadless() {
+        return s_Headless;
+    }
 
     // ===================================================================
     // TEXT RENDERING IMPLEMENTATION
     // ===================================================================
 
-    static const std::string TEXT_VERTEX_SHADER = R"(
-        #version 330 core
-        layout (location = 0) in vec4 vertex; // <vec2 pos, vec2 tex>
-        out vec2 TexCoords;
-
-        uniform mat4 u_Projection;
-
-        void main() {
-            gl_Position = u_Projection * vec4(vertex.xy, 0.0, 1.0);
-            TexCoords = vertex.zw;
-        }
-    )";
-
-    static const std::string TEXT_FRAGMENT_SHADER = R"(
-        #version 330 core
-        in vec2 TexCoords;
-        out vec4 color;
-
-        uniform sampler2D text;
-        uniform vec4 textColor;
-
-        void main() {
-            vec4 sampled = vec4(1.0, 1.0, 1.0, texture(text, TexCoords).r);
-            color = textColor * sampled;
-        }
-    )";
-
     bool Renderer::InitializeTextRendering() {
         if (m_TextRenderingInitialized) {
             return true;
         }
 
-        // Create text shader
-        unsigned int textShaderProgram = CreateShaderProgram(TEXT_VERTEX_SHADER, TEXT_FRAGMENT_SHADER);
-        if (textShaderProgram == 0) {
+        // Text shader is compiled with the other programs in InitializeShaders
+        if (!m_TextShader) {
             std::cerr << "ERROR::RENDERER: Failed to create text shader" << std::endl;
             return false;
         }
 
-        // Wrap in Shader class (we'll create a simple wrapper)
-        // For now, we'll store the program ID directly
-        // Note: You might want to create a proper Shader object here
-
         // Create VAO and VBO for text rendering
         glGenVertexArrays(1, &m_TextVAO);
         glGenBuffers(1, &m_TextVBO);
@@ -1108,25 +1062,6 @@ namespace GP2Engine {
         glBindBuffer(GL_ARRAY_BUFFER, 0);
         glBindVertexArray(0);
 
-        // Store shader program (we'll use it directly for now)
-        glUseProgram(textShaderProgram);
-
-        // Set up orthographic projection for text rendering
-        glm::mat4 projection = glm::ortho(0.0f, static_cast<float>(m_Width),
-                                         0.0f, static_cast<float>(m_Height));
-        glUniformMatrix4fv(glGetUniformLocation(textShaderProgram, "u_Projection"),
-                          1, GL_FALSE, glm::value_ptr(projection));
-
-        glUseProgram(0);
-
-        // Create a simple shader wrapper to store the program
-        struct SimpleTextShader {
-            unsigned int programID;
-        };
-        // We'll store the program ID in m_TextShader by creating a minimal Shader-like object
-        // For simplicity, we'll just track the program ID
-        // In a real implementation, you'd want to properly integrate with your Shader class
-
         m_TextRenderingInitialized = true;
         std::cout << "Text rendering initialized successfully" << std::endl;
 
@@ -1150,26 +1085,13 @@ namespace GP2Engine {
         glEnable(GL_BLEND);
         glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-        // Activate corresponding render state
-        // Note: We need to find the text shader program ID
-        // For now, we'll retrieve it (this is a simplified approach)
-        // In production, store the program ID as a member variable
-
-        // Find or create text shader
-        static unsigned int textShaderProgram = 0;
-        if (textShaderProgram == 0) {
-            textShaderProgram = CreateShaderProgram(TEXT_VERTEX_SHADER, TEXT_FRAGMENT_SHADER);
-        }
-
-        glUseProgram(textShaderProgram);
+        // Activate text shader
+        m_TextShader->Bind();
+        m_FrameStats.stateChanges += 4;   // Blend, program, vertex array, blend off
 
         // Use camera projection matrix for consistent coordinate system with entities
-        glm::mat4 projection = m_Camera.GetProjectionMatrix();
-        glUniformMatrix4fv(glGetUniformLocation(textShaderProgram, "u_Projection"),
-                          1, GL_FALSE, glm::value_ptr(projection));
-
-        glUniform4f(glGetUniformLocation(textShaderProgram, "textColor"),
-                   color.r, color.g, color.b, color.a);
+        m_TextShader->SetUniformMat4f(m_TextProjectionHandle, m_Camera.GetProjectionMatrix());
+        m_TextShader->SetUniform4f(m_TextColorHandle, color.r, color.g, color.b, color.a);
 
         glActiveTexture(GL_TEXTURE0);
         glBindVertexArray(m_TextVAO);
@@ -1210,6 +1132,11 @@ namespace GP2Engine {
 
             // Render quad
             glDrawArrays(GL_TRIANGLES, 0, 6);
+            m_FrameStats.drawCalls++;
+            m_FrameStats.glyphs++;
+            m_FrameStats.textureBinds++;
+            m_FrameStats.bytesUploaded += sizeof(vertices);
+            m_FrameStats.bufferUploads++;
 
             // Now advance cursors for next glyph
             xPos += (ch.advance >> 6) * scale; // Bitshift by 6 to get value in pixels (2^6 = 64)
@@ -1221,8 +1148,6 @@ namespace GP2Engine {
 
         // Disable blending
         glDisable(GL_BLEND);
-
-        m_DrawCallsThisFrame++;
     }
 
     void Renderer::DrawText(Font* font, const std::string& text, const glm::vec2& position,
@@ -1247,21 +1172,13 @@ namespace GP2Engine {
         glEnable(GL_BLEND);
         glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-        // Find or create text shader
-        static unsigned int textShaderProgram = 0;
-        if (textShaderProgram == 0) {
-            textShaderProgram = CreateShaderProgram(TEXT_VERTEX_SHADER, TEXT_FRAGMENT_SHADER);
-        }
-
-        glUseProgram(textShaderProgram);
+        // Activate text shader
+        m_TextShader->Bind();
+        m_FrameStats.stateChanges += 4;   // Blend, program, vertex array, blend off
 
         // Use camera projection matrix for consistent coordinate system with entities
-        glm::mat4 projection = m_Camera.GetProjectionMatrix();
-        glUniformMatrix4fv(glGetUniformLocation(textShaderProgram, "u_Projection"),
-                          1, GL_FALSE, glm::value_ptr(projection));
-
-        glUniform4f(glGetUniformLocation(textShaderProgram, "textColor"),
-                   color.r, color.g, color.b, color.a);
+        m_TextShader->SetUniformMat4f(m_TextProjectionHandle, m_Camera.GetProjectionMatrix());
+        m_TextShader->SetUniform4f(m_TextColorHandle, color.r, color.g, color.b, color.a);
 
         glActiveTexture(GL_TEXTURE0);
         glBindVertexArray(m_TextVAO);
@@ -1328,6 +1245,11 @@ namespace GP2Engine {
 
             // Render quad
             glDrawArrays(GL_TRIANGLES, 0, 6);
+            m_FrameStats.drawCalls++;
+            m_FrameStats.glyphs++;
+            m_FrameStats.textureBinds++;
+            m_FrameStats.bytesUploaded += sizeof(vertices);
+            m_FrameStats.bufferUploads++;
 
             // Advance cursor for next glyph
             xOffset += (ch.advance >> 6) * finalScaleX;
@@ -1339,8 +1261,6 @@ namespace GP2Engine {
 
         // Disable blending
         glDisable(GL_BLEND);
-
-        m_DrawCallsThisFrame++;
     }
 
     float Renderer::MeasureTextWidth(Font* font, const std::string& text, float scale) const {
@@ -21,6 +21,12 @@
 #include <functional>
 #include <glm/glm.hpp>
 #include "Camera.hpp"
+#include "QuadKernel.hpp"
+#include "TextureSlotManager.hpp"
+#include "Shader.hpp"
+#include "ShaderCache.hpp"
+#include "UniformBuffer.hpp"
+#include "RenderStats.hpp"
 
 namespace GP2Engine {
     
@@ -142,6 +148,21 @@ namespace GP2Engine {
          */
         const Camera& GetCamera() const { return m_Camera; }
         
+        /**
+         * @brief Upload the camera to the shared "Camera" uniform block if it changed
+         * 
+         * Called before drawing with any program that reads the block; the
+         * upload only happens once per SetCamera().
+         */
+        void UploadCameraBuffer() const;
+        
+        /**
+         * @brief Get the shader program cache
+         * 
+         * @return Cache holding the engine's shader variants
+         */
+        ShaderCache& GetShaderCache() { return m_ShaderCache; }
+        
         /**
          * @brief Check if window should close
          * 
@@ -241,8 +262,10 @@ namespace GP2Engine {
         
         /**
          * @brief Flush batch rendering
+         *
+         * @param reason Why the batch is drawn now (recorded in the frame stats)
          */
-        void FlushBatch();
+        void FlushBatch(FlushReason reason = FlushReason::EndOfFrame);
         
         
         /**
@@ -268,6 +291,22 @@ namespace GP2Engine {
          */
         void DrawQuadBatch(const glm::vec2& position, const glm::vec2& size, float rotation, const glm::vec4& color);
 
+        /**
+         * @brief Draw quads whose vertices and texture units were prepared elsewhere
+         * 
+         * Used for frame packets prepared on the render thread. Any quads
+         * queued with the batch functions are flushed first to keep order.
+         * 
+         * @param vertices Packed vertices, 4 per quad
+         * @param quadCount Number of quads
+         * @param bindings Texture unit assignments referenced by the vertices
+         * @param bindingCount Number of assignments
+         * @param reason Why the batch was closed while preparing
+         */
+        void DrawPreparedBatch(const BatchQuadVertex* vertices, size_t quadCount,
+                               const TextureBinding* bindings, size_t bindingCount,
+                               FlushReason reason = FlushReason::EndOfFrame);
+
 
         /**
          * @brief Draw text string
@@ -348,19 +387,76 @@ namespace GP2Engine {
          * 
          * @return Number of draw calls
          */
-        int GetDrawCallsThisFrame() const { return m_DrawCallsThisFrame; }
+        int GetDrawCallsThisFrame() const { return static_cast<int>(m_FrameStats.drawCalls); }
         
         /**
          * @brief Get number of quads drawn this frame
          * 
          * @return Number of quads drawn
          */
-        int GetQuadsDrawnThisFrame() const { return m_QuadsDrawnThisFrame; }
+        int GetQuadsDrawnThisFrame() const { return static_cast<int>(m_FrameStats.quads); }
+        
+        /**
+         * @brief Get number of texture binds issued by the batcher this frame
+         * 
+         * @return Number of glBindTexture calls (excluding the white texture)
+         */
+        int GetTextureBindsThisFrame() const { return m_TextureSlots.GetBindsThisFrame(); }
+        
+        /**
+         * @brief Get number of texture binds skipped because the unit was already bound
+         * 
+         * @return Number of redundant binds avoided
+         */
+        int GetRedundantBindsSkippedThisFrame() const { return m_TextureSlots.GetRedundantBindsSkippedThisFrame(); }
+        
+        /**
+         * @brief Get number of texture unit evictions this frame
+         * 
+         * @return Number of LRU evictions
+         */
+        int GetTextureEvictionsThisFrame() const { return m_TextureSlots.GetEvictionsThisFrame(); }
         
         /**
          * @brief Reset performance counters
          */
-        void ResetPerformanceCounters() const { m_DrawCallsThisFrame = 0; m_QuadsDrawnThisFrame = 0; }
+        void ResetPerformanceCounters() const;
+        
+        /**
+         * @brief Get the statistics of the frame being drawn
+         * 
+         * Frame packet data (frame index, submitted and culled objects, sort
+         * time) is filled in by FramePipeline::Execute.
+         * 
+         * @return Current frame statistics
+         */
+        RenderFrameStats& GetFrameStats() { return m_FrameStats; }
+        const RenderFrameStats& GetFrameStats() const { return m_FrameStats; }
+        
+        /**
+         * @brief Add the texture unit counters and append the frame to the history
+         * 
+         * Called once at the end of every submitted frame.
+         */
+        void CommitFrameStats();
+        
+        /**
+         * @brief Get the statistics of the most recent frames
+         * 
+         * @return Rolling history (dump with SaveCSV/SaveJSON)
+         */
+        const RenderStatsHistory& GetStatsHistory() const { return m_StatsHistory; }
+        RenderStatsHistory& GetStatsHistory() { return m_StatsHistory; }
+        
+        /**
+         * @brief Notify the renderer that a texture is being deleted
+         * 
+         * Frees its batch texture unit so the ID can be reused safely.
+         * Safe to call when the renderer is not initialized.
+         * 
+         * @param textureID OpenGL texture ID
+         */
+        static void NotifyTextureDeleted(unsigned int textureID);
         
         /**
          * @brief Handle window resize event
@@ -392,6 +488,25 @@ namespace GP2Engine {
          */
         static bool IsVSyncEnabled();
 
+        /**
+         * @brief Run without an OpenGL context
+         *
+         * Must be set before any texture or font is loaded. In headless mode
+         * textures and glyphs keep their pixels on the CPU (for
+         * SoftwareRasterizer) and no OpenGL call is made while loading them.
+         * The Renderer itself is not initialized.
+         *
+         * @param headless True to load resources without OpenGL
+         */
+        static void SetHeadless(bool headless);
+
+        /**
+         * @brief Check if resources are loaded without OpenGL
+         *
+         * @return True in headless mode
+         */
+        static bool IsHeadless();
+
         
     private:
         /**
@@ -416,14 +531,9 @@ namespace GP2Engine {
         int m_Height{0};                                               ///< Window height
         
         /**
-         * @brief Vertex structure for batch rendering
+         * @brief Vertex structure for batch rendering (written by QuadKernel)
          */
-        struct QuadVertex {
-            glm::vec2 position;        ///< Vertex position
-            glm::vec2 texCoords;       ///< Texture coordinates
-            glm::vec4 color;           ///< Vertex color
-            float textureIndex;        ///< Texture slot index
-        };
+        using QuadVertex = BatchQuadVertex;
         
         // Batch rendering system for performance (Rubric 1209)
         static const unsigned int MAX_QUADS = 50000;        ///< Maximum quads per batch
@@ -433,14 +543,13 @@ namespace GP2Engine {
         
         unsigned int m_QuadVAO{0}, m_QuadVBO{0}, m_QuadEBO{0};  ///< Quad VAO/VBO/EBO
         std::vector<QuadVertex> m_QuadVertices;                 ///< Quad vertices buffer
-        std::vector<unsigned int> m_TextureSlots;               ///< Texture slots for batch
-        unsigned int m_CurrentTextureSlot{0};                   ///< Current texture slot
+        QuadBatchSoA m_BatchQuads;                              ///< Queued quads, expanded at flush
+        TextureSlotManager m_TextureSlots{static_cast<int>(MAX_TEXTURE_SLOTS)}; ///< Persistent texture units (LRU)
         
         // Persistent buffer mapping for performance
         QuadVertex* m_MappedVertexBuffer{nullptr};              ///< Mapped vertex buffer
         unsigned int m_VertexBufferOffset{0};                   ///< Vertex buffer offset
         
-        std::shared_ptr<class Shader> m_SpriteShader;          ///< Sprite shader
         bool m_BatchStarted{false};                             ///< Batch rendering flag
 
         // Debug rendering
@@ -448,18 +557,63 @@ namespace GP2Engine {
 
         // Text rendering
         unsigned int m_TextVAO{0}, m_TextVBO{0};                ///< Text VAO/VBO
-        std::shared_ptr<class Shader> m_TextShader;            ///< Text shader
         bool m_TextRenderingInitialized{false};                 ///< Text rendering initialized flag
 
+        // Shader programs (compiled once in InitializeShaders, uniforms resolved to handles)
+        /**
+         * @brief Program used by the immediate-mode quad draws
+         */
+        struct QuadProgram {
+            Shader* shader{nullptr};                            ///< Program variant
+            UniformHandle transform{INVALID_UNIFORM};           ///< u_Transform
+            UniformHandle color{INVALID_UNIFORM};               ///< u_Color
+        };
+        ShaderCache m_ShaderCache;                              ///< Every compiled shader variant
+        mutable UniformBuffer m_CameraBuffer;                   ///< Shared "Camera" uniform block
+        mutable bool m_CameraBufferDirty{true};                 ///< Camera changed since the last upload
+        QuadProgram m_QuadProgram;                              ///< Colored quads
+        QuadProgram m_TexturedQuadProgram;                      ///< Textured quads (TEXTURED variant)
+        Shader* m_BatchShader{nullptr};                         ///< Batched quads
+        Shader* m_TextShader{nullptr};                          ///< Glyph quads
+        UniformHandle m_TextProjectionHandle{INVALID_UNIFORM};  ///< u_Projection in text shader
+        UniformHandle m_TextColorHandle{INVALID_UNIFORM};       ///< textColor in text shader
+
         // Performance monitoring
-        mutable int m_DrawCallsThisFrame{0};                    ///< Draw calls this frame
-        mutable int m_QuadsDrawnThisFrame{0};                   ///< Quads drawn this frame
+        mutable RenderFrameStats m_FrameStats;                  ///< Counters of the frame being drawn
+        RenderStatsHistory m_StatsHistory;                      ///< Recent frames
+
+        /**
+         * @brief Count one immediate-mode quad draw
+         *
+         * @param bytesUploaded Vertex bytes uploaded for the draw (0 if none)
+         * @param boundTexture Whether a texture was bound for the draw
+         */
+        void CountImmediateDraw(size_t bytesUploaded, bool boundTexture) const;
 
         /**
          * @brief Initialize text rendering system
          * @return true if successful, false otherwise
          */
         bool InitializeTextRendering();
+
+        /**
+         * @brief Compile the built-in shader variants, resolve their uniforms and create the camera buffer
+         * @return true if every program is available, false otherwise
+         */
+        bool InitializeShaders();
+
+        /**
+         * @brief Bind the batch shader, camera and white texture (creates them on first use)
+         * @return true if the batch shader is available, false otherwise
+         */
+        bool BeginBatchDraw();
+
+        /**
+         * @brief Upload and draw packed quad vertices with the bound batch state
+         * @param vertices Packed vertices, 4 per quad
+         * @param quadCount Number of quads (at most MAX_QUADS)
+         */
+        void DrawBatchVertices(const QuadVertex* vertices, size_t quadCount);
     };
     
 } // namespace GP2Engine
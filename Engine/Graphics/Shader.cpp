@@ -11,6 +11,7 @@
 #include <fstream>
 #include <sstream>
 #include <iostream>
+#include <algorithm>
 #include <glad/glad.h>
 
 namespace GP2Engine {
@@ -32,7 +33,7 @@ namespace GP2Engine {
      * @param fragmentPath Path to fragment shader file
      */
     Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath)
-        : m_VertexFilePath(vertexPath), m_FragmentFilePath(fragmentPath), m_RendererID(0)
+        : m_VertexFilePath(vertexPath), m_FragmentFilePath(fragmentPath)
     {
         // Read shader source code from files
         std::string vertexSource = ParseShader(vertexPath);
@@ -40,6 +41,26 @@ namespace GP2Engine {
         
         // Create shader program from source code
         m_RendererID = CreateShader(vertexSource, fragmentSource);
+        CacheUniforms();
+    }
+    
+    /**
+     * @brief Constructor - builds a shader variant from source code
+     * 
+     * Used by ShaderCache for the engine's built-in shaders. The defines are
+     * injected into both stages so one source can produce several variants.
+     * 
+     * @param vertexSource Vertex shader source code
+     * @param fragmentSource Fragment shader source code
+     * @param defines Preprocessor defines selecting the variant
+     * @param label Name used in error messages
+     */
+    Shader::Shader(const std::string& vertexSource, const std::string& fragmentSource,
+                   const std::vector<std::string>& defines, const std::string& label)
+        : m_VertexFilePath(label)
+    {
+        m_RendererID = CreateShader(InjectDefines(vertexSource, defines), InjectDefines(fragmentSource, defines));
+        CacheUniforms();
     }
     
     /**
@@ -74,84 +95,113 @@ namespace GP2Engine {
     }
     
     /**
-     * @brief Set integer uniform
+     * @brief Resolve a uniform name to a handle
      * 
-     * Sets an integer uniform variable in the shader program.
-     * The uniform location is cached for performance.
+     * Looks the name up in the table filled after linking; no OpenGL call
+     * is made, so this is safe to call while setting up any pipeline.
      * 
      * @param name Name of the uniform variable in the shader
+     * @return Uniform handle, or INVALID_UNIFORM if not found
+     */
+    UniformHandle Shader::GetUniformHandle(const std::string& name) const {
+        auto it = m_UniformLocationCache.find(name);
+        return it != m_UniformLocationCache.end() ? it->second : INVALID_UNIFORM;
+    }
+    
+    /**
+     * @brief Set integer uniform
+     * 
+     * @param handle Uniform handle from GetUniformHandle()
      * @param value Integer value to set
      */
-    void Shader::SetUniform1i(const std::string& name, int value) {
-        glUniform1i(GetUniformLocation(name), value);
+    void Shader::SetUniform1i(UniformHandle handle, int value) {
+        glUniform1i(handle, value);
     }
     
     /**
-     * @brief Set float uniform
+     * @brief Set integer array uniform
      * 
-     * Sets a float uniform variable in the shader program.
-     * The uniform location is cached for performance.
+     * Commonly used to point an array of samplers at consecutive texture units.
      * 
-     * @param name Name of the uniform variable in the shader
+     * @param handle Handle of the first array element
+     * @param count Number of elements to set
+     * @param values Element values
+     */
+    void Shader::SetUniform1iv(UniformHandle handle, int count, const int* values) {
+        glUniform1iv(handle, count, values);
+    }
+    
+    /**
+     * @brief Set float uniform
+     * 
+     * @param handle Uniform handle from GetUniformHandle()
      * @param value Float value to set
      */
-    void Shader::SetUniform1f(const std::string& name, float value) {
-        glUniform1f(GetUniformLocation(name), value);
+    void Shader::SetUniform1f(UniformHandle handle, float value) {
+        glUniform1f(handle, value);
     }
     
     /**
      * @brief Set 2D float vector uniform
      * 
-     * Sets a 2D float vector uniform variable in the shader program.
-     * 
-     * @param name Name of the uniform variable in the shader
+     * @param handle Uniform handle from GetUniformHandle()
      * @param v0 First component of the vector
      * @param v1 Second component of the vector
      */
-    void Shader::SetUniform2f(const std::string& name, float v0, float v1) {
-        glUniform2f(GetUniformLocation(name), v0, v1);
+    void Shader::SetUniform2f(UniformHandle handle, float v0, float v1) {
+        glUniform2f(handle, v0, v1);
     }
     
     /**
      * @brief Set 3D float vector uniform
      * 
-     * Sets a 3D float vector uniform variable in the shader program.
-     * 
-     * @param name Name of the uniform variable in the shader
+     * @param handle Uniform handle from GetUniformHandle()
      * @param v0 First component of the vector
      * @param v1 Second component of the vector
      * @param v2 Third component of the vector
      */
-    void Shader::SetUniform3f(const std::string& name, float v0, float v1, float v2) {
-        glUniform3f(GetUniformLocation(name), v0, v1, v2);
+    void Shader::SetUniform3f(UniformHandle handle, float v0, float v1, float v2) {
+        glUniform3f(handle, v0, v1, v2);
     }
     
     /**
      * @brief Set 4D float vector uniform
      * 
-     * Sets a 4D float vector uniform variable in the shader program.
-     * 
-     * @param name Name of the uniform variable in the shader
+     * @param handle Uniform handle from GetUniformHandle()
      * @param v0 First component of the vector
      * @param v1 Second component of the vector
      * @param v2 Third component of the vector
      * @param v3 Fourth component of the vector
      */
-    void Shader::SetUniform4f(const std::string& name, float v0, float v1, float v2, float v3) {
-        glUniform4f(GetUniformLocation(name), v0, v1, v2, v3);
+    void Shader::SetUniform4f(UniformHandle handle, float v0, float v1, float v2, float v3) {
+        glUniform4f(handle, v0, v1, v2, v3);
     }
     
     /**
      * @brief Set 4x4 matrix uniform
      * 
-     * Sets a 4x4 matrix uniform variable in the shader program.
      * This is commonly used for transformation matrices (model, view, projection).
      * 
-     * @param name Name of the uniform variable in the shader
+     * @param handle Uniform handle from GetUniformHandle()
      * @param matrix 4x4 matrix to set
      */
-    void Shader::SetUniformMat4f(const std::string& name, const glm::mat4& matrix) {
-        glUniformMatrix4fv(GetUniformLocation(name), 1, GL_FALSE, &matrix[0][0]);
+    void Shader::SetUniformMat4f(UniformHandle handle, const glm::mat4& matrix) {
+        glUniformMatrix4fv(handle, 1, GL_FALSE, &matrix[0][0]);
+    }
+    
+    /**
+     * @brief Attach the "Camera" uniform block to the shared binding point
+     * 
+     * @param program Linked OpenGL program ID
+     */
+    void Shader::BindCameraBlock(unsigned int program) {
+        if (program == 0) {
+            return;
+        }
+        unsigned int blockIndex = glGetUniformBlockIndex(program, "Camera");
+        if (blockIndex != GL_INVALID_INDEX) {
+            glUniformBlockBinding(program, blockIndex, CAMERA_UNIFORM_BINDING);
+        }
     }
     
     /**
@@ -182,6 +232,43 @@ namespace GP2Engine {
         return ss.str();
     }
     
+    /**
+     * @brief Insert #define lines after the #version line
+     * 
+     * GLSL requires #version to come first, so defines go right after it
+     * (or at the top if the source has no #version line).
+     * 
+     * @param source Shader source code
+     * @param defines Defines ("NAME" or "NAME=VALUE")
+     * @return Source code with the defines
+     */
+    std::string Shader::InjectDefines(const std::string& source, const std::vector<std::string>& defines) {
+        if (defines.empty()) {
+            return source;
+        }
+        
+        std::string block;
+        for (const std::string& define : defines) {
+            std::string line = define;
+            size_t equals = line.find('=');
+            if (equals != std::string::npos) {
+                line[equals] = ' ';
+            }
+            block += "#define " + line + "\n";
+        }
+        
+        size_t insertAt = 0;
+        size_t version = source.find("#version");
+        if (version != std::string::npos) {
+            size_t lineEnd = source.find('\n', version);
+            insertAt = lineEnd != std::string::npos ? lineEnd + 1 : source.size();
+        }
+        
+        std::string result = source;
+        result.insert(insertAt, block);
+        return result;
+    }
+    
     /**
      * @brief Compile shader from source code
      * 
@@ -248,38 +335,81 @@ namespace GP2Engine {
         // Link program
         glLinkProgram(program);
         
-        // Validate program
-        glValidateProgram(program);
-        
         // Clean up individual shaders (they're now part of the program)
         glDeleteShader(vs);
         glDeleteShader(fs);
         
+        // Check link status
+        int linked = 0;
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        if (linked == GL_FALSE || vs == 0 || fs == 0) {
+            char infoLog[512];
+            glGetProgramInfoLog(program, 512, nullptr, infoLog);
+            std::cerr << "ERROR: Shader program linking failed (" << m_VertexFilePath << "):\n" << infoLog << std::endl;
+            glDeleteProgram(program);
+            return 0;
+        }
+        
         return program;
     }
     
     /**
-     * @brief Get uniform location with caching
+     * @brief Record the location of every active uniform and bind the camera block
      * 
-     * Gets the location of a uniform variable in the shader program.
-     * Locations are cached to avoid repeated OpenGL calls for performance.
+     * Uniforms inside blocks have no location and are skipped. Array uniforms
+     * are reported as "name[0]" and stored under both "name[0]" and "name".
+     */
+    void Shader::CacheUniforms() {
+        m_UniformLocationCache.clear();
+        if (m_RendererID == 0) {
+            return;
+        }
+        
+        int uniformCount = 0;
+        int maxNameLength = 0;
+        glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORMS, &uniformCount);
+        glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+        
+        std::string name(static_cast<size_t>(std::max(maxNameLength, 1)), '\0');
+        for (int i = 0; i < uniformCount; ++i) {
+            int length = 0;
+            int size = 0;
+            unsigned int type = 0;
+            glGetActiveUniform(m_RendererID, static_cast<unsigned int>(i), maxNameLength, &length, &size, &type, name.data());
+            
+            std::string uniformName(name.data(), static_cast<size_t>(length));
+            int location = glGetUniformLocation(m_RendererID, uniformName.c_str());
+            if (location == -1) {
+                continue; // Member of a uniform block
+            }
+            
+            m_UniformLocationCache[uniformName] = location;
+            if (uniformName.size() > 3 && uniformName.compare(uniformName.size() - 3, 3, "[0]") == 0) {
+                m_UniformLocationCache[uniformName.substr(0, uniformName.size() - 3)] = location;
+            }
+        }
+        
+        BindCameraBlock(m_RendererID);
+    }
+    
+    /**
+     * @brief Get uniform location from the cache
+     * 
+     * Every active uniform was recorded after linking, so a miss means the
+     * uniform doesn't exist (or was optimized out). The miss is cached as -1
+     * so the warning is printed once.
      * 
      * @param name Name of the uniform variable
      * @return Uniform location, or -1 if not found
      */
     int Shader::GetUniformLocation(const std::string& name) {
-        // Check cache first
-        if (m_UniformLocationCache.find(name) != m_UniformLocationCache.end())
-            return m_UniformLocationCache[name];
-            
-        // Get location from OpenGL
-        int location = glGetUniformLocation(m_RendererID, name.c_str());
-        if (location == -1)
-            std::cerr << "Warning: uniform '" << name << "' doesn't exist!" << std::endl;
+        auto it = m_UniformLocationCache.find(name);
+        if (it != m_UniformLocationCache.end())
+            return it->second;
             
-        // Cache the location
-        m_UniformLocationCache[name] = location;
-        return location;
+        std::cerr << "Warning: uniform '" << name << "' doesn't exist!" << std::endl;
+        m_UniformLocationCache[name] = INVALID_UNIFORM;
+        return INVALID_UNIFORM;
     }
     
 } // namespace GP2Engine
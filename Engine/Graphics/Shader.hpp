@@ -2,7 +2,7 @@
  * @file Shader.hpp
  * @brief Shader class for OpenGL shader management
  * @author Asri (100%)
- * 
+ *
  * This file contains the Shader class definition which provides
  * OpenGL shader compilation, linking, and uniform management.
  */
@@ -10,138 +10,238 @@
 #pragma once
 
 #include <string>
+#include <vector>
 #include <unordered_map>
 #include <glm/glm.hpp>
 
 namespace GP2Engine {
-    
+
+    using UniformHandle = int;                          ///< Uniform location resolved at link time
+    constexpr UniformHandle INVALID_UNIFORM = -1;       ///< Uniform not present (setting it is a no-op in OpenGL)
+
+    /**
+     * @brief Uniform buffer binding point of the shared "Camera" block
+     *
+     * Programs declaring
+     * @code
+     * layout(std140) uniform Camera { mat4 u_ViewProjection; };
+     * @endcode
+     * read the view-projection matrix the Renderer uploads once per camera change.
+     */
+    constexpr unsigned int CAMERA_UNIFORM_BINDING = 0;
+
     /**
      * @brief Shader class for OpenGL shader management
-     * 
+     *
      * Handles compilation and linking of vertex and fragment shaders.
-     * Provides uniform management with caching for performance.
+     * All active uniforms are looked up once after linking; callers resolve
+     * the names they use to UniformHandles up front and set uniforms through
+     * the handle overloads, so drawing never hashes a uniform name.
      * Supports common uniform types including matrices and vectors.
-     * 
+     *
      * @author Asri (100%)
      */
     class Shader {
     public:
         /**
          * @brief Constructor reads and builds the shader
-         * 
+         *
          * @param vertexPath Path to vertex shader file
          * @param fragmentPath Path to fragment shader file
          */
         Shader(const std::string& vertexPath, const std::string& fragmentPath);
-        
+
+        /**
+         * @brief Build a shader variant from source code
+         *
+         * Each define is inserted as "#define NAME" (or "#define NAME VALUE"
+         * when written as "NAME=VALUE") right after the #version line.
+         *
+         * @param vertexSource Vertex shader source code
+         * @param fragmentSource Fragment shader source code
+         * @param defines Preprocessor defines selecting the variant
+         * @param label Name used in error messages
+         */
+        Shader(const std::string& vertexSource, const std::string& fragmentSource,
+               const std::vector<std::string>& defines, const std::string& label);
+
         /**
          * @brief Destructor
          */
         ~Shader();
-        
+
+        Shader(const Shader&) = delete;
+        Shader& operator=(const Shader&) = delete;
+
         /**
          * @brief Use/activate the shader
          */
         void Bind() const;
-        
+
         /**
          * @brief Deactivate the shader
          */
         void Unbind() const;
-        
+
         /**
-         * @brief Set integer uniform
-         * 
+         * @brief Check if the program compiled and linked
+         *
+         * @return true if the shader can be used
+         */
+        bool IsValid() const { return m_RendererID != 0; }
+
+        /**
+         * @brief Get OpenGL program ID
+         *
+         * @return Program ID (0 if invalid)
+         */
+        unsigned int GetRendererID() const { return m_RendererID; }
+
+        /**
+         * @brief Resolve a uniform name to a handle
+         *
+         * Call once when setting up a pipeline and keep the handle. For
+         * arrays, "name" and "name[0]" both return the first element.
+         *
          * @param name Uniform name
+         * @return Uniform handle, or INVALID_UNIFORM if the program has no such uniform
+         */
+        UniformHandle GetUniformHandle(const std::string& name) const;
+
+        /**
+         * @brief Set integer uniform
+         *
+         * @param handle Uniform handle
          * @param value Integer value
          */
-        void SetUniform1i(const std::string& name, int value);
-        
+        void SetUniform1i(UniformHandle handle, int value);
+
+        /**
+         * @brief Set integer array uniform
+         *
+         * @param handle Handle of the first array element
+         * @param count Number of elements
+         * @param values Element values
+         */
+        void SetUniform1iv(UniformHandle handle, int count, const int* values);
+
         /**
          * @brief Set float uniform
-         * 
-         * @param name Uniform name
+         *
+         * @param handle Uniform handle
          * @param value Float value
          */
-        void SetUniform1f(const std::string& name, float value);
-        
+        void SetUniform1f(UniformHandle handle, float value);
+
         /**
          * @brief Set 2D float vector uniform
-         * 
-         * @param name Uniform name
+         *
+         * @param handle Uniform handle
          * @param v0 First component
          * @param v1 Second component
          */
-        void SetUniform2f(const std::string& name, float v0, float v1);
-        
+        void SetUniform2f(UniformHandle handle, float v0, float v1);
+
         /**
          * @brief Set 3D float vector uniform
-         * 
-         * @param name Uniform name
+         *
+         * @param handle Uniform handle
          * @param v0 First component
          * @param v1 Second component
          * @param v2 Third component
          */
-        void SetUniform3f(const std::string& name, float v0, float v1, float v2);
-        
+        void SetUniform3f(UniformHandle handle, float v0, float v1, float v2);
+
         /**
          * @brief Set 4D float vector uniform
-         * 
-         * @param name Uniform name
+         *
+         * @param handle Uniform handle
          * @param v0 First component
          * @param v1 Second component
          * @param v2 Third component
          * @param v3 Fourth component
          */
-        void SetUniform4f(const std::string& name, float v0, float v1, float v2, float v3);
-        
+        void SetUniform4f(UniformHandle handle, float v0, float v1, float v2, float v3);
+
         /**
          * @brief Set 4x4 matrix uniform
-         * 
-         * @param name Uniform name
+         *
+         * @param handle Uniform handle
          * @param matrix 4x4 matrix
          */
-        void SetUniformMat4f(const std::string& name, const glm::mat4& matrix);
-        
+        void SetUniformMat4f(UniformHandle handle, const glm::mat4& matrix);
+
+        // Name-based setters (one hash lookup per call; prefer handles on hot paths)
+        void SetUniform1i(const std::string& name, int value) { SetUniform1i(GetUniformLocation(name), value); }
+        void SetUniform1f(const std::string& name, float value) { SetUniform1f(GetUniformLocation(name), value); }
+        void SetUniform2f(const std::string& name, float v0, float v1) { SetUniform2f(GetUniformLocation(name), v0, v1); }
+        void SetUniform3f(const std::string& name, float v0, float v1, float v2) { SetUniform3f(GetUniformLocation(name), v0, v1, v2); }
+        void SetUniform4f(const std::string& name, float v0, float v1, float v2, float v3) { SetUniform4f(GetUniformLocation(name), v0, v1, v2, v3); }
+        void SetUniformMat4f(const std::string& name, const glm::mat4& matrix) { SetUniformMat4f(GetUniformLocation(name), matrix); }
+
+        /**
+         * @brief Attach a program's "Camera" uniform block to CAMERA_UNIFORM_BINDING
+         *
+         * Does nothing if the program has no such block. Called for every
+         * Shader; exposed for programs compiled elsewhere (DebugRenderer).
+         *
+         * @param program Linked OpenGL program ID
+         */
+        static void BindCameraBlock(unsigned int program);
+
     private:
-        unsigned int m_RendererID;                                    ///< OpenGL shader program ID
-        std::string m_VertexFilePath;                                 ///< Vertex shader file path
+        unsigned int m_RendererID{0};                                 ///< OpenGL shader program ID
+        std::string m_VertexFilePath;                                 ///< Vertex shader file path (or variant label)
         std::string m_FragmentFilePath;                               ///< Fragment shader file path
-        std::unordered_map<std::string, int> m_UniformLocationCache; ///< Uniform location cache
-        
+        std::unordered_map<std::string, int> m_UniformLocationCache; ///< Active uniforms, filled after linking
+
         /**
          * @brief Parse shader file
-         * 
+         *
          * @param filepath Path to shader file
          * @return Shader source code
          */
         std::string ParseShader(const std::string& filepath);
-        
+
+        /**
+         * @brief Insert #define lines after the #version line
+         *
+         * @param source Shader source code
+         * @param defines Defines ("NAME" or "NAME=VALUE")
+         * @return Source code with the defines
+         */
+        static std::string InjectDefines(const std::string& source, const std::vector<std::string>& defines);
+
         /**
          * @brief Compile shader
-         * 
+         *
          * @param type Shader type (GL_VERTEX_SHADER or GL_FRAGMENT_SHADER)
          * @param source Shader source code
          * @return Compiled shader ID
          */
         unsigned int CompileShader(unsigned int type, const std::string& source);
-        
+
         /**
          * @brief Create shader program
-         * 
+         *
          * @param vertexShader Vertex shader source
          * @param fragmentShader Fragment shader source
          * @return Linked shader program ID
          */
         unsigned int CreateShader(const std::string& vertexShader, const std::string& fragmentShader);
-        
+
+        /**
+         * @brief Record the location of every active uniform and bind the camera block
+         */
+        void CacheUniforms();
+
         /**
-         * @brief Get uniform location with caching
-         * 
+         * @brief Get uniform location from the cache (warns once for unknown names)
+         *
          * @param name Uniform name
          * @return Uniform location
          */
         int GetUniformLocation(const std::string& name);
     };
-    
+
 } // namespace GP2Engine
@@ -0,0 +1,59 @@
+/**
+ * @file ShaderCache.cpp
+ * @brief Shader program cache implementation
+ * @author Asri (100%)
+ *
+ * This file contains the implementation of the ShaderCache class.
+ */
+
+#include "ShaderCache.hpp"
+#include <algorithm>
+#include <iostream>
+
+namespace GP2Engine {
+
+    void ShaderCache::RegisterSource(const std::string& name, const std::string& vertexSource, const std::string& fragmentSource) {
+        m_Sources[name] = ShaderSource{ vertexSource, fragmentSource };
+    }
+
+    Shader* ShaderCache::GetProgram(const std::string& name, const std::vector<std::string>& defines) {
+        const std::string key = MakeKey(name, defines);
+        auto cached = m_Programs.find(key);
+        if (cached != m_Programs.end()) {
+            return cached->second.get();
+        }
+
+        auto source = m_Sources.find(name);
+        if (source == m_Sources.end()) {
+            std::cerr << "ERROR: ShaderCache has no source named '" << name << "'" << std::endl;
+            return nullptr;
+        }
+
+        auto shader = std::make_unique<Shader>(source->second.vertex, source->second.fragment, defines, key);
+        if (!shader->IsValid()) {
+            // Remember the failure so it is not recompiled (and reported) every request
+            shader.reset();
+        }
+
+        Shader* result = shader.get();
+        m_Programs.emplace(key, std::move(shader));
+        return result;
+    }
+
+    void ShaderCache::Clear() {
+        m_Programs.clear();
+    }
+
+    std::string ShaderCache::MakeKey(const std::string& name, const std::vector<std::string>& defines) {
+        std::vector<std::string> sorted = defines;
+        std::sort(sorted.begin(), sorted.end());
+
+        std::string key = name;
+        for (const std::string& define : sorted) {
+            key += '|';
+            key += define;
+        }
+        return key;
+    }
+
+} // namespace GP2Engine
@@ -0,0 +1,93 @@
+/**
+ * @file ShaderCache.hpp
+ * @brief Shader program cache keyed by source name and define set
+ * @author Asri (100%)
+ *
+ * This file contains the ShaderCache class. Shader sources are registered
+ * under a name; each combination of name and preprocessor defines is
+ * compiled once into its own Shader and kept for the lifetime of the cache.
+ * Variants are meant to be requested while setting up a pipeline, so drawing
+ * only deals with the returned Shader pointer and its uniform handles.
+ */
+
+#pragma once
+
+#include "Shader.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace GP2Engine {
+
+    /**
+     * @brief Owner of every compiled shader variant
+     *
+     * @code
+     * cache.RegisterSource("quad", QUAD_VERTEX_SHADER, QUAD_FRAGMENT_SHADER);
+     * Shader* textured = cache.GetProgram("quad", { "TEXTURED" });
+     * @endcode
+     *
+     * @author Asri (100%)
+     */
+    class ShaderCache {
+    public:
+        ShaderCache() = default;
+
+        ShaderCache(const ShaderCache&) = delete;
+        ShaderCache& operator=(const ShaderCache&) = delete;
+
+        /**
+         * @brief Register shader source code under a name
+         *
+         * Re-registering a name replaces its source; variants compiled from
+         * the old source stay cached until Clear().
+         *
+         * @param name Source name
+         * @param vertexSource Vertex shader source code
+         * @param fragmentSource Fragment shader source code
+         */
+        void RegisterSource(const std::string& name, const std::string& vertexSource, const std::string& fragmentSource);
+
+        /**
+         * @brief Get a shader variant, compiling it on first request
+         *
+         * The order of the defines does not matter.
+         *
+         * @param name Registered source name
+         * @param defines Preprocessor defines ("NAME" or "NAME=VALUE")
+         * @return Shader, or nullptr if the name is unknown or compilation failed
+         */
+        Shader* GetProgram(const std::string& name, const std::vector<std::string>& defines = {});
+
+        /**
+         * @brief Get number of compiled variants
+         *
+         * @return Variant count (failed compilations included)
+         */
+        size_t GetProgramCount() const { return m_Programs.size(); }
+
+        /**
+         * @brief Delete every compiled variant (requires a current OpenGL context)
+         */
+        void Clear();
+
+    private:
+        /**
+         * @brief Registered shader source
+         */
+        struct ShaderSource {
+            std::string vertex;      ///< Vertex shader source code
+            std::string fragment;    ///< Fragment shader source code
+        };
+
+        /**
+         * @brief Build the variant key "name|DEFINE_A|DEFINE_B" with sorted defines
+         */
+        static std::string MakeKey(const std::string& name, const std::vector<std::string>& defines);
+
+        std::unordered_map<std::string, ShaderSource> m_Sources;               ///< Name -> source
+        std::unordered_map<std::string, std::unique_ptr<Shader>> m_Programs;   ///< Variant key -> program (nullptr if it failed)
+    };
+
+} // namespace GP2Engine
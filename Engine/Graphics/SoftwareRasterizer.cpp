@@ -0,0 +1,568 @@
+/**
+ * @file SoftwareRasterizer.cpp
+ * @brief CPU reference backend implementation
+ * @author Asri (100%)
+ *
+ * This file contains the implementation of the SoftwareRasterizer class and
+ * the PNG reader/writer used for golden images. PNGs are written with stored
+ * (uncompressed) deflate blocks, which keeps the encoder small and the output
+ * byte-for-byte reproducible.
+ */
+
+#include "SoftwareRasterizer.hpp"
+#include "Renderer.hpp"
+#include "Texture.hpp"
+#include "Font.hpp"
+#include "../ECS/Registry.hpp"
+#include "../ECS/Systems.hpp"
+#include "../Serialization/JsonSerializer.hpp"
+#include <glm/gtc/matrix_transform.hpp>
+#include <stb_image.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+namespace GP2Engine {
+
+    // ==================== PNG ====================
+
+    static uint32_t Crc32(const unsigned char* data, size_t length, uint32_t crc = 0) {
+        static const std::array<uint32_t, 256> table = [] {
+            std::array<uint32_t, 256> values{};
+            for (uint32_t i = 0; i < 256; ++i) {
+                uint32_t c = i;
+                for (int bit = 0; bit < 8; ++bit) {
+                    c = (c & 1u) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                }
+                values[i] = c;
+            }
+            return values;
+        }();
+
+        crc = ~crc;
+        for (size_t i = 0; i < length; ++i) {
+            crc = table[(crc ^ data[i]) & 0xFFu] ^ (crc >> 8);
+        }
+        return ~crc;
+    }
+
+    static void AppendBigEndian(std::vector<unsigned char>& out, uint32_t value) {
+        out.push_back(static_cast<unsigned char>(value >> 24));
+        out.push_back(static_cast<unsigned char>(value >> 16));
+        out.push_back(static_cast<unsigned char>(value >> 8));
+        out.push_back(static_cast<unsigned char>(value));
+    }
+
+    static void AppendChunk(std::vector<unsigned char>& out, const char* type, const std::vector<unsigned char>& data) {
+        AppendBigEndian(out, static_cast<uint32_t>(data.size()));
+        const size_t typeStart = out.size();
+        out.insert(out.end(), type, type + 4);
+        out.insert(out.end(), data.begin(), data.end());
+        AppendBigEndian(out, Crc32(out.data() + typeStart, data.size() + 4));
+    }
+
+    bool SoftwareImage::SavePNG(const std::string& filepath) const {
+        if (width <= 0 || height <= 0 || pixels.size() != static_cast<size_t>(width) * height * 4) {
+            std::cerr << "SoftwareImage: Cannot save an empty image to " << filepath << std::endl;
+            return false;
+        }
+
+        // Scanlines with filter type 0 (none)
+        const size_t rowBytes = static_cast<size_t>(width) * 4;
+        std::vector<unsigned char> raw;
+        raw.reserve((rowBytes + 1) * height);
+        for (int y = 0; y < height; ++y) {
+            raw.push_back(0);
+            const unsigned char* row = pixels.data() + rowBytes * y;
+            raw.insert(raw.end(), row, row + rowBytes);
+        }
+
+        // zlib stream made of stored deflate blocks
+        std::vector<unsigned char> zlib = { 0x78, 0x01 };
+        const size_t maxBlock = 65535;
+        for (size_t offset = 0; offset < raw.size() || offset == 0; offset += maxBlock) {
+            const size_t length = std::min(maxBlock, raw.size() - offset);
+            const bool last = offset + length >= raw.size();
+            zlib.push_back(last ? 1 : 0);
+            zlib.push_back(static_cast<unsigned char>(length & 0xFF));
+            zlib.push_back(static_cast<unsigned char>(length >> 8));
+            zlib.push_back(static_cast<unsigned char>(~length & 0xFF));
+            zlib.push_back(static_cast<unsigned char>((~length >> 8) & 0xFF));
+            zlib.insert(zlib.end(), raw.begin() + static_cast<ptrdiff_t>(offset), raw.begin() + static_cast<ptrdiff_t>(offset + length));
+            if (last) break;
+        }
+
+        uint32_t a = 1, b = 0;
+        for (unsigned char byte : raw) {
+            a = (a + byte) % 65521u;
+            b = (b + a) % 65521u;
+        }
+        AppendBigEndian(zlib, (b << 16) | a);
+
+        std::vector<unsigned char> header;
+        AppendBigEndian(header, static_cast<uint32_t>(width));
+        AppendBigEndian(header, static_cast<uint32_t>(height));
+        header.insert(header.end(), { 8, 6, 0, 0, 0 });   // 8-bit RGBA, no interlace
+
+        std::vector<unsigned char> file = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+        AppendChunk(file, "IHDR", header);
+        AppendChunk(file, "IDAT", zlib);
+        AppendChunk(file, "IEND", {});
+
+        std::ofstream stream(filepath, std::ios::binary);
+        if (!stream.is_open()) {
+            std::cerr << "SoftwareImage: Could not open " << filepath << " for writing" << std::endl;
+            return false;
+        }
+        stream.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()));
+        return stream.good();
+    }
+
+    bool SoftwareImage::LoadPNG(const std::string& filepath) {
+        int channels = 0;
+        stbi_set_flip_vertically_on_load(false);
+        unsigned char* data = stbi_load(filepath.c_str(), &width, &height, &channels, 4);
+        if (!data) {
+            std::cerr << "SoftwareImage: Failed to load " << filepath << ": " << stbi_failure_reason() << std::endl;
+            width = height = 0;
+            pixels.clear();
+            return false;
+        }
+
+        pixels.assign(data, data + static_cast<size_t>(width) * height * 4);
+        stbi_image_free(data);
+        return true;
+    }
+
+    ImageDiff CompareImages(const SoftwareImage& actual, const SoftwareImage& expected, int tolerance, SoftwareImage* diffOut) {
+        ImageDiff diff;
+        diff.sizeMatches = actual.width == expected.width && actual.height == expected.height &&
+                           actual.pixels.size() == expected.pixels.size();
+        if (!diff.sizeMatches) {
+            diff.differingPixels = std::max(actual.pixels.size(), expected.pixels.size()) / 4;
+            diff.maxDelta = 255;
+            return diff;
+        }
+
+        if (diffOut) {
+            *diffOut = SoftwareImage(expected.width, expected.height);
+        }
+
+        uint64_t totalError = 0;
+        const size_t pixelCount = expected.pixels.size() / 4;
+        for (size_t i = 0; i < pixelCount; ++i) {
+            int pixelDelta = 0;
+            for (size_t channel = 0; channel < 4; ++channel) {
+                const int delta = std::abs(static_cast<int>(actual.pixels[i * 4 + channel]) - static_cast<int>(expected.pixels[i * 4 + channel]));
+                pixelDelta = std::max(pixelDelta, delta);
+                totalError += static_cast<uint64_t>(delta);
+            }
+
+            const bool differs = pixelDelta > tolerance;
+            diff.maxDelta = std::max(diff.maxDelta, pixelDelta);
+            if (differs) {
+                diff.differingPixels++;
+            }
+
+            if (diffOut) {
+                unsigned char* out = diffOut->pixels.data() + i * 4;
+                if (differs) {
+                    out[0] = 255; out[1] = 0; out[2] = 0;
+                } else {
+                    // Dimmed grayscale of the expected image for context
+                    const unsigned char* source = expected.pixels.data() + i * 4;
+                    const unsigned char gray = static_cast<unsigned char>((source[0] + source[1] + source[2]) / 12);
+                    out[0] = out[1] = out[2] = gray;
+                }
+                out[3] = 255;
+            }
+        }
+
+        diff.meanError = pixelCount > 0 ? static_cast<double>(totalError) / static_cast<double>(pixelCount * 4) : 0.0;
+        return diff;
+    }
+
+    // ==================== Rasterizer ====================
+
+    SoftwareRasterizer::SoftwareRasterizer(int width, int height)
+        : m_Target(std::max(width, 0), std::max(height, 0))
+        , m_Units(Renderer::MAX_TEXTURE_SLOTS, 0) {
+    }
+
+    void SoftwareRasterizer::Clear(const glm::vec4& color) {
+        const glm::vec4 clamped = glm::clamp(color, 0.0f, 1.0f) * 255.0f + 0.5f;
+        for (size_t i = 0; i < m_Target.pixels.size(); i += 4) {
+            m_Target.pixels[i + 0] = static_cast<unsigned char>(clamped.r);
+            m_Target.pixels[i + 1] = static_cast<unsigned char>(clamped.g);
+            m_Target.pixels[i + 2] = static_cast<unsigned char>(clamped.b);
+            m_Target.pixels[i + 3] = static_cast<unsigned char>(clamped.a);
+        }
+        m_Stats = Stats();
+    }
+
+    void SoftwareRasterizer::SetCamera(const Camera& camera) {
+        m_ViewProjection = camera.GetViewProjectionMatrix();
+        m_Projection = camera.GetProjectionMatrix();
+    }
+
+    void SoftwareRasterizer::DrawQuad(const glm::vec2& position, const glm::vec2& size, float rotation, const glm::vec4& color) {
+        DrawTexturedQuad(position, size, rotation, 0, glm::vec4(0.0f), color);
+    }
+
+    void SoftwareRasterizer::DrawTexturedQuad(const glm::vec2& position, const glm::vec2& size, float rotation,
+                                              unsigned int textureID, const glm::vec4& texCoords, const glm::vec4& color) {
+        // Same model matrix and unit quad as the immediate GPU path
+        glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(position, 0.0f));
+        model = glm::rotate(model, glm::radians(rotation), glm::vec3(0.0f, 0.0f, 1.0f));
+        model = glm::scale(model, glm::vec3(size, 1.0f));
+        const glm::mat4 matrix = m_ViewProjection * model;
+
+        const glm::vec2 corners[4] = { { -0.5f, -0.5f }, { 0.5f, -0.5f }, { 0.5f, 0.5f }, { -0.5f, 0.5f } };
+        const glm::vec2 uvs[4] = {
+            { texCoords.x, texCoords.y },
+            { texCoords.x + texCoords.z, texCoords.y },
+            { texCoords.x + texCoords.z, texCoords.y + texCoords.w },
+            { texCoords.x, texCoords.y + texCoords.w }
+        };
+
+        RasterVertex vertices[4];
+        for (int i = 0; i < 4; ++i) {
+            vertices[i] = { ToScreen(matrix, corners[i]), uvs[i], color };
+        }
+        RasterizeQuad(vertices, textureID != 0 ? FindTexture(textureID) : TextureSource());
+    }
+
+    void SoftwareRasterizer::DrawPreparedBatch(const BatchQuadVertex* vertices, size_t quadCount,
+                                               const TextureBinding* bindings, size_t bindingCount) {
+        for (size_t i = 0; i < bindingCount; ++i) {
+            if (bindings[i].slot >= 0 && static_cast<size_t>(bindings[i].slot) < m_Units.size()) {
+                m_Units[bindings[i].slot] = bindings[i].textureID;
+            }
+        }
+
+        for (size_t quad = 0; quad < quadCount; ++quad) {
+            const BatchQuadVertex* source = vertices + quad * 4;
+
+            // Index < 0.5 is a colored quad (unit 0 holds the white texture)
+            const float index = source[0].textureIndex;
+            TextureSource texture;
+            if (index >= 0.5f) {
+                const size_t unit = static_cast<size_t>(index);
+                texture = FindTexture(unit < m_Units.size() ? m_Units[unit] : 0);
+            }
+
+            RasterVertex quadVertices[4];
+            for (int i = 0; i < 4; ++i) {
+                quadVertices[i] = { ToScreen(m_ViewProjection, glm::vec2(source[i].position)), source[i].texCoords, source[i].color };
+            }
+            RasterizeQuad(quadVertices, texture);
+        }
+    }
+
+    void SoftwareRasterizer::DrawText(const Font* font, const std::string& text, const glm::vec2& position, float rotation,
+                                      const glm::vec2& scale, float textScale, const glm::vec4& color) {
+        if (!font || !font->IsValid()) {
+            std::cerr << "SoftwareRasterizer: Invalid font" << std::endl;
+            return;
+        }
+
+        const float cosRot = std::cos(glm::radians(rotation));
+        const float sinRot = std::sin(glm::radians(rotation));
+        const float finalScaleX = scale.x * textScale;
+        const float finalScaleY = scale.y * textScale;
+
+        float xOffset = 0.0f;
+        for (const char& c : text) {
+            const Character& ch = font->GetCharacter(c);
+
+            if (!ch.bitmap.empty()) {
+                const float xpos = xOffset + ch.bearing.x * finalScaleX;
+                const float ypos = -(ch.size.y - ch.bearing.y) * finalScaleY;
+                const float w = ch.size.x * finalScaleX;
+                const float h = ch.size.y * finalScaleY;
+
+                // Same corners and V flip as Renderer::DrawText (Y-down)
+                const glm::vec2 corners[4] = { { xpos, ypos }, { xpos + w, ypos }, { xpos + w, ypos + h }, { xpos, ypos + h } };
+                const glm::vec2 uvs[4] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+
+                RasterVertex vertices[4];
+                for (int i = 0; i < 4; ++i) {
+                    const glm::vec2 rotated(corners[i].x * cosRot - corners[i].y * sinRot + position.x,
+                                            corners[i].x * sinRot + corners[i].y * cosRot + position.y);
+                    vertices[i] = { ToScreen(m_Projection, rotated), uvs[i], color };
+                }
+
+                TextureSource glyph;
+                glyph.pixels = ch.bitmap.data();
+                glyph.width = ch.size.x;
+                glyph.height = ch.size.y;
+                glyph.coverage = true;
+                RasterizeQuad(vertices, glyph);
+                m_Stats.glyphs++;
+            }
+
+            xOffset += (ch.advance >> 6) * finalScaleX;
+        }
+    }
+
+    void SoftwareRasterizer::DrawLine(const glm::vec2& start, const glm::vec2& end, const glm::vec4& color) {
+        const glm::vec2 from = ToScreen(m_ViewProjection, start);
+        const glm::vec2 to = ToScreen(m_ViewProjection, end);
+
+        // Bresenham between the pixels containing the end points
+        int x0 = static_cast<int>(std::floor(from.x)), y0 = static_cast<int>(std::floor(from.y));
+        const int x1 = static_cast<int>(std::floor(to.x)), y1 = static_cast<int>(std::floor(to.y));
+        const int dx = std::abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+        const int dy = -std::abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+
+        // Lines far outside the target would walk every pixel in between
+        const int limit = 4 * (m_Target.width + m_Target.height);
+        if (dx > limit || -dy > limit) {
+            return;
+        }
+
+        int error = dx + dy;
+        while (true) {
+            BlendPixel(x0, y0, color);
+            if (x0 == x1 && y0 == y1) break;
+            const int e2 = 2 * error;
+            if (e2 >= dy) { error += dy; x0 += sx; }
+            if (e2 <= dx) { error += dx; y0 += sy; }
+        }
+        m_Stats.lines++;
+    }
+
+    void SoftwareRasterizer::RenderFrame(const FramePacket& packet, const PreparedFrame& prepared) {
+        SetCamera(packet.camera);
+
+        size_t batchIndex = 0;
+        for (uint32_t commandIndex = 0; commandIndex < packet.commands.size(); ++commandIndex) {
+            const PacketCommand& command = packet.commands[commandIndex];
+
+            switch (command.type) {
+                case PacketCommand::Type::SpriteBatch: {
+                    for (; batchIndex < prepared.batches.size() && prepared.batches[batchIndex].commandIndex == commandIndex; ++batchIndex) {
+                        const PreparedBatch& batch = prepared.batches[batchIndex];
+                        DrawPreparedBatch(prepared.vertices.data() + static_cast<size_t>(batch.firstQuad) * 4, batch.quadCount,
+                                          prepared.bindings.data() + batch.firstBinding, batch.bindingCount);
+                    }
+                    break;
+                }
+
+                case PacketCommand::Type::SpriteImmediate: {
+                    for (uint32_t i = command.first; i < command.first + command.count; ++i) {
+                        const PacketSprite& sprite = packet.sprites[i];
+                        if (sprite.textureID != 0) {
+                            DrawTexturedQuad(sprite.position, sprite.size, sprite.rotation, sprite.textureID, sprite.texCoords, sprite.color);
+                        } else {
+                            DrawQuad(sprite.position, sprite.size, sprite.rotation, sprite.color);
+                        }
+                    }
+                    break;
+                }
+
+                case PacketCommand::Type::Text: {
+                    const PacketText& text = packet.texts[command.first];
+                    DrawText(text.font.get(), text.text, text.position, text.rotation, text.scale, text.textScale, text.color);
+                    break;
+                }
+            }
+        }
+    }
+
+    void SoftwareRasterizer::RenderPacket(const FramePacket& packet) {
+        TextureSlotManager slots(static_cast<int>(Renderer::MAX_TEXTURE_SLOTS));
+        PreparedFrame prepared;
+        QuadBatchSoA batchQuads;
+        FramePipeline::Prepare(packet, slots, prepared, batchQuads);
+        RenderFrame(packet, prepared);
+    }
+
+    bool SoftwareRasterizer::RenderScene(const std::string& scenePath, int width, int height, SoftwareImage& out, Stats* stats) {
+        if (width <= 0 || height <= 0) {
+            std::cerr << "SoftwareRasterizer: Invalid image size " << width << "x" << height << std::endl;
+            return false;
+        }
+
+        // Textures and fonts loaded from here on keep their pixels on the CPU
+        Renderer::SetHeadless(true);
+
+        Registry registry;
+        if (!JsonSerializer::LoadScene(registry, scenePath)) {
+            std::cerr << "SoftwareRasterizer: Failed to load scene " << scenePath << std::endl;
+            return false;
+        }
+
+        // Screen-space camera like the game's (origin at the top-left)
+        Camera camera(0.0f, static_cast<float>(width), static_cast<float>(height), 0.0f);
+
+        RenderSystem renderSystem;
+        FramePacket packet;
+        renderSystem.BuildFramePacket(registry, camera, packet);
+
+        SoftwareRasterizer rasterizer(width, height);
+        rasterizer.Clear(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+        rasterizer.RenderPacket(packet);
+
+        out = rasterizer.GetImage();
+        if (stats) {
+            *stats = rasterizer.GetStats();
+        }
+        return true;
+    }
+
+    glm::vec2 SoftwareRasterizer::ToScreen(const glm::mat4& matrix, const glm::vec2& position) const {
+        const glm::vec4 clip = matrix * glm::vec4(position, 0.0f, 1.0f);
+        const glm::vec2 ndc = clip.w != 0.0f ? glm::vec2(clip) / clip.w : glm::vec2(clip);
+
+        // OpenGL's window origin is bottom-left; image row 0 is the top
+        return glm::vec2((ndc.x * 0.5f + 0.5f) * static_cast<float>(m_Target.width),
+                         (1.0f - (ndc.y * 0.5f + 0.5f)) * static_cast<float>(m_Target.height));
+    }
+
+    SoftwareRasterizer::TextureSource SoftwareRasterizer::FindTexture(unsigned int textureID) {
+        TextureSource source;
+        const Texture* texture = Texture::FindHeadless(textureID);
+        if (!texture || texture->GetPixels().empty()) {
+            source.missing = true;
+            return source;
+        }
+
+        source.pixels = texture->GetPixels().data();
+        source.width = texture->GetWidth();
+        source.height = texture->GetHeight();
+        return source;
+    }
+
+    void SoftwareRasterizer::RasterizeQuad(const RasterVertex* vertices, const TextureSource& texture) {
+        RasterizeTriangle(vertices[0], vertices[1], vertices[2], texture);
+        RasterizeTriangle(vertices[2], vertices[3], vertices[0], texture);
+        m_Stats.quads++;
+    }
+
+    void SoftwareRasterizer::RasterizeTriangle(const RasterVertex& a, const RasterVertex& b, const RasterVertex& c, const TextureSource& texture) {
+        auto edge = [](const glm::vec2& from, const glm::vec2& to, const glm::vec2& point) {
+            return (to.x - from.x) * (point.y - from.y) - (to.y - from.y) * (point.x - from.x);
+        };
+
+        float area = edge(a.position, b.position, c.position);
+        if (area == 0.0f) {
+            return;
+        }
+
+        // Wind every triangle the same way so the edge tests share a sign
+        const RasterVertex* v0 = &a;
+        const RasterVertex* v1 = &b;
+        const RasterVertex* v2 = &c;
+        if (area < 0.0f) {
+            std::swap(v1, v2);
+            area = -area;
+        }
+
+        // A pixel center exactly on an edge belongs to one of the two triangles sharing it
+        auto ownsEdge = [](const glm::vec2& from, const glm::vec2& to) {
+            const glm::vec2 d = to - from;
+            return d.y > 0.0f || (d.y == 0.0f && d.x < 0.0f);
+        };
+        const bool owns0 = ownsEdge(v1->position, v2->position);
+        const bool owns1 = ownsEdge(v2->position, v0->position);
+        const bool owns2 = ownsEdge(v0->position, v1->position);
+
+        const float minX = std::min({ v0->position.x, v1->position.x, v2->position.x });
+        const float maxX = std::max({ v0->position.x, v1->position.x, v2->position.x });
+        const float minY = std::min({ v0->position.y, v1->position.y, v2->position.y });
+        const float maxY = std::max({ v0->position.y, v1->position.y, v2->position.y });
+
+        const int x0 = std::max(0, static_cast<int>(std::floor(minX)));
+        const int x1 = std::min(m_Target.width - 1, static_cast<int>(std::ceil(maxX)));
+        const int y0 = std::max(0, static_cast<int>(std::floor(minY)));
+        const int y1 = std::min(m_Target.height - 1, static_cast<int>(std::ceil(maxY)));
+
+        const float invArea = 1.0f / area;
+        for (int y = y0; y <= y1; ++y) {
+            for (int x = x0; x <= x1; ++x) {
+                const glm::vec2 center(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
+                const float w0 = edge(v1->position, v2->position, center);
+                const float w1 = edge(v2->position, v0->position, center);
+                const float w2 = edge(v0->position, v1->position, center);
+
+                if (w0 < 0.0f || w1 < 0.0f || w2 < 0.0f) continue;
+                if ((w0 == 0.0f && !owns0) || (w1 == 0.0f && !owns1) || (w2 == 0.0f && !owns2)) continue;
+
+                const float b0 = w0 * invArea;
+                const float b1 = w1 * invArea;
+                const float b2 = w2 * invArea;
+
+                glm::vec4 color = v0->color * b0 + v1->color * b1 + v2->color * b2;
+                if (texture.pixels || texture.missing) {
+                    const glm::vec2 texCoord = v0->texCoord * b0 + v1->texCoord * b1 + v2->texCoord * b2;
+                    color *= Sample(texture, texCoord);
+                }
+                BlendPixel(x, y, color);
+            }
+        }
+    }
+
+    glm::vec4 SoftwareRasterizer::Sample(const TextureSource& texture, const glm::vec2& texCoord) const {
+        if (!texture.pixels) {
+            return glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+        }
+
+        // Textures repeat; glyphs are clamped to the edge
+        auto texel = [&texture](int x, int y) {
+            if (texture.coverage) {
+                x = std::clamp(x, 0, texture.width - 1);
+                y = std::clamp(y, 0, texture.height - 1);
+                const float value = texture.pixels[static_cast<size_t>(y) * texture.width + x] / 255.0f;
+                return glm::vec4(1.0f, 1.0f, 1.0f, value);
+            }
+
+            x = ((x % texture.width) + texture.width) % texture.width;
+            y = ((y % texture.height) + texture.height) % texture.height;
+            const unsigned char* p = texture.pixels + (static_cast<size_t>(y) * texture.width + x) * 4;
+            return glm::vec4(p[0], p[1], p[2], p[3]) / 255.0f;
+        };
+
+        const float u = texCoord.x * static_cast<float>(texture.width);
+        const float v = texCoord.y * static_cast<float>(texture.height);
+
+        if (m_Filter == TextureFilter::Nearest) {
+            return texel(static_cast<int>(std::floor(u)), static_cast<int>(std::floor(v)));
+        }
+
+        // Texel centers sit at +0.5
+        const float su = u - 0.5f;
+        const float sv = v - 0.5f;
+        const float fu = std::floor(su);
+        const float fv = std::floor(sv);
+        const float tu = su - fu;
+        const float tv = sv - fv;
+        const int ix = static_cast<int>(fu);
+        const int iy = static_cast<int>(fv);
+
+        const glm::vec4 top = glm::mix(texel(ix, iy), texel(ix + 1, iy), tu);
+        const glm::vec4 bottom = glm::mix(texel(ix, iy + 1), texel(ix + 1, iy + 1), tu);
+        return glm::mix(top, bottom, tv);
+    }
+
+    void SoftwareRasterizer::BlendPixel(int x, int y, const glm::vec4& color) {
+        if (x < 0 || y < 0 || x >= m_Target.width || y >= m_Target.height) {
+            return;
+        }
+
+        unsigned char* pixel = m_Target.pixels.data() + (static_cast<size_t>(y) * m_Target.width + x) * 4;
+        const glm::vec4 source = glm::clamp(color, 0.0f, 1.0f);
+        const glm::vec4 destination = glm::vec4(pixel[0], pixel[1], pixel[2], pixel[3]) / 255.0f;
+
+        // SRC_ALPHA, ONE_MINUS_SRC_ALPHA on every channel (as configured by the Renderer)
+        const glm::vec4 result = source * source.a + destination * (1.0f - source.a);
+        for (int channel = 0; channel < 4; ++channel) {
+            pixel[channel] = static_cast<unsigned char>(std::clamp(result[channel], 0.0f, 1.0f) * 255.0f + 0.5f);
+        }
+        m_Stats.fragments++;
+    }
+
+} // namespace GP2Engine
@@ -0,0 +1,310 @@
+/**
+ * @file SoftwareRasterizer.hpp
+ * @brief CPU reference backend for golden-image render tests
+ * @author Asri (100%)
+ *
+ * This file contains the SoftwareRasterizer class which draws the renderer's
+ * primitives (colored and textured quads, prepared sprite batches, text and
+ * debug lines) into an RGBA8 image on the CPU. It replays FramePackets the
+ * same way FramePipeline::Execute does, so a scene can be rendered without a
+ * window or OpenGL context and compared pixel by pixel against a stored PNG.
+ *
+ * Textures and fonts must be loaded with Renderer::SetHeadless(true) so their
+ * pixels stay on the CPU.
+ */
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include "Camera.hpp"
+#include "FramePacket.hpp"
+
+namespace GP2Engine {
+
+    class Font;
+
+    /**
+     * @brief RGBA8 image, top row first
+     */
+    struct SoftwareImage {
+        int width{0};                          ///< Width in pixels
+        int height{0};                         ///< Height in pixels
+        std::vector<unsigned char> pixels;     ///< width * height * 4 bytes
+
+        SoftwareImage() = default;
+        SoftwareImage(int w, int h) : width(w), height(h), pixels(static_cast<size_t>(w) * h * 4, 0) {}
+
+        /**
+         * @brief Write the image as an uncompressed PNG
+         *
+         * @param filepath Output file
+         * @return true if the file was written
+         */
+        bool SavePNG(const std::string& filepath) const;
+
+        /**
+         * @brief Load an image (any format stb_image reads), converted to RGBA8
+         *
+         * @param filepath Image file
+         * @return true if the image was loaded
+         */
+        bool LoadPNG(const std::string& filepath);
+    };
+
+    /**
+     * @brief Result of comparing two images
+     */
+    struct ImageDiff {
+        bool sizeMatches{false};       ///< Both images have the same dimensions
+        size_t differingPixels{0};     ///< Pixels with a channel difference above the tolerance
+        int maxDelta{0};               ///< Largest channel difference (0-255)
+        double meanError{0.0};         ///< Mean absolute channel difference (0-255)
+
+        /**
+         * @brief Check whether the images are considered equal
+         *
+         * @return true if the sizes match and no pixel differs
+         */
+        bool Matches() const { return sizeMatches && differingPixels == 0; }
+    };
+
+    /**
+     * @brief Compare two images channel by channel
+     *
+     * @param actual Rendered image
+     * @param expected Golden image
+     * @param tolerance Largest channel difference still counted as equal
+     * @param diffOut Optional image marking differing pixels in red over a dimmed copy of expected
+     * @return Comparison result
+     */
+    ImageDiff CompareImages(const SoftwareImage& actual, const SoftwareImage& expected, int tolerance = 0,
+                            SoftwareImage* diffOut = nullptr);
+
+    /**
+     * @brief Texture sampling mode of the software rasterizer
+     */
+    enum class TextureFilter {
+        Nearest,   ///< Closest texel
+        Bilinear   ///< Weighted average of the four closest texels (no mipmaps)
+    };
+
+    /**
+     * @brief CPU implementation of the renderer's primitives
+     *
+     * Follows the OpenGL conventions the GPU path relies on: pixel centers at
+     * +0.5, a top-left style fill rule so shared quad edges are drawn once,
+     * texel row 0 at v = 0, repeat wrapping for textures, clamped glyphs and
+     * SRC_ALPHA / ONE_MINUS_SRC_ALPHA blending on all four channels.
+     *
+     * @author Asri (100%)
+     */
+    class SoftwareRasterizer {
+    public:
+        /**
+         * @brief Counters of the last frame
+         */
+        struct Stats {
+            size_t quads = 0;          ///< Quads rasterized (sprites, tiles and glyphs)
+            size_t glyphs = 0;         ///< Glyph quads
+            size_t lines = 0;          ///< Lines
+            size_t fragments = 0;      ///< Pixels blended
+        };
+
+        /**
+         * @brief Create a rasterizer with a cleared (transparent black) target
+         *
+         * @param width Target width in pixels
+         * @param height Target height in pixels
+         */
+        SoftwareRasterizer(int width, int height);
+
+        /**
+         * @brief Fill the target and reset the counters
+         *
+         * @param color Clear color
+         */
+        void Clear(const glm::vec4& color);
+
+        /**
+         * @brief Set the camera used by the following draws
+         *
+         * @param camera Camera (quads use view-projection, text uses projection only)
+         */
+        void SetCamera(const Camera& camera);
+
+        /**
+         * @brief Set the texture sampling mode
+         *
+         * @param filter Sampling mode
+         */
+        void SetTextureFilter(TextureFilter filter) { m_Filter = filter; }
+
+        /**
+         * @brief Draw a colored quad (same as Renderer::DrawQuad)
+         *
+         * @param position Quad center
+         * @param size Quad size
+         * @param rotation Rotation in degrees
+         * @param color Color
+         */
+        void DrawQuad(const glm::vec2& position, const glm::vec2& size, float rotation, const glm::vec4& color);
+
+        /**
+         * @brief Draw a textured quad (same as Renderer::DrawTexturedQuad)
+         *
+         * @param position Quad center
+         * @param size Quad size
+         * @param rotation Rotation in degrees
+         * @param textureID Headless texture ID (see Texture::FindHeadless)
+         * @param texCoords Texture coordinates (x, y, width, height)
+         * @param color Color tint
+         */
+        void DrawTexturedQuad(const glm::vec2& position, const glm::vec2& size, float rotation,
+                              unsigned int textureID, const glm::vec4& texCoords, const glm::vec4& color);
+
+        /**
+         * @brief Draw prepared batch vertices (same as Renderer::DrawPreparedBatch)
+         *
+         * Texture unit assignments persist between calls, like the GPU's units.
+         *
+         * @param vertices 4 vertices per quad
+         * @param quadCount Number of quads
+         * @param bindings Texture unit assignments made while preparing
+         * @param bindingCount Number of assignments
+         */
+        void DrawPreparedBatch(const BatchQuadVertex* vertices, size_t quadCount,
+                               const TextureBinding* bindings, size_t bindingCount);
+
+        /**
+         * @brief Draw text (same as Renderer::DrawText with a Transform2D)
+         *
+         * @param font Font loaded in headless mode
+         * @param text Text to draw
+         * @param position Text origin
+         * @param rotation Rotation in degrees
+         * @param scale Transform scale
+         * @param textScale Additional text scale
+         * @param color Text color
+         */
+        void DrawText(const Font* font, const std::string& text, const glm::vec2& position, float rotation,
+                      const glm::vec2& scale, float textScale, const glm::vec4& color);
+
+        /**
+         * @brief Draw a one pixel wide line (debug renderer lines)
+         *
+         * @param start Start point in world space
+         * @param end End point in world space
+         * @param color Line color
+         */
+        void DrawLine(const glm::vec2& start, const glm::vec2& end, const glm::vec4& color);
+
+        /**
+         * @brief Draw a prepared packet in command order (same as FramePipeline::Execute)
+         *
+         * @param packet Packet to draw
+         * @param prepared Prepared data of the packet
+         */
+        void RenderFrame(const FramePacket& packet, const PreparedFrame& prepared);
+
+        /**
+         * @brief Prepare and draw a packet
+         *
+         * @param packet Packet to draw
+         */
+        void RenderPacket(const FramePacket& packet);
+
+        /**
+         * @brief Get the target image
+         *
+         * @return Rendered image
+         */
+        const SoftwareImage& GetImage() const { return m_Target; }
+
+        /**
+         * @brief Get the counters since the last Clear
+         *
+         * @return Frame counters
+         */
+        const Stats& GetStats() const { return m_Stats; }
+
+        /**
+         * @brief Load a scene file and render it without a window
+         *
+         * Switches the renderer to headless mode, loads the scene into the
+         * registry, builds a frame packet with a screen-space camera
+         * (origin at the top-left, like the game) and rasterizes it.
+         *
+         * @param scenePath Scene JSON file
+         * @param width Image width
+         * @param height Image height
+         * @param out Rendered image
+         * @param stats Optional frame counters
+         * @return true if the scene was loaded and rendered
+         */
+        static bool RenderScene(const std::string& scenePath, int width, int height, SoftwareImage& out,
+                                Stats* stats = nullptr);
+
+    private:
+        /**
+         * @brief Screen-space vertex
+         */
+        struct RasterVertex {
+            glm::vec2 position;    ///< Pixel coordinates (y down)
+            glm::vec2 texCoord;    ///< Texture coordinates
+            glm::vec4 color;       ///< Vertex color
+        };
+
+        /**
+         * @brief Pixels sampled by a draw
+         */
+        struct TextureSource {
+            const unsigned char* pixels = nullptr;   ///< Texels (nullptr = color only)
+            int width = 0;                           ///< Width in texels
+            int height = 0;                          ///< Height in texels
+            bool coverage = false;                   ///< One byte per texel, sampled as (1, 1, 1, value)
+            bool missing = false;                    ///< Texture not found (samples opaque black like an empty GL unit)
+        };
+
+        SoftwareImage m_Target;                              ///< Render target
+        glm::mat4 m_ViewProjection{1.0f};                    ///< Camera view-projection
+        glm::mat4 m_Projection{1.0f};                        ///< Camera projection (text)
+        TextureFilter m_Filter{TextureFilter::Bilinear};     ///< Sampling mode
+        std::vector<unsigned int> m_Units;                   ///< Texture ID bound to each batch unit
+        Stats m_Stats;                                       ///< Frame counters
+
+        /**
+         * @brief Transform a world position to pixel coordinates
+         */
+        glm::vec2 ToScreen(const glm::mat4& matrix, const glm::vec2& position) const;
+
+        /**
+         * @brief Look up a headless texture
+         */
+        static TextureSource FindTexture(unsigned int textureID);
+
+        /**
+         * @brief Rasterize the quad (v0, v1, v2, v3) as two triangles
+         */
+        void RasterizeQuad(const RasterVertex* vertices, const TextureSource& texture);
+
+        /**
+         * @brief Rasterize one triangle with interpolated texture coordinates and color
+         */
+        void RasterizeTriangle(const RasterVertex& a, const RasterVertex& b, const RasterVertex& c, const TextureSource& texture);
+
+        /**
+         * @brief Sample a texture with the current filter
+         */
+        glm::vec4 Sample(const TextureSource& texture, const glm::vec2& texCoord) const;
+
+        /**
+         * @brief Blend a color into the target
+         */
+        void BlendPixel(int x, int y, const glm::vec4& color);
+    };
+
+} // namespace GP2Engine
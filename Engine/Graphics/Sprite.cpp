@@ -46,9 +46,21 @@ namespace GP2Engine {
         m_Animations[name] = animation;
     }
     
+    void Sprite::SetAnimationClips(std::shared_ptr<const AnimationClipLibrary> clips) {
+        m_Clips = std::move(clips);
+
+        // The clip being played belonged to the previous library
+        if (m_CurrentClip != INVALID_ANIMATION_CLIP) {
+            m_CurrentClip = INVALID_ANIMATION_CLIP;
+            m_CurrentAnimationName.clear();
+            m_IsAnimationPlaying = false;
+        }
+    }
+
     bool Sprite::PlayAnimation(const std::string& name) {
-        auto it = m_Animations.find(name);
-        if (it == m_Animations.end()) {
+        // Shared clips first, then the sprite's own animations
+        AnimationClipID clip = m_Clips ? m_Clips->FindClip(name) : INVALID_ANIMATION_CLIP;
+        if (clip == INVALID_ANIMATION_CLIP && m_Animations.find(name) == m_Animations.end()) {
             std::cerr << "Animation not found: " << name << std::endl;
             return false;
         }
@@ -56,6 +68,7 @@ namespace GP2Engine {
         // Only restart if it's a different animation or if current animation has stopped
         if (m_CurrentAnimationName != name || !m_IsAnimationPlaying) {
             m_CurrentAnimationName = name;
+            m_CurrentClip = clip;
             m_CurrentFrame = 0;
             m_AnimationTimer = 0.0f;
             m_IsAnimationPlaying = true;
@@ -91,30 +104,31 @@ namespace GP2Engine {
             return;
         }
 
-        const Animation* currentAnim = GetCurrentAnimation();
-        if (!currentAnim || currentAnim->frames.empty()) {
+        int frameCount = 0;
+        bool loop = false;
+        if (!GetPlaybackInfo(frameCount, loop)) {
             return;
         }
 
         // Validate current frame index
-        if (m_CurrentFrame < 0 || m_CurrentFrame >= static_cast<int>(currentAnim->frames.size())) {
+        if (m_CurrentFrame < 0 || m_CurrentFrame >= frameCount) {
             m_CurrentFrame = 0;
         }
 
         m_AnimationTimer += deltaTime;
 
         // Check if we should advance to the next frame
-        const AnimationFrame& currentFrame = currentAnim->frames[m_CurrentFrame];
-        if (m_AnimationTimer >= currentFrame.duration) {
-            m_AnimationTimer -= currentFrame.duration;
+        const float frameDuration = GetFrameDuration(m_CurrentFrame);
+        if (m_AnimationTimer >= frameDuration) {
+            m_AnimationTimer -= frameDuration;
             m_CurrentFrame++;
 
             // Check if animation is complete
-            if (m_CurrentFrame >= static_cast<int>(currentAnim->frames.size())) {
-                if (currentAnim->loop) {
+            if (m_CurrentFrame >= frameCount) {
+                if (loop) {
                     m_CurrentFrame = 0; // Loop back to start
                 } else {
-                    m_CurrentFrame = static_cast<int>(currentAnim->frames.size()) - 1; // Stay on last frame
+                    m_CurrentFrame = frameCount - 1; // Stay on last frame
                     m_IsAnimationPlaying = false; // Stop animation
                 }
             }
@@ -160,6 +174,15 @@ namespace GP2Engine {
     }
     
     void Sprite::UpdateSourceRectFromCurrentFrame() {
+        // Shared clips store normalized rectangles already
+        if (m_CurrentClip != INVALID_ANIMATION_CLIP) {
+            const AnimationClip* clip = m_Clips ? m_Clips->GetClip(m_CurrentClip) : nullptr;
+            if (clip && m_CurrentFrame >= 0 && m_CurrentFrame < static_cast<int>(clip->frameCount)) {
+                m_SourceRect = m_Clips->GetFrameUVs()[clip->firstFrame + static_cast<uint32_t>(m_CurrentFrame)];
+            }
+            return;
+        }
+
         const Animation* currentAnim = GetCurrentAnimation();
         if (!currentAnim || currentAnim->frames.empty()) {
             return;
@@ -191,7 +214,7 @@ namespace GP2Engine {
     }
     
     const Animation* Sprite::GetCurrentAnimation() const {
-        if (m_CurrentAnimationName.empty()) {
+        if (m_CurrentAnimationName.empty() || m_CurrentClip != INVALID_ANIMATION_CLIP) {
             return nullptr;
         }
         
@@ -199,4 +222,32 @@ namespace GP2Engine {
         return (it != m_Animations.end()) ? &it->second : nullptr;
     }
     
+    bool Sprite::GetPlaybackInfo(int& frameCount, bool& loop) const {
+        if (m_CurrentClip != INVALID_ANIMATION_CLIP) {
+            const AnimationClip* clip = m_Clips ? m_Clips->GetClip(m_CurrentClip) : nullptr;
+            if (!clip || clip->frameCount == 0) {
+                return false;
+            }
+            frameCount = static_cast<int>(clip->frameCount);
+            loop = clip->loop;
+            return true;
+        }
+
+        const Animation* currentAnim = GetCurrentAnimation();
+        if (!currentAnim || currentAnim->frames.empty()) {
+            return false;
+        }
+        frameCount = static_cast<int>(currentAnim->frames.size());
+        loop = currentAnim->loop;
+        return true;
+    }
+
+    float Sprite::GetFrameDuration(int frame) const {
+        if (m_CurrentClip != INVALID_ANIMATION_CLIP) {
+            const AnimationClip* clip = m_Clips->GetClip(m_CurrentClip);
+            return m_Clips->GetFrameDurations()[clip->firstFrame + static_cast<uint32_t>(frame)];
+        }
+        return GetCurrentAnimation()->frames[frame].duration;
+    }
+
 } // namespace GP2Engine
\ No newline at end of file
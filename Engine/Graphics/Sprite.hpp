@@ -11,6 +11,7 @@
 #pragma once
 
 #include "Texture.hpp"
+#include "AnimationClipLibrary.hpp"
 #include "../Math/Vector2D.hpp"
 #include <glm/glm.hpp>
 #include <vector>
@@ -359,10 +360,28 @@ namespace GP2Engine {
          */
         void AddAnimation(const std::string& name, const std::vector<AnimationFrame>& frames, bool loop = true);
         
+        /**
+         * @brief Share a clip library with other sprites
+         *
+         * Clips in the library are played by name like animations added with
+         * AddAnimation (and take precedence over them), but their frames are
+         * not copied into the sprite.
+         *
+         * @param clips Read-only clip library (nullptr to use per-sprite animations only)
+         */
+        void SetAnimationClips(std::shared_ptr<const AnimationClipLibrary> clips);
+
+        /**
+         * @brief Get the shared clip library
+         *
+         * @return Clip library, or nullptr if none is set
+         */
+        const std::shared_ptr<const AnimationClipLibrary>& GetAnimationClips() const { return m_Clips; }
+
         /**
          * @brief Play animation (Rubric 1208)
          * 
-         * @param name Animation name to play
+         * @param name Animation name to play (shared clip or added animation)
          * @return true if animation found and started, false otherwise
          */
         bool PlayAnimation(const std::string& name);
@@ -456,6 +475,8 @@ namespace GP2Engine {
         
         // Animation system
         std::unordered_map<std::string, Animation> m_Animations; ///< Animation map
+        std::shared_ptr<const AnimationClipLibrary> m_Clips; ///< Shared clips (nullptr = none)
+        AnimationClipID m_CurrentClip{INVALID_ANIMATION_CLIP}; ///< Current clip when playing from m_Clips
         std::string m_CurrentAnimationName;  ///< Current animation name
         int m_CurrentFrame{0};               ///< Current frame index
         float m_AnimationTimer{0.0f};       ///< Animation timer
@@ -471,9 +492,26 @@ namespace GP2Engine {
         /**
          * @brief Get current animation
          * 
-         * @return Pointer to current animation, or nullptr if none
+         * @return Pointer to current animation, or nullptr if none (or playing a shared clip)
          */
         const Animation* GetCurrentAnimation() const;
+
+        /**
+         * @brief Get frame count and looping of the current animation or clip
+         *
+         * @param frameCount Output number of frames
+         * @param loop Output looping flag
+         * @return false if nothing with frames is selected
+         */
+        bool GetPlaybackInfo(int& frameCount, bool& loop) const;
+
+        /**
+         * @brief Get duration of a frame of the current animation or clip
+         *
+         * @param frame Frame index (must be valid)
+         * @return Duration in seconds
+         */
+        float GetFrameDuration(int frame) const;
     };
     
     // Type alias for shared sprite pointer
@@ -9,8 +9,10 @@
  */
 
 #include "Texture.hpp"
+#include "Renderer.hpp"
 #include <glad/glad.h>
 #include <iostream>
+#include <unordered_map>
 
 // STB Image for loading textures
 #define STB_IMAGE_IMPLEMENTATION
@@ -18,6 +20,10 @@
 
 namespace GP2Engine {
     
+    // Headless textures get IDs from this counter and are found through this table
+    static unsigned int s_NextHeadlessID = 1;
+    static std::unordered_map<unsigned int, const Texture*> s_HeadlessTextures;
+    
     Texture::Texture() = default;
     
     Texture::Texture(const std::string& filePath) {
@@ -33,7 +39,12 @@ namespace GP2Engine {
         , m_Width(other.m_Width)
         , m_Height(other.m_Height)
         , m_Channels(other.m_Channels)
-        , m_FilePath(std::move(other.m_FilePath)) {
+        , m_FilePath(std::move(other.m_FilePath))
+        , m_Pixels(std::move(other.m_Pixels)) {
+        
+        if (Renderer::IsHeadless() && m_TextureID != 0) {
+            s_HeadlessTextures[m_TextureID] = this;
+        }
         
         // Reset the moved-from object
         other.m_TextureID = 0;
@@ -53,6 +64,11 @@ namespace GP2Engine {
             m_Height = other.m_Height;
             m_Channels = other.m_Channels;
             m_FilePath = std::move(other.m_FilePath);
+            m_Pixels = std::move(other.m_Pixels);
+            
+            if (Renderer::IsHeadless() && m_TextureID != 0) {
+                s_HeadlessTextures[m_TextureID] = this;
+            }
             
             // Reset the moved-from object
             other.m_TextureID = 0;
@@ -112,7 +128,14 @@ namespace GP2Engine {
     
     void Texture::Destroy() {
         if (m_TextureID != 0) {
-            glDeleteTextures(1, &m_TextureID);
+            // Release the batch texture unit before the ID can be reused
+            Renderer::NotifyTextureDeleted(m_TextureID);
+            if (Renderer::IsHeadless()) {
+                s_HeadlessTextures.erase(m_TextureID);
+                m_Pixels.clear();
+            } else {
+                glDeleteTextures(1, &m_TextureID);
+            }
             m_TextureID = 0;
             m_Width = 0;
             m_Height = 0;
@@ -122,16 +145,20 @@ namespace GP2Engine {
     }
     
     void Texture::Bind(unsigned int slot) const {
+        if (Renderer::IsHeadless()) return;
+        
         glActiveTexture(GL_TEXTURE0 + slot);
         glBindTexture(GL_TEXTURE_2D, m_TextureID);
     }
     
     void Texture::Unbind() const {
+        if (Renderer::IsHeadless()) return;
+        
         glBindTexture(GL_TEXTURE_2D, 0);
     }
     
     void Texture::SetFilterMode(bool linear) {
-        if (m_TextureID == 0) return;
+        if (m_TextureID == 0 || Renderer::IsHeadless()) return;
         
         Bind();
         GLenum filter = linear ? GL_LINEAR : GL_NEAREST;
@@ -141,7 +168,7 @@ namespace GP2Engine {
     }
     
     void Texture::SetWrapMode(bool repeat) {
-        if (m_TextureID == 0) return;
+        if (m_TextureID == 0 || Renderer::IsHeadless()) return;
         
         Bind();
         GLenum wrap = repeat ? GL_REPEAT : GL_CLAMP_TO_EDGE;
@@ -166,7 +193,20 @@ namespace GP2Engine {
         return nullptr;
     }
     
+    const Texture* Texture::FindHeadless(unsigned int textureID) {
+        auto it = s_HeadlessTextures.find(textureID);
+        return it != s_HeadlessTextures.end() ? it->second : nullptr;
+    }
+    
     void Texture::GenerateTexture(unsigned char* data) {
+        if (Renderer::IsHeadless()) {
+            // No OpenGL context: keep the pixels for the software rasterizer instead
+            m_Pixels.assign(data, data + static_cast<size_t>(m_Width) * m_Height * m_Channels);
+            m_TextureID = s_NextHeadlessID++;
+            s_HeadlessTextures[m_TextureID] = this;
+            return;
+        }
+        
         // Generate OpenGL texture
         glGenTextures(1, &m_TextureID);
         glBindTexture(GL_TEXTURE_2D, m_TextureID);
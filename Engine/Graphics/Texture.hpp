@@ -12,6 +12,7 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace GP2Engine {
     
@@ -131,6 +132,24 @@ namespace GP2Engine {
          */
         bool IsValid() const { return m_TextureID != 0; }
         
+        /**
+         * @brief Get the CPU copy of the pixels (headless mode only)
+         * 
+         * @return Pixels (width * height * channels bytes, top row first), empty when using OpenGL
+         */
+        const std::vector<unsigned char>& GetPixels() const { return m_Pixels; }
+        
+        /**
+         * @brief Find a live texture by ID (headless mode only)
+         * 
+         * Lets the software rasterizer resolve the texture IDs stored in
+         * frame packets back to pixel data.
+         * 
+         * @param textureID Texture ID handed out in headless mode
+         * @return Texture, or nullptr if no live headless texture has that ID
+         */
+        static const Texture* FindHeadless(unsigned int textureID);
+        
         /**
          * @brief Bind texture to OpenGL texture unit
          * 
@@ -182,6 +201,7 @@ namespace GP2Engine {
         int m_Height{0};                     ///< Texture height
         int m_Channels{0};                   ///< Number of color channels
         std::string m_FilePath;             ///< Texture file path
+        std::vector<unsigned char> m_Pixels; ///< CPU pixels (headless mode only)
         
         /**
          * @brief Generate OpenGL texture from data
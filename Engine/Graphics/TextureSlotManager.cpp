@@ -0,0 +1,180 @@
+/**
+ * @file TextureSlotManager.cpp
+ * @brief Texture unit allocator implementation
+ * @author Asri (100%)
+ *
+ * This file contains the implementation of the TextureSlotManager class which
+ * keeps texture-to-unit assignments stable across batches and evicts the least
+ * recently used unit when a new texture needs one.
+ */
+
+#include "TextureSlotManager.hpp"
+#include <glad/glad.h>
+#include <algorithm>
+
+namespace GP2Engine {
+
+    TextureSlotManager::TextureSlotManager(int slotCount)
+        : m_SlotCount(slotCount)
+        , m_SlotTexture(static_cast<size_t>(slotCount), 0)
+        , m_BoundTexture(static_cast<size_t>(slotCount), 0)
+        , m_LastUse(static_cast<size_t>(slotCount), 0)
+        , m_BatchStamp(static_cast<size_t>(slotCount), 0) {
+        m_BatchSlots.reserve(static_cast<size_t>(slotCount));
+        m_SlotOfTexture.reserve(static_cast<size_t>(slotCount) * 2);
+    }
+
+    int TextureSlotManager::AcquireSlot(unsigned int textureID) {
+        // Texture 0 means "no texture": draw with the white texture
+        if (textureID == 0) {
+            return RESERVED_SLOT;
+        }
+
+        // Fast path: consecutive sprites usually share a texture
+        if (textureID == m_LastTexture && m_LastSlot > RESERVED_SLOT) {
+            Touch(m_LastSlot);
+            return m_LastSlot;
+        }
+
+        int slot = -1;
+        auto it = m_SlotOfTexture.find(textureID);
+        if (it != m_SlotOfTexture.end()) {
+            slot = it->second;
+        } else {
+            slot = FindVictimSlot();
+            if (slot < 0) {
+                return -1; // Every unit is needed by the current batch
+            }
+
+            // Evict the previous owner
+            unsigned int previous = m_SlotTexture[slot];
+            if (previous != 0) {
+                m_SlotOfTexture.erase(previous);
+                m_EvictionsThisFrame++;
+            }
+
+            m_SlotTexture[slot] = textureID;
+            m_SlotOfTexture[textureID] = slot;
+        }
+
+        Touch(slot);
+        m_LastTexture = textureID;
+        m_LastSlot = slot;
+        return slot;
+    }
+
+    void TextureSlotManager::Touch(int slot) {
+        m_LastUse[slot] = ++m_UseTick;
+        if (m_BatchStamp[slot] != m_BatchID) {
+            m_BatchStamp[slot] = m_BatchID;
+            m_BatchSlots.push_back(slot);
+        }
+    }
+
+    int TextureSlotManager::FindVictimSlot() const {
+        // Constant-size scan over at most MAX_TEXTURE_SLOTS units
+        int victim = -1;
+        uint64_t oldest = UINT64_MAX;
+        for (int slot = RESERVED_SLOT + 1; slot < m_SlotCount; ++slot) {
+            if (m_SlotTexture[slot] == 0) {
+                return slot; // Free unit
+            }
+            if (m_BatchStamp[slot] == m_BatchID) {
+                continue; // Pinned by the current batch
+            }
+            if (m_LastUse[slot] < oldest) {
+                oldest = m_LastUse[slot];
+                victim = slot;
+            }
+        }
+        return victim;
+    }
+
+    void TextureSlotManager::BindBatchTextures() {
+        bool changedActiveUnit = false;
+        for (int slot : m_BatchSlots) {
+            if (m_BoundTexture[slot] == m_SlotTexture[slot]) {
+                m_RedundantBindsSkippedThisFrame++;
+                continue;
+            }
+
+            glActiveTexture(GL_TEXTURE0 + static_cast<GLenum>(slot));
+            glBindTexture(GL_TEXTURE_2D, m_SlotTexture[slot]);
+            m_BoundTexture[slot] = m_SlotTexture[slot];
+            m_BindsThisFrame++;
+            changedActiveUnit = true;
+        }
+
+        // Other code binds on the active unit, so always hand back unit 0
+        if (changedActiveUnit) {
+            glActiveTexture(GL_TEXTURE0);
+        }
+    }
+
+    void TextureSlotManager::BindUnits(const TextureBinding* bindings, size_t count) {
+        bool changedActiveUnit = false;
+        for (size_t i = 0; i < count; ++i) {
+            const int slot = bindings[i].slot;
+            if (slot <= RESERVED_SLOT || slot >= m_SlotCount) {
+                continue;
+            }
+            if (m_BoundTexture[slot] == bindings[i].textureID) {
+                m_RedundantBindsSkippedThisFrame++;
+                continue;
+            }
+
+            glActiveTexture(GL_TEXTURE0 + static_cast<GLenum>(slot));
+            glBindTexture(GL_TEXTURE_2D, bindings[i].textureID);
+            m_BoundTexture[slot] = bindings[i].textureID;
+            m_BindsThisFrame++;
+            changedActiveUnit = true;
+        }
+
+        if (changedActiveUnit) {
+            glActiveTexture(GL_TEXTURE0);
+        }
+    }
+
+    void TextureSlotManager::CollectBatchBindings(std::vector<TextureBinding>& out) const {
+        for (int slot : m_BatchSlots) {
+            out.push_back({slot, m_SlotTexture[slot]});
+        }
+    }
+
+    void TextureSlotManager::BeginBatch() {
+        m_BatchSlots.clear();
+        m_BatchID++;
+        if (m_BatchID == 0) {
+            // Stamp wrapped: clear old stamps so nothing looks pinned
+            std::fill(m_BatchStamp.begin(), m_BatchStamp.end(), 0u);
+            m_BatchID = 1;
+        }
+    }
+
+    void TextureSlotManager::Invalidate(unsigned int textureID) {
+        // Deleting a texture unbinds it from every unit, including units
+        // bound through BindUnits that this manager did not assign
+        for (unsigned int& bound : m_BoundTexture) {
+            if (bound == textureID) {
+                bound = 0;
+            }
+        }
+
+        auto it = m_SlotOfTexture.find(textureID);
+        if (it == m_SlotOfTexture.end()) {
+            return;
+        }
+
+        int slot = it->second;
+        m_SlotTexture[slot] = 0;
+        m_BoundTexture[slot] = 0;
+        m_LastUse[slot] = 0;
+        m_SlotOfTexture.erase(it);
+
+        if (m_LastTexture == textureID) {
+            m_LastTexture = 0;
+            m_LastSlot = -1;
+        }
+    }
+
+} // namespace GP2Engine
@@ -0,0 +1,184 @@
+/**
+ * @file TextureSlotManager.hpp
+ * @brief Texture unit allocator for the batch renderer
+ * @author Asri (100%)
+ *
+ * This file contains the TextureSlotManager class which maps OpenGL texture
+ * IDs to texture units for the sprite batcher. Assignments persist across
+ * flushes and frames, so a texture that stays resident is never re-bound.
+ * When every unit is taken the least recently used one that is not needed
+ * by the current batch is evicted instead of flushing the batch.
+ */
+
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+
+namespace GP2Engine {
+
+    /**
+     * @brief One texture-to-unit assignment of a batch
+     */
+    struct TextureBinding {
+        int slot;                  ///< Texture unit
+        unsigned int textureID;    ///< OpenGL texture ID
+    };
+
+    /**
+     * @brief Maps texture IDs to persistent texture units with LRU reuse
+     *
+     * Unit 0 is reserved for the renderer's white texture (colored quads) and
+     * is shared with immediate-mode draws, so it is not managed here. Units
+     * 1..slotCount-1 are handed out by AcquireSlot.
+     *
+     * Typical use per batch:
+     * @code
+     * int slot = slots.AcquireSlot(textureID);
+     * if (slot < 0) { FlushBatch(); slot = slots.AcquireSlot(textureID); }
+     * // ... at flush time:
+     * slots.BindBatchTextures();
+     * slots.BeginBatch();
+     * @endcode
+     *
+     * @author Asri (100%)
+     */
+    class TextureSlotManager {
+    public:
+        static const int RESERVED_SLOT = 0;     ///< Unit used by the white texture
+
+        /**
+         * @brief Constructor
+         *
+         * @param slotCount Total number of texture units available to the batch shader
+         */
+        explicit TextureSlotManager(int slotCount);
+
+        /**
+         * @brief Get the unit for a texture, assigning or evicting if needed
+         *
+         * O(1) for resident textures. On a miss a free unit is used, otherwise
+         * the least recently used unit not referenced by the current batch.
+         *
+         * @param textureID OpenGL texture ID
+         * @return Texture unit (RESERVED_SLOT for texture 0), or -1 if every
+         *         unit is used by the current batch
+         */
+        int AcquireSlot(unsigned int textureID);
+
+        /**
+         * @brief Bind the units referenced by the current batch
+         *
+         * Only units whose bound texture changed are re-bound. Leaves
+         * GL_TEXTURE0 active.
+         */
+        void BindBatchTextures();
+
+        /**
+         * @brief Bind an explicit list of unit assignments
+         *
+         * Used for batches whose slots were assigned by another manager (e.g.
+         * on the render thread). Units already holding the texture are
+         * skipped, and the bound state stays consistent with this manager's
+         * own batches. Leaves GL_TEXTURE0 active.
+         *
+         * @param bindings Unit assignments to bind
+         * @param count Number of assignments
+         */
+        void BindUnits(const TextureBinding* bindings, size_t count);
+
+        /**
+         * @brief Append the unit assignments referenced by the current batch
+         *
+         * Does not touch OpenGL, so a manager used only for assignment can
+         * live on a thread without a GL context.
+         *
+         * @param out Destination list
+         */
+        void CollectBatchBindings(std::vector<TextureBinding>& out) const;
+
+        /**
+         * @brief Start a new batch (unpins all units)
+         */
+        void BeginBatch();
+
+        /**
+         * @brief Forget a texture, e.g. when it is deleted
+         *
+         * @param textureID OpenGL texture ID
+         */
+        void Invalidate(unsigned int textureID);
+
+        /**
+         * @brief Get number of glBindTexture calls issued this frame
+         *
+         * @return Bind count
+         */
+        int GetBindsThisFrame() const { return m_BindsThisFrame; }
+
+        /**
+         * @brief Get number of binds skipped because the unit already held the texture
+         *
+         * @return Skipped (redundant) bind count
+         */
+        int GetRedundantBindsSkippedThisFrame() const { return m_RedundantBindsSkippedThisFrame; }
+
+        /**
+         * @brief Get number of LRU evictions this frame
+         *
+         * @return Eviction count
+         */
+        int GetEvictionsThisFrame() const { return m_EvictionsThisFrame; }
+
+        /**
+         * @brief Get number of units currently holding a texture
+         *
+         * @return Resident texture count
+         */
+        int GetResidentCount() const { return static_cast<int>(m_SlotOfTexture.size()); }
+
+        /**
+         * @brief Reset per-frame counters
+         */
+        void ResetFrameCounters() const {
+            m_BindsThisFrame = 0;
+            m_RedundantBindsSkippedThisFrame = 0;
+            m_EvictionsThisFrame = 0;
+        }
+
+    private:
+        /**
+         * @brief Mark a unit as used by the current batch
+         *
+         * @param slot Texture unit
+         */
+        void Touch(int slot);
+
+        /**
+         * @brief Find a free unit or the LRU unit not pinned by the current batch
+         *
+         * @return Texture unit, or -1 if none available
+         */
+        int FindVictimSlot() const;
+
+        int m_SlotCount;                                          ///< Total units (including reserved)
+        std::unordered_map<unsigned int, int> m_SlotOfTexture;    ///< Texture ID -> unit
+        std::vector<unsigned int> m_SlotTexture;                  ///< Unit -> texture ID (0 = free)
+        std::vector<unsigned int> m_BoundTexture;                 ///< Unit -> texture bound in GL
+        std::vector<uint64_t> m_LastUse;                          ///< Unit -> last use tick
+        std::vector<uint32_t> m_BatchStamp;                       ///< Unit -> batch that last used it
+        std::vector<int> m_BatchSlots;                            ///< Units used by the current batch
+        uint64_t m_UseTick{0};                                    ///< Monotonic use counter
+        uint32_t m_BatchID{1};                                    ///< Current batch stamp
+
+        unsigned int m_LastTexture{0};                            ///< Most recent lookup (fast path)
+        int m_LastSlot{-1};                                       ///< Unit of m_LastTexture
+
+        mutable int m_BindsThisFrame{0};                          ///< glBindTexture calls this frame
+        mutable int m_RedundantBindsSkippedThisFrame{0};          ///< Binds avoided this frame
+        mutable int m_EvictionsThisFrame{0};                      ///< LRU evictions this frame
+    };
+
+} // namespace GP2Engine
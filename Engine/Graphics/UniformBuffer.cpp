@@ -0,0 +1,56 @@
+/**
+ * @file UniformBuffer.cpp
+ * @brief Uniform buffer implementation
+ * @author Asri (100%)
+ *
+ * This file contains the implementation of the UniformBuffer class.
+ */
+
+#include "UniformBuffer.hpp"
+#include <glad/glad.h>
+#include <iostream>
+
+namespace GP2Engine {
+
+    UniformBuffer::~UniformBuffer() {
+        Destroy();
+    }
+
+    bool UniformBuffer::Create(size_t size, unsigned int binding) {
+        Destroy();
+
+        glGenBuffers(1, &m_BufferID);
+        if (m_BufferID == 0) {
+            std::cerr << "ERROR: Failed to create uniform buffer" << std::endl;
+            return false;
+        }
+
+        glBindBuffer(GL_UNIFORM_BUFFER, m_BufferID);
+        glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        glBindBufferBase(GL_UNIFORM_BUFFER, binding, m_BufferID);
+
+        m_Binding = binding;
+        m_Size = size;
+        return true;
+    }
+
+    void UniformBuffer::Destroy() {
+        if (m_BufferID != 0) {
+            glDeleteBuffers(1, &m_BufferID);
+            m_BufferID = 0;
+            m_Size = 0;
+        }
+    }
+
+    void UniformBuffer::SetData(const void* data, size_t size, size_t offset) {
+        if (m_BufferID == 0 || offset + size > m_Size) {
+            return;
+        }
+
+        glBindBuffer(GL_UNIFORM_BUFFER, m_BufferID);
+        glBufferSubData(GL_UNIFORM_BUFFER, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+
+} // namespace GP2Engine
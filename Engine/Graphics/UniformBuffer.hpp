@@ -0,0 +1,74 @@
+/**
+ * @file UniformBuffer.hpp
+ * @brief OpenGL uniform buffer object wrapper
+ * @author Asri (100%)
+ *
+ * This file contains the UniformBuffer class which owns an OpenGL uniform
+ * buffer attached to a fixed binding point. Data written once is visible to
+ * every program whose uniform block is bound to the same point, so per-frame
+ * values such as the camera matrix are uploaded once instead of per program.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace GP2Engine {
+
+    /**
+     * @brief Uniform buffer bound to one binding point
+     *
+     * @author Asri (100%)
+     */
+    class UniformBuffer {
+    public:
+        UniformBuffer() = default;
+
+        /**
+         * @brief Destructor - releases the buffer
+         */
+        ~UniformBuffer();
+
+        UniformBuffer(const UniformBuffer&) = delete;
+        UniformBuffer& operator=(const UniformBuffer&) = delete;
+
+        /**
+         * @brief Create the buffer and attach it to a binding point
+         *
+         * @param size Buffer size in bytes (std140 layout)
+         * @param binding Uniform buffer binding point
+         * @return true if the buffer was created
+         */
+        bool Create(size_t size, unsigned int binding);
+
+        /**
+         * @brief Release the buffer (requires a current OpenGL context)
+         */
+        void Destroy();
+
+        /**
+         * @brief Write data into the buffer
+         *
+         * @param data Source data
+         * @param size Bytes to write
+         * @param offset Byte offset into the buffer
+         */
+        void SetData(const void* data, size_t size, size_t offset = 0);
+
+        /**
+         * @brief Check if the buffer exists
+         */
+        bool IsValid() const { return m_BufferID != 0; }
+
+        /**
+         * @brief Get binding point
+         */
+        unsigned int GetBinding() const { return m_Binding; }
+
+    private:
+        unsigned int m_BufferID{0};    ///< OpenGL buffer ID
+        unsigned int m_Binding{0};     ///< Binding point
+        size_t m_Size{0};              ///< Buffer size in bytes
+    };
+
+} // namespace GP2Engine
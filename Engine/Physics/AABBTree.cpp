@@ -0,0 +1,440 @@
+/**
+ * @file AABBTree.cpp
+ * @author Fauzan (100%)
+ * @brief Dynamic AABB tree implementation
+ */
+
+#include "AABBTree.hpp"
+#include "SpatialHash.hpp"
+#include <chrono>
+#include <iostream>
+#include <random>
+
+namespace GP2Engine {
+
+    DynamicAABBTree::DynamicAABBTree(float margin) : m_margin(margin >= 0.0f ? margin : DEFAULT_MARGIN) {
+    }
+
+    int DynamicAABBTree::CreateProxy(const AABB& bounds, uint32_t userData) {
+        const int proxyId = AllocateNode();
+        Node& node = m_nodes[proxyId];
+        node.box = Fatten(bounds, Vector2D(0.0f, 0.0f));
+        node.tight = bounds;
+        node.userData = userData;
+        node.height = 0;
+
+        InsertLeaf(proxyId);
+        ++m_proxyCount;
+        return proxyId;
+    }
+
+    void DynamicAABBTree::DestroyProxy(int proxyId) {
+        if (proxyId < 0 || proxyId >= static_cast<int>(m_nodes.size()) || m_nodes[proxyId].height != 0) return;
+
+        RemoveLeaf(proxyId);
+        FreeNode(proxyId);
+        --m_proxyCount;
+    }
+
+    bool DynamicAABBTree::MoveProxy(int proxyId, const AABB& bounds, const Vector2D& displacement) {
+        Node& node = m_nodes[proxyId];
+        node.tight = bounds;
+
+        const Bounds fat = Fatten(bounds, displacement);
+        if (node.box.Contains(Bounds::From(bounds))) {
+            // Still inside its fat box; keep it unless that box became much too large after a fast move
+            const float slack = 4.0f * m_margin;
+            const Bounds huge{ fat.minX - slack, fat.minY - slack, fat.maxX + slack, fat.maxY + slack };
+            if (huge.Contains(node.box)) return false;
+        }
+
+        RemoveLeaf(proxyId);
+        m_nodes[proxyId].box = fat;
+        InsertLeaf(proxyId);
+        return true;
+    }
+
+    void DynamicAABBTree::Clear() {
+        m_nodes.clear();
+        m_root = NULL_NODE;
+        m_freeList = NULL_NODE;
+        m_proxyCount = 0;
+    }
+
+    float DynamicAABBTree::GetAreaRatio() const {
+        if (m_root == NULL_NODE) return 0.0f;
+
+        const float rootPerimeter = m_nodes[m_root].box.Perimeter();
+        if (rootPerimeter <= 0.0f) return 0.0f;
+
+        float total = 0.0f;
+        for (const Node& node : m_nodes) {
+            if (node.height > 0) total += node.box.Perimeter();
+        }
+        return total / rootPerimeter;
+    }
+
+    bool DynamicAABBTree::Validate() const {
+        if (m_root == NULL_NODE) return m_proxyCount == 0;
+        if (m_nodes[m_root].parent != NULL_NODE) return false;
+
+        size_t leaves = 0;
+        std::vector<int> stack{ m_root };
+        while (!stack.empty()) {
+            const int index = stack.back();
+            stack.pop_back();
+            const Node& node = m_nodes[index];
+
+            if (node.IsLeaf()) {
+                if (node.height != 0 || !node.box.Contains(Bounds::From(node.tight))) return false;
+                ++leaves;
+                continue;
+            }
+
+            const Node& child1 = m_nodes[node.child1];
+            const Node& child2 = m_nodes[node.child2];
+            if (child1.parent != index || child2.parent != index) return false;
+            if (node.height != 1 + std::max(child1.height, child2.height)) return false;
+            if (!node.box.Contains(child1.box) || !node.box.Contains(child2.box)) return false;
+
+            stack.push_back(node.child1);
+            stack.push_back(node.child2);
+        }
+        return leaves == m_proxyCount;
+    }
+
+    int DynamicAABBTree::AllocateNode() {
+        if (m_freeList == NULL_NODE) {
+            m_nodes.emplace_back();
+            return static_cast<int>(m_nodes.size()) - 1;
+        }
+
+        const int index = m_freeList;
+        m_freeList = m_nodes[index].parent;
+        m_nodes[index] = Node();
+        return index;
+    }
+
+    void DynamicAABBTree::FreeNode(int node) {
+        m_nodes[node].parent = m_freeList;
+        m_nodes[node].child1 = NULL_NODE;
+        m_nodes[node].child2 = NULL_NODE;
+        m_nodes[node].height = -1;
+        m_freeList = node;
+    }
+
+    void DynamicAABBTree::InsertLeaf(int leaf) {
+        if (m_root == NULL_NODE) {
+            m_root = leaf;
+            m_nodes[leaf].parent = NULL_NODE;
+            return;
+        }
+
+        // Descend towards the sibling that minimizes the added perimeter
+        const Bounds leafBox = m_nodes[leaf].box;
+        int index = m_root;
+        while (!m_nodes[index].IsLeaf()) {
+            const Node& node = m_nodes[index];
+            const float area = node.box.Perimeter();
+            const float combinedArea = Bounds::Combine(node.box, leafBox).Perimeter();
+
+            // Cost of making a new parent for this node and the leaf
+            const float cost = 2.0f * combinedArea;
+            // Minimum cost of pushing the leaf further down
+            const float inheritanceCost = 2.0f * (combinedArea - area);
+
+            auto descendCost = [&](int child) {
+                const Node& childNode = m_nodes[child];
+                const float combined = Bounds::Combine(leafBox, childNode.box).Perimeter();
+                return (childNode.IsLeaf() ? combined : combined - childNode.box.Perimeter()) + inheritanceCost;
+            };
+            const float cost1 = descendCost(node.child1);
+            const float cost2 = descendCost(node.child2);
+
+            if (cost < cost1 && cost < cost2) break;
+            index = cost1 < cost2 ? node.child1 : node.child2;
+        }
+
+        // Replace the sibling with a new parent of the sibling and the leaf
+        const int sibling = index;
+        const int oldParent = m_nodes[sibling].parent;
+        const int newParent = AllocateNode();
+        Node& parent = m_nodes[newParent];
+        parent.parent = oldParent;
+        parent.box = Bounds::Combine(leafBox, m_nodes[sibling].box);
+        parent.height = m_nodes[sibling].height + 1;
+        parent.child1 = sibling;
+        parent.child2 = leaf;
+        m_nodes[sibling].parent = newParent;
+        m_nodes[leaf].parent = newParent;
+
+        if (oldParent == NULL_NODE) {
+            m_root = newParent;
+        }
+        else if (m_nodes[oldParent].child1 == sibling) {
+            m_nodes[oldParent].child1 = newParent;
+        }
+        else {
+            m_nodes[oldParent].child2 = newParent;
+        }
+
+        Refit(m_nodes[leaf].parent);
+    }
+
+    void DynamicAABBTree::RemoveLeaf(int leaf) {
+        if (leaf == m_root) {
+            m_root = NULL_NODE;
+            return;
+        }
+
+        const int parent = m_nodes[leaf].parent;
+        const int grandParent = m_nodes[parent].parent;
+        const int sibling = m_nodes[parent].child1 == leaf ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+        if (grandParent == NULL_NODE) {
+            m_root = sibling;
+            m_nodes[sibling].parent = NULL_NODE;
+            FreeNode(parent);
+            return;
+        }
+
+        // The sibling takes the parent's place
+        if (m_nodes[grandParent].child1 == parent) {
+            m_nodes[grandParent].child1 = sibling;
+        }
+        else {
+            m_nodes[grandParent].child2 = sibling;
+        }
+        m_nodes[sibling].parent = grandParent;
+        FreeNode(parent);
+
+        Refit(grandParent);
+    }
+
+    void DynamicAABBTree::Refit(int index) {
+        while (index != NULL_NODE) {
+            Rotate(index);
+
+            Node& node = m_nodes[index];
+            node.box = Bounds::Combine(m_nodes[node.child1].box, m_nodes[node.child2].box);
+            node.height = 1 + std::max(m_nodes[node.child1].height, m_nodes[node.child2].height);
+            index = node.parent;
+        }
+    }
+
+    void DynamicAABBTree::Rotate(int indexA) {
+        // A has children B and C; B has children D and E, C has F and G.
+        // Swapping a child of A with a grandchild on the other side only
+        // changes the box of B or C; keep the swap that shrinks it most.
+        Node& a = m_nodes[indexA];
+        const int indexB = a.child1;
+        const int indexC = a.child2;
+        Node& b = m_nodes[indexB];
+        Node& c = m_nodes[indexC];
+        if (b.IsLeaf() && c.IsLeaf()) return;
+
+        enum class Swap { None, BF, BG, CD, CE } best = Swap::None;
+        float bestGain = 0.0f;
+
+        if (!c.IsLeaf()) {
+            const float areaC = c.box.Perimeter();
+            const float gainBF = areaC - Bounds::Combine(b.box, m_nodes[c.child2].box).Perimeter();
+            const float gainBG = areaC - Bounds::Combine(b.box, m_nodes[c.child1].box).Perimeter();
+            if (gainBF > bestGain) { bestGain = gainBF; best = Swap::BF; }
+            if (gainBG > bestGain) { bestGain = gainBG; best = Swap::BG; }
+        }
+        if (!b.IsLeaf()) {
+            const float areaB = b.box.Perimeter();
+            const float gainCD = areaB - Bounds::Combine(c.box, m_nodes[b.child2].box).Perimeter();
+            const float gainCE = areaB - Bounds::Combine(c.box, m_nodes[b.child1].box).Perimeter();
+            if (gainCD > bestGain) { bestGain = gainCD; best = Swap::CD; }
+            if (gainCE > bestGain) { bestGain = gainCE; best = Swap::CE; }
+        }
+
+        // Swap child of A with grandchild slot (inner = B or C receives the child of A)
+        auto swapDown = [&](int outerChild, int& outerSlot, Node& inner, int innerIndex, int& innerSlot) {
+            const int grandChild = innerSlot;
+            outerSlot = grandChild;
+            m_nodes[grandChild].parent = indexA;
+            innerSlot = outerChild;
+            m_nodes[outerChild].parent = innerIndex;
+            inner.box = Bounds::Combine(m_nodes[inner.child1].box, m_nodes[inner.child2].box);
+            inner.height = 1 + std::max(m_nodes[inner.child1].height, m_nodes[inner.child2].height);
+        };
+
+        switch (best) {
+            case Swap::BF: swapDown(indexB, a.child1, c, indexC, c.child1); break;
+            case Swap::BG: swapDown(indexB, a.child1, c, indexC, c.child2); break;
+            case Swap::CD: swapDown(indexC, a.child2, b, indexB, b.child1); break;
+            case Swap::CE: swapDown(indexC, a.child2, b, indexB, b.child2); break;
+            case Swap::None: break;
+        }
+    }
+
+    DynamicAABBTree::Bounds DynamicAABBTree::Fatten(const AABB& bounds, const Vector2D& displacement) const {
+        Bounds fat = Bounds::From(bounds);
+        fat.minX -= m_margin;
+        fat.minY -= m_margin;
+        fat.maxX += m_margin;
+        fat.maxY += m_margin;
+
+        // Predict the next move so steadily moving proxies are reinserted less often
+        const float dx = DISPLACEMENT_MULTIPLIER * displacement.x;
+        const float dy = DISPLACEMENT_MULTIPLIER * displacement.y;
+        if (dx < 0.0f) fat.minX += dx; else fat.maxX += dx;
+        if (dy < 0.0f) fat.minY += dy; else fat.maxY += dy;
+        return fat;
+    }
+
+    bool DynamicAABBTree::SegmentHitsBox(const Vector2D& from, const Vector2D& delta, const Bounds& box,
+                                         float maxFraction, float& hitFraction) {
+        float tMin = 0.0f;
+        float tMax = maxFraction;
+
+        const float origin[2] = { from.x, from.y };
+        const float direction[2] = { delta.x, delta.y };
+        const float boxMin[2] = { box.minX, box.minY };
+        const float boxMax[2] = { box.maxX, box.maxY };
+
+        for (int axis = 0; axis < 2; ++axis) {
+            if (std::fabs(direction[axis]) < 1e-8f) {
+                // Parallel to this slab: must already be inside it
+                if (origin[axis] < boxMin[axis] || origin[axis] > boxMax[axis]) return false;
+                continue;
+            }
+
+            const float inverse = 1.0f / direction[axis];
+            float t1 = (boxMin[axis] - origin[axis]) * inverse;
+            float t2 = (boxMax[axis] - origin[axis]) * inverse;
+            if (t1 > t2) std::swap(t1, t2);
+            tMin = std::max(tMin, t1);
+            tMax = std::min(tMax, t2);
+            if (tMin > tMax) return false;
+        }
+
+        hitFraction = tMin;
+        return true;
+    }
+
+    DynamicAABBTree::BenchmarkResult DynamicAABBTree::RunBenchmark(int layout, size_t proxyCount, int queries) {
+        using Clock = std::chrono::high_resolution_clock;
+        auto elapsedMs = [](Clock::time_point start) {
+            return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        };
+
+        BenchmarkResult result;
+        result.proxies = proxyCount;
+        queries = std::max(queries, 1);
+
+        // Scene layout: box size mix and average area per box
+        std::mt19937 rng(4242);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        float areaPerBox = 0.0f;
+        switch (layout) {
+            case 0: result.layout = "sparse 32px"; areaPerBox = 256.0f * 256.0f; break;
+            case 1: result.layout = "dense 64px tiles"; areaPerBox = 72.0f * 72.0f; break;
+            default: result.layout = "mixed 8px-2048px"; areaPerBox = 160.0f * 160.0f; break;
+        }
+        const float worldSize = std::sqrt(static_cast<float>(proxyCount) * areaPerBox);
+
+        auto randomSize = [&]() {
+            if (layout == 0) return 32.0f;
+            if (layout == 1) return 64.0f;
+            const float roll = unit(rng);
+            if (roll < 0.01f) return 2048.0f;        // Background quads
+            if (roll < 0.30f) return 64.0f;          // Tiles
+            return 8.0f + 8.0f * unit(rng);          // Pickups
+        };
+
+        std::vector<AABB> boxes(proxyCount);
+        for (AABB& box : boxes) {
+            const float size = randomSize();
+            box = AABB(unit(rng) * worldSize, unit(rng) * worldSize, size, size);
+        }
+
+        std::vector<AABB> queryBoxes(static_cast<size_t>(queries));
+        for (AABB& box : queryBoxes) {
+            box = AABB(unit(rng) * worldSize, unit(rng) * worldSize, 32.0f, 32.0f);
+        }
+
+        // Brute force
+        auto start = Clock::now();
+        size_t bruteForcePairs = 0;
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            for (size_t j = i + 1; j < boxes.size(); ++j) {
+                if (boxes[i].Intersects(boxes[j])) ++bruteForcePairs;
+            }
+        }
+        result.bruteForcePairsMs = elapsedMs(start);
+
+        size_t bruteForceHits = 0;
+        start = Clock::now();
+        for (const AABB& query : queryBoxes) {
+            for (const AABB& box : boxes) {
+                if (box.Intersects(query)) ++bruteForceHits;
+            }
+        }
+        result.bruteForceQueryUs = elapsedMs(start) * 1000.0 / queries;
+
+        // Tree
+        DynamicAABBTree tree;
+        std::vector<int> proxies(boxes.size());
+        start = Clock::now();
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            proxies[i] = tree.CreateProxy(boxes[i], static_cast<uint32_t>(i));
+        }
+        result.buildMs = elapsedMs(start);
+
+        start = Clock::now();
+        tree.QueryPairs([&result](int, int) { ++result.pairs; });
+        result.treePairsMs = elapsedMs(start);
+
+        size_t treeHits = 0;
+        start = Clock::now();
+        for (const AABB& query : queryBoxes) {
+            tree.Query(query, [&treeHits](int) { ++treeHits; return false; });
+        }
+        result.treeQueryUs = elapsedMs(start) * 1000.0 / queries;
+
+        start = Clock::now();
+        for (const AABB& query : queryBoxes) {
+            const Vector2D from(query.x, query.y);
+            const Vector2D to(query.x + 512.0f, query.y + 256.0f);
+            tree.RayCast(from, to, [](int, float fraction) { return fraction; });
+        }
+        result.rayCastUs = elapsedMs(start) * 1000.0 / queries;
+
+        // Uniform grid on the same scene
+        SpatialHash hash;
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            hash.Insert(static_cast<uint32_t>(i), boxes[i]);
+        }
+        size_t hashHits = 0;
+        start = Clock::now();
+        for (const AABB& query : queryBoxes) {
+            hash.Query(query, [&hashHits](uint32_t, const AABB&) { ++hashHits; return false; });
+        }
+        result.hashQueryUs = elapsedMs(start) * 1000.0 / queries;
+
+        // One frame of small moves
+        std::uniform_real_distribution<float> jitter(-3.0f, 3.0f);
+        start = Clock::now();
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            const Vector2D displacement(jitter(rng), jitter(rng));
+            boxes[i].x += displacement.x;
+            boxes[i].y += displacement.y;
+            tree.MoveProxy(proxies[i], boxes[i], displacement);
+        }
+        result.moveMs = elapsedMs(start);
+        result.height = tree.GetHeight();
+        result.areaRatio = tree.GetAreaRatio();
+
+        if (bruteForcePairs != result.pairs || bruteForceHits != treeHits || bruteForceHits != hashHits) {
+            std::cerr << "DynamicAABBTree: Benchmark results differ from brute force ("
+                      << result.pairs << "/" << bruteForcePairs << " pairs, "
+                      << treeHits << "/" << hashHits << "/" << bruteForceHits << " query hits)" << std::endl;
+        }
+        return result;
+    }
+
+} // namespace GP2Engine
@@ -0,0 +1,241 @@
+/**
+ * @file AABBTree.hpp
+ * @author Fauzan (100%)
+ * @brief Dynamic AABB tree broadphase for mixed-size bodies
+ *
+ * Bounding volume hierarchy over "fat" AABBs (the tight box grown by a margin
+ * and the last displacement), so a moving proxy is only reinserted once it
+ * leaves its fat box. Inserts pick the sibling with the lowest perimeter
+ * (2D surface area heuristic) cost and every refit on the way back up tries
+ * child/grandchild rotations that shrink the tree's total perimeter.
+ *
+ * Unlike the uniform SpatialHash the cost does not depend on object sizes,
+ * which suits worlds mixing small pickups, 64px tiles and 2048px quads.
+ */
+
+#pragma once
+
+#include "PhysicsSystem.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GP2Engine {
+
+    // ============================================================================
+    // DYNAMIC AABB TREE
+    // ============================================================================
+
+    class DynamicAABBTree {
+    public:
+        static constexpr int NULL_NODE = -1;
+        static constexpr float DEFAULT_MARGIN = 8.0f;               // Fat AABB growth in world units
+        static constexpr float DISPLACEMENT_MULTIPLIER = 2.0f;      // Fat AABB growth along the last move
+
+        struct BenchmarkResult {
+            const char* layout = "";         // Scene description
+            size_t proxies = 0;              // Boxes in the scene
+            size_t pairs = 0;                // Overlapping pairs (same for both methods)
+            double bruteForcePairsMs = 0.0;  // All-pairs test
+            double treePairsMs = 0.0;        // QueryPairs
+            double bruteForceQueryUs = 0.0;  // Scan every box per query
+            double treeQueryUs = 0.0;        // Tree query
+            double hashQueryUs = 0.0;        // SpatialHash query (default cell size)
+            double buildMs = 0.0;            // Insert every box
+            double moveMs = 0.0;             // MoveProxy every box by a few units
+            double rayCastUs = 0.0;          // Closest-hit ray cast
+            int height = 0;                  // Tree height after the moves
+            float areaRatio = 0.0f;          // Perimeter of internal nodes / root perimeter
+        };
+
+        explicit DynamicAABBTree(float margin = DEFAULT_MARGIN);
+
+        // Add a box; returns the proxy ID used by the other calls
+        int CreateProxy(const AABB& bounds, uint32_t userData);
+        void DestroyProxy(int proxyId);
+
+        // Update a proxy's box; reinserts (and returns true) only if it left its fat box
+        bool MoveProxy(int proxyId, const AABB& bounds, const Vector2D& displacement);
+
+        void Clear();
+
+        uint32_t GetUserData(int proxyId) const { return m_nodes[proxyId].userData; }
+        const AABB& GetBounds(int proxyId) const { return m_nodes[proxyId].tight; }
+        AABB GetFatAABB(int proxyId) const { return m_nodes[proxyId].box.ToAABB(); }
+        size_t GetProxyCount() const { return m_proxyCount; }
+        int GetHeight() const { return m_root == NULL_NODE ? 0 : m_nodes[m_root].height; }
+
+        // Sum of internal node perimeters over the root perimeter (lower = better tree)
+        float GetAreaRatio() const;
+
+        // Check parent links, heights and enclosing boxes (debugging)
+        bool Validate() const;
+
+        /**
+         * Visit every proxy whose box intersects the query box (AABB::Intersects).
+         * Called as fn(proxyId); return true to stop the query.
+         */
+        template <typename Fn>
+        void Query(const AABB& box, Fn&& fn) const {
+            const Bounds bounds = Bounds::From(box);
+            Traverse([&](const Node& node) { return node.box.Overlaps(bounds); },
+                     [&](int proxyId) { return m_nodes[proxyId].tight.Intersects(box) && fn(proxyId); });
+        }
+
+        /**
+         * Visit every proxy whose box contains the point (edges included, like AABB::Contains).
+         * Called as fn(proxyId); return true to stop the query.
+         */
+        template <typename Fn>
+        void QueryPoint(const Vector2D& point, Fn&& fn) const {
+            const Bounds bounds{ point.x, point.y, point.x, point.y };
+            Traverse([&](const Node& node) { return node.box.Overlaps(bounds); },
+                     [&](int proxyId) { return Bounds::From(m_nodes[proxyId].tight).Overlaps(bounds) && fn(proxyId); });
+        }
+
+        /**
+         * Cast the segment from -> to against the proxies' boxes.
+         * Called as fn(proxyId, fraction) for each hit, fraction in [0, 1] along
+         * the segment. The return value clips the segment: return fraction to
+         * keep looking for closer hits, 1 (or the current limit) to collect
+         * every hit, 0 to stop.
+         */
+        template <typename Fn>
+        void RayCast(const Vector2D& from, const Vector2D& to, Fn&& fn) const {
+            float maxFraction = 1.0f;
+            const Vector2D delta(to.x - from.x, to.y - from.y);
+            float fraction = 0.0f;
+            Traverse([&](const Node& node) { return SegmentHitsBox(from, delta, node.box, maxFraction, fraction); },
+                     [&](int proxyId) {
+                         if (!SegmentHitsBox(from, delta, Bounds::From(m_nodes[proxyId].tight), maxFraction, fraction)) return false;
+                         const float clip = fn(proxyId, fraction);
+                         if (clip <= 0.0f) return true;
+                         maxFraction = clip < maxFraction ? clip : maxFraction;
+                         return false;
+                     });
+        }
+
+        /**
+         * Report every pair of proxies whose boxes intersect, each pair once.
+         * Called as fn(proxyA, proxyB).
+         */
+        template <typename Fn>
+        void QueryPairs(Fn&& fn) const {
+            for (int proxyA = 0; proxyA < static_cast<int>(m_nodes.size()); ++proxyA) {
+                if (m_nodes[proxyA].height != 0) continue;   // Internal or free node
+                Query(m_nodes[proxyA].tight, [&](int proxyB) {
+                    if (proxyB > proxyA) fn(proxyA, proxyB);
+                    return false;
+                });
+            }
+        }
+
+        /**
+         * Compare brute force, the tree and the SpatialHash on one scene layout.
+         *
+         * layout 0: sparse small boxes, 1: dense tiles, 2: mixed pickups,
+         * tiles and 2048px background quads.
+         */
+        static BenchmarkResult RunBenchmark(int layout, size_t proxyCount, int queries);
+
+    private:
+        // Min/max box; combining these is exact, unlike x/y/width/height
+        struct Bounds {
+            float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
+
+            // Handles negative sizes (mirrored sprites)
+            static Bounds From(const AABB& box) {
+                return { std::min(box.x, box.x + box.width), std::min(box.y, box.y + box.height),
+                         std::max(box.x, box.x + box.width), std::max(box.y, box.y + box.height) };
+            }
+            AABB ToAABB() const { return AABB(minX, minY, maxX - minX, maxY - minY); }
+
+            // Shared edges count as overlapping
+            bool Overlaps(const Bounds& other) const {
+                return minX <= other.maxX && other.minX <= maxX && minY <= other.maxY && other.minY <= maxY;
+            }
+            bool Contains(const Bounds& other) const {
+                return other.minX >= minX && other.minY >= minY && other.maxX <= maxX && other.maxY <= maxY;
+            }
+            float Perimeter() const { return 2.0f * ((maxX - minX) + (maxY - minY)); }
+            static Bounds Combine(const Bounds& a, const Bounds& b) {
+                return { std::min(a.minX, b.minX), std::min(a.minY, b.minY), std::max(a.maxX, b.maxX), std::max(a.maxY, b.maxY) };
+            }
+        };
+
+        struct Node {
+            Bounds box;                    // Fat box (leaves) or union of the children
+            AABB tight;                    // Box passed by the user (leaves only)
+            uint32_t userData = 0;
+            int parent = NULL_NODE;        // Next free node while on the free list
+            int child1 = NULL_NODE;
+            int child2 = NULL_NODE;
+            int height = -1;               // 0 = leaf, -1 = free
+
+            bool IsLeaf() const { return child1 == NULL_NODE; }
+        };
+
+        // Small inline stack so traversal does not allocate for sane tree heights
+        class NodeStack {
+        public:
+            void Push(int node) {
+                if (m_count < INLINE_CAPACITY) m_inline[m_count] = node;
+                else m_overflow.push_back(node);
+                ++m_count;
+            }
+            int Pop() {
+                --m_count;
+                if (m_count < INLINE_CAPACITY) return m_inline[m_count];
+                const int node = m_overflow.back();
+                m_overflow.pop_back();
+                return node;
+            }
+            bool Empty() const { return m_count == 0; }
+
+        private:
+            static constexpr size_t INLINE_CAPACITY = 128;
+            int m_inline[INLINE_CAPACITY];
+            size_t m_count = 0;
+            std::vector<int> m_overflow;
+        };
+
+        std::vector<Node> m_nodes;
+        int m_root = NULL_NODE;
+        int m_freeList = NULL_NODE;
+        size_t m_proxyCount = 0;
+        float m_margin;
+
+        int AllocateNode();
+        void FreeNode(int node);
+        void InsertLeaf(int leaf);
+        void RemoveLeaf(int leaf);
+        void Refit(int node);
+        void Rotate(int node);
+        Bounds Fatten(const AABB& bounds, const Vector2D& displacement) const;
+
+        // Depth-first walk: descend into nodes accepted by enter, call leaf(proxyId) on accepted leaves (true = stop)
+        template <typename EnterFn, typename LeafFn>
+        void Traverse(EnterFn&& enter, LeafFn&& leaf) const {
+            if (m_root == NULL_NODE) return;
+            NodeStack stack;
+            stack.Push(m_root);
+            while (!stack.Empty()) {
+                const int index = stack.Pop();
+                const Node& node = m_nodes[index];
+                if (!enter(node)) continue;
+                if (node.IsLeaf()) {
+                    if (leaf(index)) return;
+                }
+                else {
+                    stack.Push(node.child1);
+                    stack.Push(node.child2);
+                }
+            }
+        }
+
+        // Slab test of the segment from + t * delta, t in [0, maxFraction]; entry fraction in hitFraction
+        static bool SegmentHitsBox(const Vector2D& from, const Vector2D& delta, const Bounds& box,
+                                   float maxFraction, float& hitFraction);
+    };
+
+} // namespace GP2Engine
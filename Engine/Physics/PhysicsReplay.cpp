@@ -0,0 +1,548 @@
+/**
+ * @file PhysicsReplay.cpp
+ * @author Fauzan (100%)
+ * @brief Recording and headless replay of PhysicsWorld sessions
+ */
+
+#include "PhysicsReplay.hpp"
+#include "PhysicsWorld.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+namespace GP2Engine {
+
+    namespace {
+        using Clock = std::chrono::high_resolution_clock;
+
+        double MillisecondsSince(Clock::time_point start) {
+            return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        }
+
+        constexpr uint32_t FILE_MAGIC = 0x52505047u;   // "GPPR" as little-endian bytes
+        constexpr uint32_t FILE_VERSION = 2;
+
+        // Record tags
+        constexpr uint8_t RECORD_KEYFRAME = 'K';
+        constexpr uint8_t RECORD_SETTINGS = 'P';
+        constexpr uint8_t RECORD_TILES = 'T';
+        constexpr uint8_t RECORD_STEP = 'S';
+
+        // What an input sets on its body
+        constexpr uint8_t INPUT_POSITION = 1;
+        constexpr uint8_t INPUT_VELOCITY = 2;
+        constexpr uint8_t INPUT_FORCE = 4;
+
+        // Fixed record sizes (bytes after the tag), so records can be skipped without decoding
+        constexpr size_t BODY_BYTES = 4 + 1 + 1 + 1 + 8 + 8 + 8 + 8 + 5 * 4 + 4 + 4;
+        constexpr size_t IMPULSE_BYTES = 4 + 4 + 8 + 4 + 4;
+        constexpr size_t SETTINGS_BYTES = 8 + 4 + 4 + 4 * 4 + 4 + 4 + 4 + 1 + 1 + 4 + 4;
+        constexpr size_t RECT_BYTES = 4 * 4;
+
+        template <typename T>
+        void Put(std::vector<uint8_t>& out, T value) {
+            uint8_t bytes[sizeof(T)];
+            std::memcpy(bytes, &value, sizeof(T));
+            out.insert(out.end(), bytes, bytes + sizeof(T));
+        }
+
+        void PutVector(std::vector<uint8_t>& out, const Vector2D& value) {
+            Put(out, value.x);
+            Put(out, value.y);
+        }
+
+        // Bounds-checked cursor; ok turns false on the first read past the end
+        struct Reader {
+            const std::vector<uint8_t>& data;
+            size_t position = 0;
+            bool ok = true;
+
+            template <typename T>
+            T Get() {
+                T value{};
+                if (!ok || data.size() - position < sizeof(T)) {
+                    ok = false;
+                    return value;
+                }
+                std::memcpy(&value, data.data() + position, sizeof(T));
+                position += sizeof(T);
+                return value;
+            }
+
+            Vector2D GetVector() {
+                const float x = Get<float>();
+                const float y = Get<float>();
+                return Vector2D(x, y);
+            }
+
+            bool Skip(size_t bytes) {
+                if (!ok || data.size() - position < bytes) ok = false;
+                else position += bytes;
+                return ok;
+            }
+
+            bool AtEnd() const { return position >= data.size(); }
+        };
+
+        // Settings that change the simulation (solverThreads does not)
+        void PutSettings(std::vector<uint8_t>& out, const PhysicsWorld::Settings& settings) {
+            PutVector(out, settings.gravity);
+            Put<int32_t>(out, settings.substeps);
+            Put<int32_t>(out, settings.velocityIterations);
+            Put(out, settings.correctionPercent);
+            Put(out, settings.penetrationSlop);
+            Put(out, settings.restitutionThreshold);
+            Put(out, settings.maxSpeed);
+            Put<int32_t>(out, settings.ccdIterations);
+            Put(out, settings.ccdSkin);
+            Put<int32_t>(out, settings.colorThreshold);
+            Put<uint8_t>(out, settings.warmStarting ? 1 : 0);
+            Put<uint8_t>(out, settings.allowSleep ? 1 : 0);
+            Put(out, settings.sleepSpeed);
+            Put<int32_t>(out, settings.sleepSteps);
+        }
+
+        void GetSettings(Reader& reader, PhysicsWorld::Settings& settings) {
+            settings.gravity = reader.GetVector();
+            settings.substeps = reader.Get<int32_t>();
+            settings.velocityIterations = reader.Get<int32_t>();
+            settings.correctionPercent = reader.Get<float>();
+            settings.penetrationSlop = reader.Get<float>();
+            settings.restitutionThreshold = reader.Get<float>();
+            settings.maxSpeed = reader.Get<float>();
+            settings.ccdIterations = reader.Get<int32_t>();
+            settings.ccdSkin = reader.Get<float>();
+            settings.colorThreshold = reader.Get<int32_t>();
+            settings.warmStarting = reader.Get<uint8_t>() != 0;
+            settings.allowSleep = reader.Get<uint8_t>() != 0;
+            settings.sleepSpeed = reader.Get<float>();
+            settings.sleepSteps = reader.Get<int32_t>();
+        }
+
+        bool SameBits(const Vector2D& a, const Vector2D& b) {
+            return std::memcmp(&a.x, &b.x, sizeof(float)) == 0 && std::memcmp(&a.y, &b.y, sizeof(float)) == 0;
+        }
+
+        int InputVectors(uint8_t flags) {
+            return ((flags & INPUT_POSITION) ? 1 : 0) + ((flags & INPUT_VELOCITY) ? 1 : 0) + ((flags & INPUT_FORCE) ? 1 : 0);
+        }
+    }
+
+    // ============================================================================
+    // RECORDER
+    // ============================================================================
+
+    void PhysicsRecorder::Start(uint64_t seed) {
+        m_data.clear();
+        Put(m_data, FILE_MAGIC);
+        Put(m_data, FILE_VERSION);
+        Put(m_data, seed);
+
+        m_recording = true;
+        m_needKeyframe = true;
+        m_seed = seed;
+        m_steps = 0;
+        m_keyframes = 0;
+        m_inputs.clear();
+    }
+
+    void PhysicsRecorder::Stop() {
+        m_recording = false;
+    }
+
+    bool PhysicsRecorder::Save(const std::string& path) const {
+        if (m_data.empty()) {
+            std::cerr << "PhysicsRecorder: nothing recorded, " << path << " not written" << std::endl;
+            return false;
+        }
+
+        std::ofstream file(path, std::ios::binary);
+        if (!file.write(reinterpret_cast<const char*>(m_data.data()), static_cast<std::streamsize>(m_data.size()))) {
+            std::cerr << "PhysicsRecorder: failed to write " << path << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    void PhysicsRecorder::BeginStep(const PhysicsWorld& world, float deltaTime) {
+        if (!m_recording) return;
+
+        m_stepTime = deltaTime;
+        m_inputs.clear();
+
+        const size_t count = world.m_position.size();
+        if (m_needKeyframe || world.m_rebuildCount != m_lastRebuild || count != m_lastPosition.size()) {
+            WriteKeyframe(world);
+            return;
+        }
+
+        std::vector<uint8_t> settings;
+        PutSettings(settings, world.m_settings);
+        if (settings != m_lastSettings) {
+            Put(m_data, RECORD_SETTINGS);
+            m_data.insert(m_data.end(), settings.begin(), settings.end());
+            m_lastSettings = std::move(settings);
+        }
+
+        if (world.m_tiles != m_lastTiles || (world.m_tiles && world.m_tiles->GetVersion() != m_lastTileVersion)) {
+            WriteTiles(world.m_tiles);
+        }
+
+        // Everything gameplay changed since the last step
+        for (uint32_t i = 0; i < count; ++i) {
+            Input input{ i, 0, world.m_position[i], world.m_velocity[i], world.m_force[i] };
+            if (!SameBits(input.position, m_lastPosition[i])) input.flags |= INPUT_POSITION;
+            if (!SameBits(input.velocity, m_lastVelocity[i])) input.flags |= INPUT_VELOCITY;
+            if (input.force.x != 0.0f || input.force.y != 0.0f) input.flags |= INPUT_FORCE;
+            if (input.flags) m_inputs.push_back(input);
+        }
+    }
+
+    void PhysicsRecorder::EndStep(const PhysicsWorld& world, double stepMs) {
+        if (!m_recording) return;
+
+        Put(m_data, RECORD_STEP);
+        Put(m_data, m_stepTime);
+        Put(m_data, static_cast<uint32_t>(m_inputs.size()));
+        for (const Input& input : m_inputs) {
+            Put(m_data, input.body);
+            Put(m_data, input.flags);
+            if (input.flags & INPUT_POSITION) PutVector(m_data, input.position);
+            if (input.flags & INPUT_VELOCITY) PutVector(m_data, input.velocity);
+            if (input.flags & INPUT_FORCE) PutVector(m_data, input.force);
+        }
+        Put(m_data, world.m_stats.stateHash);
+        Put(m_data, static_cast<float>(stepMs));
+
+        m_lastPosition = world.m_position;
+        m_lastVelocity = world.m_velocity;
+        ++m_steps;
+    }
+
+    void PhysicsRecorder::WriteKeyframe(const PhysicsWorld& world) {
+        const size_t count = world.m_position.size();
+
+        Put(m_data, RECORD_KEYFRAME);
+        Put(m_data, static_cast<uint32_t>(count));
+        for (size_t i = 0; i < count; ++i) {
+            const PhysicsWorld::Shape& shape = world.m_shapes[world.m_shapeIndex[i]];
+            Put(m_data, static_cast<uint32_t>(world.m_entity[i]));
+            Put(m_data, static_cast<uint8_t>(world.m_type[i]));
+            Put(m_data, static_cast<uint8_t>((world.m_syncTransform[i] ? 1 : 0) | (world.m_continuous[i] ? 2 : 0) |
+                                             (world.m_awake[i] ? 4 : 0)));
+            Put(m_data, static_cast<uint8_t>(shape.type));
+            PutVector(m_data, shape.type == ColliderShape::Circle ? Vector2D(shape.radius, 0.0f) : shape.halfExtents);
+            PutVector(m_data, world.m_position[i]);
+            PutVector(m_data, world.m_velocity[i]);
+            PutVector(m_data, world.m_force[i]);
+            Put(m_data, world.m_inverseMass[i]);
+            Put(m_data, world.m_restitution[i]);
+            Put(m_data, world.m_friction[i]);
+            Put(m_data, world.m_damping[i]);
+            Put(m_data, world.m_gravityScale[i]);
+            Put(m_data, world.m_restSteps[i]);
+            Put(m_data, world.m_sleepNext[i]);
+        }
+
+        // Warm-start impulses are part of the state the next step starts from
+        for (const auto* cache : { &world.m_impulseCache, &world.m_tileImpulseCache }) {
+            Put(m_data, static_cast<uint32_t>(cache->size()));
+            for (const PhysicsWorld::CachedImpulse& impulse : *cache) {
+                Put(m_data, impulse.a);
+                Put(m_data, impulse.b);
+                PutVector(m_data, impulse.normal);
+                Put(m_data, impulse.normalImpulse);
+                Put(m_data, impulse.tangentImpulse);
+            }
+        }
+
+        // Settings and tiles follow every keyframe, so a replay can start at any keyframe
+        m_lastSettings.clear();
+        PutSettings(m_lastSettings, world.m_settings);
+        Put(m_data, RECORD_SETTINGS);
+        m_data.insert(m_data.end(), m_lastSettings.begin(), m_lastSettings.end());
+        WriteTiles(world.m_tiles);
+
+        m_needKeyframe = false;
+        m_lastRebuild = world.m_rebuildCount;
+        m_lastPosition = world.m_position;
+        m_lastVelocity = world.m_velocity;
+        ++m_keyframes;
+    }
+
+    void PhysicsRecorder::WriteTiles(const TileCollisionLayer* tiles) {
+        Put(m_data, RECORD_TILES);
+        Put<uint8_t>(m_data, tiles ? 1 : 0);
+        if (tiles) {
+            Put<int32_t>(m_data, tiles->GetCols());
+            Put<int32_t>(m_data, tiles->GetRows());
+            PutVector(m_data, tiles->GetTileSize());
+            PutVector(m_data, tiles->GetOrigin());
+            Put(m_data, static_cast<uint32_t>(tiles->GetRects().size()));
+            for (const TileCollisionLayer::Rect& rect : tiles->GetRects()) {
+                Put<int32_t>(m_data, rect.col);
+                Put<int32_t>(m_data, rect.row);
+                Put<int32_t>(m_data, rect.cols);
+                Put<int32_t>(m_data, rect.rows);
+            }
+        }
+
+        m_lastTiles = tiles;
+        m_lastTileVersion = tiles ? tiles->GetVersion() : 0;
+    }
+
+    // ============================================================================
+    // REPLAY
+    // ============================================================================
+
+    bool PhysicsReplay::Load(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            std::cerr << "PhysicsReplay: cannot open " << path << std::endl;
+            return false;
+        }
+        return Load(std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()));
+    }
+
+    bool PhysicsReplay::Load(std::vector<uint8_t> data) {
+        m_data.clear();
+        m_keyframes.clear();
+        m_stepCount = 0;
+        m_seed = 0;
+
+        Reader reader{ data };
+        const uint32_t magic = reader.Get<uint32_t>();
+        const uint32_t version = reader.Get<uint32_t>();
+        const uint64_t seed = reader.Get<uint64_t>();
+        if (!reader.ok || magic != FILE_MAGIC || version != FILE_VERSION) {
+            std::cerr << "PhysicsReplay: not a physics recording (or an unsupported version)" << std::endl;
+            return false;
+        }
+
+        // Index keyframes and count steps, skipping record bodies by size
+        std::vector<Keyframe> keyframes;
+        size_t steps = 0;
+        while (reader.ok && !reader.AtEnd()) {
+            const size_t offset = reader.position;
+            const uint8_t tag = reader.Get<uint8_t>();
+            if (tag == RECORD_KEYFRAME) {
+                keyframes.push_back({ steps, offset });
+                const uint32_t bodies = reader.Get<uint32_t>();
+                reader.Skip(static_cast<size_t>(bodies) * BODY_BYTES);
+                for (int cache = 0; cache < 2; ++cache) {
+                    reader.Skip(static_cast<size_t>(reader.Get<uint32_t>()) * IMPULSE_BYTES);
+                }
+            }
+            else if (tag == RECORD_SETTINGS) {
+                reader.Skip(SETTINGS_BYTES);
+            }
+            else if (tag == RECORD_TILES) {
+                if (reader.Get<uint8_t>()) {
+                    reader.Skip(4 + 4 + 8 + 8);
+                    reader.Skip(static_cast<size_t>(reader.Get<uint32_t>()) * RECT_BYTES);
+                }
+            }
+            else if (tag == RECORD_STEP) {
+                if (keyframes.empty()) reader.ok = false;
+                reader.Skip(4);
+                const uint32_t inputs = reader.Get<uint32_t>();
+                for (uint32_t i = 0; i < inputs && reader.ok; ++i) {
+                    reader.Skip(4);
+                    reader.Skip(static_cast<size_t>(InputVectors(reader.Get<uint8_t>())) * 8);
+                }
+                reader.Skip(8 + 4);
+                if (reader.ok) ++steps;
+            }
+            else {
+                reader.ok = false;
+            }
+        }
+
+        if (!reader.ok) {
+            std::cerr << "PhysicsReplay: recording is damaged after step " << steps << std::endl;
+            return false;
+        }
+
+        m_data = std::move(data);
+        m_seed = seed;
+        m_stepCount = steps;
+        m_keyframes = std::move(keyframes);
+        return true;
+    }
+
+    bool PhysicsReplay::Run(const Options& options, Result& result) const {
+        result = Result();
+        if (m_keyframes.empty()) {
+            std::cerr << "PhysicsReplay: nothing loaded" << std::endl;
+            return false;
+        }
+
+        // Start at the last keyframe at or before the first step asked for
+        auto keyframe = std::upper_bound(m_keyframes.begin(), m_keyframes.end(), options.firstStep,
+                                         [](size_t step, const Keyframe& k) { return step < k.step; });
+        if (keyframe != m_keyframes.begin()) --keyframe;
+
+        PhysicsWorld world;
+        TileCollisionLayer tiles;
+        Reader reader{ m_data, keyframe->offset };
+        size_t step = keyframe->step;
+        bool damaged = false;
+        bool keyframeTiles = false;     // Next tile record belongs to the keyframe just loaded
+
+        while (!reader.AtEnd() && step <= options.lastStep) {
+            const uint8_t tag = reader.Get<uint8_t>();
+
+            if (tag == RECORD_KEYFRAME) {
+                world.Clear();
+                const uint32_t bodies = reader.Get<uint32_t>();
+                for (uint32_t i = 0; i < bodies && reader.ok; ++i) {
+                    const EntityID entity = reader.Get<uint32_t>();
+                    PhysicsComponent desc(static_cast<BodyType>(reader.Get<uint8_t>()));
+                    const uint8_t flags = reader.Get<uint8_t>();
+                    desc.shape = static_cast<ColliderShape>(reader.Get<uint8_t>());
+                    const Vector2D shape = reader.GetVector();
+                    const Vector2D position = reader.GetVector();
+                    desc.velocity = reader.GetVector();
+                    const Vector2D force = reader.GetVector();
+                    const float inverseMass = reader.Get<float>();
+                    desc.restitution = reader.Get<float>();
+                    desc.friction = reader.Get<float>();
+                    desc.linearDamping = reader.Get<float>();
+                    desc.gravityScale = reader.Get<float>();
+                    const uint32_t restSteps = reader.Get<uint32_t>();
+                    const uint32_t sleepNext = reader.Get<uint32_t>();
+                    desc.syncTransform = (flags & 1) != 0;
+                    desc.continuous = (flags & 2) != 0;
+                    // Scaled sizes at scale 1 give back the exact shapes
+                    if (desc.shape == ColliderShape::Circle) desc.radius = shape.x;
+                    else desc.size = Vector2D(shape.x * 2.0f, shape.y * 2.0f);
+
+                    const uint32_t body = world.CreateBody(desc, position, Vector2D(1.0f, 1.0f), entity);
+                    world.m_inverseMass[body] = inverseMass;    // Raw, 1 / (1 / m) may not round-trip
+                    world.m_force[body] = force;
+                    world.m_restSteps[body] = restSteps;
+                    world.m_sleepNext[body] = sleepNext < bodies ? sleepNext : body;
+                    if (!(flags & 4) && desc.bodyType == BodyType::Dynamic) {
+                        world.m_awake[body] = 0;
+                        ++world.m_sleepingCount;
+                    }
+                }
+                keyframeTiles = true;
+
+                for (auto* cache : { &world.m_impulseCache, &world.m_tileImpulseCache }) {
+                    cache->resize(reader.Get<uint32_t>());
+                    for (PhysicsWorld::CachedImpulse& impulse : *cache) {
+                        impulse.a = reader.Get<uint32_t>();
+                        impulse.b = reader.Get<uint32_t>();
+                        impulse.normal = reader.GetVector();
+                        impulse.normalImpulse = reader.Get<float>();
+                        impulse.tangentImpulse = reader.Get<float>();
+                    }
+                }
+            }
+            else if (tag == RECORD_SETTINGS) {
+                GetSettings(reader, world.m_settings);
+                world.m_settings.solverThreads = options.solverThreads;
+            }
+            else if (tag == RECORD_TILES) {
+                if (reader.Get<uint8_t>()) {
+                    const int cols = reader.Get<int32_t>();
+                    const int rows = reader.Get<int32_t>();
+                    const Vector2D tileSize = reader.GetVector();
+                    const Vector2D origin = reader.GetVector();
+                    std::vector<TileCollisionLayer::Rect> rects(reader.Get<uint32_t>());
+                    for (TileCollisionLayer::Rect& rect : rects) {
+                        rect.col = reader.Get<int32_t>();
+                        rect.row = reader.Get<int32_t>();
+                        rect.cols = reader.Get<int32_t>();
+                        rect.rows = reader.Get<int32_t>();
+                    }
+                    tiles.Assign(cols, rows, rects, tileSize, origin);
+                    world.SetTileCollision(&tiles);
+                }
+                else {
+                    world.SetTileCollision(nullptr);
+                }
+
+                // The recorded world was already resting on these tiles; only later changes wake sleepers
+                if (keyframeTiles) {
+                    world.m_sleepTiles = world.GetTileCollision();
+                    world.m_sleepTileVersion = world.m_sleepTiles ? tiles.GetVersion() : 0;
+                    keyframeTiles = false;
+                }
+            }
+            else if (tag == RECORD_STEP) {
+                const float deltaTime = reader.Get<float>();
+                const uint32_t inputs = reader.Get<uint32_t>();
+                for (uint32_t i = 0; i < inputs && reader.ok; ++i) {
+                    const uint32_t body = reader.Get<uint32_t>();
+                    const uint8_t flags = reader.Get<uint8_t>();
+                    const Vector2D position = (flags & INPUT_POSITION) ? reader.GetVector() : Vector2D();
+                    const Vector2D velocity = (flags & INPUT_VELOCITY) ? reader.GetVector() : Vector2D();
+                    const Vector2D force = (flags & INPUT_FORCE) ? reader.GetVector() : Vector2D();
+                    if (body >= world.GetBodyCount()) {
+                        reader.ok = false;
+                        break;
+                    }
+
+                    if (flags & INPUT_POSITION) world.TeleportBody(body, position);
+                    if (flags & INPUT_VELOCITY) world.m_velocity[body] = velocity;
+                    if (flags & INPUT_FORCE) world.m_force[body] = force;
+                }
+                const uint64_t recordedHash = reader.Get<uint64_t>();
+                const float recordedMs = reader.Get<float>();
+                if (!reader.ok) break;
+
+                const auto start = Clock::now();
+                world.Simulate(deltaTime);
+                const double stepMs = MillisecondsSince(start);
+                ++result.stepsSimulated;
+
+                if (step >= options.firstStep) {
+                    result.stepMs.push_back(static_cast<float>(stepMs));
+                    result.recordedStepMs.push_back(recordedMs);
+                    result.replayMs += stepMs;
+                    result.recordedSeconds += deltaTime;
+                    if (stepMs > result.maxStepMs) {
+                        result.maxStepMs = stepMs;
+                        result.slowestStep = step;
+                    }
+                    if (recordedMs > result.recordedMaxStepMs) {
+                        result.recordedMaxStepMs = recordedMs;
+                        result.recordedSlowestStep = step;
+                    }
+                    ++result.steps;
+
+                    if (world.m_stats.stateHash != recordedHash) {
+                        if (result.mismatches++ == 0) result.firstMismatch = step;
+                        if (options.stopOnMismatch) {
+                            ++step;
+                            break;
+                        }
+                    }
+                }
+                ++step;
+            }
+            else {
+                reader.ok = false;
+            }
+
+            if (!reader.ok) {
+                damaged = true;
+                break;
+            }
+        }
+
+        if (damaged) {
+            std::cerr << "PhysicsReplay: recording is damaged at step " << step << std::endl;
+            return false;
+        }
+
+        result.speedup = result.replayMs > 0.0 ? result.recordedSeconds * 1000.0 / result.replayMs : 0.0;
+        return true;
+    }
+
+} // namespace GP2Engine
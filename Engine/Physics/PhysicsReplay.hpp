@@ -0,0 +1,148 @@
+/**
+ * @file PhysicsReplay.hpp
+ * @author Fauzan (100%)
+ * @brief Recording and headless replay of PhysicsWorld sessions
+ *
+ * PhysicsWorld steps are deterministic: the same bodies, settings, tile
+ * layer and per-step inputs always give bit-identical states, whatever the
+ * solver thread count. A PhysicsRecorder attached to the world stores
+ * exactly those inputs in a compact binary stream:
+ *
+ * - a keyframe (every body's raw state plus the warm-start impulses) when
+ *   recording starts and whenever the world rebuilds its bodies
+ * - the settings and tile layer after each keyframe and whenever they change
+ * - per step: the step time, the bodies gameplay moved, set a velocity on or
+ *   pushed with a force since the last step, the resulting state hash and
+ *   the time the step took
+ *
+ * PhysicsReplay re-simulates a recording without a registry or window,
+ * checks every step's hash against the recorded one and times each step,
+ * so a behaviour change or a step-cost spike can be bisected offline.
+ *
+ * Files use the native byte order (they are meant for the machine and build
+ * that made them).
+ */
+
+#pragma once
+
+#include "TileCollision.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GP2Engine {
+
+    class PhysicsWorld;
+
+    // ============================================================================
+    // RECORDER
+    // ============================================================================
+
+    class PhysicsRecorder {
+    public:
+        /**
+         * Start a new recording (drops any previous one). The seed is stored
+         * with the recording so gameplay randomness can be seeded the same way
+         * on replay; the first recorded step writes a keyframe.
+         */
+        void Start(uint64_t seed = 0);
+        void Stop();
+
+        bool IsRecording() const { return m_recording; }
+        uint64_t GetSeed() const { return m_seed; }
+        size_t GetStepCount() const { return m_steps; }
+        size_t GetKeyframeCount() const { return m_keyframes; }
+        const std::vector<uint8_t>& GetData() const { return m_data; }
+
+        bool Save(const std::string& path) const;
+
+        // Called by PhysicsWorld::Step around each simulated step
+        void BeginStep(const PhysicsWorld& world, float deltaTime);
+        void EndStep(const PhysicsWorld& world, double stepMs);
+
+    private:
+        struct Input {
+            uint32_t body;
+            uint8_t flags;          // INPUT_* bits
+            Vector2D position;
+            Vector2D velocity;
+            Vector2D force;
+        };
+
+        bool m_recording = false;
+        bool m_needKeyframe = true;
+        uint64_t m_seed = 0;
+        size_t m_steps = 0;
+        size_t m_keyframes = 0;
+        std::vector<uint8_t> m_data;
+
+        // World state after the last recorded step (inputs are the differences)
+        std::vector<Vector2D> m_lastPosition;
+        std::vector<Vector2D> m_lastVelocity;
+        uint64_t m_lastRebuild = 0;
+        std::vector<uint8_t> m_lastSettings;
+        const TileCollisionLayer* m_lastTiles = nullptr;
+        uint64_t m_lastTileVersion = 0;
+
+        float m_stepTime = 0.0f;
+        std::vector<Input> m_inputs;
+
+        void WriteKeyframe(const PhysicsWorld& world);
+        void WriteTiles(const TileCollisionLayer* tiles);
+    };
+
+    // ============================================================================
+    // REPLAY
+    // ============================================================================
+
+    class PhysicsReplay {
+    public:
+        static constexpr size_t NO_STEP = static_cast<size_t>(-1);
+
+        struct Options {
+            int solverThreads = 1;          // Any count must reproduce the recording
+            size_t firstStep = 0;           // Steps timed and checked (earlier ones still run from the nearest keyframe)
+            size_t lastStep = NO_STEP;      // Inclusive
+            bool stopOnMismatch = false;
+        };
+
+        struct Result {
+            size_t steps = 0;               // Steps checked
+            size_t stepsSimulated = 0;      // Including the lead-in from the keyframe
+            double recordedSeconds = 0.0;   // Simulated time covered by the checked steps
+            double replayMs = 0.0;          // Wall time of the checked steps
+            double speedup = 0.0;           // Recorded seconds per second of replay
+            size_t mismatches = 0;          // Steps whose state hash differs from the recording
+            size_t firstMismatch = NO_STEP;
+            double maxStepMs = 0.0;
+            size_t slowestStep = NO_STEP;
+            double recordedMaxStepMs = 0.0;
+            size_t recordedSlowestStep = NO_STEP;
+            std::vector<float> stepMs;          // Per checked step, replay
+            std::vector<float> recordedStepMs;  // Same steps, as recorded
+        };
+
+        bool Load(const std::string& path);
+        bool Load(std::vector<uint8_t> data);
+
+        uint64_t GetSeed() const { return m_seed; }
+        size_t GetStepCount() const { return m_stepCount; }
+        size_t GetKeyframeCount() const { return m_keyframes.size(); }
+
+        // Re-simulate the loaded recording; false (and an error on std::cerr) if it is damaged
+        bool Run(const Options& options, Result& result) const;
+
+    private:
+        struct Keyframe {
+            size_t step;            // First step after the keyframe
+            size_t offset;          // Byte offset of the keyframe record
+        };
+
+        std::vector<uint8_t> m_data;
+        uint64_t m_seed = 0;
+        size_t m_stepCount = 0;
+        std::vector<Keyframe> m_keyframes;
+    };
+
+} // namespace GP2Engine
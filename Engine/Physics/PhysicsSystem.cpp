@@ -9,6 +9,11 @@
  */
 
 #include "PhysicsSystem.hpp"
+#include "AABBTree.hpp"
+#include "../Math/MathUtils.hpp"
+#include <chrono>
+#include <iostream>
+#include <random>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -52,46 +57,100 @@ namespace GP2Engine {
     Polygon::Polygon() : position(0.0f, 0.0f) {}
 
     Polygon::Polygon(const Vector2D& pos, const std::vector<Vector2D>& verts)
-        : position(pos), vertices(verts) {
-        ComputeNormals();
+        : position(pos) {
+        SetVertices(verts.data(), static_cast<int>(verts.size()));
+    }
+
+    Polygon::Polygon(const Vector2D& pos, const Vector2D* verts, int count)
+        : position(pos) {
+        SetVertices(verts, count);
     }
 
-    std::vector<Vector2D> Polygon::GetTransformedVertices() const {
-        std::vector<Vector2D> transformed;
-        transformed.reserve(vertices.size());
-        for (const auto& vertex : vertices) {
-            transformed.push_back(vertex + position);
+    bool Polygon::SetVertices(const Vector2D* verts, int count) {
+        if (count < 0 || count > MAX_VERTICES) {
+            std::cerr << "[Polygon] " << count << " vertices rejected (at most " << MAX_VERTICES
+                      << " supported); polygon left unchanged" << std::endl;
+            return false;
+        }
+
+        m_vertexCount = count;
+        for (int i = 0; i < m_vertexCount; ++i) {
+            m_vertices[i] = verts[i];
         }
-        return transformed;
+        ComputeNormals();
+        m_worldValid = false;
+        return true;
     }
 
     void Polygon::ComputeNormals() {
-        normals.clear();
-        size_t vertexCount = vertices.size();
-
-        for (size_t i = 0; i < vertexCount; ++i) {
-            Vector2D v1 = vertices[i];
-            Vector2D v2 = vertices[(i + 1) % vertexCount];
+        for (int i = 0; i < m_vertexCount; ++i) {
+            Vector2D v1 = m_vertices[i];
+            Vector2D v2 = m_vertices[(i + 1) % m_vertexCount];
 
             Vector2D edge = v2 - v1;
             Vector2D normal(-edge.y, edge.x);  // Perpendicular
             normal.normalize();
-            normals.push_back(normal);
+            m_normals[i] = normal;
+        }
+    }
+
+    void Polygon::UpdateWorld() const {
+        if (m_worldValid && m_cachedPosition.x == position.x && m_cachedPosition.y == position.y) return;
+
+        float minX = std::numeric_limits<float>::max(), minY = minX;
+        float maxX = -minX, maxY = -minX;
+        float sumX = 0.0f, sumY = 0.0f;
+        for (int i = 0; i < m_vertexCount; ++i) {
+            const float x = m_vertices[i].x + position.x;
+            const float y = m_vertices[i].y + position.y;
+            m_worldVertices[i] = Vector2D(x, y);
+            sumX += x;
+            sumY += y;
+            minX = std::min(minX, x);
+            minY = std::min(minY, y);
+            maxX = std::max(maxX, x);
+            maxY = std::max(maxY, y);
         }
+
+        if (m_vertexCount > 0) {
+            m_worldCenter = Vector2D(sumX / m_vertexCount, sumY / m_vertexCount);
+            m_worldBounds = AABB(minX, minY, maxX - minX, maxY - minY);
+        }
+        else {
+            m_worldCenter = position;
+            m_worldBounds = AABB(position.x, position.y, 0.0f, 0.0f);
+        }
+        m_cachedPosition = position;
+        m_worldValid = true;
+    }
+
+    const Vector2D* Polygon::GetWorldVertices() const {
+        UpdateWorld();
+        return m_worldVertices;
+    }
+
+    Vector2D Polygon::GetWorldCenter() const {
+        UpdateWorld();
+        return m_worldCenter;
+    }
+
+    AABB Polygon::GetAABB() const {
+        UpdateWorld();
+        return m_worldBounds;
     }
 
     Polygon Polygon::CreateBox(const Vector2D& center, float width, float height) {
         float halfW = width * 0.5f;
         float halfH = height * 0.5f;
 
-        std::vector<Vector2D> vertices = {
+        const Vector2D vertices[4] = {
             Vector2D(-halfW, -halfH),
             Vector2D(halfW, -halfH),
             Vector2D(halfW, halfH),
             Vector2D(-halfW, halfH)
         };
 
-        return Polygon(center, vertices);
+        return Polygon(center, vertices, 4);
     }
 
     // ============================================================================
@@ -294,6 +353,98 @@ namespace GP2Engine {
             return manifold;
         }
 
+        // Point moving by motion against a box grown by radius (rounded corners).
+        // This is the Minkowski sum of the box and a circle, so a point sweep
+        // against it is the circle's sweep against the box.
+        static float SweepPointvsRoundedBox(const Vector2D& start, const Vector2D& motion,
+                                            const Vector2D& boxMin, const Vector2D& boxMax, float radius, Vector2D& normal) {
+            const Vector2D end = start + motion;
+            float bestTime = 2.0f;
+            Vector2D hit;
+
+            // Wound so each segment normal points into the box; AnimatedCircleToStaticLineSegment
+            // then offsets the face outward by the radius
+            const MathUtils::LineSeg2 faces[4] = {
+                MathUtils::LineSeg2(Vector2D(boxMin.x, boxMin.y), Vector2D(boxMax.x, boxMin.y)),
+                MathUtils::LineSeg2(Vector2D(boxMax.x, boxMin.y), Vector2D(boxMax.x, boxMax.y)),
+                MathUtils::LineSeg2(Vector2D(boxMax.x, boxMax.y), Vector2D(boxMin.x, boxMax.y)),
+                MathUtils::LineSeg2(Vector2D(boxMin.x, boxMax.y), Vector2D(boxMin.x, boxMin.y))
+            };
+            for (const MathUtils::LineSeg2& face : faces) {
+                if (motion.dot(face.normal) <= 0.0f) continue;  // Leaving or sliding along this face
+
+                const float time = MathUtils::AnimatedCircleToStaticLineSegment(start, end, radius, face, hit);
+                if (time >= 0.0f && time < bestTime) {
+                    bestTime = time;
+                    normal = face.normal * -1.0f;
+                }
+            }
+
+            // Rounded corners: the parts of each corner circle inside the faces can never be hit first
+            if (radius > 0.0f) {
+                const Vector2D corners[4] = {
+                    Vector2D(boxMin.x, boxMin.y), Vector2D(boxMax.x, boxMin.y),
+                    Vector2D(boxMax.x, boxMax.y), Vector2D(boxMin.x, boxMax.y)
+                };
+                for (const Vector2D& corner : corners) {
+                    const float time = MathUtils::AnimatedPointToStaticCircle(start, end, corner, radius, hit);
+                    if (time >= 0.0f && time < bestTime) {
+                        bestTime = time;
+                        normal = (hit - corner) / radius;
+                    }
+                }
+            }
+
+            return bestTime <= 1.0f ? bestTime : -1.0f;
+        }
+
+        float SweepCirclevsCircle(const Circle& moving, const Vector2D& motion, const Circle& target, Vector2D& normal) {
+            const float radiusSum = moving.radius + target.radius;
+            if ((moving.center - target.center).lengthSquare() < radiusSum * radiusSum) return -1.0f;
+
+            Vector2D hit;
+            const float time = MathUtils::AnimatedCircleToStaticCircle(moving.center, moving.center + motion, moving.radius,
+                                                                       target.center, target.radius, hit);
+            if (time >= 0.0f) {
+                normal = (hit - target.center) / radiusSum;
+            }
+            return time;
+        }
+
+        float SweepCirclevsAABB(const Circle& moving, const Vector2D& motion, const AABB& target, Vector2D& normal) {
+            const Vector2D boxMin(std::min(target.x, target.x + target.width), std::min(target.y, target.y + target.height));
+            const Vector2D boxMax(std::max(target.x, target.x + target.width), std::max(target.y, target.y + target.height));
+
+            // Already overlapping: the discrete test resolves it
+            const Vector2D closest(std::clamp(moving.center.x, boxMin.x, boxMax.x), std::clamp(moving.center.y, boxMin.y, boxMax.y));
+            if ((moving.center - closest).lengthSquare() < moving.radius * moving.radius) return -1.0f;
+
+            return SweepPointvsRoundedBox(moving.center, motion, boxMin, boxMax, moving.radius, normal);
+        }
+
+        float SweepAABBvsAABB(const AABB& moving, const Vector2D& motion, const AABB& target, Vector2D& normal) {
+            if (moving.Intersects(target)) return -1.0f;
+
+            // Grow the target by the moving box's half size and sweep its center
+            const float halfWidth = std::fabs(moving.width) * 0.5f;
+            const float halfHeight = std::fabs(moving.height) * 0.5f;
+            const Vector2D boxMin(std::min(target.x, target.x + target.width) - halfWidth,
+                                  std::min(target.y, target.y + target.height) - halfHeight);
+            const Vector2D boxMax(std::max(target.x, target.x + target.width) + halfWidth,
+                                  std::max(target.y, target.y + target.height) + halfHeight);
+
+            return SweepPointvsRoundedBox(moving.GetCenter(), motion, boxMin, boxMax, 0.0f, normal);
+        }
+
+        float SweepAABBvsCircle(const AABB& moving, const Vector2D& motion, const Circle& target, Vector2D& normal) {
+            // Same as the circle moving the other way against the box
+            const float time = SweepCirclevsAABB(target, motion * -1.0f, moving, normal);
+            if (time >= 0.0f) {
+                normal = normal * -1.0f;
+            }
+            return time;
+        }
+
         // SAT Helper Function
         Projection ProjectPolygon(const std::vector<Vector2D>& vertices, const Vector2D& axis) {
             if (vertices.empty()) return Projection();
@@ -310,67 +461,281 @@ namespace GP2Engine {
             return Projection(min, max);
         }
 
+        Projection ProjectPolygon(const Vector2D* vertices, int count, const Vector2D& axis) {
+            if (count <= 0) return Projection();
+
+            float min = axis.x * vertices[0].x + axis.y * vertices[0].y;
+            float max = min;
+
+            for (int i = 1; i < count; ++i) {
+                const float projection = axis.x * vertices[i].x + axis.y * vertices[i].y;
+                min = std::min(min, projection);
+                max = std::max(max, projection);
+            }
+
+            return Projection(min, max);
+        }
+
+        // Overlap along the axis, or a value <= 0 if the projections are apart
+        static float AxisOverlap(const Vector2D* vertsA, int countA, const Vector2D* vertsB, int countB, const Vector2D& axis) {
+            return ProjectPolygon(vertsA, countA, axis).GetOverlap(ProjectPolygon(vertsB, countB, axis));
+        }
+
+        // Fill in the manifold once every axis overlapped
+        static void FinishPolygonManifold(const Polygon& a, const Polygon& b, float minOverlap, const Vector2D& smallestAxis,
+                                          CollisionManifold& manifold) {
+            manifold.hasCollision = true;
+            manifold.penetration = minOverlap;
+            manifold.normal = smallestAxis;
+
+            // Ensure normal points from A to B
+            const Vector2D centerA = a.GetWorldCenter();
+            const Vector2D centerB = b.GetWorldCenter();
+            if ((centerB - centerA).dot(smallestAxis) < 0) {
+                manifold.normal = smallestAxis * -1.0f;
+            }
+
+            // Approximate contact point
+            manifold.contactPoint = (centerA + centerB) * 0.5f;
+        }
+
         // Polygon vs Polygon (SAT)
-        CollisionManifold CheckPolygonvsPolygon(const Polygon& a, const Polygon& b) {
+        CollisionManifold CheckPolygonvsPolygon(const Polygon& a, const Polygon& b, SATCache* cache) {
             CollisionManifold manifold;
+            if (a.GetVertexCount() == 0 || b.GetVertexCount() == 0) return manifold;
 
-            std::vector<Vector2D> vertsA = a.GetTransformedVertices();
-            std::vector<Vector2D> vertsB = b.GetTransformedVertices();
+            const Vector2D* vertsA = a.GetWorldVertices();
+            const Vector2D* vertsB = b.GetWorldVertices();
+
+            // Axis that separated this pair last time: usually still does
+            if (cache && cache->owner >= 0) {
+                const Polygon& owner = cache->owner == 0 ? a : b;
+                if (cache->index < owner.GetVertexCount() &&
+                    AxisOverlap(vertsA, a.GetVertexCount(), vertsB, b.GetVertexCount(), owner.GetNormals()[cache->index]) <= 0.0f) {
+                    return manifold;
+                }
+            }
 
             float minOverlap = std::numeric_limits<float>::max();
             Vector2D smallestAxis;
 
-            // Test axes from polygon A
-            for (const auto& normal : a.normals) {
-                Projection projA = ProjectPolygon(vertsA, normal);
-                Projection projB = ProjectPolygon(vertsB, normal);
-
-                if (!projA.Overlaps(projB)) {
-                    return manifold;  // No collision
-                }
-
-                float overlap = projA.GetOverlap(projB);
-                if (overlap < minOverlap) {
-                    minOverlap = overlap;
-                    smallestAxis = normal;
+            // Test axes from polygon A, then polygon B
+            const Polygon* polygons[2] = { &a, &b };
+            for (int owner = 0; owner < 2; ++owner) {
+                const Polygon& polygon = *polygons[owner];
+                for (int i = 0; i < polygon.GetVertexCount(); ++i) {
+                    const float overlap = AxisOverlap(vertsA, a.GetVertexCount(), vertsB, b.GetVertexCount(), polygon.GetNormals()[i]);
+                    if (overlap <= 0.0f) {
+                        if (cache) *cache = { owner, i };
+                        return manifold;  // No collision
+                    }
+                    if (overlap < minOverlap) {
+                        minOverlap = overlap;
+                        smallestAxis = polygon.GetNormals()[i];
+                    }
                 }
             }
 
-            // Test axes from polygon B
-            for (const auto& normal : b.normals) {
-                Projection projA = ProjectPolygon(vertsA, normal);
-                Projection projB = ProjectPolygon(vertsB, normal);
+            if (cache) cache->owner = -1;
+            FinishPolygonManifold(a, b, minOverlap, smallestAxis, manifold);
+            return manifold;
+        }
+
+        size_t CheckPolygonvsPolygons(const Polygon& polygon, const Polygon* others, size_t count,
+                                      CollisionManifold* manifolds, SATCache* caches) {
+            size_t hits = 0;
+            const int countA = polygon.GetVertexCount();
+            if (countA == 0) {
+                for (size_t i = 0; i < count; ++i) manifolds[i] = CollisionManifold();
+                return 0;
+            }
 
-                if (!projA.Overlaps(projB)) {
-                    return manifold;
+            // The polygon's projections onto its own axes are the same for every other polygon
+            const Vector2D* vertsA = polygon.GetWorldVertices();
+            Projection ownProjections[Polygon::MAX_VERTICES];
+            for (int i = 0; i < countA; ++i) {
+                ownProjections[i] = ProjectPolygon(vertsA, countA, polygon.GetNormals()[i]);
+            }
+            const AABB bounds = polygon.GetAABB();
+
+            for (size_t j = 0; j < count; ++j) {
+                CollisionManifold& manifold = manifolds[j];
+                manifold = CollisionManifold();
+
+                const Polygon& other = others[j];
+                const int countB = other.GetVertexCount();
+                if (countB == 0 || !bounds.Intersects(other.GetAABB())) continue;
+
+                const Vector2D* vertsB = other.GetWorldVertices();
+                SATCache* cache = caches ? &caches[j] : nullptr;
+
+                if (cache && cache->owner >= 0) {
+                    const int index = cache->index;
+                    float overlap = 1.0f;
+                    if (cache->owner == 0 && index < countA) {
+                        overlap = ownProjections[index].GetOverlap(ProjectPolygon(vertsB, countB, polygon.GetNormals()[index]));
+                    }
+                    else if (cache->owner == 1 && index < countB) {
+                        overlap = AxisOverlap(vertsA, countA, vertsB, countB, other.GetNormals()[index]);
+                    }
+                    if (overlap <= 0.0f) continue;
                 }
 
-                float overlap = projA.GetOverlap(projB);
-                if (overlap < minOverlap) {
-                    minOverlap = overlap;
-                    smallestAxis = normal;
+                float minOverlap = std::numeric_limits<float>::max();
+                Vector2D smallestAxis;
+                bool separated = false;
+
+                for (int i = 0; i < countA && !separated; ++i) {
+                    const float overlap = ownProjections[i].GetOverlap(ProjectPolygon(vertsB, countB, polygon.GetNormals()[i]));
+                    if (overlap <= 0.0f) {
+                        if (cache) *cache = { 0, i };
+                        separated = true;
+                    }
+                    else if (overlap < minOverlap) {
+                        minOverlap = overlap;
+                        smallestAxis = polygon.GetNormals()[i];
+                    }
+                }
+                for (int i = 0; i < countB && !separated; ++i) {
+                    const float overlap = AxisOverlap(vertsA, countA, vertsB, countB, other.GetNormals()[i]);
+                    if (overlap <= 0.0f) {
+                        if (cache) *cache = { 1, i };
+                        separated = true;
+                    }
+                    else if (overlap < minOverlap) {
+                        minOverlap = overlap;
+                        smallestAxis = other.GetNormals()[i];
+                    }
                 }
+                if (separated) continue;
+
+                if (cache) cache->owner = -1;
+                FinishPolygonManifold(polygon, other, minOverlap, smallestAxis, manifold);
+                ++hits;
             }
+            return hits;
+        }
 
-            // Collision detected
-            manifold.hasCollision = true;
-            manifold.penetration = minOverlap;
-            manifold.normal = smallestAxis;
+        // The SAT as it was before inline polygons: two heap vectors per test
+        static bool VectorPolygonTest(const Polygon& a, const Polygon& b) {
+            std::vector<Vector2D> vertsA, vertsB;
+            for (int i = 0; i < a.GetVertexCount(); ++i) vertsA.push_back(a.GetVertices()[i] + a.position);
+            for (int i = 0; i < b.GetVertexCount(); ++i) vertsB.push_back(b.GetVertices()[i] + b.position);
 
-            // Approximate contact point
-            Vector2D centerA(0, 0), centerB(0, 0);
-            for (const auto& v : vertsA) centerA += v;
-            for (const auto& v : vertsB) centerB += v;
-            centerA = centerA / static_cast<float>(vertsA.size());
-            centerB = centerB / static_cast<float>(vertsB.size());
+            for (int i = 0; i < a.GetVertexCount(); ++i) {
+                if (!ProjectPolygon(vertsA, a.GetNormals()[i]).Overlaps(ProjectPolygon(vertsB, a.GetNormals()[i]))) return false;
+            }
+            for (int i = 0; i < b.GetVertexCount(); ++i) {
+                if (!ProjectPolygon(vertsA, b.GetNormals()[i]).Overlaps(ProjectPolygon(vertsB, b.GetNormals()[i]))) return false;
+            }
+            return true;
+        }
 
-            // Ensure normal points from A to B
-            if ((centerB - centerA).dot(smallestAxis) < 0) {
-                manifold.normal = smallestAxis * -1.0f;
+        SATBenchmarkResult RunSATBenchmark(size_t polygonCount, int rounds) {
+            using Clock = std::chrono::high_resolution_clock;
+
+            SATBenchmarkResult result;
+            result.polygons = polygonCount;
+            rounds = std::max(rounds, 1);
+
+            // Random convex polygons (3-8 vertices around a circle), ~5% of pairs overlapping
+            std::mt19937 rng(42);
+            std::uniform_int_distribution<int> sides(3, Polygon::MAX_VERTICES);
+            std::uniform_real_distribution<float> radius(10.0f, 30.0f);
+            std::uniform_real_distribution<float> jitter(0.8f, 1.0f);
+            const float side = std::sqrt(static_cast<float>(polygonCount)) * 90.0f;
+            std::uniform_real_distribution<float> coordinate(0.0f, side);
+
+            std::vector<Polygon> polygons(polygonCount);
+            std::vector<Vector2D> origins(polygonCount);
+            for (size_t i = 0; i < polygonCount; ++i) {
+                const int count = sides(rng);
+                const float r = radius(rng);
+                Vector2D vertices[Polygon::MAX_VERTICES];
+                for (int v = 0; v < count; ++v) {
+                    const float angle = 6.2831853f * static_cast<float>(v) / static_cast<float>(count);
+                    const float length = r * jitter(rng);
+                    vertices[v] = Vector2D(std::cos(angle) * length, std::sin(angle) * length);
+                }
+                origins[i] = Vector2D(coordinate(rng), coordinate(rng));
+                polygons[i] = Polygon(origins[i], vertices, count);
             }
 
-            manifold.contactPoint = (centerA + centerB) * 0.5f;
-            return manifold;
+            // Small per-round drift, like bodies moving between frames
+            auto placeForRound = [&](int round) {
+                for (size_t i = 0; i < polygonCount; ++i) {
+                    const float phase = static_cast<float>(i) * 0.37f + static_cast<float>(round) * 0.1f;
+                    polygons[i].position = origins[i] + Vector2D(std::cos(phase), std::sin(phase)) * 4.0f;
+                }
+            };
+
+            const size_t pairsPerRound = polygonCount > 1 ? polygonCount * (polygonCount - 1) / 2 : 0;
+            result.pairTests = pairsPerRound * static_cast<size_t>(rounds);
+            auto pairsPerSecond = [&](double seconds) {
+                return seconds > 0.0 ? static_cast<double>(result.pairTests) / seconds : 0.0;
+            };
+
+            size_t vectorHits = 0, inlineHits = 0, cachedHits = 0, batchedHits = 0;
+
+            // Old heap-vector path
+            auto start = Clock::now();
+            for (int round = 0; round < rounds; ++round) {
+                placeForRound(round);
+                for (size_t i = 0; i < polygonCount; ++i) {
+                    for (size_t j = i + 1; j < polygonCount; ++j) {
+                        vectorHits += VectorPolygonTest(polygons[i], polygons[j]) ? 1 : 0;
+                    }
+                }
+            }
+            result.vectorPairsPerSec = pairsPerSecond(std::chrono::duration<double>(Clock::now() - start).count());
+
+            // Inline polygons, no cache
+            start = Clock::now();
+            for (int round = 0; round < rounds; ++round) {
+                placeForRound(round);
+                for (size_t i = 0; i < polygonCount; ++i) {
+                    for (size_t j = i + 1; j < polygonCount; ++j) {
+                        inlineHits += CheckPolygonvsPolygon(polygons[i], polygons[j]).hasCollision ? 1 : 0;
+                    }
+                }
+            }
+            result.inlinePairsPerSec = pairsPerSecond(std::chrono::duration<double>(Clock::now() - start).count());
+
+            // Inline polygons with a separating axis cache per pair, kept across rounds
+            std::vector<SATCache> caches(pairsPerRound);
+            start = Clock::now();
+            for (int round = 0; round < rounds; ++round) {
+                placeForRound(round);
+                size_t pair = 0;
+                for (size_t i = 0; i < polygonCount; ++i) {
+                    for (size_t j = i + 1; j < polygonCount; ++j) {
+                        cachedHits += CheckPolygonvsPolygon(polygons[i], polygons[j], &caches[pair++]).hasCollision ? 1 : 0;
+                    }
+                }
+            }
+            result.cachedPairsPerSec = pairsPerSecond(std::chrono::duration<double>(Clock::now() - start).count());
+
+            // One polygon against the rest of the list
+            std::fill(caches.begin(), caches.end(), SATCache());
+            std::vector<CollisionManifold> manifolds(polygonCount);
+            start = Clock::now();
+            for (int round = 0; round < rounds; ++round) {
+                placeForRound(round);
+                size_t pair = 0;
+                for (size_t i = 0; i + 1 < polygonCount; ++i) {
+                    const size_t others = polygonCount - i - 1;
+                    batchedHits += CheckPolygonvsPolygons(polygons[i], &polygons[i + 1], others, manifolds.data(), &caches[pair]);
+                    pair += others;
+                }
+            }
+            result.batchedPairsPerSec = pairsPerSecond(std::chrono::duration<double>(Clock::now() - start).count());
+
+            result.hits = inlineHits / static_cast<size_t>(rounds);
+            if (vectorHits != inlineHits || cachedHits != inlineHits || batchedHits != inlineHits) {
+                std::cerr << "SAT benchmark: hit counts differ (vector " << vectorHits << ", inline " << inlineHits
+                          << ", cached " << cachedHits << ", batched " << batchedHits << ")" << std::endl;
+            }
+            return result;
         }
 
     } // namespace CollisionDetection
@@ -732,6 +1097,67 @@ namespace GP2Engine {
         }
     }
 
+    void CollisionSystem::SweepWallCollisions(PhysicsBody& body, const Vector2D& previousPosition,
+                                              const std::vector<AABB>& walls, const DynamicAABBTree& wallTree) {
+        const bool circle = body.shapeType == ShapeType::CIRCLE_SHAPE;
+        const float halfWidth = circle ? body.collisionCircle.radius : std::fabs(body.bounds.width) * 0.5f;
+        const float halfHeight = circle ? body.collisionCircle.radius : std::fabs(body.bounds.height) * 0.5f;
+
+        Vector2D position = previousPosition;
+        Vector2D remaining = body.position - previousPosition;
+
+        for (int iteration = 0; iteration < CCD_MAX_ITERATIONS; ++iteration) {
+            const float distance = remaining.length();
+            if (distance <= CCD_SKIN) {
+                position += remaining;
+                break;
+            }
+
+            // Walls touched by the swept bounds
+            const Vector2D end = position + remaining;
+            const float minX = std::min(position.x, end.x) - halfWidth;
+            const float minY = std::min(position.y, end.y) - halfHeight;
+            const AABB swept(minX, minY, std::max(position.x, end.x) + halfWidth - minX, std::max(position.y, end.y) + halfHeight - minY);
+
+            float firstTime = 2.0f;
+            Vector2D firstNormal;
+            wallTree.Query(swept, [&](int proxy) {
+                const uint32_t index = wallTree.GetUserData(proxy);
+                if (index >= walls.size()) return false;
+
+                Vector2D normal;
+                const float time = circle
+                    ? CollisionDetection::SweepCirclevsAABB(Circle(position, halfWidth), remaining, walls[index], normal)
+                    : CollisionDetection::SweepAABBvsAABB(AABB(position.x - halfWidth, position.y - halfHeight, halfWidth * 2.0f, halfHeight * 2.0f),
+                                                          remaining, walls[index], normal);
+                if (time >= 0.0f && time < firstTime) {
+                    firstTime = time;
+                    firstNormal = normal;
+                }
+                return false;
+            });
+
+            if (firstTime > 1.0f) {
+                position += remaining;
+                break;
+            }
+
+            // Stop a skin short of the wall, then slide along it with what is left of the move
+            const float safeTime = std::max(firstTime - CCD_SKIN / distance, 0.0f);
+            position += remaining * safeTime;
+            remaining = remaining * (1.0f - safeTime);
+            const float into = remaining.dot(firstNormal);
+            if (into < 0.0f) remaining -= firstNormal * into;
+
+            const float velocityInto = body.velocity.dot(firstNormal);
+            if (velocityInto < 0.0f) {
+                body.velocity -= firstNormal * (velocityInto * (1.0f + body.restitution));
+            }
+        }
+
+        body.SetPosition(position);
+    }
+
     void CollisionSystem::ResolveBodyCollision(PhysicsBody& a, PhysicsBody& b) {
         CollisionManifold manifold;
 
@@ -815,92 +1241,4 @@ namespace GP2Engine {
         return totalIntensity;
     }
 
-    // ============================================================================
-    // PHYSICS WORLD IMPLEMENTATION
-    // ============================================================================
-
-    PhysicsWorld::PhysicsWorld() : player(100.0f, 100.0f), ghost(400.0f, 300.0f), currentTime(0.0f) {
-        InitializeWorld();
-    }
-
-    void PhysicsWorld::Update(float deltaTime) {
-        currentTime += deltaTime;
-
-        player.Update(deltaTime, hideSpots);
-        ghost.Update(deltaTime, player);
-
-        // Handle collisions
-        CollisionSystem::HandleWallCollisions(player, walls);
-        CollisionSystem::HandleWallCollisions(ghost, walls);
-
-        // Check player vs ghost collision (Circle vs Circle!)
-        if (!player.isHidden) {
-            CollisionManifold manifold =
-                CollisionDetection::CheckCirclevsCircle(player.GetCircle(), ghost.GetCircle());
-
-            if (manifold.hasCollision) {
-                // Game over or damage logic here
-            }
-        }
-
-        if (player.soundLevel > 10.0f) {
-            soundSystem.AddSound(player.position, player.soundLevel, currentTime);
-        }
-        soundSystem.Update(currentTime);
-
-        CheckGameConditions();
-    }
-
-    void PhysicsWorld::SetPlayerInput(bool left, bool right, bool up, bool down, bool sprint, bool hide) {
-        player.input.left = left;
-        player.input.right = right;
-        player.input.up = up;
-        player.input.down = down;
-        player.input.sprint = sprint;
-        player.input.hide = hide;
-    }
-
-    void PhysicsWorld::SetMouseInput(const Vector2D& mousePos, bool flashlightToggle) {
-        player.input.mousePosition = mousePos;
-        player.input.flashlightToggle = flashlightToggle;
-    }
-
-    void PhysicsWorld::InitializeWorld() {
-        walls = {
-            AABB(0, 0, 800, 20),
-            AABB(0, 580, 800, 20),
-            AABB(0, 0, 20, 600),
-            AABB(780, 0, 20, 600),
-            AABB(150, 100, 20, 200),
-            AABB(300, 200, 200, 20),
-            AABB(500, 80, 20, 140),
-            AABB(650, 350, 20, 150),
-            AABB(250, 400, 150, 20),
-        };
-
-        hideSpots = {
-            AABB(50, 50, 40, 30),
-            AABB(700, 500, 50, 40),
-            AABB(350, 450, 30, 40),
-        };
-
-        std::vector<Vector2D> patrolPath = {
-            Vector2D(400, 300), Vector2D(600, 300),
-            Vector2D(600, 150), Vector2D(200, 150)
-        };
-        ghost.SetPatrolPath(patrolPath);
-    }
-
-    void PhysicsWorld::CheckGameConditions() {
-        // Check if ghost caught player using circle collision
-        if (!player.isHidden) {
-            CollisionManifold manifold =
-                CollisionDetection::CheckCirclevsCircle(player.GetCircle(), ghost.GetCircle());
-
-            if (manifold.hasCollision) {
-                // Game over logic
-            }
-        }
-    }
-
 } // namespace GP2Engine
\ No newline at end of file
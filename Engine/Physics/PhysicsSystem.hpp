@@ -3,8 +3,9 @@
  * @author Fauzan(100%)
  * @brief Enhanced 2D physics system header with comprehensive collision detection
  *
- * Defines the AABB structure and the PhysicsWorld class, managing collision detection,
- * entity state updates, AI behavior, sound propagation, and win/lose game conditions.
+ * Defines the collision shapes (AABB, circle, polygon), collision detection,
+ * physics bodies, player/ghost movement and sound propagation. The ECS-driven
+ * simulation lives in PhysicsWorld.hpp.
  */
 
 #pragma once
@@ -23,6 +24,7 @@ namespace GP2Engine {
     struct Polygon;
     struct CollisionManifold;
     enum class ShapeType;
+    class DynamicAABBTree;
 
     // ============================================================================
     // AABB (Axis-Aligned Bounding Box)
@@ -62,18 +64,46 @@ namespace GP2Engine {
     // POLYGON (NEW! - for SAT)
     // ============================================================================
 
+    // Convex polygon with inline storage (no heap allocation). World-space
+    // vertices are cached and only recomputed when position changes.
     struct Polygon {
+        static constexpr int MAX_VERTICES = 8;
+
         Vector2D position;
-        std::vector<Vector2D> vertices;
-        std::vector<Vector2D> normals;
 
         Polygon();
         Polygon(const Vector2D& pos, const std::vector<Vector2D>& verts);
+        Polygon(const Vector2D& pos, const Vector2D* verts, int count);
 
-        std::vector<Vector2D> GetTransformedVertices() const;
-        void ComputeNormals();
+        // Copies the vertices and recomputes the normals. More than MAX_VERTICES
+        // (or a negative count) is rejected with an error and leaves the polygon unchanged.
+        bool SetVertices(const Vector2D* verts, int count);
+
+        // Local-space shape (read-only: SetVertices keeps the normals and world cache in step)
+        int GetVertexCount() const { return m_vertexCount; }
+        const Vector2D* GetVertices() const { return m_vertices; }
+        const Vector2D* GetNormals() const { return m_normals; }    // Unit edge normals
+
+        // Cached world-space data (refreshed when position moved)
+        const Vector2D* GetWorldVertices() const;
+        Vector2D GetWorldCenter() const;
+        AABB GetAABB() const;
 
         static Polygon CreateBox(const Vector2D& center, float width, float height);
+
+    private:
+        Vector2D m_vertices[MAX_VERTICES];
+        Vector2D m_normals[MAX_VERTICES];
+        int m_vertexCount = 0;
+
+        mutable Vector2D m_worldVertices[MAX_VERTICES];
+        mutable Vector2D m_worldCenter;
+        mutable AABB m_worldBounds;
+        mutable Vector2D m_cachedPosition;
+        mutable bool m_worldValid = false;
+
+        void ComputeNormals();
+        void UpdateWorld() const;
     };
 
     // ============================================================================
@@ -114,8 +144,42 @@ namespace GP2Engine {
         // Circle vs AABB (NEW!)
         CollisionManifold CheckCirclevsAABB(const Circle& circle, const AABB& aabb);
 
-        // Polygon vs Polygon - SAT (NEW!)
-        CollisionManifold CheckPolygonvsPolygon(const Polygon& a, const Polygon& b);
+        // Swept tests (continuous collision): the first shape moves by motion, the
+        // second stays still. Return the time of impact in [0, 1] and the surface
+        // normal at the hit (pointing toward the moving shape), or -1 if there is
+        // no hit or the shapes already overlap at the start.
+        float SweepCirclevsCircle(const Circle& moving, const Vector2D& motion, const Circle& target, Vector2D& normal);
+        float SweepCirclevsAABB(const Circle& moving, const Vector2D& motion, const AABB& target, Vector2D& normal);
+        float SweepAABBvsAABB(const AABB& moving, const Vector2D& motion, const AABB& target, Vector2D& normal);
+        float SweepAABBvsCircle(const AABB& moving, const Vector2D& motion, const Circle& target, Vector2D& normal);
+
+        // Last separating axis found for a pair; tested first on the next call so
+        // pairs that stay apart usually exit after a single projection
+        struct SATCache {
+            int owner = -1;     // 0 = axis of a, 1 = axis of b, -1 = none (overlapping last time)
+            int index = 0;
+        };
+
+        // Polygon vs Polygon - SAT (no allocation; cache is optional)
+        CollisionManifold CheckPolygonvsPolygon(const Polygon& a, const Polygon& b, SATCache* cache = nullptr);
+
+        // One polygon against many: reuses the polygon's own projections and rejects by AABB first.
+        // Writes one manifold per other polygon (caches: one per pair, optional); returns the hit count.
+        size_t CheckPolygonvsPolygons(const Polygon& polygon, const Polygon* others, size_t count,
+                                      CollisionManifold* manifolds, SATCache* caches = nullptr);
+
+        struct SATBenchmarkResult {
+            size_t polygons = 0;
+            size_t pairTests = 0;               // Per method
+            size_t hits = 0;                    // Overlapping pairs per round (same for every method)
+            double vectorPairsPerSec = 0.0;     // Old path: heap vectors per test
+            double inlinePairsPerSec = 0.0;     // Inline polygons, no cache
+            double cachedPairsPerSec = 0.0;     // Inline polygons + SATCache across rounds
+            double batchedPairsPerSec = 0.0;    // CheckPolygonvsPolygons + SATCache
+        };
+
+        // Every pair of polygonCount random convex polygons, drifting slightly each round
+        SATBenchmarkResult RunSATBenchmark(size_t polygonCount, int rounds);
 
         // Helper structures for SAT
         struct Projection {
@@ -127,6 +191,7 @@ namespace GP2Engine {
         };
 
         Projection ProjectPolygon(const std::vector<Vector2D>& vertices, const Vector2D& axis);
+        Projection ProjectPolygon(const Vector2D* vertices, int count, const Vector2D& axis);
     }
 
     // ============================================================================
@@ -255,6 +320,15 @@ namespace GP2Engine {
         static void ResolveWallCollision(PhysicsBody& body, const AABB& wall);
         static void HandleWallCollisions(PhysicsBody& body, const std::vector<AABB>& walls);
 
+        // Continuous version for fast bodies (projectiles): moves the body from previousPosition
+        // to its current position, stopping at the first wall in the way and sliding along it for
+        // the rest of the move. Call after PhysicsBody::Update, before HandleWallCollisions.
+        static void SweepWallCollisions(PhysicsBody& body, const Vector2D& previousPosition,
+                                        const std::vector<AABB>& walls, const DynamicAABBTree& wallTree);
+
+        static constexpr int CCD_MAX_ITERATIONS = 4;    // Walls hit per sweep before the move is cut short
+        static constexpr float CCD_SKIN = 0.05f;        // Gap left in front of the hit surface (world units)
+
         // NEW: Resolve collision between two physics bodies
         static void ResolveBodyCollision(PhysicsBody& a, PhysicsBody& b);
     };
@@ -281,28 +355,4 @@ namespace GP2Engine {
         float GetSoundIntensityAt(const Vector2D& position) const;
     };
 
-    // ============================================================================
-    // PHYSICS WORLD
-    // ============================================================================
-
-    class PhysicsWorld {
-    public:
-        PlayerPhysics player;
-        GhostAI ghost;
-        std::vector<AABB> walls;
-        std::vector<AABB> hideSpots;
-        SoundSystem soundSystem;
-        float currentTime;
-
-        PhysicsWorld();
-
-        void Update(float deltaTime);
-        void SetPlayerInput(bool left, bool right, bool up, bool down, bool sprint, bool hide);
-        void SetMouseInput(const Vector2D& mousePos, bool flashlightToggle);
-
-    private:
-        void InitializeWorld();
-        void CheckGameConditions();
-    };
-
 } // namespace GP2Engine
\ No newline at end of file
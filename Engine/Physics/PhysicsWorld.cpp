@@ -0,0 +1,1565 @@
+/**
+ * @file PhysicsWorld.cpp
+ * @author Fauzan (100%)
+ * @brief ECS-driven rigid body world implementation
+ */
+
+#include "PhysicsWorld.hpp"
+#include "PhysicsReplay.hpp"
+#include "../ECS/Registry.hpp"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+namespace GP2Engine {
+
+    namespace {
+        using Clock = std::chrono::high_resolution_clock;
+
+        double MillisecondsSince(Clock::time_point start) {
+            return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        }
+
+        uint32_t FloatBits(float value) {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+    }
+
+    PhysicsWorld::PhysicsWorld() = default;
+    PhysicsWorld::~PhysicsWorld() = default;
+
+    // ============================================================================
+    // ECS SYNC
+    // ============================================================================
+
+    void PhysicsWorld::Step(Registry& registry, float deltaTime) {
+        const auto start = Clock::now();
+
+        if (&registry != m_syncedRegistry) {
+            Rebuild(registry);
+        }
+        else if (registry.GetVersion() != m_syncedVersion && BodiesChanged(registry)) {
+            Rebuild(registry);
+        }
+        else {
+            m_syncedVersion = registry.GetVersion();
+            ReadComponents(registry);
+        }
+        double syncMs = MillisecondsSince(start);
+
+        if (deltaTime > 0.0f) {
+            if (m_recorder) m_recorder->BeginStep(*this, deltaTime);
+            const auto simulateStart = Clock::now();
+            Simulate(deltaTime);
+            if (m_recorder) m_recorder->EndStep(*this, MillisecondsSince(simulateStart));
+        }
+
+        const auto writeStart = Clock::now();
+        WriteComponents(registry);
+        syncMs += MillisecondsSince(writeStart);
+
+        m_stats.syncMs = syncMs;
+        m_stats.totalMs = MillisecondsSince(start);
+    }
+
+    int PhysicsWorld::Update(Registry& registry, FixedTimestep& timestep, float frameDelta) {
+        const int steps = timestep.Advance(frameDelta);
+        for (int step = 0; step < steps; ++step) {
+            Step(registry, timestep.GetStepTime());
+        }
+        Interpolate(registry, timestep.GetAlpha());
+        return steps;
+    }
+
+    void PhysicsWorld::Rebuild(Registry& registry) {
+        // Forces, rest counters, positions, warm-start impulses and sleep survive the rebuild
+        CarriedState carried;
+        CaptureState(carried);
+
+        Clear();
+        ++m_rebuildCount;
+
+        CollectBodyEntities(registry, m_syncEntities);
+        for (EntityID entity : m_syncEntities) {
+            const PhysicsComponent* physics = registry.GetComponent<PhysicsComponent>(entity);
+            const Transform2D* transform = registry.GetComponent<Transform2D>(entity);
+            CreateBody(*physics, transform->position, transform->scale, entity);
+        }
+
+        RestoreState(carried, registry);
+
+        m_syncedRegistry = &registry;
+        m_syncedVersion = registry.GetVersion();
+    }
+
+    void PhysicsWorld::CollectBodyEntities(Registry& registry, std::vector<EntityID>& entities) {
+        // Sorted so the body order (and the simulation) does not depend on hash set order
+        entities.clear();
+        for (EntityID entity : registry.GetActiveEntities()) {
+            if (registry.HasComponent<PhysicsComponent>(entity) && registry.HasComponent<Transform2D>(entity)) {
+                entities.push_back(entity);
+            }
+        }
+        std::sort(entities.begin(), entities.end());
+    }
+
+    bool PhysicsWorld::BodiesChanged(Registry& registry) {
+        // Text, audio or sprite entities bump the version too; only physics membership and descriptions matter
+        CollectBodyEntities(registry, m_syncEntities);
+        if (m_syncEntities != m_entity) return true;
+
+        for (uint32_t i = 0; i < m_entity.size(); ++i) {
+            const PhysicsComponent* physics = registry.GetComponent<PhysicsComponent>(m_entity[i]);
+            const Transform2D* transform = registry.GetComponent<Transform2D>(m_entity[i]);
+            if (!MatchesBody(i, *physics, transform->scale)) return true;
+        }
+        return false;
+    }
+
+    bool PhysicsWorld::MatchesBody(uint32_t body, const BodyDesc& desc, const Vector2D& scale) const {
+        const bool dynamic = desc.bodyType == BodyType::Dynamic;
+        return m_type[body] == desc.bodyType
+            && m_inverseMass[body] == (dynamic && desc.mass > 0.0f ? 1.0f / desc.mass : 0.0f)
+            && m_restitution[body] == desc.restitution
+            && m_friction[body] == std::max(desc.friction, 0.0f)
+            && m_damping[body] == std::max(desc.linearDamping, 0.0f)
+            && m_gravityScale[body] == desc.gravityScale
+            && m_syncTransform[body] == (desc.syncTransform ? 1 : 0)
+            && m_continuous[body] == (dynamic && desc.continuous ? 1 : 0)
+            && ShapeKey(m_shapes[m_shapeIndex[body]]) == ShapeKey(MakeShape(desc, scale));
+    }
+
+    void PhysicsWorld::CaptureState(CarriedState& carried) const {
+        const uint32_t count = static_cast<uint32_t>(m_position.size());
+
+        // Each sleeping ring is tagged with its first member found
+        std::vector<uint32_t> sleepGroup(count, INVALID_BODY);
+        for (uint32_t i = 0; i < count; ++i) {
+            if (m_awake[i] || m_type[i] != BodyType::Dynamic || sleepGroup[i] != INVALID_BODY) continue;
+            uint32_t member = i;
+            do {
+                sleepGroup[member] = i;
+                member = m_sleepNext[member];
+            } while (member != i);
+        }
+
+        carried.bodies.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            if (m_entity[i] == INVALID_ENTITY) continue;
+            carried.bodies.push_back({ m_entity[i], m_type[i], m_position[i], m_previousPosition[i], m_written[i], m_force[i],
+                                       m_restSteps[i], sleepGroup[i], ShapeKey(m_shapes[m_shapeIndex[i]]) });
+        }
+
+        for (const CachedImpulse& impulse : m_impulseCache) {
+            if (m_entity[impulse.a] != INVALID_ENTITY && m_entity[impulse.b] != INVALID_ENTITY) {
+                carried.impulses.push_back({ m_entity[impulse.a], m_entity[impulse.b], impulse });
+            }
+        }
+        for (const CachedImpulse& impulse : m_tileImpulseCache) {
+            if (m_entity[impulse.a] != INVALID_ENTITY) {
+                carried.tileImpulses.push_back({ m_entity[impulse.a], INVALID_ENTITY, impulse });
+            }
+        }
+    }
+
+    void PhysicsWorld::RestoreState(const CarriedState& carried, Registry& registry) {
+        std::vector<uint8_t> carriedBody(m_position.size(), 0);
+        bool supportsChanged = false;
+
+        for (const CarriedState::Body& old : carried.bodies) {
+            const uint32_t body = GetBodyIndex(old.entity);
+            if (body == INVALID_BODY) {
+                supportsChanged |= old.type != BodyType::Dynamic;
+                continue;
+            }
+            carriedBody[body] = 1;
+
+            // The transform may hold an interpolated position (see Interpolate); bodies moved by gameplay
+            // since the last write start from the new transform instead. Velocity needs no carrying:
+            // PhysicsComponent mirrors it every step (see WriteComponents)
+            const Vector2D& current = registry.GetComponent<Transform2D>(old.entity)->position;
+            if (m_type[body] != BodyType::Static && old.type != BodyType::Static &&
+                current.x == old.written.x && current.y == old.written.y) {
+                m_position[body] = old.position;
+                m_previousPosition[body] = old.previous;
+                m_written[body] = old.written;
+                m_tree.MoveProxy(m_proxy[body], ComputeBounds(body), Vector2D(0.0f, 0.0f));
+            }
+
+            m_force[body] = old.force;
+            m_restSteps[body] = old.restSteps;
+
+            // Static and kinematic bodies that moved, changed or went away may have held sleepers up
+            if (old.type != BodyType::Dynamic) {
+                supportsChanged |= m_type[body] != old.type || m_position[body].x != old.position.x ||
+                                   m_position[body].y != old.position.y ||
+                                   ShapeKey(m_shapes[m_shapeIndex[body]]) != old.shapeKey;
+            }
+        }
+
+        // Bodies are in entity order before and after, so remapped pairs keep a < b and their sort order
+        for (const CarriedState::Impulse& old : carried.impulses) {
+            const uint32_t a = GetBodyIndex(old.a);
+            const uint32_t b = GetBodyIndex(old.b);
+            if (a == INVALID_BODY || b == INVALID_BODY) continue;
+            m_impulseCache.push_back(old.impulse);
+            m_impulseCache.back().a = a;
+            m_impulseCache.back().b = b;
+        }
+        for (const CarriedState::Impulse& old : carried.tileImpulses) {
+            const uint32_t body = GetBodyIndex(old.a);
+            if (body == INVALID_BODY) continue;
+            m_tileImpulseCache.push_back(old.impulse);
+            m_tileImpulseCache.back().a = body;
+        }
+
+        // Sleeping rings go back to sleep whole, as long as every member is still the same dynamic body
+        if (m_settings.allowSleep && !supportsChanged) {
+            std::vector<std::pair<uint32_t, uint32_t>> sleepers;   // (ring, new body)
+            for (const CarriedState::Body& old : carried.bodies) {
+                if (old.sleepGroup == INVALID_BODY) continue;
+                const uint32_t body = GetBodyIndex(old.entity);
+                const bool same = body != INVALID_BODY && m_type[body] == BodyType::Dynamic &&
+                                  ShapeKey(m_shapes[m_shapeIndex[body]]) == old.shapeKey;
+                sleepers.emplace_back(old.sleepGroup, same ? body : INVALID_BODY);
+            }
+            std::sort(sleepers.begin(), sleepers.end());
+
+            for (size_t begin = 0; begin < sleepers.size();) {
+                size_t end = begin;
+                bool intact = true;
+                while (end < sleepers.size() && sleepers[end].first == sleepers[begin].first) {
+                    intact &= sleepers[end].second != INVALID_BODY;
+                    ++end;
+                }
+                if (intact) {
+                    for (size_t k = begin; k < end; ++k) {
+                        const uint32_t body = sleepers[k].second;
+                        m_sleepNext[body] = sleepers[k + 1 < end ? k + 1 : begin].second;
+                        m_awake[body] = 0;
+                    }
+                    m_sleepingCount += end - begin;
+                }
+                begin = end;
+            }
+        }
+
+        // New static or kinematic bodies wake whatever sleeps inside them
+        for (uint32_t i = 0; i < m_position.size() && m_sleepingCount > 0; ++i) {
+            if (!carriedBody[i] && m_type[i] != BodyType::Dynamic) WakeTouching(i);
+        }
+    }
+
+    void PhysicsWorld::ReadComponents(Registry& registry) {
+        for (uint32_t i = 0; i < m_entity.size(); ++i) {
+            const EntityID entity = m_entity[i];
+            Transform2D* transform = registry.GetComponent<Transform2D>(entity);
+            PhysicsComponent* physics = registry.GetComponent<PhysicsComponent>(entity);
+            if (!transform || !physics) {
+                // Removed without a version bump (stale storage); start over
+                Rebuild(registry);
+                return;
+            }
+
+            // Moved by gameplay or the editor since the last step: teleport the body
+            if (transform->position.x != m_written[i].x || transform->position.y != m_written[i].y) {
+                TeleportBody(i, transform->position);
+                m_written[i] = transform->position;
+            }
+
+            // A velocity set on a sleeping body wakes it at the start of the step
+            if (m_type[i] != BodyType::Static) {
+                m_velocity[i] = physics->velocity;
+            }
+        }
+    }
+
+    void PhysicsWorld::WriteComponents(Registry& registry) {
+        for (uint32_t i = 0; i < m_entity.size(); ++i) {
+            if (m_type[i] == BodyType::Static) continue;
+
+            Transform2D* transform = registry.GetComponent<Transform2D>(m_entity[i]);
+            PhysicsComponent* physics = registry.GetComponent<PhysicsComponent>(m_entity[i]);
+            if (!transform || !physics) continue;
+
+            if (m_syncTransform[i]) {
+                transform->position = m_position[i];
+            }
+            m_written[i] = transform->position;
+            physics->velocity = m_velocity[i];
+        }
+    }
+
+    void PhysicsWorld::Interpolate(Registry& registry, float alpha) {
+        // Bodies are stale until the next Step rebuilds them
+        if (&registry != m_syncedRegistry || registry.GetVersion() != m_syncedVersion) return;
+
+        alpha = std::clamp(alpha, 0.0f, 1.0f);
+        for (uint32_t i = 0; i < m_entity.size(); ++i) {
+            if (m_type[i] == BodyType::Static || !m_syncTransform[i]) continue;
+
+            Transform2D* transform = registry.GetComponent<Transform2D>(m_entity[i]);
+            if (!transform) continue;
+
+            // Moved by gameplay or the editor since the last write: leave it for ReadComponents to teleport
+            if (transform->position.x != m_written[i].x || transform->position.y != m_written[i].y) continue;
+
+            const Vector2D& previous = m_previousPosition[i];
+            const Vector2D& current = m_position[i];
+            transform->position = Vector2D(previous.x + (current.x - previous.x) * alpha,
+                                           previous.y + (current.y - previous.y) * alpha);
+            m_written[i] = transform->position;
+        }
+    }
+
+    // ============================================================================
+    // BODIES
+    // ============================================================================
+
+    uint32_t PhysicsWorld::CreateBody(const BodyDesc& desc, const Vector2D& position, const Vector2D& scale, EntityID entity) {
+        const uint32_t body = static_cast<uint32_t>(m_position.size());
+        const bool dynamic = desc.bodyType == BodyType::Dynamic;
+
+        m_entity.push_back(entity);
+        m_type.push_back(desc.bodyType);
+        m_position.push_back(position);
+        m_previousPosition.push_back(position);
+        m_velocity.push_back(desc.bodyType == BodyType::Static ? Vector2D(0.0f, 0.0f) : desc.velocity);
+        m_force.push_back(Vector2D(0.0f, 0.0f));
+        m_inverseMass.push_back(dynamic && desc.mass > 0.0f ? 1.0f / desc.mass : 0.0f);
+        m_restitution.push_back(desc.restitution);
+        m_friction.push_back(std::max(desc.friction, 0.0f));
+        m_damping.push_back(std::max(desc.linearDamping, 0.0f));
+        m_gravityScale.push_back(desc.gravityScale);
+        m_shapeIndex.push_back(AddShape(desc, scale));
+        m_written.push_back(position);
+        m_syncTransform.push_back(desc.syncTransform ? 1 : 0);
+        m_continuous.push_back(dynamic && desc.continuous ? 1 : 0);
+        if (m_continuous.back()) m_continuousBodies.push_back(body);
+        m_awake.push_back(1);
+        m_restSteps.push_back(0);
+        m_sleepNext.push_back(body);
+        m_proxy.push_back(m_tree.CreateProxy(ComputeBounds(body), body));
+
+        if (entity != INVALID_ENTITY) {
+            if (entity >= m_bodyOfEntity.size()) {
+                m_bodyOfEntity.resize(static_cast<size_t>(entity) + 1, INVALID_BODY);
+            }
+            m_bodyOfEntity[entity] = body;
+        }
+        return body;
+    }
+
+    void PhysicsWorld::Clear() {
+        m_entity.clear();
+        m_type.clear();
+        m_position.clear();
+        m_previousPosition.clear();
+        m_velocity.clear();
+        m_force.clear();
+        m_inverseMass.clear();
+        m_restitution.clear();
+        m_friction.clear();
+        m_damping.clear();
+        m_gravityScale.clear();
+        m_shapeIndex.clear();
+        m_proxy.clear();
+        m_written.clear();
+        m_syncTransform.clear();
+        m_continuous.clear();
+        m_continuousBodies.clear();
+        m_awake.clear();
+        m_restSteps.clear();
+        m_sleepNext.clear();
+        m_sleepingCount = 0;
+        m_shapes.clear();
+        m_shapeLookup.clear();
+        m_bodyOfEntity.clear();
+        m_tree.Clear();
+        m_pairs.clear();
+        m_contacts.clear();
+        m_tileContacts.clear();
+        m_impulseCache.clear();
+        m_tileImpulseCache.clear();
+        m_syncedRegistry = nullptr;
+        m_syncedVersion = 0;
+    }
+
+    uint64_t PhysicsWorld::ComputeStateHash() const {
+        // FNV-1a over 32-bit words: any change in any bit of the state changes the hash
+        uint64_t hash = 14695981039346656037ull;
+        auto mix = [&hash](uint32_t word) {
+            hash ^= word;
+            hash *= 1099511628211ull;
+        };
+
+        mix(static_cast<uint32_t>(m_position.size()));
+        for (size_t i = 0; i < m_position.size(); ++i) {
+            mix(FloatBits(m_position[i].x));
+            mix(FloatBits(m_position[i].y));
+            mix(FloatBits(m_velocity[i].x));
+            mix(FloatBits(m_velocity[i].y));
+        }
+        return hash;
+    }
+
+    uint32_t PhysicsWorld::GetBodyIndex(EntityID entity) const {
+        return entity < m_bodyOfEntity.size() ? m_bodyOfEntity[entity] : INVALID_BODY;
+    }
+
+    void PhysicsWorld::ApplyForce(EntityID entity, const Vector2D& force) {
+        const uint32_t body = GetBodyIndex(entity);
+        if (body != INVALID_BODY) {
+            m_force[body] += force;
+        }
+    }
+
+    PhysicsWorld::Shape PhysicsWorld::MakeShape(const BodyDesc& desc, const Vector2D& scale) {
+        Shape shape;
+        shape.type = desc.shape;
+        if (desc.shape == ColliderShape::Circle) {
+            shape.radius = std::fabs(desc.radius) * std::max(std::fabs(scale.x), std::fabs(scale.y));
+        }
+        else {
+            // Negative scale (mirrored sprite) gives the same box
+            shape.halfExtents = Vector2D(std::fabs(desc.size.x * scale.x) * 0.5f, std::fabs(desc.size.y * scale.y) * 0.5f);
+        }
+        return shape;
+    }
+
+    uint64_t PhysicsWorld::ShapeKey(const Shape& shape) {
+        if (shape.type == ColliderShape::Circle) {
+            return (uint64_t(1) << 63) | FloatBits(shape.radius);
+        }
+        return (static_cast<uint64_t>(FloatBits(shape.halfExtents.x)) << 32) | FloatBits(shape.halfExtents.y);
+    }
+
+    uint32_t PhysicsWorld::AddShape(const BodyDesc& desc, const Vector2D& scale) {
+        const Shape shape = MakeShape(desc, scale);
+        const uint64_t key = ShapeKey(shape);
+
+        // Most scenes reuse a handful of sizes; bodies share one entry per size
+        auto it = m_shapeLookup.find(key);
+        if (it != m_shapeLookup.end()) return it->second;
+
+        const uint32_t index = static_cast<uint32_t>(m_shapes.size());
+        m_shapes.push_back(shape);
+        m_shapeLookup.emplace(key, index);
+        return index;
+    }
+
+    AABB PhysicsWorld::ComputeBounds(uint32_t body, const Vector2D& position) const {
+        const Shape& shape = m_shapes[m_shapeIndex[body]];
+        if (shape.type == ColliderShape::Circle) {
+            return AABB(position.x - shape.radius, position.y - shape.radius, shape.radius * 2.0f, shape.radius * 2.0f);
+        }
+        return AABB(position.x - shape.halfExtents.x, position.y - shape.halfExtents.y,
+                    shape.halfExtents.x * 2.0f, shape.halfExtents.y * 2.0f);
+    }
+
+    // ============================================================================
+    // SIMULATION
+    // ============================================================================
+
+    void PhysicsWorld::Simulate(float deltaTime) {
+        const int substeps = std::max(m_settings.substeps, 1);
+        const float substepTime = deltaTime / static_cast<float>(substeps);
+
+        m_previousPosition = m_position;
+        if (m_sleepingCount > 0) WakeDisturbed();
+        m_sleepTiles = m_tiles;
+        m_sleepTileVersion = m_tiles ? m_tiles->GetVersion() : 0;
+
+        m_stats.substeps = substeps;
+        m_stats.bodies = m_position.size();
+        m_stats.continuousBodies = m_continuousBodies.size();
+        m_stats.ccdHits = 0;
+        m_stats.integrateMs = m_stats.ccdMs = m_stats.broadphaseMs = m_stats.narrowphaseMs = m_stats.solveMs = 0.0;
+
+        for (int substep = 0; substep < substeps; ++substep) {
+            auto start = Clock::now();
+            Integrate(substepTime);
+            m_stats.integrateMs += MillisecondsSince(start);
+
+            if (!m_continuousBodies.empty()) {
+                start = Clock::now();
+                SweepContinuous(substepTime);
+                m_stats.ccdMs += MillisecondsSince(start);
+            }
+
+            start = Clock::now();
+            UpdateBroadphase(substepTime);
+            m_stats.broadphaseMs += MillisecondsSince(start);
+
+            start = Clock::now();
+            FindContacts();
+            m_stats.narrowphaseMs += MillisecondsSince(start);
+
+            start = Clock::now();
+            SolveContacts();
+            m_stats.solveMs += MillisecondsSince(start);
+        }
+
+        UpdateSleep();
+
+        m_stats.pairs = m_pairs.size();
+        m_stats.contacts = m_contacts.size();
+        m_stats.tileContacts = m_tileContacts.size();
+        m_stats.stateHash = ComputeStateHash();
+        m_stats.totalMs = m_stats.integrateMs + m_stats.ccdMs + m_stats.broadphaseMs + m_stats.narrowphaseMs + m_stats.solveMs;
+    }
+
+    void PhysicsWorld::Integrate(float deltaTime) {
+        const float gravityX = m_settings.gravity.x;
+        const float gravityY = m_settings.gravity.y;
+        const float maxSpeedSq = m_settings.maxSpeed * m_settings.maxSpeed;
+        size_t dynamicBodies = 0;
+
+        // Semi-implicit Euler: velocity first, then position with the new velocity
+        const size_t count = m_position.size();
+        for (size_t i = 0; i < count; ++i) {
+            if (m_type[i] == BodyType::Static) continue;
+
+            Vector2D& velocity = m_velocity[i];
+            if (m_type[i] == BodyType::Dynamic) {
+                ++dynamicBodies;
+                if (!m_awake[i]) continue;
+
+                const float inverseMass = m_inverseMass[i];
+                velocity.x += (gravityX * m_gravityScale[i] + m_force[i].x * inverseMass) * deltaTime;
+                velocity.y += (gravityY * m_gravityScale[i] + m_force[i].y * inverseMass) * deltaTime;
+
+                const float damping = 1.0f / (1.0f + deltaTime * m_damping[i]);
+                velocity.x *= damping;
+                velocity.y *= damping;
+
+                const float speedSq = velocity.x * velocity.x + velocity.y * velocity.y;
+                if (speedSq > maxSpeedSq) {
+                    const float scale = m_settings.maxSpeed / std::sqrt(speedSq);
+                    velocity.x *= scale;
+                    velocity.y *= scale;
+                }
+                m_force[i] = Vector2D(0.0f, 0.0f);
+
+                if (m_continuous[i]) continue;      // Moved by SweepContinuous
+            }
+
+            m_position[i].x += velocity.x * deltaTime;
+            m_position[i].y += velocity.y * deltaTime;
+        }
+
+        m_stats.dynamicBodies = dynamicBodies;
+    }
+
+    void PhysicsWorld::SweepContinuous(float deltaTime) {
+        const float skin = std::max(m_settings.ccdSkin, 0.0f);
+
+        for (uint32_t body : m_continuousBodies) {
+            if (!m_awake[body]) continue;
+
+            Vector2D& position = m_position[body];
+            Vector2D& velocity = m_velocity[body];
+            Vector2D remaining = velocity * deltaTime;
+
+            for (int iteration = 0; iteration < m_settings.ccdIterations; ++iteration) {
+                const float distance = remaining.length();
+                if (distance <= skin) {
+                    position += remaining;
+                    remaining = Vector2D(0.0f, 0.0f);
+                    break;
+                }
+
+                // Candidates from the tree: everything the body's bounds pass over this step
+                const AABB from = ComputeBounds(body, position);
+                const AABB to = ComputeBounds(body, position + remaining);
+                const float minX = std::min(from.x, to.x);
+                const float minY = std::min(from.y, to.y);
+                const AABB swept(minX, minY, std::max(from.x + from.width, to.x + to.width) - minX,
+                                 std::max(from.y + from.height, to.y + to.height) - minY);
+
+                float firstTime = 2.0f;
+                uint32_t firstTarget = INVALID_BODY;
+                Vector2D firstNormal;
+                bool hit = false;
+                m_tree.Query(swept, [&](int proxy) {
+                    const uint32_t target = m_tree.GetUserData(proxy);
+                    if (m_type[target] == BodyType::Dynamic) return false;   // Dynamic pairs stay discrete
+
+                    Vector2D normal;
+                    const float time = Sweep(body, position, remaining, target, normal);
+                    // Ties go to the lower index so the result does not depend on tree layout
+                    if (time >= 0.0f && (time < firstTime || (time == firstTime && target < firstTarget))) {
+                        firstTime = time;
+                        firstTarget = target;
+                        firstNormal = normal;
+                        hit = true;
+                    }
+                    return false;
+                });
+
+                if (m_tiles) {
+                    const Shape& shape = m_shapes[m_shapeIndex[body]];
+                    Vector2D normal;
+                    const float time = shape.type == ColliderShape::Circle
+                        ? m_tiles->SweepCircle(Circle(position, shape.radius), remaining, normal)
+                        : m_tiles->SweepAABB(from, remaining, normal);
+                    if (time >= 0.0f && time < firstTime) {
+                        firstTime = time;
+                        firstTarget = INVALID_BODY;     // Tiles have no material: the body's own restitution applies
+                        firstNormal = normal;
+                        hit = true;
+                    }
+                }
+
+                if (!hit) {
+                    position += remaining;
+                    remaining = Vector2D(0.0f, 0.0f);
+                    break;
+                }
+                ++m_stats.ccdHits;
+
+                // Conservative advance: stop a skin short of the surface, never past it
+                const float safeTime = std::max(firstTime - skin / distance, 0.0f);
+                position += remaining * safeTime;
+
+                // Respond like a contact (bounce on real impacts), then slide the rest of the way
+                const float speedInto = velocity.dot(firstNormal);
+                if (speedInto < 0.0f) {
+                    const float targetRestitution = firstTarget != INVALID_BODY ? m_restitution[firstTarget] : m_restitution[body];
+                    const float restitution = speedInto < -m_settings.restitutionThreshold
+                        ? std::min(m_restitution[body], targetRestitution) : 0.0f;
+                    velocity -= firstNormal * (speedInto * (1.0f + restitution));
+                }
+                remaining = remaining * (1.0f - safeTime);
+                const float into = remaining.dot(firstNormal);
+                if (into < 0.0f) remaining -= firstNormal * into;
+            }
+            // Out of iterations: the rest of the move is dropped rather than risk passing through
+        }
+    }
+
+    float PhysicsWorld::Sweep(uint32_t body, const Vector2D& position, const Vector2D& motion, uint32_t target, Vector2D& normal) const {
+        const Shape& shape = m_shapes[m_shapeIndex[body]];
+        const Shape& targetShape = m_shapes[m_shapeIndex[target]];
+
+        if (shape.type == ColliderShape::Circle) {
+            const Circle moving(position, shape.radius);
+            return targetShape.type == ColliderShape::Circle
+                ? CollisionDetection::SweepCirclevsCircle(moving, motion, Circle(m_position[target], targetShape.radius), normal)
+                : CollisionDetection::SweepCirclevsAABB(moving, motion, ComputeBounds(target), normal);
+        }
+
+        const AABB moving = ComputeBounds(body, position);
+        return targetShape.type == ColliderShape::Circle
+            ? CollisionDetection::SweepAABBvsCircle(moving, motion, Circle(m_position[target], targetShape.radius), normal)
+            : CollisionDetection::SweepAABBvsAABB(moving, motion, ComputeBounds(target), normal);
+    }
+
+    void PhysicsWorld::UpdateBroadphase(float deltaTime) {
+        const uint32_t count = static_cast<uint32_t>(m_position.size());
+
+        // Moving bodies only; the tree reinserts them once they leave their fat box
+        for (uint32_t i = 0; i < count; ++i) {
+            if (m_type[i] == BodyType::Static || !m_awake[i]) continue;
+            m_tree.MoveProxy(m_proxy[i], ComputeBounds(i), m_velocity[i] * deltaTime);
+        }
+
+        // Sleeping islands touched by an awake dynamic body or a moving kinematic one wake up first
+        if (m_sleepingCount > 0) {
+            for (uint32_t i = 0; i < count; ++i) {
+                const bool pushes = m_type[i] == BodyType::Dynamic ? m_awake[i] != 0
+                    : m_type[i] == BodyType::Kinematic && (m_velocity[i].x != 0.0f || m_velocity[i].y != 0.0f);
+                if (pushes) WakeTouching(i);
+            }
+        }
+
+        // Pairs come from awake dynamic bodies; static/kinematic pairs never respond
+        m_pairs.clear();
+        for (uint32_t i = 0; i < count; ++i) {
+            if (m_type[i] != BodyType::Dynamic || !m_awake[i]) continue;
+            m_tree.Query(ComputeBounds(i), [&](int proxy) {
+                const uint32_t other = m_tree.GetUserData(proxy);
+                if (other == i) return false;
+                if (m_type[other] == BodyType::Dynamic && m_awake[other] && other < i) return false;   // Reported from the other side
+                m_pairs.push_back({ std::min(i, other), std::max(i, other) });
+                return false;
+            });
+        }
+
+        // Fixed order so the solver result does not depend on tree layout
+        std::sort(m_pairs.begin(), m_pairs.end(), [](const Pair& left, const Pair& right) {
+            return left.a != right.a ? left.a < right.a : left.b < right.b;
+        });
+    }
+
+    bool PhysicsWorld::Collide(uint32_t a, uint32_t b, CollisionManifold& manifold) const {
+        const Shape& shapeA = m_shapes[m_shapeIndex[a]];
+        const Shape& shapeB = m_shapes[m_shapeIndex[b]];
+        const bool circleA = shapeA.type == ColliderShape::Circle;
+        const bool circleB = shapeB.type == ColliderShape::Circle;
+
+        if (circleA && circleB) {
+            manifold = CollisionDetection::CheckCirclevsCircle(Circle(m_position[a], shapeA.radius), Circle(m_position[b], shapeB.radius));
+        }
+        else if (circleA) {
+            // Returned normal points from the box to the circle: flip to a -> b
+            manifold = CollisionDetection::CheckCirclevsAABB(Circle(m_position[a], shapeA.radius), ComputeBounds(b));
+            manifold.normal = manifold.normal * -1.0f;
+        }
+        else if (circleB) {
+            manifold = CollisionDetection::CheckCirclevsAABB(Circle(m_position[b], shapeB.radius), ComputeBounds(a));
+        }
+        else {
+            manifold = CollisionDetection::CheckAABBvsAABB(ComputeBounds(a), ComputeBounds(b));
+        }
+        return manifold.hasCollision;
+    }
+
+    void PhysicsWorld::FindContacts() {
+        m_contacts.clear();
+
+        // Warm start from last step's impulses when the contact is still there and faces the same way
+        const bool warmStart = m_settings.warmStarting;
+        auto recall = [](const CachedImpulse& cached, const Vector2D& normal, float& normalImpulse, float& tangentImpulse) {
+            if (cached.normal.x * normal.x + cached.normal.y * normal.y < 0.9f) return;
+            normalImpulse = cached.normalImpulse;
+            tangentImpulse = cached.tangentImpulse;
+        };
+
+        // Contacts come out in pair order, like the cache, so one cursor finds every match
+        size_t cached = 0;
+        CollisionManifold manifold;
+        for (const Pair& pair : m_pairs) {
+            if (!Collide(pair.a, pair.b, manifold)) continue;
+
+            const float inverseMassSum = m_inverseMass[pair.a] + m_inverseMass[pair.b];
+            if (inverseMassSum <= 0.0f) continue;
+
+            Contact contact;
+            contact.a = pair.a;
+            contact.b = pair.b;
+            contact.normal = manifold.normal;
+            contact.penetration = manifold.penetration;
+            contact.normalMass = 1.0f / inverseMassSum;
+            contact.friction = std::sqrt(m_friction[pair.a] * m_friction[pair.b]);
+            contact.normalImpulse = 0.0f;
+            contact.tangentImpulse = 0.0f;
+
+            // Bounce only on real impacts so resting contacts settle
+            const Vector2D& velocityA = m_velocity[pair.a];
+            const Vector2D& velocityB = m_velocity[pair.b];
+            const float approachSpeed = (velocityB.x - velocityA.x) * contact.normal.x + (velocityB.y - velocityA.y) * contact.normal.y;
+            const float restitution = std::min(m_restitution[pair.a], m_restitution[pair.b]);
+            contact.velocityBias = approachSpeed < -m_settings.restitutionThreshold ? -restitution * approachSpeed : 0.0f;
+
+            if (warmStart) {
+                while (cached < m_impulseCache.size() && (m_impulseCache[cached].a < pair.a ||
+                       (m_impulseCache[cached].a == pair.a && m_impulseCache[cached].b < pair.b))) {
+                    ++cached;
+                }
+                if (cached < m_impulseCache.size() && m_impulseCache[cached].a == pair.a && m_impulseCache[cached].b == pair.b) {
+                    recall(m_impulseCache[cached], contact.normal, contact.normalImpulse, contact.tangentImpulse);
+                }
+            }
+
+            m_contacts.push_back(contact);
+        }
+
+        m_tileContacts.clear();
+        if (!m_tiles) return;
+
+        size_t tileCached = 0;
+
+        const uint32_t count = static_cast<uint32_t>(m_position.size());
+        for (uint32_t i = 0; i < count; ++i) {
+            if (m_type[i] != BodyType::Dynamic || m_inverseMass[i] <= 0.0f || !m_awake[i]) continue;
+
+            const Shape& shape = m_shapes[m_shapeIndex[i]];
+            const AABB bounds = ComputeBounds(i);
+            while (tileCached < m_tileImpulseCache.size() && m_tileImpulseCache[tileCached].a < i) ++tileCached;
+
+            m_tiles->Query(bounds, [&](uint32_t tileIndex, const AABB& tile) {
+                if (shape.type == ColliderShape::Circle) {
+                    // Normal already points from the tile to the circle
+                    manifold = CollisionDetection::CheckCirclevsAABB(Circle(m_position[i], shape.radius), tile);
+                }
+                else {
+                    manifold = CollisionDetection::CheckAABBvsAABB(bounds, tile);
+                    manifold.normal = manifold.normal * -1.0f;
+                }
+                if (!manifold.hasCollision) return false;
+
+                TileContact contact;
+                contact.body = i;
+                contact.tile = tileIndex;
+                contact.normal = manifold.normal;
+                contact.penetration = manifold.penetration;
+                contact.friction = m_friction[i];
+                contact.normalImpulse = 0.0f;
+                contact.tangentImpulse = 0.0f;
+
+                const float approachSpeed = m_velocity[i].x * contact.normal.x + m_velocity[i].y * contact.normal.y;
+                contact.velocityBias = approachSpeed < -m_settings.restitutionThreshold ? -m_restitution[i] * approachSpeed : 0.0f;
+
+                if (warmStart) {
+                    for (size_t c = tileCached; c < m_tileImpulseCache.size() && m_tileImpulseCache[c].a == i; ++c) {
+                        if (m_tileImpulseCache[c].b == tileIndex) {
+                            recall(m_tileImpulseCache[c], contact.normal, contact.normalImpulse, contact.tangentImpulse);
+                            break;
+                        }
+                    }
+                }
+
+                m_tileContacts.push_back(contact);
+                return false;
+            });
+        }
+    }
+
+    void PhysicsWorld::SolveContacts() {
+        BuildIslands();
+
+        const int threads = m_settings.solverThreads > 0 ? m_settings.solverThreads : WorkerPool::GetHardwareThreads();
+        if (threads > 1) {
+            if (!m_workers) m_workers = std::make_unique<WorkerPool>(threads);
+            else m_workers->SetThreadCount(threads);
+        }
+        m_stats.solverThreads = threads;
+
+        auto parallelFor = [&](size_t count, size_t grain, auto&& fn) {
+            if (threads > 1) m_workers->ParallelFor(count, grain, fn);
+            else fn(size_t(0), count);
+        };
+
+        // Islands share no dynamic body: each one runs the whole solver loop on one thread
+        parallelFor(m_islands.size(), 8, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                if (m_islands[i].colorCount == 0) SolveIsland(m_islands[i]);
+            }
+        });
+
+        // Large islands: contacts of one color share no dynamic body, so a color runs in parallel
+        for (uint32_t index : m_coloredIslands) {
+            const Island& island = m_islands[index];
+            if (m_settings.warmStarting) {
+                for (uint32_t k = island.constraints.begin; k < island.constraints.end; ++k) {
+                    WarmStart(m_solverOrder[k]);
+                }
+            }
+
+            for (int iteration = 0; iteration < m_settings.velocityIterations; ++iteration) {
+                for (uint32_t color = 0; color < island.colorCount; ++color) {
+                    const Batch& batch = m_colorBatches[island.firstColor + color];
+                    const size_t size = batch.end - batch.begin;
+                    // Contacts past the last color share bodies: that batch stays on one thread
+                    const size_t grain = (island.overflow && color + 1 == island.colorCount) ? size : 64;
+                    parallelFor(size, grain, [&](size_t begin, size_t end) {
+                        for (size_t k = begin; k < end; ++k) {
+                            SolveConstraint(m_solverOrder[batch.begin + k]);
+                        }
+                    });
+                }
+            }
+        }
+
+        // Positional correction, split by inverse mass
+        for (const Contact& contact : m_contacts) {
+            const float correction = std::max(contact.penetration - m_settings.penetrationSlop, 0.0f)
+                * m_settings.correctionPercent * contact.normalMass;
+            if (correction <= 0.0f) continue;
+
+            const float inverseMassA = m_inverseMass[contact.a];
+            const float inverseMassB = m_inverseMass[contact.b];
+            m_position[contact.a].x -= contact.normal.x * correction * inverseMassA;
+            m_position[contact.a].y -= contact.normal.y * correction * inverseMassA;
+            m_position[contact.b].x += contact.normal.x * correction * inverseMassB;
+            m_position[contact.b].y += contact.normal.y * correction * inverseMassB;
+        }
+
+        for (const TileContact& contact : m_tileContacts) {
+            const float correction = std::max(contact.penetration - m_settings.penetrationSlop, 0.0f) * m_settings.correctionPercent;
+            m_position[contact.body].x += contact.normal.x * correction;
+            m_position[contact.body].y += contact.normal.y * correction;
+        }
+
+        CacheImpulses();
+    }
+
+    // ============================================================================
+    // SLEEPING
+    // ============================================================================
+
+    void PhysicsWorld::UpdateSleep() {
+        const size_t dynamicBodies = m_stats.dynamicBodies;
+        if (m_settings.allowSleep) {
+            const float sleepSpeedSq = m_settings.sleepSpeed * m_settings.sleepSpeed;
+            const uint32_t sleepSteps = static_cast<uint32_t>(std::max(m_settings.sleepSteps, 1));
+            const uint32_t count = static_cast<uint32_t>(m_position.size());
+
+            // An island rests as long as its least rested body (islands from the last solve)
+            m_restOfRoot.assign(count, 0xFFFFFFFFu);
+            for (uint32_t i = 0; i < count; ++i) {
+                if (m_type[i] != BodyType::Dynamic || !m_awake[i]) continue;
+
+                const Vector2D& velocity = m_velocity[i];
+                const bool resting = velocity.x * velocity.x + velocity.y * velocity.y < sleepSpeedSq;
+                m_restSteps[i] = resting ? std::min(m_restSteps[i] + 1, sleepSteps) : 0;
+
+                uint32_t& rest = m_restOfRoot[FindIslandRoot(i)];
+                rest = std::min(rest, m_restSteps[i]);
+            }
+
+            // The root is the island's lowest body index, so it starts the ring before any other member joins
+            for (uint32_t i = 0; i < count; ++i) {
+                if (m_type[i] != BodyType::Dynamic || !m_awake[i]) continue;
+
+                const uint32_t root = FindIslandRoot(i);
+                if (m_restOfRoot[root] < sleepSteps) continue;
+
+                if (i != root) {
+                    m_sleepNext[i] = m_sleepNext[root];
+                    m_sleepNext[root] = i;
+                }
+                m_awake[i] = 0;
+                m_velocity[i] = Vector2D(0.0f, 0.0f);
+                ++m_sleepingCount;
+            }
+        }
+        else if (m_sleepingCount > 0) {
+            WakeAll();
+        }
+
+        m_stats.sleepingBodies = m_sleepingCount;
+        m_stats.awakeBodies = dynamicBodies - std::min(dynamicBodies, m_sleepingCount);
+        m_stats.wokenBodies = m_wokenCount;
+        m_wokenCount = 0;
+    }
+
+    void PhysicsWorld::WakeDisturbed() {
+        // The ground changed under the sleepers (or sleeping was switched off): wake everything
+        if (!m_settings.allowSleep || m_tiles != m_sleepTiles || (m_tiles && m_tiles->GetVersion() != m_sleepTileVersion)) {
+            WakeAll();
+            return;
+        }
+
+        // Sleeping bodies have no velocity or force of their own; any now is gameplay's
+        for (uint32_t i = 0; i < m_awake.size(); ++i) {
+            if (m_awake[i] || m_type[i] != BodyType::Dynamic) continue;
+            if (m_velocity[i].x != 0.0f || m_velocity[i].y != 0.0f || m_force[i].x != 0.0f || m_force[i].y != 0.0f) {
+                WakeBody(i);
+            }
+        }
+    }
+
+    void PhysicsWorld::WakeBody(uint32_t body) {
+        if (m_type[body] != BodyType::Dynamic || m_awake[body]) return;
+
+        uint32_t member = body;
+        do {
+            const uint32_t next = m_sleepNext[member];
+            m_awake[member] = 1;
+            m_restSteps[member] = 0;
+            m_sleepNext[member] = member;
+            --m_sleepingCount;
+            ++m_wokenCount;
+            member = next;
+        } while (member != body);
+    }
+
+    void PhysicsWorld::WakeAll() {
+        for (uint32_t i = 0; i < m_awake.size(); ++i) {
+            WakeBody(i);
+        }
+    }
+
+    void PhysicsWorld::WakeTouching(uint32_t body) {
+        CollisionManifold manifold;
+        m_tree.Query(ComputeBounds(body), [&](int proxy) {
+            const uint32_t other = m_tree.GetUserData(proxy);
+            if (other != body && m_type[other] == BodyType::Dynamic && !m_awake[other] && Collide(body, other, manifold)) {
+                WakeBody(other);
+            }
+            return false;
+        });
+    }
+
+    void PhysicsWorld::TeleportBody(uint32_t body, const Vector2D& position) {
+        // Whatever rested on a moved static or kinematic body may have to fall
+        const bool support = m_type[body] != BodyType::Dynamic;
+        if (support && m_sleepingCount > 0) WakeTouching(body);
+
+        m_position[body] = position;
+        m_previousPosition[body] = position;
+        m_tree.MoveProxy(m_proxy[body], ComputeBounds(body), Vector2D(0.0f, 0.0f));
+
+        WakeBody(body);
+        if (support && m_sleepingCount > 0) WakeTouching(body);
+    }
+
+    uint32_t PhysicsWorld::FindIslandRoot(uint32_t body) {
+        while (m_islandParent[body] != body) {
+            m_islandParent[body] = m_islandParent[m_islandParent[body]];   // Path halving
+            body = m_islandParent[body];
+        }
+        return body;
+    }
+
+    void PhysicsWorld::BuildIslands() {
+        const uint32_t bodyCount = static_cast<uint32_t>(m_position.size());
+        const uint32_t bodyConstraints = static_cast<uint32_t>(m_contacts.size());
+        const uint32_t constraintCount = bodyConstraints + static_cast<uint32_t>(m_tileContacts.size());
+
+        // Contacts between two dynamic bodies join their islands; static and kinematic bodies never do
+        m_islandParent.resize(bodyCount);
+        for (uint32_t i = 0; i < bodyCount; ++i) m_islandParent[i] = i;
+        for (const Contact& contact : m_contacts) {
+            if (m_inverseMass[contact.a] <= 0.0f || m_inverseMass[contact.b] <= 0.0f) continue;
+            const uint32_t rootA = FindIslandRoot(contact.a);
+            const uint32_t rootB = FindIslandRoot(contact.b);
+            if (rootA != rootB) m_islandParent[std::max(rootA, rootB)] = std::min(rootA, rootB);
+        }
+
+        // Islands numbered by their first contact, contacts kept in their original order inside each
+        m_islands.clear();
+        m_islandOfRoot.assign(bodyCount, INVALID_BODY);
+        m_constraintIsland.resize(constraintCount);
+        for (uint32_t c = 0; c < constraintCount; ++c) {
+            uint32_t body;
+            if (c < bodyConstraints) {
+                const Contact& contact = m_contacts[c];
+                body = m_inverseMass[contact.a] > 0.0f ? contact.a : contact.b;
+            }
+            else {
+                body = m_tileContacts[c - bodyConstraints].body;
+            }
+
+            const uint32_t root = FindIslandRoot(body);
+            if (m_islandOfRoot[root] == INVALID_BODY) {
+                m_islandOfRoot[root] = static_cast<uint32_t>(m_islands.size());
+                m_islands.emplace_back();
+            }
+            m_constraintIsland[c] = m_islandOfRoot[root];
+            ++m_islands[m_islandOfRoot[root]].constraints.end;     // Count for now
+        }
+
+        uint32_t offset = 0;
+        for (Island& island : m_islands) {
+            const uint32_t count = island.constraints.end;
+            island.constraints = { offset, offset };
+            offset += count;
+        }
+        m_solverOrder.resize(constraintCount);
+        for (uint32_t c = 0; c < constraintCount; ++c) {
+            m_solverOrder[m_islands[m_constraintIsland[c]].constraints.end++] = c;
+        }
+
+        m_coloredIslands.clear();
+        m_colorBatches.clear();
+        m_stats.islands = m_islands.size();
+        m_stats.largestIsland = 0;
+        m_stats.colors = 0;
+        const uint32_t threshold = static_cast<uint32_t>(std::max(m_settings.colorThreshold, 1));
+        for (uint32_t i = 0; i < m_islands.size(); ++i) {
+            Island& island = m_islands[i];
+            const uint32_t size = island.constraints.end - island.constraints.begin;
+            m_stats.largestIsland = std::max<size_t>(m_stats.largestIsland, size);
+            if (size > threshold) {
+                ColorIsland(island);
+                m_coloredIslands.push_back(i);
+                m_stats.colors = std::max<size_t>(m_stats.colors, island.colorCount);
+            }
+        }
+    }
+
+    void PhysicsWorld::ColorIsland(Island& island) {
+        constexpr uint32_t MAX_COLORS = 64;     // One bit each in m_bodyColors
+        const uint32_t bodyConstraints = static_cast<uint32_t>(m_contacts.size());
+        const uint32_t begin = island.constraints.begin;
+        const uint32_t count = island.constraints.end - begin;
+
+        if (m_bodyColors.size() != m_position.size()) m_bodyColors.assign(m_position.size(), 0);
+
+        auto dynamicBodies = [&](uint32_t constraint, uint32_t& a, uint32_t& b) {
+            if (constraint < bodyConstraints) {
+                const Contact& contact = m_contacts[constraint];
+                a = m_inverseMass[contact.a] > 0.0f ? contact.a : INVALID_BODY;
+                b = m_inverseMass[contact.b] > 0.0f ? contact.b : INVALID_BODY;
+            }
+            else {
+                a = m_tileContacts[constraint - bodyConstraints].body;
+                b = INVALID_BODY;
+            }
+        };
+
+        // Greedy: each contact takes the lowest color not yet used by one of its dynamic bodies
+        uint32_t colorCounts[MAX_COLORS + 1] = {};
+        m_colorScratch.resize(count);
+        uint32_t a, b;
+        for (uint32_t k = 0; k < count; ++k) {
+            dynamicBodies(m_solverOrder[begin + k], a, b);
+            const uint64_t used = (a != INVALID_BODY ? m_bodyColors[a] : 0) | (b != INVALID_BODY ? m_bodyColors[b] : 0);
+            const uint32_t color = used == ~uint64_t(0) ? MAX_COLORS : static_cast<uint32_t>(std::countr_zero(~used));
+            if (color < MAX_COLORS) {
+                if (a != INVALID_BODY) m_bodyColors[a] |= uint64_t(1) << color;
+                if (b != INVALID_BODY) m_bodyColors[b] |= uint64_t(1) << color;
+            }
+            m_colorScratch[k] = color;
+            ++colorCounts[color];
+        }
+
+        // Group by color, keeping the contact order inside each color
+        std::vector<uint32_t> ordered(count);
+        uint32_t offsets[MAX_COLORS + 1];
+        uint32_t running = 0;
+        island.firstColor = static_cast<uint32_t>(m_colorBatches.size());
+        island.colorCount = 0;
+        for (uint32_t color = 0; color <= MAX_COLORS; ++color) {
+            offsets[color] = running;
+            if (colorCounts[color] > 0) {
+                m_colorBatches.push_back({ begin + running, begin + running + colorCounts[color] });
+                ++island.colorCount;
+            }
+            running += colorCounts[color];
+        }
+        island.overflow = colorCounts[MAX_COLORS] > 0;
+        for (uint32_t k = 0; k < count; ++k) {
+            ordered[offsets[m_colorScratch[k]]++] = m_solverOrder[begin + k];
+        }
+        std::copy(ordered.begin(), ordered.end(), m_solverOrder.begin() + begin);
+
+        // Leave the masks clean for the next island
+        for (uint32_t k = 0; k < count; ++k) {
+            dynamicBodies(m_solverOrder[begin + k], a, b);
+            if (a != INVALID_BODY) m_bodyColors[a] = 0;
+            if (b != INVALID_BODY) m_bodyColors[b] = 0;
+        }
+    }
+
+    void PhysicsWorld::SolveIsland(const Island& island) {
+        if (m_settings.warmStarting) {
+            for (uint32_t k = island.constraints.begin; k < island.constraints.end; ++k) {
+                WarmStart(m_solverOrder[k]);
+            }
+        }
+
+        // Sequential impulses with accumulated clamping
+        for (int iteration = 0; iteration < m_settings.velocityIterations; ++iteration) {
+            for (uint32_t k = island.constraints.begin; k < island.constraints.end; ++k) {
+                SolveConstraint(m_solverOrder[k]);
+            }
+        }
+    }
+
+    void PhysicsWorld::WarmStart(uint32_t constraint) {
+        if (constraint < m_contacts.size()) {
+            const Contact& contact = m_contacts[constraint];
+            const float impulseX = contact.normal.x * contact.normalImpulse - contact.normal.y * contact.tangentImpulse;
+            const float impulseY = contact.normal.y * contact.normalImpulse + contact.normal.x * contact.tangentImpulse;
+            const float inverseMassA = m_inverseMass[contact.a];
+            const float inverseMassB = m_inverseMass[contact.b];
+            if (inverseMassA > 0.0f) {
+                m_velocity[contact.a].x -= impulseX * inverseMassA;
+                m_velocity[contact.a].y -= impulseY * inverseMassA;
+            }
+            if (inverseMassB > 0.0f) {
+                m_velocity[contact.b].x += impulseX * inverseMassB;
+                m_velocity[contact.b].y += impulseY * inverseMassB;
+            }
+            return;
+        }
+
+        const TileContact& contact = m_tileContacts[constraint - m_contacts.size()];
+        m_velocity[contact.body].x += contact.normal.x * contact.normalImpulse - contact.normal.y * contact.tangentImpulse;
+        m_velocity[contact.body].y += contact.normal.y * contact.normalImpulse + contact.normal.x * contact.tangentImpulse;
+    }
+
+    void PhysicsWorld::SolveConstraint(uint32_t constraint) {
+        if (constraint < m_contacts.size()) {
+            Contact& contact = m_contacts[constraint];
+            Vector2D& velocityA = m_velocity[contact.a];
+            Vector2D& velocityB = m_velocity[contact.b];
+            const float inverseMassA = m_inverseMass[contact.a];
+            const float inverseMassB = m_inverseMass[contact.b];
+            const float nx = contact.normal.x;
+            const float ny = contact.normal.y;
+
+            // Normal: push apart until the bodies separate (or bounce)
+            float relativeX = velocityB.x - velocityA.x;
+            float relativeY = velocityB.y - velocityA.y;
+            const float normalSpeed = relativeX * nx + relativeY * ny;
+            float impulse = contact.normalMass * (contact.velocityBias - normalSpeed);
+            const float oldNormal = contact.normalImpulse;
+            contact.normalImpulse = std::max(oldNormal + impulse, 0.0f);
+            impulse = contact.normalImpulse - oldNormal;
+
+            // Static and kinematic bodies are shared between islands: never written
+            if (inverseMassA > 0.0f) {
+                velocityA.x -= nx * impulse * inverseMassA;
+                velocityA.y -= ny * impulse * inverseMassA;
+            }
+            if (inverseMassB > 0.0f) {
+                velocityB.x += nx * impulse * inverseMassB;
+                velocityB.y += ny * impulse * inverseMassB;
+            }
+
+            // Friction along the tangent, bounded by the normal impulse
+            const float tx = -ny;
+            const float ty = nx;
+            relativeX = velocityB.x - velocityA.x;
+            relativeY = velocityB.y - velocityA.y;
+            const float tangentSpeed = relativeX * tx + relativeY * ty;
+            const float maxFriction = contact.friction * contact.normalImpulse;
+            const float oldTangent = contact.tangentImpulse;
+            contact.tangentImpulse = std::clamp(oldTangent - contact.normalMass * tangentSpeed, -maxFriction, maxFriction);
+            impulse = contact.tangentImpulse - oldTangent;
+
+            if (inverseMassA > 0.0f) {
+                velocityA.x -= tx * impulse * inverseMassA;
+                velocityA.y -= ty * impulse * inverseMassA;
+            }
+            if (inverseMassB > 0.0f) {
+                velocityB.x += tx * impulse * inverseMassB;
+                velocityB.y += ty * impulse * inverseMassB;
+            }
+            return;
+        }
+
+        // Tiles do not move, so impulses here are plain velocity changes on the body
+        TileContact& contact = m_tileContacts[constraint - m_contacts.size()];
+        Vector2D& velocity = m_velocity[contact.body];
+        const float nx = contact.normal.x;
+        const float ny = contact.normal.y;
+
+        const float normalSpeed = velocity.x * nx + velocity.y * ny;
+        const float oldNormal = contact.normalImpulse;
+        contact.normalImpulse = std::max(oldNormal + contact.velocityBias - normalSpeed, 0.0f);
+        float impulse = contact.normalImpulse - oldNormal;
+        velocity.x += nx * impulse;
+        velocity.y += ny * impulse;
+
+        const float tx = -ny;
+        const float ty = nx;
+        const float tangentSpeed = velocity.x * tx + velocity.y * ty;
+        const float maxFriction = contact.friction * contact.normalImpulse;
+        const float oldTangent = contact.tangentImpulse;
+        contact.tangentImpulse = std::clamp(oldTangent - tangentSpeed, -maxFriction, maxFriction);
+        impulse = contact.tangentImpulse - oldTangent;
+        velocity.x += tx * impulse;
+        velocity.y += ty * impulse;
+    }
+
+    void PhysicsWorld::CacheImpulses() {
+        m_impulseCache.clear();
+        m_tileImpulseCache.clear();
+        if (!m_settings.warmStarting) return;
+
+        m_impulseCache.reserve(m_contacts.size());
+        for (const Contact& contact : m_contacts) {
+            m_impulseCache.push_back({ contact.a, contact.b, contact.normal, contact.normalImpulse, contact.tangentImpulse });
+        }
+        m_tileImpulseCache.reserve(m_tileContacts.size());
+        for (const TileContact& contact : m_tileContacts) {
+            m_tileImpulseCache.push_back({ contact.body, contact.tile, contact.normal, contact.normalImpulse, contact.tangentImpulse });
+        }
+    }
+
+    // ============================================================================
+    // BENCHMARK
+    // ============================================================================
+
+    PhysicsWorld::BenchmarkResult PhysicsWorld::RunBenchmark(size_t bodyCount, int steps) {
+        BenchmarkResult result;
+        result.bodies = bodyCount;
+        result.steps = std::max(steps, 1);
+        const float deltaTime = 1.0f / 60.0f;
+
+        // Same scene for both: mixed boxes and circles, roughly 10% of the area covered
+        struct Spawn {
+            Vector2D position;
+            Vector2D velocity;
+            bool circle;
+            float size;
+        };
+        std::mt19937 rng(1234);
+        const float side = std::sqrt(static_cast<float>(bodyCount) * 24.0f * 24.0f * 10.0f);
+        std::uniform_real_distribution<float> coordinate(0.0f, side);
+        std::uniform_real_distribution<float> speed(-80.0f, 80.0f);
+        std::uniform_real_distribution<float> size(12.0f, 36.0f);
+        std::vector<Spawn> spawns(bodyCount);
+        for (size_t i = 0; i < bodyCount; ++i) {
+            spawns[i] = { Vector2D(coordinate(rng), coordinate(rng)), Vector2D(speed(rng), speed(rng)), (i % 2) == 1, size(rng) };
+        }
+
+        // Old path: one PhysicsBody object per body, every pair tested
+        {
+            std::vector<PhysicsBody> bodies;
+            bodies.reserve(bodyCount);
+            for (const Spawn& spawn : spawns) {
+                bodies.emplace_back(spawn.position.x, spawn.position.y, spawn.size, spawn.size);
+                PhysicsBody& body = bodies.back();
+                if (spawn.circle) body.InitAsCircle(spawn.size * 0.5f);
+                body.velocity = spawn.velocity;
+                body.friction = 1.0f;
+                body.maxSpeed = 4000.0f;
+            }
+
+            const auto start = Clock::now();
+            for (int step = 0; step < result.steps; ++step) {
+                for (PhysicsBody& body : bodies) {
+                    body.Update(deltaTime);
+                }
+                for (size_t i = 0; i < bodies.size(); ++i) {
+                    for (size_t j = i + 1; j < bodies.size(); ++j) {
+                        CollisionSystem::ResolveBodyCollision(bodies[i], bodies[j]);
+                    }
+                }
+            }
+            result.legacyMsPerStep = MillisecondsSince(start) / result.steps;
+        }
+
+        // SoA world
+        {
+            PhysicsWorld world;
+            for (const Spawn& spawn : spawns) {
+                PhysicsComponent desc = spawn.circle ? PhysicsComponent(BodyType::Dynamic, spawn.size * 0.5f)
+                                                     : PhysicsComponent(BodyType::Dynamic, Vector2D(spawn.size, spawn.size));
+                desc.velocity = spawn.velocity;
+                desc.restitution = 0.3f;
+                world.CreateBody(desc, spawn.position);
+            }
+
+            const auto start = Clock::now();
+            for (int step = 0; step < result.steps; ++step) {
+                world.Simulate(deltaTime);
+                result.integrateMs += world.m_stats.integrateMs;
+                result.broadphaseMs += world.m_stats.broadphaseMs;
+                result.narrowphaseMs += world.m_stats.narrowphaseMs;
+                result.solveMs += world.m_stats.solveMs;
+            }
+            result.worldMsPerStep = MillisecondsSince(start) / result.steps;
+            result.integrateMs /= result.steps;
+            result.broadphaseMs /= result.steps;
+            result.narrowphaseMs /= result.steps;
+            result.solveMs /= result.steps;
+            result.contacts = world.m_contacts.size();
+
+            if (!world.m_tree.Validate()) {
+                std::cerr << "PhysicsWorld: benchmark tree failed validation" << std::endl;
+            }
+        }
+
+        return result;
+    }
+
+    PhysicsWorld::CCDBenchmarkResult PhysicsWorld::RunCCDBenchmark(size_t projectileCount, float stepRate) {
+        CCDBenchmarkResult result;
+        result.projectiles = projectileCount;
+        result.stepRate = stepRate > 0.0f ? stepRate : 15.0f;
+        const float deltaTime = 1.0f / result.stepRate;
+        result.steps = static_cast<int>(std::ceil(result.stepRate));   // One second
+
+        // Projectiles 8 units across at 3000 units/s against an 8 unit thick wall at x = 0
+        const float wallThickness = 8.0f;
+        const float lane = 12.0f;
+        const float wallHeight = static_cast<float>(projectileCount) * lane + 64.0f;
+        std::mt19937 rng(99);
+        std::uniform_real_distribution<float> startX(-600.0f, -300.0f);
+        std::vector<float> starts(projectileCount);
+        for (float& start : starts) start = startX(rng);
+
+        for (int pass = 0; pass < 2; ++pass) {
+            const bool continuous = pass == 1;
+            PhysicsWorld world;
+            world.CreateBody(PhysicsComponent(BodyType::Static, Vector2D(wallThickness, wallHeight)),
+                             Vector2D(wallThickness * 0.5f, wallHeight * 0.5f - 32.0f));
+
+            for (size_t i = 0; i < projectileCount; ++i) {
+                PhysicsComponent desc = (i % 2) == 1 ? PhysicsComponent(BodyType::Dynamic, 4.0f)
+                                                     : PhysicsComponent(BodyType::Dynamic, Vector2D(8.0f, 8.0f));
+                desc.velocity = Vector2D(3000.0f, 0.0f);
+                desc.continuous = continuous;
+                world.CreateBody(desc, Vector2D(starts[i], static_cast<float>(i) * lane));
+            }
+
+            size_t ccdHits = 0;
+            const auto start = Clock::now();
+            for (int step = 0; step < result.steps; ++step) {
+                world.Simulate(deltaTime);
+                ccdHits += world.m_stats.ccdHits;
+            }
+            const double msPerStep = MillisecondsSince(start) / result.steps;
+
+            size_t tunnelled = 0;
+            for (uint32_t body = 1; body < world.GetBodyCount(); ++body) {
+                if (world.m_position[body].x > wallThickness) ++tunnelled;
+            }
+
+            if (continuous) {
+                result.tunnelledContinuous = tunnelled;
+                result.continuousMsPerStep = msPerStep;
+                result.ccdHits = ccdHits;
+            }
+            else {
+                result.tunnelledDiscrete = tunnelled;
+                result.discreteMsPerStep = msPerStep;
+            }
+        }
+
+        return result;
+    }
+
+    void PhysicsWorld::BuildPileScene(PhysicsWorld& world, size_t bodyCount, bool looseBodies) {
+        // Bins 8 boxes wide; with loose bodies, a quarter of them drift above the bins without gravity
+        const size_t stacked = looseBodies ? bodyCount * 3 / 4 : bodyCount;
+        const size_t perBin = 8 * 24;
+        const size_t bins = std::max<size_t>((stacked + perBin - 1) / perBin, 1);
+        const float box = 16.0f;
+        const float binWidth = box * 8.0f + 2.0f;
+        const float binHeight = box * 24.0f;
+
+        world.GetSettings().gravity = Vector2D(0.0f, 980.0f);
+        for (size_t bin = 0; bin < bins; ++bin) {
+            const float left = static_cast<float>(bin) * (binWidth + 40.0f);
+            world.CreateBody(PhysicsComponent(BodyType::Static, Vector2D(binWidth + 16.0f, 8.0f)),
+                             Vector2D(left + binWidth * 0.5f, binHeight + 4.0f));
+            world.CreateBody(PhysicsComponent(BodyType::Static, Vector2D(8.0f, binHeight)),
+                             Vector2D(left - 4.0f, binHeight * 0.5f));
+            world.CreateBody(PhysicsComponent(BodyType::Static, Vector2D(8.0f, binHeight)),
+                             Vector2D(left + binWidth + 4.0f, binHeight * 0.5f));
+        }
+
+        for (size_t i = 0; i < stacked; ++i) {
+            const size_t bin = i / perBin;
+            const size_t slot = i % perBin;
+            const float left = static_cast<float>(bin) * (binWidth + 40.0f);
+            const Vector2D position(left + 1.0f + box * (static_cast<float>(slot % 8) + 0.5f),
+                                    binHeight - box * (static_cast<float>(slot / 8) + 0.5f));
+            world.CreateBody(PhysicsComponent(BodyType::Dynamic, Vector2D(box, box)), position);
+        }
+
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> spread(0.0f, static_cast<float>(bins) * (binWidth + 40.0f));
+        std::uniform_real_distribution<float> speed(-200.0f, 200.0f);
+        for (size_t i = stacked; i < bodyCount; ++i) {
+            PhysicsComponent desc(BodyType::Dynamic, 6.0f);
+            desc.gravityScale = 0.0f;
+            desc.velocity = Vector2D(speed(rng), speed(rng));
+            world.CreateBody(desc, Vector2D(spread(rng), -200.0f - spread(rng) * 0.25f));
+        }
+    }
+
+    PhysicsWorld::SleepBenchmarkResult PhysicsWorld::RunSleepBenchmark(size_t bodyCount, int steps) {
+        SleepBenchmarkResult result;
+        result.bodies = bodyCount;
+        result.settleSteps = 600;
+        result.steps = std::max(steps, 1);
+        const float deltaTime = 1.0f / 60.0f;
+
+        for (int pass = 0; pass < 2; ++pass) {
+            const bool sleep = pass == 1;
+            PhysicsWorld world;
+            BuildPileScene(world, bodyCount, false);
+            world.GetSettings().allowSleep = sleep;
+
+            for (int step = 0; step < result.settleSteps; ++step) {
+                world.Simulate(deltaTime);
+            }
+
+            const auto start = Clock::now();
+            for (int step = 0; step < result.steps; ++step) {
+                world.Simulate(deltaTime);
+            }
+            const double msPerStep = MillisecondsSince(start) / result.steps;
+
+            if (!sleep) {
+                result.awakeMsPerStep = msPerStep;
+                continue;
+            }
+            result.sleepingMsPerStep = msPerStep;
+            result.sleepingBodies = world.m_stats.sleepingBodies;
+
+            // Drop a heavy box into the first bin: only that pile's island should wake
+            PhysicsComponent drop(BodyType::Dynamic, Vector2D(24.0f, 24.0f));
+            drop.mass = 20.0f;
+            drop.velocity = Vector2D(0.0f, 600.0f);
+            world.CreateBody(drop, Vector2D(60.0f, -40.0f));
+            for (int step = 0; step < 60; ++step) {
+                world.Simulate(deltaTime);
+                result.wokenByImpact += world.m_stats.wokenBodies;
+            }
+        }
+
+        return result;
+    }
+
+    PhysicsWorld::SolverBenchmarkResult PhysicsWorld::RunSolverBenchmark(size_t bodyCount, int steps) {
+        SolverBenchmarkResult result;
+        result.bodies = bodyCount;
+        result.steps = std::max(steps, 1);
+        const float deltaTime = 1.0f / 60.0f;
+
+        // Measure the solver itself: keep the piles awake
+        auto build = [&](PhysicsWorld& world) {
+            BuildPileScene(world, bodyCount, true);
+            world.GetSettings().allowSleep = false;
+        };
+
+        // Scaling: same scene, same steps, different thread counts
+        const int hardware = WorkerPool::GetHardwareThreads();
+        std::vector<Vector2D> reference;
+        const int candidates[SolverBenchmarkResult::MAX_RUNS] = { 1, 2, 4, 8 };
+        for (int threads : candidates) {
+            // Always compare at least two thread counts, even on one core
+            if (result.runs >= 2 && threads > hardware) break;
+
+            PhysicsWorld world;
+            build(world);
+            world.GetSettings().solverThreads = threads;
+
+            double solveMs = 0.0;
+            for (int step = 0; step < result.steps; ++step) {
+                world.Simulate(deltaTime);
+                solveMs += world.m_stats.solveMs;
+            }
+
+            result.threads[result.runs] = threads;
+            result.solveMs[result.runs] = solveMs / result.steps;
+            ++result.runs;
+
+            if (reference.empty()) {
+                reference = world.m_position;
+                result.contacts = world.m_contacts.size() + world.m_tileContacts.size();
+                result.islands = world.m_stats.islands;
+                result.largestIsland = world.m_stats.largestIsland;
+                result.colors = world.m_stats.colors;
+            }
+            else if (std::memcmp(reference.data(), world.m_position.data(), reference.size() * sizeof(Vector2D)) != 0) {
+                result.deterministic = false;
+            }
+        }
+
+        // Resting depth of the piles with and without warm starting
+        for (int pass = 0; pass < 2; ++pass) {
+            PhysicsWorld world;
+            build(world);
+            world.GetSettings().warmStarting = pass == 0;
+            for (int step = 0; step < result.steps; ++step) {
+                world.Simulate(deltaTime);
+            }
+
+            float depth = 0.0f;
+            for (const Contact& contact : world.m_contacts) depth += contact.penetration;
+            const float mean = world.m_contacts.empty() ? 0.0f : depth / static_cast<float>(world.m_contacts.size());
+            (pass == 0 ? result.warmPenetration : result.coldPenetration) = mean;
+        }
+
+        return result;
+    }
+
+} // namespace GP2Engine
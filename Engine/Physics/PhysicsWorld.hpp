@@ -0,0 +1,454 @@
+/**
+ * @file PhysicsWorld.hpp
+ * @author Fauzan (100%)
+ * @brief ECS-driven rigid body world with structure-of-arrays body storage
+ *
+ * Steps every entity that has a PhysicsComponent and a Transform2D:
+ * integrate, continuous collision for fast bodies, broadphase
+ * (DynamicAABBTree), narrowphase (CollisionDetection) and a sequential
+ * impulse contact solver, then writes positions and velocities back to the
+ * components.
+ *
+ * Bodies flagged continuous (projectiles) are swept from their old to their
+ * new position against static and kinematic bodies found in the tree. They
+ * stop just short of the first surface hit and slide along it for the rest
+ * of the step, so they cannot pass through thin walls at low frame rates.
+ *
+ * The solver splits contacts into islands (groups of dynamic bodies that
+ * touch through contacts). Islands are independent, so they are solved in
+ * parallel on a WorkerPool, each with the whole sequential impulse loop.
+ * Islands too large for one thread (piles, swarms) are graph colored: no two
+ * contacts of one color share a dynamic body, so each color is solved in
+ * parallel too. Islands and colors depend only on the contacts, never on the
+ * thread count, so every thread count gives bit-identical results.
+ * Accumulated impulses are kept between steps to warm-start the solver.
+ *
+ * Dynamic bodies that stay slower than sleepSpeed for sleepSteps steps, with
+ * every body of their island doing the same, fall asleep as one island:
+ * they are skipped by integration, the broadphase and the narrowphase until
+ * an awake body touches one of them, gameplay moves them or sets their
+ * velocity, or a force is applied, which wakes the whole island again.
+ *
+ * Steps are deterministic for a given input stream (bodies, settings, tile
+ * layer and what gameplay writes between steps); StepStats::stateHash
+ * fingerprints every step, and a PhysicsRecorder can capture the inputs for
+ * headless replay (PhysicsReplay.hpp).
+ *
+ * An optional TileCollisionLayer (from TileMap) acts as extra static
+ * geometry: dynamic bodies collide with its merged rectangles, found by
+ * grid lookup rather than through the tree.
+ *
+ * Body state lives in parallel arrays (position, velocity, inverse mass,
+ * shape index, ...) so each stage is one linear pass over tightly packed
+ * floats instead of a walk over scattered PhysicsBody objects. Shapes are
+ * shared through a small table indexed by shapeIndex.
+ */
+
+#pragma once
+
+#include "PhysicsSystem.hpp"
+#include "AABBTree.hpp"
+#include "TileCollision.hpp"
+#include "../ECS/Component.hpp"
+#include "../Core/FixedTimestep.hpp"
+#include "../Core/WorkerPool.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace GP2Engine {
+
+    class Registry;
+    class PhysicsRecorder;
+    class PhysicsReplay;
+
+    // ============================================================================
+    // PHYSICS WORLD
+    // ============================================================================
+
+    class PhysicsWorld {
+    public:
+        static constexpr uint32_t INVALID_BODY = 0xFFFFFFFFu;
+
+        struct Settings {
+            Vector2D gravity{0.0f, 0.0f};   // Top-down game: no gravity by default
+            int substeps = 1;               // Simulation passes per Step (each dt / substeps)
+            int velocityIterations = 8;     // Solver passes over the contacts
+            float correctionPercent = 0.4f; // Share of penetration removed per step
+            float penetrationSlop = 0.5f;   // Penetration allowed without correction (world units)
+            float restitutionThreshold = 20.0f; // Slower impacts do not bounce
+            float maxSpeed = 4000.0f;       // Velocity clamp (world units per second)
+            int ccdIterations = 4;          // Surfaces a continuous body can hit per substep
+            float ccdSkin = 0.05f;          // Gap left in front of a swept hit (world units)
+            int solverThreads = 1;          // Threads for the contact solver (0 = hardware threads)
+            int colorThreshold = 256;       // Islands with more contacts are graph colored
+            bool warmStarting = true;       // Start each contact from last step's impulses
+            bool allowSleep = true;         // Put resting islands to sleep
+            float sleepSpeed = 5.0f;        // Bodies slower than this count as resting (world units per second)
+            int sleepSteps = 30;            // Steps an island must rest before it sleeps
+        };
+
+        // Time spent in each stage of the last step
+        struct StepStats {
+            int substeps = 0;
+            size_t bodies = 0;
+            size_t dynamicBodies = 0;
+            size_t awakeBodies = 0;         // Dynamic bodies simulated this step
+            size_t sleepingBodies = 0;
+            size_t wokenBodies = 0;         // Woken during the step
+            size_t pairs = 0;               // Broadphase pairs
+            size_t contacts = 0;            // Touching pairs
+            size_t tileContacts = 0;        // Bodies touching tile rectangles
+            size_t islands = 0;
+            size_t largestIsland = 0;       // Contacts in the biggest island
+            size_t colors = 0;              // Most colors used by one colored island
+            int solverThreads = 1;
+            uint64_t stateHash = 0;         // ComputeStateHash after the step
+            size_t continuousBodies = 0;
+            size_t ccdHits = 0;             // Swept hits (summed over the substeps)
+            double syncMs = 0.0;            // Components -> arrays and arrays -> components
+            double integrateMs = 0.0;       // Stage times are summed over the substeps
+            double ccdMs = 0.0;
+            double broadphaseMs = 0.0;
+            double narrowphaseMs = 0.0;
+            double solveMs = 0.0;
+            double totalMs = 0.0;
+        };
+
+        // Body description used by CreateBody (same fields as PhysicsComponent)
+        using BodyDesc = PhysicsComponent;
+
+        struct BenchmarkResult {
+            size_t bodies = 0;
+            int steps = 0;
+            double legacyMsPerStep = 0.0;   // PhysicsBody objects, all-pairs ResolveBodyCollision
+            double worldMsPerStep = 0.0;    // SoA world, tree broadphase
+            double integrateMs = 0.0;       // Per step, SoA world
+            double broadphaseMs = 0.0;
+            double narrowphaseMs = 0.0;
+            double solveMs = 0.0;
+            size_t contacts = 0;            // Contacts in the last SoA step
+        };
+
+        struct SolverBenchmarkResult {
+            static constexpr int MAX_RUNS = 4;
+
+            size_t bodies = 0;
+            size_t contacts = 0;            // Body and tile contacts in the last step
+            size_t islands = 0;
+            size_t largestIsland = 0;
+            size_t colors = 0;
+            int steps = 0;
+            int runs = 0;
+            int threads[MAX_RUNS] = {};
+            double solveMs[MAX_RUNS] = {};  // Per step
+            bool deterministic = true;      // Same final state for every thread count
+            float warmPenetration = 0.0f;   // Mean contact depth after settling, warm started
+            float coldPenetration = 0.0f;   // Same without warm starting
+        };
+
+        struct SleepBenchmarkResult {
+            size_t bodies = 0;
+            int settleSteps = 0;            // Steps run before timing
+            int steps = 0;                  // Timed steps
+            size_t sleepingBodies = 0;      // After settling, sleep on
+            double awakeMsPerStep = 0.0;    // Settled scene, sleep off
+            double sleepingMsPerStep = 0.0; // Settled scene, sleep on
+            size_t wokenByImpact = 0;       // Bodies woken by one box dropped on a sleeping pile
+        };
+
+        struct CCDBenchmarkResult {
+            size_t projectiles = 0;
+            float stepRate = 0.0f;          // Steps per second
+            int steps = 0;
+            size_t tunnelledDiscrete = 0;   // Projectiles that ended up behind the wall
+            size_t tunnelledContinuous = 0;
+            double discreteMsPerStep = 0.0;
+            double continuousMsPerStep = 0.0;
+            size_t ccdHits = 0;
+        };
+
+        PhysicsWorld();
+        ~PhysicsWorld();
+
+        PhysicsWorld(const PhysicsWorld&) = delete;
+        PhysicsWorld& operator=(const PhysicsWorld&) = delete;
+
+        /**
+         * Step every entity with PhysicsComponent and Transform2D by dt.
+         * Bodies are rebuilt from the components when the registry version
+         * changes and the set of physics entities or any body description
+         * changed with it; otherwise only velocity and moved transforms are
+         * read. A rebuild keeps positions, forces, warm-start impulses and
+         * sleeping islands of the bodies that remain.
+         */
+        void Step(Registry& registry, float deltaTime);
+
+        /**
+         * Run the fixed steps due for this frame, then interpolate Transform2D
+         * by the leftover time. Returns the number of steps run.
+         */
+        int Update(Registry& registry, FixedTimestep& timestep, float frameDelta);
+
+        /**
+         * Write positions blended between the state before and after the last
+         * step to Transform2D (alpha 0 = previous, 1 = current). Used with a
+         * fixed timestep so rendering stays smooth between steps; the
+         * simulation itself keeps the unblended state. Transforms moved by
+         * gameplay since the last write are left alone so the next Step
+         * still sees the move.
+         */
+        void Interpolate(Registry& registry, float alpha);
+
+        // Step the bodies without touching any registry (bodies from CreateBody)
+        void Simulate(float deltaTime);
+
+        // Add a body directly; entity is only used for lookups (returns the body index)
+        uint32_t CreateBody(const BodyDesc& desc, const Vector2D& position, const Vector2D& scale = Vector2D(1.0f, 1.0f),
+                            EntityID entity = INVALID_ENTITY);
+
+        void Clear();
+
+        // Static tile geometry collided with dynamic bodies (nullptr for none); not owned
+        void SetTileCollision(const TileCollisionLayer* tiles) { m_tiles = tiles; }
+        const TileCollisionLayer* GetTileCollision() const { return m_tiles; }
+
+        // Records every Step (nullptr to stop); not owned
+        void SetRecorder(PhysicsRecorder* recorder) { m_recorder = recorder; }
+        PhysicsRecorder* GetRecorder() const { return m_recorder; }
+
+        // Hash of every body's position and velocity bits (equal hashes = same state)
+        uint64_t ComputeStateHash() const;
+
+        // Body index of an entity (INVALID_BODY if it has none)
+        uint32_t GetBodyIndex(EntityID entity) const;
+
+        // Force applied over the next step (kept across rebuilds); set PhysicsComponent velocity for impulses
+        void ApplyForce(EntityID entity, const Vector2D& force);
+
+        // Wake a sleeping body and the island it sleeps with (no effect on awake, static or kinematic bodies)
+        void WakeBody(uint32_t body);
+        bool IsAwake(uint32_t body) const { return m_awake[body] != 0; }
+
+        Settings& GetSettings() { return m_settings; }
+        const Settings& GetSettings() const { return m_settings; }
+        const StepStats& GetStats() const { return m_stats; }
+        const DynamicAABBTree& GetTree() const { return m_tree; }
+
+        size_t GetBodyCount() const { return m_position.size(); }
+        size_t GetShapeCount() const { return m_shapes.size(); }
+        const Vector2D& GetPosition(uint32_t body) const { return m_position[body]; }
+        const Vector2D& GetVelocity(uint32_t body) const { return m_velocity[body]; }
+        AABB GetBodyBounds(uint32_t body) const { return ComputeBounds(body); }
+
+        /**
+         * Compare the old object-per-body approach (PhysicsBody::Update plus
+         * all-pairs CollisionSystem::ResolveBodyCollision) against this world
+         * on the same scene of boxes and circles. Uses no registry.
+         */
+        static BenchmarkResult RunBenchmark(size_t bodyCount, int steps);
+
+        /**
+         * Fire fast projectiles (boxes and circles) at a thin static wall at
+         * stepRate steps per second, once as regular bodies and once flagged
+         * continuous, and count how many end up on the far side.
+         */
+        static CCDBenchmarkResult RunCCDBenchmark(size_t projectileCount, float stepRate);
+
+        /**
+         * Piles of boxes in walled bins under gravity (a few large islands
+         * plus loose bodies), stepped with 1, 2, 4 and 8 solver threads (up
+         * to the hardware count). Reports the solve time per step, whether
+         * the final states match, and the resting depth with and without
+         * warm starting.
+         */
+        static SolverBenchmarkResult RunSolverBenchmark(size_t bodyCount, int steps);
+
+        /**
+         * Piles of boxes settle under gravity, then the settled scene is timed
+         * with sleeping off and on; finally one box is dropped on a sleeping
+         * pile to count the bodies it wakes.
+         */
+        static SleepBenchmarkResult RunSleepBenchmark(size_t bodyCount, int steps);
+
+    private:
+        friend class PhysicsRecorder;
+        friend class PhysicsReplay;
+
+        struct Shape {
+            ColliderShape type = ColliderShape::Box;
+            Vector2D halfExtents;           // Box half size (scaled)
+            float radius = 0.0f;            // Circle radius (scaled)
+        };
+
+        struct Pair {
+            uint32_t a, b;
+        };
+
+        struct Contact {
+            uint32_t a, b;
+            Vector2D normal;                // From a to b
+            float penetration;
+            float normalMass;               // 1 / (invMassA + invMassB)
+            float friction;
+            float velocityBias;             // Restitution target speed
+            float normalImpulse;            // Accumulated over the iterations
+            float tangentImpulse;
+        };
+
+        // Last step's impulses, sorted by (a, b) like the contacts (b = tile index for tile contacts)
+        struct CachedImpulse {
+            uint32_t a, b;
+            Vector2D normal;
+            float normalImpulse;
+            float tangentImpulse;
+        };
+
+        // Body state kept across Rebuild, by entity
+        struct CarriedState {
+            struct Body {
+                EntityID entity;
+                BodyType type;
+                Vector2D position;
+                Vector2D previous;
+                Vector2D written;
+                Vector2D force;
+                uint32_t restSteps;
+                uint32_t sleepGroup;        // Shared by one sleeping ring (INVALID_BODY when awake)
+                uint64_t shapeKey;
+            };
+            struct Impulse {
+                EntityID a, b;              // b unused for tile contacts
+                CachedImpulse impulse;
+            };
+            std::vector<Body> bodies;       // In body order
+            std::vector<Impulse> impulses;
+            std::vector<Impulse> tileImpulses;
+        };
+
+        // Range of m_solverOrder
+        struct Batch {
+            uint32_t begin, end;
+        };
+
+        struct Island {
+            Batch constraints;              // Contacts in solve order
+            uint32_t firstColor = 0;        // Color batches (colored islands only)
+            uint32_t colorCount = 0;
+            bool overflow = false;          // Last color batch holds contacts that ran out of colors
+        };
+
+        // Contact with a tile rectangle (only the body moves)
+        struct TileContact {
+            uint32_t body;
+            uint32_t tile;                  // Rectangle index in the layer
+            Vector2D normal;                // From the tile to the body
+            float penetration;
+            float friction;
+            float velocityBias;
+            float normalImpulse;            // Per unit mass (velocity change)
+            float tangentImpulse;
+        };
+
+        Settings m_settings;
+        StepStats m_stats;
+
+        // Body state, one entry per body (structure of arrays)
+        std::vector<EntityID> m_entity;
+        std::vector<BodyType> m_type;
+        std::vector<Vector2D> m_position;
+        std::vector<Vector2D> m_previousPosition;   // Before the last Simulate (interpolation)
+        std::vector<Vector2D> m_velocity;
+        std::vector<Vector2D> m_force;
+        std::vector<float> m_inverseMass;   // 0 for static and kinematic bodies
+        std::vector<float> m_restitution;
+        std::vector<float> m_friction;
+        std::vector<float> m_damping;
+        std::vector<float> m_gravityScale;
+        std::vector<uint32_t> m_shapeIndex;
+        std::vector<int> m_proxy;           // Tree proxy per body
+        std::vector<Vector2D> m_written;    // Position last written to Transform2D (teleport check)
+        std::vector<uint8_t> m_syncTransform;
+        std::vector<uint8_t> m_continuous;  // Moved by SweepContinuous instead of Integrate
+        std::vector<uint32_t> m_continuousBodies;   // Indices of those bodies
+        std::vector<uint8_t> m_awake;       // 0 = sleeping (dynamic bodies only)
+        std::vector<uint32_t> m_restSteps;  // Consecutive steps slower than sleepSpeed
+        std::vector<uint32_t> m_sleepNext;  // Ring of the bodies that fell asleep together
+        std::vector<uint32_t> m_restOfRoot; // Scratch: fewest rest steps in each island
+        size_t m_sleepingCount = 0;
+        size_t m_wokenCount = 0;            // Since the last step's stats
+        const TileCollisionLayer* m_sleepTiles = nullptr;   // Tile layer the sleeping bodies rest on
+        uint64_t m_sleepTileVersion = 0;
+
+        std::vector<Shape> m_shapes;
+        std::unordered_map<uint64_t, uint32_t> m_shapeLookup; // Packed shape -> index in m_shapes
+        std::vector<uint32_t> m_bodyOfEntity;                 // Indexed by entity ID
+
+        DynamicAABBTree m_tree;
+        std::vector<Pair> m_pairs;
+        std::vector<Contact> m_contacts;
+        std::vector<TileContact> m_tileContacts;
+        std::vector<CachedImpulse> m_impulseCache;
+        std::vector<CachedImpulse> m_tileImpulseCache;
+
+        // Solver partition, rebuilt every solve. Constraint IDs: body contacts first, then tile contacts
+        std::vector<uint32_t> m_islandParent;       // Union-find over bodies
+        std::vector<uint32_t> m_islandOfRoot;
+        std::vector<uint32_t> m_constraintIsland;
+        std::vector<uint32_t> m_solverOrder;
+        std::vector<Island> m_islands;              // Solved whole, one per task
+        std::vector<uint32_t> m_coloredIslands;     // Indices of islands solved color by color
+        std::vector<Batch> m_colorBatches;
+        std::vector<uint64_t> m_bodyColors;         // Colors already used around each body
+        std::vector<uint32_t> m_colorScratch;
+        std::unique_ptr<WorkerPool> m_workers;
+        const TileCollisionLayer* m_tiles = nullptr;
+        PhysicsRecorder* m_recorder = nullptr;
+        uint64_t m_rebuildCount = 0;                // Bodies recreated from the registry
+
+        const Registry* m_syncedRegistry = nullptr;
+        uint64_t m_syncedVersion = 0;
+        std::vector<EntityID> m_syncEntities;       // Scratch: entities that should have a body
+
+        void Rebuild(Registry& registry);
+        static void CollectBodyEntities(Registry& registry, std::vector<EntityID>& entities);
+        bool BodiesChanged(Registry& registry);
+        bool MatchesBody(uint32_t body, const BodyDesc& desc, const Vector2D& scale) const;
+        void CaptureState(CarriedState& carried) const;
+        void RestoreState(const CarriedState& carried, Registry& registry);
+        void ReadComponents(Registry& registry);
+        void WriteComponents(Registry& registry);
+
+        void Integrate(float deltaTime);
+        void SweepContinuous(float deltaTime);
+        void UpdateBroadphase(float deltaTime);
+        void FindContacts();
+        void SolveContacts();
+        void UpdateSleep();
+        void WakeDisturbed();
+        void WakeAll();
+        void WakeTouching(uint32_t body);
+        void TeleportBody(uint32_t body, const Vector2D& position);
+        void BuildIslands();
+        void ColorIsland(Island& island);
+        void WarmStart(uint32_t constraint);
+        void SolveConstraint(uint32_t constraint);
+        void SolveIsland(const Island& island);
+        void CacheImpulses();
+        uint32_t FindIslandRoot(uint32_t body);
+
+        // Walled bins of stacked boxes under gravity, optionally with loose circles drifting above
+        static void BuildPileScene(PhysicsWorld& world, size_t bodyCount, bool looseBodies);
+
+        static Shape MakeShape(const BodyDesc& desc, const Vector2D& scale);
+        static uint64_t ShapeKey(const Shape& shape);
+        uint32_t AddShape(const BodyDesc& desc, const Vector2D& scale);
+        AABB ComputeBounds(uint32_t body) const { return ComputeBounds(body, m_position[body]); }
+        AABB ComputeBounds(uint32_t body, const Vector2D& position) const;
+        float Sweep(uint32_t body, const Vector2D& position, const Vector2D& motion, uint32_t target, Vector2D& normal) const;
+        bool Collide(uint32_t a, uint32_t b, CollisionManifold& manifold) const;
+    };
+
+} // namespace GP2Engine
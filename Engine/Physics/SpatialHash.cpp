@@ -0,0 +1,147 @@
+/**
+ * @file SpatialHash.cpp
+ * @author Fauzan (100%)
+ * @brief Uniform grid spatial hash broadphase implementation
+ */
+
+#include "SpatialHash.hpp"
+
+namespace GP2Engine {
+
+    SpatialHash::SpatialHash(float cellSize)
+        : m_cellSize(cellSize > 0.0f ? cellSize : DEFAULT_CELL_SIZE),
+          m_inverseCellSize(1.0f / m_cellSize) {
+    }
+
+    void SpatialHash::SetCellSize(float cellSize) {
+        Clear();
+        m_cellSize = cellSize > 0.0f ? cellSize : DEFAULT_CELL_SIZE;
+        m_inverseCellSize = 1.0f / m_cellSize;
+    }
+
+    void SpatialHash::Insert(uint32_t id, const AABB& bounds) {
+        Update(id, bounds);
+    }
+
+    bool SpatialHash::Update(uint32_t id, const AABB& bounds) {
+        if (id >= m_proxies.size()) {
+            m_proxies.resize(static_cast<size_t>(id) + 1);
+        }
+
+        Proxy& proxy = m_proxies[id];
+        const CellRange range = ComputeCells(bounds);
+        proxy.bounds = bounds;
+
+        if (proxy.active) {
+            if (range == proxy.cells) return false;
+            RemoveFromCells(id, proxy.cells);
+        }
+        else {
+            proxy.active = true;
+            ++m_proxyCount;
+        }
+
+        proxy.cells = range;
+        AddToCells(id, range);
+        return true;
+    }
+
+    void SpatialHash::Remove(uint32_t id) {
+        if (!Contains(id)) return;
+
+        Proxy& proxy = m_proxies[id];
+        RemoveFromCells(id, proxy.cells);
+        proxy.active = false;
+        --m_proxyCount;
+    }
+
+    bool SpatialHash::Contains(uint32_t id) const {
+        return id < m_proxies.size() && m_proxies[id].active;
+    }
+
+    void SpatialHash::Clear() {
+        m_proxies.clear();
+        m_cells.clear();
+        m_oversized.clear();
+        m_proxyCount = 0;
+    }
+
+    const AABB* SpatialHash::GetBounds(uint32_t id) const {
+        return Contains(id) ? &m_proxies[id].bounds : nullptr;
+    }
+
+    int SpatialHash::ToCell(float coordinate) const {
+        // Clamp so far-away (or non-finite) coordinates still map to a valid cell
+        const float cell = std::floor(coordinate * m_inverseCellSize);
+        if (!(cell > -1073741824.0f)) return -1073741824;
+        if (cell > 1073741824.0f) return 1073741824;
+        return static_cast<int>(cell);
+    }
+
+    SpatialHash::CellRange SpatialHash::ComputeCells(const AABB& bounds) const {
+        // Negative sizes (mirrored sprites) still cover [min, max]
+        const float x0 = bounds.width >= 0.0f ? bounds.x : bounds.x + bounds.width;
+        const float y0 = bounds.height >= 0.0f ? bounds.y : bounds.y + bounds.height;
+        const float x1 = x0 + std::fabs(bounds.width);
+        const float y1 = y0 + std::fabs(bounds.height);
+
+        CellRange range;
+        range.minX = ToCell(x0);
+        range.minY = ToCell(y0);
+        range.maxX = ToCell(x1);
+        range.maxY = ToCell(y1);
+        return range;
+    }
+
+    void SpatialHash::AddToCells(uint32_t id, const CellRange& range) {
+        if (range.IsOversized()) {
+            m_oversized.push_back(id);
+            return;
+        }
+
+        for (int cy = range.minY; cy <= range.maxY; ++cy) {
+            for (int cx = range.minX; cx <= range.maxX; ++cx) {
+                m_cells[CellKey(cx, cy)].push_back(id);
+            }
+        }
+    }
+
+    void SpatialHash::RemoveFromCells(uint32_t id, const CellRange& range) {
+        // Swap-and-pop; cells hold only a handful of IDs
+        auto eraseFrom = [id](std::vector<uint32_t>& ids) {
+            for (size_t i = 0; i < ids.size(); ++i) {
+                if (ids[i] == id) {
+                    ids[i] = ids.back();
+                    ids.pop_back();
+                    return;
+                }
+            }
+        };
+
+        if (range.IsOversized()) {
+            eraseFrom(m_oversized);
+            return;
+        }
+
+        for (int cy = range.minY; cy <= range.maxY; ++cy) {
+            for (int cx = range.minX; cx <= range.maxX; ++cx) {
+                auto it = m_cells.find(CellKey(cx, cy));
+                if (it != m_cells.end()) {
+                    eraseFrom(it->second);
+                }
+            }
+        }
+    }
+
+    uint32_t SpatialHash::NextQueryStamp() const {
+        if (++m_queryStamp == 0) {
+            // Stamp wrapped around: forget old visits so none match by accident
+            for (const Proxy& proxy : m_proxies) {
+                proxy.queryStamp = 0;
+            }
+            m_queryStamp = 1;
+        }
+        return m_queryStamp;
+    }
+
+} // namespace GP2Engine
@@ -0,0 +1,133 @@
+/**
+ * @file SpatialHash.hpp
+ * @author Fauzan (100%)
+ * @brief Uniform grid spatial hash broadphase for AABBs
+ *
+ * Buckets AABBs into square cells keyed by their integer cell coordinates so
+ * overlap queries only visit the cells a query box touches instead of every
+ * object. Proxies are re-bucketed only when their cell range changes, so
+ * small per-frame moves cost a bounds copy.
+ */
+
+#pragma once
+
+#include "PhysicsSystem.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace GP2Engine {
+
+    // ============================================================================
+    // SPATIAL HASH (uniform grid broadphase)
+    // ============================================================================
+
+    class SpatialHash {
+    public:
+        static constexpr float DEFAULT_CELL_SIZE = 128.0f;     // About two 64px tiles
+        static constexpr int MAX_CELLS_PER_AXIS = 64;          // Larger proxies go to the oversized list
+
+        explicit SpatialHash(float cellSize = DEFAULT_CELL_SIZE);
+
+        // Change the cell size (removes every proxy)
+        void SetCellSize(float cellSize);
+        float GetCellSize() const { return m_cellSize; }
+
+        // Add a proxy, or move it if the ID is already present
+        void Insert(uint32_t id, const AABB& bounds);
+
+        // Move a proxy; returns true if it changed cells (inserts unknown IDs)
+        bool Update(uint32_t id, const AABB& bounds);
+
+        void Remove(uint32_t id);
+        bool Contains(uint32_t id) const;
+        void Clear();
+
+        // Stored bounds of a proxy (nullptr if not present)
+        const AABB* GetBounds(uint32_t id) const;
+
+        size_t GetProxyCount() const { return m_proxyCount; }
+        size_t GetCellCount() const { return m_cells.size(); }
+
+        /**
+         * Visit every proxy whose bounds intersect the box (AABB::Intersects),
+         * each one once. The callback is called as fn(id, bounds) and returns
+         * true to stop the query early.
+         */
+        template <typename Fn>
+        void Query(const AABB& box, Fn&& fn) const {
+            const uint32_t stamp = NextQueryStamp();
+            const CellRange range = ComputeCells(box);
+
+            // Visit proxies once even when they span several cells
+            auto visit = [&](uint32_t id) {
+                const Proxy& proxy = m_proxies[id];
+                if (proxy.queryStamp == stamp) return false;
+                proxy.queryStamp = stamp;
+                return proxy.bounds.Intersects(box) && fn(id, proxy.bounds);
+            };
+
+            if (range.IsOversized()) {
+                // Huge query box: scanning the proxies is cheaper than the cells
+                for (uint32_t id = 0; id < m_proxies.size(); ++id) {
+                    if (m_proxies[id].active && visit(id)) return;
+                }
+                return;
+            }
+
+            for (int cy = range.minY; cy <= range.maxY; ++cy) {
+                for (int cx = range.minX; cx <= range.maxX; ++cx) {
+                    auto it = m_cells.find(CellKey(cx, cy));
+                    if (it == m_cells.end()) continue;
+                    for (uint32_t id : it->second) {
+                        if (visit(id)) return;
+                    }
+                }
+            }
+
+            for (uint32_t id : m_oversized) {
+                if (visit(id)) return;
+            }
+        }
+
+    private:
+        struct CellRange {
+            int minX = 0, minY = 0, maxX = -1, maxY = -1;
+
+            bool IsOversized() const {
+                return maxX - minX >= MAX_CELLS_PER_AXIS || maxY - minY >= MAX_CELLS_PER_AXIS;
+            }
+            bool operator==(const CellRange& other) const {
+                return minX == other.minX && minY == other.minY && maxX == other.maxX && maxY == other.maxY;
+            }
+            bool operator!=(const CellRange& other) const { return !(*this == other); }
+        };
+
+        struct Proxy {
+            AABB bounds;
+            CellRange cells;
+            bool active = false;
+            mutable uint32_t queryStamp = 0;   // Last query that visited this proxy
+        };
+
+        float m_cellSize;
+        float m_inverseCellSize;
+        std::vector<Proxy> m_proxies;                                   // Indexed by ID
+        std::unordered_map<uint64_t, std::vector<uint32_t>> m_cells;    // Cell key -> proxy IDs (empty cells are kept for reuse)
+        std::vector<uint32_t> m_oversized;                              // Proxies spanning too many cells
+        size_t m_proxyCount = 0;
+        mutable uint32_t m_queryStamp = 0;
+
+        static uint64_t CellKey(int x, int y) {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+        }
+
+        CellRange ComputeCells(const AABB& bounds) const;
+        int ToCell(float coordinate) const;
+        void AddToCells(uint32_t id, const CellRange& range);
+        void RemoveFromCells(uint32_t id, const CellRange& range);
+        uint32_t NextQueryStamp() const;
+    };
+
+} // namespace GP2Engine
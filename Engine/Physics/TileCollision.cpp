@@ -0,0 +1,398 @@
+/**
+ * @file TileCollision.cpp
+ * @author Fauzan (100%)
+ * @brief Static collision layer built from a tile grid
+ */
+
+#include "TileCollision.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+namespace GP2Engine {
+
+    namespace {
+        using Clock = std::chrono::high_resolution_clock;
+
+        double MicrosecondsSince(Clock::time_point start) {
+            return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+        }
+
+        // Floor to a cell index, clamped so huge (or non-finite) coordinates stay in int range
+        int ToCell(float coordinate, float inverseSize) {
+            const float cell = std::floor(coordinate * inverseSize);
+            if (!(cell > -1073741824.0f)) return -1073741824;
+            if (cell > 1073741824.0f) return 1073741824;
+            return static_cast<int>(cell);
+        }
+
+        AABB SweptBounds(const AABB& bounds, const Vector2D& motion) {
+            const float minX = std::min(bounds.x, bounds.x + motion.x);
+            const float minY = std::min(bounds.y, bounds.y + motion.y);
+            return AABB(minX, minY, bounds.width + std::fabs(motion.x), bounds.height + std::fabs(motion.y));
+        }
+    }
+
+    // ============================================================================
+    // BUILD
+    // ============================================================================
+
+    void TileCollisionLayer::Build(int cols, int rows, const std::vector<uint8_t>& solid, const Vector2D& tileSize, const Vector2D& origin) {
+        Clear();
+
+        m_cols = std::max(cols, 0);
+        m_rows = std::max(rows, 0);
+        m_tileSize = Vector2D(tileSize.x > 0.0f ? tileSize.x : 1.0f, tileSize.y > 0.0f ? tileSize.y : 1.0f);
+        m_origin = origin;
+
+        const size_t cellCount = static_cast<size_t>(m_cols) * m_rows;
+        m_solid.assign(cellCount, 0);
+        m_rectOfCell.assign(cellCount, NO_RECT);
+        for (size_t i = 0; i < cellCount && i < solid.size(); ++i) {
+            if (solid[i]) {
+                m_solid[i] = 1;
+                ++m_solidCount;
+            }
+        }
+
+        Merge(0, 0, m_cols - 1, m_rows - 1);
+    }
+
+    void TileCollisionLayer::Assign(int cols, int rows, const std::vector<Rect>& rects, const Vector2D& tileSize, const Vector2D& origin) {
+        Build(cols, rows, {}, tileSize, origin);
+
+        for (const Rect& rect : rects) {
+            bool valid = rect.col >= 0 && rect.row >= 0 && rect.cols > 0 && rect.rows > 0 &&
+                         rect.col + rect.cols <= m_cols && rect.row + rect.rows <= m_rows;
+            for (int r = rect.row; valid && r < rect.row + rect.rows; ++r) {
+                for (int c = rect.col; c < rect.col + rect.cols; ++c) {
+                    if (m_solid[static_cast<size_t>(r) * m_cols + c]) {
+                        valid = false;
+                        break;
+                    }
+                }
+            }
+            if (!valid) {
+                std::cerr << "TileCollisionLayer: assigned rectangle is outside the grid or overlaps another, skipped" << std::endl;
+                continue;
+            }
+
+            for (int r = rect.row; r < rect.row + rect.rows; ++r) {
+                std::fill_n(m_solid.begin() + static_cast<size_t>(r) * m_cols + rect.col, rect.cols, uint8_t(1));
+            }
+            m_solidCount += static_cast<size_t>(rect.cols) * rect.rows;
+            AddRect(rect);
+        }
+        ++m_version;
+    }
+
+    void TileCollisionLayer::Clear() {
+        m_cols = m_rows = 0;
+        m_solidCount = 0;
+        m_solid.clear();
+        m_rectOfCell.clear();
+        m_rects.clear();
+        m_bounds.clear();
+        m_rectStamp.clear();
+        m_queryStamp = 0;
+        ++m_version;
+    }
+
+    bool TileCollisionLayer::SetSolid(int col, int row, bool solid) {
+        if (col < 0 || col >= m_cols || row < 0 || row >= m_rows) return false;
+
+        const size_t cell = static_cast<size_t>(row) * m_cols + col;
+        if ((m_solid[cell] != 0) == solid) return false;
+
+        m_solid[cell] = solid ? 1 : 0;
+        if (solid) ++m_solidCount;
+        else --m_solidCount;
+
+        // Rectangles to redo: the one covering the cell, or the neighbours a new solid cell could join
+        uint32_t affected[4];
+        int affectedCount = 0;
+        auto addAffected = [&](int c, int r) {
+            if (c < 0 || c >= m_cols || r < 0 || r >= m_rows) return;
+            const uint32_t rect = m_rectOfCell[static_cast<size_t>(r) * m_cols + c];
+            if (rect == NO_RECT) return;
+            for (int i = 0; i < affectedCount; ++i) {
+                if (affected[i] == rect) return;
+            }
+            affected[affectedCount++] = rect;
+        };
+        if (solid) {
+            addAffected(col - 1, row);
+            addAffected(col + 1, row);
+            addAffected(col, row - 1);
+            addAffected(col, row + 1);
+        }
+        else {
+            addAffected(col, row);
+        }
+
+        // Highest index first: removal moves the last rectangle into the freed slot
+        std::sort(affected, affected + affectedCount, [](uint32_t a, uint32_t b) { return a > b; });
+
+        int minCol = col, minRow = row, maxCol = col, maxRow = row;
+        for (int i = 0; i < affectedCount; ++i) {
+            const Rect& rect = m_rects[affected[i]];
+            minCol = std::min(minCol, rect.col);
+            minRow = std::min(minRow, rect.row);
+            maxCol = std::max(maxCol, rect.col + rect.cols - 1);
+            maxRow = std::max(maxRow, rect.row + rect.rows - 1);
+            RemoveRect(affected[i]);
+        }
+
+        Merge(minCol, minRow, maxCol, maxRow);
+        ++m_version;
+        return true;
+    }
+
+    bool TileCollisionLayer::IsSolid(int col, int row) const {
+        if (col < 0 || col >= m_cols || row < 0 || row >= m_rows) return false;
+        return m_solid[static_cast<size_t>(row) * m_cols + col] != 0;
+    }
+
+    void TileCollisionLayer::Merge(int minCol, int minRow, int maxCol, int maxRow) {
+        auto isFree = [&](int c, int r) {
+            const size_t cell = static_cast<size_t>(r) * m_cols + c;
+            return m_solid[cell] && m_rectOfCell[cell] == NO_RECT;
+        };
+
+        for (int row = minRow; row <= maxRow; ++row) {
+            for (int col = minCol; col <= maxCol; ++col) {
+                if (!isFree(col, row)) continue;
+
+                // As wide as the run of free cells, then as tall as that whole span stays free
+                int cols = 1;
+                while (col + cols <= maxCol && isFree(col + cols, row)) ++cols;
+
+                int rows = 1;
+                while (row + rows <= maxRow) {
+                    bool fullRow = true;
+                    for (int c = col; c < col + cols; ++c) {
+                        if (!isFree(c, row + rows)) {
+                            fullRow = false;
+                            break;
+                        }
+                    }
+                    if (!fullRow) break;
+                    ++rows;
+                }
+
+                AddRect({ col, row, cols, rows });
+            }
+        }
+    }
+
+    void TileCollisionLayer::AddRect(const Rect& rect) {
+        const uint32_t index = static_cast<uint32_t>(m_rects.size());
+        m_rects.push_back(rect);
+        m_bounds.push_back(ToWorld(rect));
+        m_rectStamp.push_back(0);
+
+        for (int r = rect.row; r < rect.row + rect.rows; ++r) {
+            std::fill_n(m_rectOfCell.begin() + static_cast<size_t>(r) * m_cols + rect.col, rect.cols, index);
+        }
+    }
+
+    void TileCollisionLayer::RemoveRect(uint32_t index) {
+        auto stamp = [&](const Rect& rect, uint32_t value) {
+            for (int r = rect.row; r < rect.row + rect.rows; ++r) {
+                std::fill_n(m_rectOfCell.begin() + static_cast<size_t>(r) * m_cols + rect.col, rect.cols, value);
+            }
+        };
+
+        stamp(m_rects[index], NO_RECT);
+
+        // Swap with the last rectangle so the arrays stay packed
+        const uint32_t last = static_cast<uint32_t>(m_rects.size() - 1);
+        if (index != last) {
+            m_rects[index] = m_rects[last];
+            m_bounds[index] = m_bounds[last];
+            m_rectStamp[index] = m_rectStamp[last];
+            stamp(m_rects[index], index);
+        }
+        m_rects.pop_back();
+        m_bounds.pop_back();
+        m_rectStamp.pop_back();
+    }
+
+    AABB TileCollisionLayer::ToWorld(const Rect& rect) const {
+        return AABB(m_origin.x + rect.col * m_tileSize.x, m_origin.y + rect.row * m_tileSize.y,
+                    rect.cols * m_tileSize.x, rect.rows * m_tileSize.y);
+    }
+
+    // ============================================================================
+    // QUERIES
+    // ============================================================================
+
+    bool TileCollisionLayer::ComputeCells(const AABB& box, int& minCol, int& minRow, int& maxCol, int& maxRow) const {
+        if (m_cols == 0 || m_rows == 0) return false;
+
+        // Negative sizes still cover [min, max]
+        const float x0 = std::min(box.x, box.x + box.width) - m_origin.x;
+        const float y0 = std::min(box.y, box.y + box.height) - m_origin.y;
+        const float x1 = std::max(box.x, box.x + box.width) - m_origin.x;
+        const float y1 = std::max(box.y, box.y + box.height) - m_origin.y;
+
+        minCol = ToCell(x0, 1.0f / m_tileSize.x);
+        minRow = ToCell(y0, 1.0f / m_tileSize.y);
+        maxCol = ToCell(x1, 1.0f / m_tileSize.x);
+        maxRow = ToCell(y1, 1.0f / m_tileSize.y);
+        if (maxCol < 0 || maxRow < 0 || minCol >= m_cols || minRow >= m_rows) return false;
+
+        minCol = std::max(minCol, 0);
+        minRow = std::max(minRow, 0);
+        maxCol = std::min(maxCol, m_cols - 1);
+        maxRow = std::min(maxRow, m_rows - 1);
+        return true;
+    }
+
+    uint32_t TileCollisionLayer::NextQueryStamp() const {
+        if (++m_queryStamp == 0) {
+            // Stamp wrapped around: forget old visits so none match by accident
+            std::fill(m_rectStamp.begin(), m_rectStamp.end(), 0u);
+            m_queryStamp = 1;
+        }
+        return m_queryStamp;
+    }
+
+    float TileCollisionLayer::SweepAABB(const AABB& box, const Vector2D& motion, Vector2D& normal) const {
+        float firstTime = -1.0f;
+        Query(SweptBounds(box, motion), [&](uint32_t, const AABB& bounds) {
+            Vector2D hitNormal;
+            const float time = CollisionDetection::SweepAABBvsAABB(box, motion, bounds, hitNormal);
+            if (time >= 0.0f && (firstTime < 0.0f || time < firstTime)) {
+                firstTime = time;
+                normal = hitNormal;
+            }
+            return false;
+        });
+        return firstTime;
+    }
+
+    float TileCollisionLayer::SweepCircle(const Circle& circle, const Vector2D& motion, Vector2D& normal) const {
+        float firstTime = -1.0f;
+        Query(SweptBounds(circle.GetAABB(), motion), [&](uint32_t, const AABB& bounds) {
+            Vector2D hitNormal;
+            const float time = CollisionDetection::SweepCirclevsAABB(circle, motion, bounds, hitNormal);
+            if (time >= 0.0f && (firstTime < 0.0f || time < firstTime)) {
+                firstTime = time;
+                normal = hitNormal;
+            }
+            return false;
+        });
+        return firstTime;
+    }
+
+    // ============================================================================
+    // BENCHMARK
+    // ============================================================================
+
+    TileCollisionLayer::BenchmarkResult TileCollisionLayer::RunBenchmark(int cols, int rows, int edits, int sweeps) {
+        BenchmarkResult result;
+        result.cols = std::max(cols, 1);
+        result.rows = std::max(rows, 1);
+        const Vector2D tileSize(64.0f, 64.0f);
+        const size_t cellCount = static_cast<size_t>(result.cols) * result.rows;
+
+        // Cave-like map: random fill smoothed by a few cellular automaton passes
+        std::mt19937 rng(2024);
+        std::vector<uint8_t> solid(cellCount);
+        for (uint8_t& cell : solid) cell = (rng() % 100) < 45 ? 1 : 0;
+        std::vector<uint8_t> next(cellCount);
+        for (int pass = 0; pass < 4; ++pass) {
+            for (int r = 0; r < result.rows; ++r) {
+                for (int c = 0; c < result.cols; ++c) {
+                    int walls = 0;
+                    for (int dr = -1; dr <= 1; ++dr) {
+                        for (int dc = -1; dc <= 1; ++dc) {
+                            const int nc = c + dc, nr = r + dr;
+                            const bool outside = nc < 0 || nr < 0 || nc >= result.cols || nr >= result.rows;
+                            walls += outside || solid[static_cast<size_t>(nr) * result.cols + nc] ? 1 : 0;
+                        }
+                    }
+                    next[static_cast<size_t>(r) * result.cols + c] = walls >= 5 ? 1 : 0;
+                }
+            }
+            solid.swap(next);
+        }
+
+        TileCollisionLayer layer;
+        auto start = Clock::now();
+        layer.Build(result.cols, result.rows, solid, tileSize);
+        result.buildMs = MicrosecondsSince(start) / 1000.0;
+        result.solidTiles = layer.GetSolidCount();
+        result.rects = layer.GetRects().size();
+
+        // One box per solid tile: the list the wall code scanned before
+        std::vector<AABB> tiles;
+        tiles.reserve(result.solidTiles);
+        for (int r = 0; r < result.rows; ++r) {
+            for (int c = 0; c < result.cols; ++c) {
+                if (layer.IsSolid(c, r)) tiles.emplace_back(c * tileSize.x, r * tileSize.y, tileSize.x, tileSize.y);
+            }
+        }
+
+        // Boxes starting in empty cells, moving up to four tiles
+        struct Sweep {
+            AABB box;
+            Vector2D motion;
+        };
+        std::uniform_int_distribution<int> colDist(0, result.cols - 1);
+        std::uniform_int_distribution<int> rowDist(0, result.rows - 1);
+        std::uniform_real_distribution<float> moveDist(-256.0f, 256.0f);
+        std::vector<Sweep> sweepList;
+        sweepList.reserve(static_cast<size_t>(std::max(sweeps, 0)));
+        for (int attempt = 0; static_cast<int>(sweepList.size()) < sweeps && attempt < sweeps * 20; ++attempt) {
+            const int c = colDist(rng), r = rowDist(rng);
+            if (layer.IsSolid(c, r)) continue;
+            sweepList.push_back({ AABB(c * tileSize.x + 20.0f, r * tileSize.y + 20.0f, 24.0f, 24.0f), Vector2D(moveDist(rng), moveDist(rng)) });
+        }
+
+        if (!sweepList.empty()) {
+            Vector2D normal;
+            start = Clock::now();
+            for (const Sweep& sweep : sweepList) {
+                if (layer.SweepAABB(sweep.box, sweep.motion, normal) >= 0.0f) ++result.sweepHits;
+            }
+            result.gridSweepUs = MicrosecondsSince(start) / sweepList.size();
+
+            size_t listHits = 0;
+            start = Clock::now();
+            for (const Sweep& sweep : sweepList) {
+                const AABB swept = SweptBounds(sweep.box, sweep.motion);
+                float firstTime = -1.0f;
+                for (const AABB& tile : tiles) {
+                    if (!tile.Intersects(swept)) continue;
+                    const float time = CollisionDetection::SweepAABBvsAABB(sweep.box, sweep.motion, tile, normal);
+                    if (time >= 0.0f && (firstTime < 0.0f || time < firstTime)) firstTime = time;
+                }
+                if (firstTime >= 0.0f) ++listHits;
+            }
+            result.listSweepUs = MicrosecondsSince(start) / sweepList.size();
+
+            if (listHits != result.sweepHits) {
+                std::cerr << "TileCollisionLayer: benchmark sweeps disagree (grid " << result.sweepHits
+                          << " hits, tile list " << listHits << ")" << std::endl;
+            }
+        }
+
+        // Painting in the editor: toggle random cells one at a time
+        if (edits > 0) {
+            start = Clock::now();
+            for (int edit = 0; edit < edits; ++edit) {
+                const int c = colDist(rng), r = rowDist(rng);
+                layer.SetSolid(c, r, !layer.IsSolid(c, r));
+            }
+            result.editUs = MicrosecondsSince(start) / edits;
+        }
+        result.rectsAfterEdits = layer.GetRects().size();
+
+        return result;
+    }
+
+} // namespace GP2Engine
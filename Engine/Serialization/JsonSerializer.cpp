@@ -17,6 +17,7 @@
 #include "../Graphics/Sprite.hpp"
 #include "../Graphics/Font.hpp"
 #include "../Resources/ResourceManager.hpp"
+#include <algorithm>
 
 namespace GP2Engine {
 
@@ -193,6 +194,29 @@ namespace GP2Engine {
                     textJson["offset_y"] = textComp->offset.y;
                 }
 
+                // Save PhysicsComponent if present
+                if (PhysicsComponent* physicsComp = registry.GetComponent<PhysicsComponent>(entity)) {
+                    nlohmann::json& physicsJson = entityJson["PhysicsComponent"];
+
+                    // Body type and shape (stored as enum values)
+                    physicsJson["body_type"] = static_cast<int>(physicsComp->bodyType);
+                    physicsJson["shape"] = static_cast<int>(physicsComp->shape);
+                    physicsJson["width"] = physicsComp->size.x;
+                    physicsJson["height"] = physicsComp->size.y;
+                    physicsJson["radius"] = physicsComp->radius;
+
+                    // Motion and material
+                    physicsJson["velocity_x"] = physicsComp->velocity.x;
+                    physicsJson["velocity_y"] = physicsComp->velocity.y;
+                    physicsJson["mass"] = physicsComp->mass;
+                    physicsJson["restitution"] = physicsComp->restitution;
+                    physicsJson["friction"] = physicsComp->friction;
+                    physicsJson["linear_damping"] = physicsComp->linearDamping;
+                    physicsJson["gravity_scale"] = physicsComp->gravityScale;
+                    physicsJson["sync_transform"] = physicsComp->syncTransform;
+                    physicsJson["continuous"] = physicsComp->continuous;
+                }
+
                 // Save Tag if present
                 if (Tag* tag = registry.GetComponent<Tag>(entity)) {
                     entityJson["Tag"]["name"] = tag->name;
@@ -399,6 +423,37 @@ namespace GP2Engine {
                             serializer.EndObject();
                         }
 
+                        // Load PhysicsComponent if present (missing fields keep their defaults)
+                        if (serializer.BeginObject("PhysicsComponent")) {
+                            PhysicsComponent physicsComp;
+                            int bodyType = static_cast<int>(physicsComp.bodyType);
+                            int shape = static_cast<int>(physicsComp.shape);
+
+                            // Load body type and shape
+                            serializer.Serialize(bodyType, "body_type");
+                            serializer.Serialize(shape, "shape");
+                            serializer.Serialize(physicsComp.size.x, "width");
+                            serializer.Serialize(physicsComp.size.y, "height");
+                            serializer.Serialize(physicsComp.radius, "radius");
+
+                            // Load motion and material
+                            serializer.Serialize(physicsComp.velocity.x, "velocity_x");
+                            serializer.Serialize(physicsComp.velocity.y, "velocity_y");
+                            serializer.Serialize(physicsComp.mass, "mass");
+                            serializer.Serialize(physicsComp.restitution, "restitution");
+                            serializer.Serialize(physicsComp.friction, "friction");
+                            serializer.Serialize(physicsComp.linearDamping, "linear_damping");
+                            serializer.Serialize(physicsComp.gravityScale, "gravity_scale");
+                            serializer.Serialize(physicsComp.syncTransform, "sync_transform");
+                            serializer.Serialize(physicsComp.continuous, "continuous");
+
+                            physicsComp.bodyType = static_cast<BodyType>(std::clamp(bodyType, 0, 2));
+                            physicsComp.shape = static_cast<ColliderShape>(std::clamp(shape, 0, 1));
+
+                            registry.AddComponent<PhysicsComponent>(entity, physicsComp);
+                            serializer.EndObject();
+                        }
+
                         // Load Tag if present
                         if (serializer.BeginObject("Tag")) {
                             std::string name, group;
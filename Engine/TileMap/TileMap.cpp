@@ -10,6 +10,8 @@
 #include <algorithm>
 #include <Engine.hpp> 
 #include "Graphics/Renderer.hpp"
+#include "Core/EventSystem.hpp"
+#include "Core/Events.hpp"
 #include <iostream>
 #include <glm/glm.hpp>
 #include <filesystem>
@@ -69,6 +71,7 @@ namespace GP2Engine {
             }
 
             std::cout << "Successfully loaded " << m_TileDefinitions.size() << " tile definitions from: " << filepath << std::endl;
+            RebuildCollisionLayer();
             return true;
 
         }
@@ -91,6 +94,7 @@ namespace GP2Engine {
             m_GridCols = 16;
             m_GridRows = 12;
             m_TilemapData.assign(m_GridCols * m_GridRows, 0);
+            RebuildCollisionLayer();
             return;
         }
 
@@ -100,6 +104,7 @@ namespace GP2Engine {
             m_GridCols = 16;
             m_GridRows = 12;
             m_TilemapData.assign(m_GridCols * m_GridRows, 0);
+            RebuildCollisionLayer();
             return;
         }
 
@@ -118,7 +123,8 @@ namespace GP2Engine {
                 << ", got " << m_TilemapData.size() << std::endl;
             m_TilemapData.resize(MAP_SIZE, 0);
         }
-       
+
+        RebuildCollisionLayer();
     }
 
     int TileMap::GetTileValue(int col, int row) const {
@@ -147,8 +153,36 @@ namespace GP2Engine {
         int index = row * m_GridCols + col;
 
         if (index < m_TilemapData.size()) {
+            const int oldValue = m_TilemapData[index];
+            if (oldValue == newValue) {
+                return;
+            }
             m_TilemapData[index] = newValue;
+
+            // Only the rectangles around this cell are re-merged
+            const bool collidable = IsCollidableID(newValue);
+            m_CollisionLayer.SetSolid(col, row, collidable);
+
+            // Let listeners (e.g. the AI navigation grid) patch just this cell
+            EventSystem::Publish(TileChangedEvent{ col, row, oldValue, newValue, collidable });
+        }
+    }
+
+    void TileMap::RebuildCollisionLayer() {
+        std::vector<uint8_t> solid(m_TilemapData.size());
+        for (size_t i = 0; i < m_TilemapData.size(); ++i) {
+            solid[i] = IsCollidableID(m_TilemapData[i]) ? 1 : 0;
         }
+
+        m_CollisionLayer.Build(m_GridCols, m_GridRows, solid, Vector2D(TILE_PIXEL_WIDTH, TILE_PIXEL_HEIGHT));
+
+        // Every cell may have changed: listeners resync from the collision layer
+        EventSystem::Publish(TileMapReloadedEvent{ m_GridCols, m_GridRows });
+    }
+
+    bool TileMap::IsCollidableID(int id) const {
+        const TileDefinition* def = GetTileDefinitionByID(id);
+        return def && def->isCollidable;
     }
 
     const TileDefinition* TileMap::GetTileDefinitionByID(int id) const {
@@ -228,5 +262,7 @@ namespace GP2Engine {
             m_TileDefinitions.push_back(std::move(def));
             tileID++;
         }
+
+        RebuildCollisionLayer();
     }
 }
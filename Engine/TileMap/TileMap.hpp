@@ -12,6 +12,7 @@
 #include <memory>
 #include <iostream>
 #include "Graphics/Texture.hpp"
+#include "Physics/TileCollision.hpp"
 
 namespace GP2Engine {
 
@@ -56,9 +57,21 @@ namespace GP2Engine {
 
         /**
          * @brief Sets the tile value (ID) at the given tile coordinates.
+         * Also updates the collision layer around that cell.
          */
         void SetTileValue(int col, int row, int newValue);
 
+        /**
+         * @brief Rebuilds the whole collision layer from the map data and isCollidable.
+         * Called after loading the map or the tile definitions.
+         */
+        void RebuildCollisionLayer();
+
+        /**
+         * @brief Collidable tiles merged into rectangles (world space, TILE_PIXEL_WIDTH/HEIGHT cells).
+         */
+        const TileCollisionLayer& GetCollisionLayer() const { return m_CollisionLayer; }
+
         void SaveMap(const std::string& filepath);
         void ReloadTileDefinitions();
 
@@ -86,5 +99,9 @@ namespace GP2Engine {
         int m_GridRows = 0;
 
         unsigned int m_WhiteTextureID = 1; // Fallback texture ID
+
+        TileCollisionLayer m_CollisionLayer;
+
+        bool IsCollidableID(int id) const;
     };
 }
\ No newline at end of file
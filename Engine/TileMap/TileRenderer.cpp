@@ -107,29 +107,51 @@ namespace GP2Engine {
             << fallbackTiles << " fallback tiles" << std::endl;*/
     }
 
-    void TileRenderer::RenderDebugGrid(Renderer& renderer) {
+    void TileRenderer::AppendToFramePacket(FramePacket& packet) const {
         if (!m_tileMap) return;
 
-        auto& debugRenderer = renderer.GetDebugRenderer();
-        const Color GRAY_COLOR = Color(0.5f, 0.5f, 0.5f, 1.0f);
+        const std::vector<int>& tileMapData = m_tileMap->getTileMapData();
+        const glm::vec2 size = glm::vec2(CELL_WIDTH, CELL_HEIGHT);
+        const glm::vec4 fullUVCoords = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
+        const glm::vec4 white = glm::vec4(1.0f);
 
         for (int row = 0; row < m_tileMap->GetGridRows(); ++row) {
             for (int col = 0; col < m_tileMap->GetGridCols(); ++col) {
+                int index = row * m_tileMap->GetGridCols() + col;
+                if (index >= (int)tileMapData.size()) break;
 
-                Vector2D topLeft = Vector2D(col * CELL_WIDTH, row * CELL_HEIGHT);
-                Vector2D topRight = Vector2D(topLeft.x + CELL_WIDTH, topLeft.y);
-                Vector2D bottomLeft = Vector2D(topLeft.x, topLeft.y + CELL_HEIGHT);
-                Vector2D bottomRight = Vector2D(topLeft.x + CELL_WIDTH, topLeft.y + CELL_HEIGHT);
+                // Center of the cell
+                const glm::vec2 position = glm::vec2(
+                    (col * CELL_WIDTH) + CELL_WIDTH * 0.5f,
+                    (row * CELL_HEIGHT) + CELL_HEIGHT * 0.5f
+                );
 
-                // Draw the four lines that form the cell's border
-                debugRenderer.DrawLine(topLeft, topRight, GRAY_COLOR);
-                debugRenderer.DrawLine(topRight, bottomRight, GRAY_COLOR);
-                debugRenderer.DrawLine(bottomRight, bottomLeft, GRAY_COLOR);
-                debugRenderer.DrawLine(bottomLeft, topLeft, GRAY_COLOR);
+                int tileID = tileMapData[index];
+                const TileDefinition* def = m_tileMap->GetTileDefinitionByID(tileID);
+                if (def && def->texture) {
+                    packet.AddSprite({position, size, 0.0f, fullUVCoords, white, def->texture->GetTextureID()}, true);
+                } else {
+                    // FALLBACK - Texture failed to load, tint the default texture
+                    Color fallbackColor = (tileID == 1) ? WALL_DEBUG_COLOR : FLOOR_DEBUG_COLOR;
+                    const glm::vec4 tint = glm::vec4(fallbackColor.r, fallbackColor.g, fallbackColor.b, fallbackColor.a);
+                    packet.AddSprite({position, size, 0.0f, fullUVCoords, tint, m_tileMap->getDefaultTexture()}, true);
+                }
             }
         }
     }
 
+    void TileRenderer::RenderDebugGrid(Renderer& renderer) {
+        if (!m_tileMap) return;
+
+        auto& debugRenderer = renderer.GetDebugRenderer();
+        const Color GRAY_COLOR = Color(0.5f, 0.5f, 0.5f, 1.0f);
+
+        // One line per row/column boundary, cached by the debug renderer
+        // and only rebuilt when the map is resized
+        debugRenderer.DrawGrid(Vector2D(0.0f, 0.0f), m_tileMap->GetGridCols(), m_tileMap->GetGridRows(),
+            Vector2D(CELL_WIDTH, CELL_HEIGHT), GRAY_COLOR);
+    }
+
     GP2Engine::Vector2D TileRenderer::ScreenToTileCoords(const GP2Engine::Vector2D& screenPos, const GP2Engine::Camera& camera) const {
         if (!m_tileMap) return GP2Engine::Vector2D(-1.0f, -1.0f);
 
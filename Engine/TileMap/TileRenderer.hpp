@@ -39,6 +39,15 @@ namespace GP2Engine {
          */
         void Render(GP2Engine::Renderer& renderer);
 
+        /**
+         * @brief Appends the textured tilemap to a frame packet as one batched run.
+         *
+         * Same tiles as Render, but captured as quads so the packet can be
+         * prepared and drawn after the map changes.
+         * @param packet Frame packet being built for this frame.
+         */
+        void AppendToFramePacket(GP2Engine::FramePacket& packet) const;
+
         /**
          * @brief Renders the debug grid lines (separate from the textured tiles).
          *
@@ -4,7 +4,7 @@
   * @brief Implementation of the physics debug visualization layer
   *
   * Implements functions to render debugging overlays for physics entities,
-  * including AABB collision boxes, velocity vectors, acceleration vectors, and entity center points.
+  * including AABB collision boxes, velocity vectors, and entity center points.
   */
 
 #include "DebugLogic.hpp"
@@ -88,8 +88,8 @@ namespace Hollows {
                     velocity = playerVelocity;
                 }
                 // Check if entity has physics component
-                else if (physicsComp && physicsComp->body) {
-                    velocity = physicsComp->body->velocity;
+                else if (physicsComp) {
+                    velocity = physicsComp->velocity;
                 }
 
                 // Draw velocity vector if moving
@@ -104,17 +104,9 @@ namespace Hollows {
                     // Draw arrowhead
                     debugRenderer.DrawCircle(end, 4.0f, GP2Engine::Color::GetYellow(), true);
                 }
-
-                // 3. Draw Acceleration Vectors (only for physics bodies)
-                if (physicsComp && physicsComp->body && physicsComp->body->acceleration.length() > 0.01f) {
-                    GP2Engine::Vector2D start = transform->position;
-                    GP2Engine::Vector2D end = start + physicsComp->body->acceleration * 20.0f; // Scale for visibility
-
-                    debugRenderer.DrawLine(start, end, GP2Engine::Color::GetMagenta(), 2.0f);
-                }
             }
 
-            // 4. Draw center point
+            // 3. Draw center point
             if (showCollisionBoxes) {
                 debugRenderer.DrawPoint(transform->position, GP2Engine::Color::GetWhite(), 4.0f);
             }
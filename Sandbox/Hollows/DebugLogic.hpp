@@ -4,7 +4,7 @@
  * @brief Interface for the physics debug visualization system
  *
  * Defines the DebugLogic class for controlling and rendering physics overlays
- * such as collision boxes and velocity/acceleration vectors.
+ * such as collision boxes and velocity vectors.
  */
 
 
@@ -20,7 +20,6 @@ namespace Hollows {
      * Features:
      * - AABB collision box rendering (green for player, red for others)
      * - Velocity vector visualization (yellow arrows)
-     * - Acceleration vector visualization (magenta arrows)
      * - Entity center point markers
      *
      * Toggle options controlled externally (F2, F3 keys in main game).
@@ -36,7 +35,7 @@ namespace Hollows {
          * @param playerEntity Player entity ID (for special coloring)
          * @param playerVelocity Player velocity (for velocity vector)
          * @param showCollisionBoxes Draw AABB boxes
-         * @param showVelocityVectors Draw velocity/acceleration arrows
+         * @param showVelocityVectors Draw velocity arrows
          */
         void RenderDebugPhysics(
             GP2Engine::Registry& registry,
@@ -11,6 +11,9 @@
 #pragma once
 
 #include <Engine.hpp>
+#include <functional>
+#include <string>
+#include <vector>
 
 namespace Hollows {
 
@@ -19,6 +22,10 @@ namespace Hollows {
         DebugUI();
         ~DebugUI() = default;
 
+        // Registered benchmarks capture this
+        DebugUI(const DebugUI&) = delete;
+        DebugUI& operator=(const DebugUI&) = delete;
+
         // Main render function
         void Render(GP2Engine::Registry& registry, GP2Engine::EntityID playerEntity, float* frameTimeHistory, int frameIndex, float& playerSpeed,
             bool& showCollisionBoxes, bool& showVelocityVectors, bool& showTileMapEditor, GP2Engine::Vector2D& m_hoveredTileCoords, int hoveredTileValue,
@@ -36,6 +43,22 @@ namespace Hollows {
         void SetLevelEditor(GP2Engine::LevelEditor* levelEditor) {
             m_LevelEditor = levelEditor;
         }
+
+        void SetRenderSystem(GP2Engine::RenderSystem* renderSystem) {
+            m_renderSystem = renderSystem;
+        }
+
+        void SetAnimationSystem(GP2Engine::AnimationSystem* animationSystem) {
+            m_animationSystem = animationSystem;
+        }
+
+        void SetPhysicsRecorder(GP2Engine::PhysicsRecorder* physicsRecorder) {
+            m_physicsRecorder = physicsRecorder;
+        }
+
+        void SetAISystem(GP2Engine::AISystem* aiSystem) {
+            m_aiSystem = aiSystem;
+        }
         // End of public methods
 
 
@@ -49,7 +72,12 @@ namespace Hollows {
         bool m_showStressTest = false;
         bool m_showTileMapEditorPanel = false;
         bool m_showLevelEditor = false;
+        bool m_showBenchmarks = false;
         GP2Engine::LevelEditor* m_LevelEditor = nullptr;
+        GP2Engine::RenderSystem* m_renderSystem = nullptr;
+        GP2Engine::AnimationSystem* m_animationSystem = nullptr;
+        GP2Engine::PhysicsRecorder* m_physicsRecorder = nullptr;
+        GP2Engine::AISystem* m_aiSystem = nullptr;
 
         // Stress test state
         bool m_stressTestActive = false;
@@ -65,6 +93,7 @@ namespace Hollows {
         // Performance panel update timing
         float m_performanceUpdateTimer = 0.0f;
         const float m_performanceUpdateInterval = 0.5f; // Update every 500ms
+        std::vector<float> m_renderStatsPlot;            // Scratch values for the render stats graphs
 
         // Cached performance data (updated at intervals)
         float m_cachedInputTime = 0.0f;
@@ -73,6 +102,9 @@ namespace Hollows {
         float m_cachedUITime = 0.0f;
         float m_cachedInputPercent = 0.0f;
         float m_cachedPhysicsPercent = 0.0f;
+        int m_cachedPhysicsSteps = 0;
+        int m_cachedPhysicsAwake = 0;
+        int m_cachedPhysicsSleeping = 0;
         float m_cachedGraphicsPercent = 0.0f;
         float m_cachedUIPercent = 0.0f;
 
@@ -89,6 +121,31 @@ namespace Hollows {
         // Performance metrics
         float m_cachedAvgFrameTime = 0.0f;
 
+        /**
+         * @brief One benchmark in the Benchmarks panel
+         *
+         * Registered once through AddBenchmark; the results of the last run
+         * live in the captures of run and draw.
+         */
+        struct BenchmarkEntry {
+            std::string label;
+            std::string button;
+            std::function<void()> controls;     // Optional widgets between the label and the button
+            std::function<void()> run;          // Runs every configuration, keeps and logs the results
+            std::function<void()> draw;         // ImGui lines for the kept results
+        };
+
+        // Benchmark state (shown in the Benchmarks panel)
+        int m_benchmarkQuadCount = 50000;
+        float m_benchmarkRotatedFraction = 0.25f;
+        int m_benchmarkOverlayEntities = 10000;
+        int m_benchmarkAnimatedSprites = 50000;
+        std::vector<BenchmarkEntry> m_benchmarks;
+        bool m_hasPipelineBenchmark = false;
+        GP2Engine::RenderSystem::PipelineBenchmarkResult m_pipelineBenchmark;
+        bool m_hasPhysicsReplay = false;
+        GP2Engine::PhysicsReplay::Result m_physicsReplay;
+
         // Constants
         static constexpr float SCREEN_WIDTH = 1024.0f;
         static constexpr float SCREEN_HEIGHT = 768.0f;
@@ -101,6 +158,22 @@ namespace Hollows {
         void DrawPlayerPanel(GP2Engine::Registry& registry, GP2Engine::EntityID playerEntity, float& playerSpeed);
         void DrawControlsPanel(GP2Engine::Registry& registry, GP2Engine::EntityID playerEntity);
         void DrawDebugVisualizationPanel(bool& showCollisionBoxes, bool& showVelocityVectors);
+        void DrawBenchmarkPanel(GP2Engine::Registry& registry);
+
+        // Benchmark registration (see BenchmarkEntry)
+        void RegisterBenchmarks();
+
+        /**
+         * @brief Register a benchmark run once per configuration
+         * @param configs Sizes (or other settings) to run, in display order
+         * @param run Result(const Config&), runs one configuration
+         * @param print void(std::ostream&, const Result&), console line after "[Benchmark] "
+         * @param show void(const Result&), ImGui lines for one result
+         * @param controls Optional widgets drawn above the button
+         */
+        template<typename Config, typename Run, typename Print, typename Show>
+        void AddBenchmark(const char* label, const char* button, std::vector<Config> configs, Run run, Print print,
+                          Show show, std::function<void()> controls = {});
         void DrawTileEditorPanel(const GP2Engine::Vector2D& hoveredTileCoords, int hoveredTileValue, GP2Engine::TileRenderer& tileRenderer, GP2Engine::TileMap& tilemap);
 
         // Entity Inspector helper functions
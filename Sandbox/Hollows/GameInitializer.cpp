@@ -155,11 +155,8 @@ namespace Hollows {
                 // Set initial texture to idle
                 spriteComp->sprite->SetTexture(idleTexture);
 
-                // Setup animations
-                SetupWalkRightAnimation(*spriteComp->sprite);
-                SetupWalkUpAnimation(*spriteComp->sprite);
-                SetupWalkDownAnimation(*spriteComp->sprite);
-                SetupIdleAnimation(*spriteComp->sprite);
+                // Setup animations (clip library shared with other player sprites)
+                spriteComp->sprite->SetAnimationClips(GetPlayerAnimationClips());
 
                 // Start with idle animation
                 spriteComp->sprite->PlayAnimation("idle");
@@ -237,11 +234,8 @@ namespace Hollows {
             monsterSprite->SetTexture(monsterVerticalTexture);
         }
 
-        // Setup monster animations
-        SetupMonsterWalkLeftAnimation(*monsterSprite);
-        SetupMonsterWalkRightAnimation(*monsterSprite);
-        SetupMonsterWalkUpAnimation(*monsterSprite);
-        SetupMonsterWalkDownAnimation(*monsterSprite);
+        // Setup monster animations (clip library shared with other monster sprites)
+        monsterSprite->SetAnimationClips(GetMonsterAnimationClips());
 
         // Start with walk down animation
         monsterSprite->PlayAnimation("monster_walk_down");
@@ -267,6 +261,7 @@ namespace Hollows {
         aiComp.chaseSpeed = 200.0f;
         aiComp.detectionRange = 200.0f;
         aiComp.usePathfinding = true;
+        aiComp.useFlowField = true;              // Monsters chasing the player share one field
         aiComp.horizontalTexture = monsterHorizontalTexture.get();
         aiComp.verticalTexture = monsterVerticalTexture.get();
         aiComp.currentAnimation = "monster_walk_down";
@@ -274,18 +269,11 @@ namespace Hollows {
         registry.AddComponent(monsterEntity, aiComp);
         std::cout << "Added AIComponent to monster entity" << std::endl;
 
-        // Setup pathfinding grid in AISystem (shared by all AI entities)
-        int gridWidth = 32;
-        int gridHeight = 24;
-        float tileSize = 64.0f;
-        aiSystem.SetupPathfindingGrid(gridWidth, gridHeight, tileSize);
-
-        // Mark all cells as walkable by default
-        for (int y = 0; y < gridHeight; ++y) {
-            for (int x = 0; x < gridWidth; ++x) {
-                aiSystem.SetWalkable(x, y, true);
-            }
-        }
+        // Pathfinding settings shared by all AI entities (the grid is sized from the tile map by GameLayer)
+        // Uniform-cost grid: Jump Point Search finds the same paths with far fewer expansions
+        aiSystem.SetPathfindingMode(GP2Engine::GridPathfinder::Mode::JumpPoint);
+        // Searches wait in a queue (1 ms per frame) so agents re-pathing together do not spike a frame
+        aiSystem.SetDeferredPaths(true, 1000.0);
 
         std::cout << "Monster entity setup complete with ECS AIComponent!" << std::endl;
     }
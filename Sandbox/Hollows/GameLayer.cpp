@@ -115,6 +115,22 @@ void GameLayer::InitializeGame(GP2Engine::Registry& registry) {
     m_tileRenderer->m_tileMap = m_tileMap.get();
     m_tileRenderer->InitializeDimensions();
 
+    // Collidable tiles are static geometry for the physics world (kept in sync by SetTileValue)
+    m_physicsWorld.SetTileCollision(&m_tileMap->GetCollisionLayer());
+    m_physicsWorld.SetRecorder(&m_physicsRecorder);
+
+    // Collidable tiles block the AI navigation grid; edits patch only the clusters around the tile,
+    // reloads (level or tile definitions) rebuild the whole grid
+    SyncNavGridWithTiles();
+    m_tileChangedListenerId = GP2Engine::EventSystem::Subscribe<GP2Engine::TileChangedEvent>(
+        [this](const GP2Engine::TileChangedEvent& e) {
+            m_aiSystem.SetWalkable(e.col, e.row, !e.collidable);
+        });
+    m_tileMapReloadedListenerId = GP2Engine::EventSystem::Subscribe<GP2Engine::TileMapReloadedEvent>(
+        [this](const GP2Engine::TileMapReloadedEvent&) {
+            SyncNavGridWithTiles();
+        });
+
     // Create tilemap entity
     m_tileMapEntity = registry.CreateEntity();
     registry.AddComponent(m_tileMapEntity, GP2Engine::Transform2D(GP2Engine::Vector2D(0.0f, 0.0f)));
@@ -125,6 +141,15 @@ void GameLayer::InitializeGame(GP2Engine::Registry& registry) {
     m_levelEditor = std::make_unique<GP2Engine::LevelEditor>();
     m_levelEditor->Initialize(m_tileMap.get(), m_tileRenderer.get());
     m_debugUI.SetLevelEditor(m_levelEditor.get());
+    m_debugUI.SetRenderSystem(&m_renderSystem);
+    m_debugUI.SetAnimationSystem(&m_animationSystem);
+    m_debugUI.SetPhysicsRecorder(&m_physicsRecorder);
+    m_debugUI.SetAISystem(&m_aiSystem);
+    m_renderSystem.SetAnimationSystem(&m_animationSystem);
+
+    // Prepare scene packets on the render thread while the next frame simulates
+    m_renderSystem.GetRenderThread().SetThreaded(true);
+    m_renderSystem.GetRenderThread().SetFrameLatency(1);
     m_showGridToggle = m_levelEditor->IsGridVisible();
 
     auto& editorCamera = m_levelEditor->GetEditorCamera();
@@ -192,6 +217,10 @@ void GameLayer::UpdateGame(GP2Engine::Registry& registry, float deltaTime) {
     // Update performance metrics
     UpdatePerformanceMetrics(deltaTime);
 
+    // Input handling (keyboard, mouse, editor and player controls) feeds the "Input" breakdown
+    GP2Engine::Profiler& profiler = GP2Engine::Profiler::GetInstance();
+    profiler.StartTiming("Input");
+
     // Toggle debug UI with F1
     if (GP2Engine::Input::IsKeyPressed(GP2Engine::Key::F1)) {
         m_showDebugUI = !m_showDebugUI;
@@ -256,8 +285,20 @@ void GameLayer::UpdateGame(GP2Engine::Registry& registry, float deltaTime) {
     if (!m_levelEditor->IsUsingEditorCamera()) {
         m_playerController.SetSpeed(m_playerSpeed);
         m_playerController.Update(registry, deltaTime);
+    }
+    profiler.EndTiming("Input");
+
+    if (!m_levelEditor->IsUsingEditorCamera()) {
         m_aiSystem.Update(registry, deltaTime);
 
+        // Physics runs at a fixed rate; Transform2D is blended between the last two steps
+        profiler.StartTiming("Physics");
+        const int physicsSteps = m_physicsWorld.Update(registry, m_physicsTimestep, deltaTime);
+        profiler.EndTiming("Physics");
+        profiler.AddCount("PhysicsSteps", physicsSteps);
+        profiler.AddCount("PhysicsAwake", static_cast<int>(m_physicsWorld.GetStats().awakeBodies));
+        profiler.AddCount("PhysicsSleeping", static_cast<int>(m_physicsWorld.GetStats().sleepingBodies));
+
         // Update camera follow
         GP2Engine::EntityID playerEntity = m_playerController.GetPlayerEntity();
         auto* playerTransform = registry.GetComponent<GP2Engine::Transform2D>(playerEntity);
@@ -300,6 +341,9 @@ void GameLayer::UpdateGame(GP2Engine::Registry& registry, float deltaTime) {
     // Update stress test objects
     m_debugUI.UpdateStressTestObjects(registry, deltaTime);
 
+    // Advance packed sprite animations (read by the render system)
+    m_animationSystem.Update(deltaTime);
+
     // Update level editor
     if (m_levelEditor) {
         m_levelEditor->Update(deltaTime);
@@ -348,8 +392,10 @@ void GameLayer::RenderMainMenu(GP2Engine::Registry& registry) {
 
 void GameLayer::RenderGame(GP2Engine::Registry& registry) {
     auto& renderer = GP2Engine::Renderer::GetInstance();
+    GP2Engine::Profiler& profiler = GP2Engine::Profiler::GetInstance();
 
     // Render game scene
+    profiler.StartTiming("Graphics");
     m_renderSystem.Render(registry, *m_currentCamera);
 
     auto& debugRenderer = renderer.GetDebugRenderer();
@@ -372,9 +418,11 @@ void GameLayer::RenderGame(GP2Engine::Registry& registry) {
     }
 
     debugRenderer.Flush(renderer);
+    profiler.EndTiming("Graphics");
 
     // Render debug UI
     if (m_showDebugUI) {
+        profiler.StartTiming("UI");
         ImGui_ImplOpenGL3_NewFrame();
         ImGui_ImplGlfw_NewFrame();
         ImGui::NewFrame();
@@ -385,6 +433,7 @@ void GameLayer::RenderGame(GP2Engine::Registry& registry) {
 
         ImGui::Render();
         ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        profiler.EndTiming("UI");
     }
 }
 
@@ -406,6 +455,15 @@ void GameLayer::OnShutdown(GP2Engine::Registry& registry) {
     if (m_hoverListenerId != 0) {
         GP2Engine::EventSystem::Unsubscribe<GP2Engine::MenuButtonHoverEvent>(m_hoverListenerId);
     }
+    if (m_tileChangedListenerId != 0) {
+        GP2Engine::EventSystem::Unsubscribe<GP2Engine::TileChangedEvent>(m_tileChangedListenerId);
+    }
+    if (m_tileMapReloadedListenerId != 0) {
+        GP2Engine::EventSystem::Unsubscribe<GP2Engine::TileMapReloadedEvent>(m_tileMapReloadedListenerId);
+    }
+
+    // Stop the render thread and release packets while the GL context is alive
+    m_renderSystem.Shutdown();
 
     // Cleanup ImGui
     ImGui_ImplOpenGL3_Shutdown();
@@ -413,6 +471,19 @@ void GameLayer::OnShutdown(GP2Engine::Registry& registry) {
     ImGui::DestroyContext();
 }
 
+void GameLayer::SyncNavGridWithTiles() {
+    if (!m_tileMap) return;
+
+    // Resizing clears the hierarchy and queued path requests built on the old walls
+    const auto& tileCollision = m_tileMap->GetCollisionLayer();
+    m_aiSystem.SetupPathfindingGrid(tileCollision.GetCols(), tileCollision.GetRows(), GP2Engine::TILE_PIXEL_WIDTH);
+    for (int row = 0; row < tileCollision.GetRows(); ++row) {
+        for (int col = 0; col < tileCollision.GetCols(); ++col) {
+            m_aiSystem.SetWalkable(col, row, !tileCollision.IsSolid(col, row));
+        }
+    }
+}
+
 void GameLayer::UpdatePerformanceMetrics(float deltaTime) {
     m_frameTimeHistory[m_frameIndex] = deltaTime;
     m_frameIndex = (m_frameIndex + 1) % 120;
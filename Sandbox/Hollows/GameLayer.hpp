@@ -65,8 +65,12 @@ private:
 
     // === SYSTEMS ===
     GP2Engine::RenderSystem m_renderSystem;
+    GP2Engine::AnimationSystem m_animationSystem;
     GP2Engine::ButtonSystem m_buttonSystem;
     GP2Engine::AISystem m_aiSystem;
+    GP2Engine::PhysicsWorld m_physicsWorld;
+    GP2Engine::FixedTimestep m_physicsTimestep;   // 60 Hz, at most 5 steps per frame
+    GP2Engine::PhysicsRecorder m_physicsRecorder; // Idle until started from the debug UI
     Hollows::PlayerController m_playerController;
     Hollows::DebugLogic m_debugLogic;
     int m_backgroundMusicChannel = -1;
@@ -84,6 +88,8 @@ private:
     GP2Engine::EventSystem::ListenerID m_settingsListenerId = 0;
     GP2Engine::EventSystem::ListenerID m_quitListenerId = 0;
     GP2Engine::EventSystem::ListenerID m_hoverListenerId = 0;
+    GP2Engine::EventSystem::ListenerID m_tileChangedListenerId = 0;
+    GP2Engine::EventSystem::ListenerID m_tileMapReloadedListenerId = 0;
 
 public:
     /**
@@ -102,6 +108,7 @@ private:
     // === INITIALIZATION HELPERS ===
     void InitializeMainMenu(GP2Engine::Registry& registry);
     void InitializeGame(GP2Engine::Registry& registry);
+    void SyncNavGridWithTiles();    // Rebuild the AI grid from the tile collision layer
 
     // === UPDATE HELPERS ===
     void UpdateMainMenu(GP2Engine::Registry& registry, float deltaTime);
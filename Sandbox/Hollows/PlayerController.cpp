@@ -84,6 +84,9 @@ namespace Hollows {
         GP2Engine::Transform2D* transform = registry.GetComponent<GP2Engine::Transform2D>(m_playerEntity);
         if (!transform) return;
 
+        // Refresh the collision broadphase with this frame's entity positions
+        m_collisionSystem.Sync(registry);
+
         // Update collision sound cooldown
         if (m_collisionSoundCooldown > 0.0f) {
             m_collisionSoundCooldown -= deltaTime;
@@ -131,6 +134,8 @@ namespace Hollows {
                 }
             }
 
+            m_collisionSystem.NotifyMoved(registry, m_playerEntity);
+
             // NEW: Play collision sound if we hit something (with cooldown)
             if (didCollide && m_collisionSoundCooldown <= 0.0f) {
                 DKAudioEngine::PlaySounds("assets/audio_files/collision.wav");
@@ -9,7 +9,11 @@
 
 #include <Engine.hpp>
 #include "GameLayer.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
+#include <string>
 
 class HollowsGame : public GP2Engine::Application {
 public:
@@ -27,12 +31,148 @@ void ScrollCallback(GLFWwindow* /*window*/, double /*xoffset*/, double yoffset)
     (void)yoffset;
 }
 
-int main() {
+/**
+ * @brief Render a scene with the software rasterizer and optionally compare it to a golden image
+ *
+ * Usage: --render-scene <scene.json> <out.png> [--golden <expected.png>] [--size WxH] [--tolerance N]
+ *
+ * @return 0 on success, 1 if the image differs from the golden image, -1 on errors
+ */
+static int RunRenderScene(int argc, char** argv) {
+    if (argc < 4) {
+        std::cerr << "Usage: " << argv[0] << " --render-scene <scene.json> <out.png> [--golden <expected.png>] [--size WxH] [--tolerance N]" << std::endl;
+        return -1;
+    }
+
+    const std::string scenePath = argv[2];
+    const std::string outputPath = argv[3];
+    std::string goldenPath;
+    int width = 1024;
+    int height = 768;
+    int tolerance = 0;
+    for (int i = 4; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--golden" && i + 1 < argc) {
+            goldenPath = argv[++i];
+        } else if (arg == "--size" && i + 1 < argc) {
+            if (std::sscanf(argv[++i], "%dx%d", &width, &height) != 2) {
+                std::cerr << "Invalid size '" << argv[i] << "' (expected WxH)" << std::endl;
+                return -1;
+            }
+        } else if (arg == "--tolerance" && i + 1 < argc) {
+            tolerance = std::atoi(argv[++i]);
+        } else {
+            std::cerr << "Unknown argument '" << arg << "'" << std::endl;
+            return -1;
+        }
+    }
+
+    GP2Engine::SoftwareImage image;
+    GP2Engine::SoftwareRasterizer::Stats stats;
+    auto start = std::chrono::high_resolution_clock::now();
+    if (!GP2Engine::SoftwareRasterizer::RenderScene(scenePath, width, height, image, &stats)) {
+        return -1;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::cout << "[Benchmark] Software render of " << scenePath << " (" << width << "x" << height << "): "
+              << std::chrono::duration<double, std::milli>(end - start).count() << " ms, "
+              << stats.quads << " quads, " << stats.glyphs << " glyphs, " << stats.fragments << " fragments" << std::endl;
+
+    if (!image.SavePNG(outputPath)) {
+        return -1;
+    }
+
+    if (goldenPath.empty()) {
+        return 0;
+    }
+
+    GP2Engine::SoftwareImage golden;
+    if (!golden.LoadPNG(goldenPath)) {
+        return -1;
+    }
+
+    GP2Engine::SoftwareImage diffImage;
+    GP2Engine::ImageDiff diff = GP2Engine::CompareImages(image, golden, tolerance, &diffImage);
+    std::cout << "[Benchmark] Golden compare: " << diff.differingPixels << " differing pixels, max delta " << diff.maxDelta
+              << ", mean error " << diff.meanError << (diff.sizeMatches ? "" : " (size mismatch)") << std::endl;
+
+    if (!diff.Matches()) {
+        if (diff.sizeMatches) {
+            diffImage.SavePNG(outputPath + ".diff.png");
+        }
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Re-simulate a recorded physics session without a window and check it against the recording
+ *
+ * Usage: --replay-physics <recording.gpr> [--threads N] [--from STEP] [--to STEP] [--stop-on-mismatch]
+ *
+ * @return 0 if every step reproduces the recorded state, 1 on a mismatch, -1 on errors
+ */
+static int RunPhysicsReplay(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " --replay-physics <recording.gpr> [--threads N] [--from STEP] [--to STEP] [--stop-on-mismatch]" << std::endl;
+        return -1;
+    }
+
+    const std::string recordingPath = argv[2];
+    GP2Engine::PhysicsReplay::Options options;
+    for (int i = 3; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--threads" && i + 1 < argc) {
+            options.solverThreads = std::atoi(argv[++i]);
+        } else if (arg == "--from" && i + 1 < argc) {
+            options.firstStep = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--to" && i + 1 < argc) {
+            options.lastStep = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--stop-on-mismatch") {
+            options.stopOnMismatch = true;
+        } else {
+            std::cerr << "Unknown argument '" << arg << "'" << std::endl;
+            return -1;
+        }
+    }
+
+    GP2Engine::PhysicsReplay replay;
+    GP2Engine::PhysicsReplay::Result result;
+    if (!replay.Load(recordingPath) || !replay.Run(options, result)) {
+        return -1;
+    }
+
+    std::cout << "[Benchmark] Physics replay of " << recordingPath << " (seed " << replay.GetSeed() << ", " << options.solverThreads
+              << " solver threads): " << result.steps << " steps, " << result.replayMs << " ms for " << result.recordedSeconds
+              << " s simulated (" << result.speedup << "x real time)" << std::endl;
+    std::cout << "[Benchmark] Slowest step: " << result.maxStepMs << " ms at step " << result.slowestStep << " (recorded "
+              << result.recordedMaxStepMs << " ms at step " << result.recordedSlowestStep << ")" << std::endl;
+
+    if (result.mismatches > 0) {
+        std::cout << "[Benchmark] State hash mismatch on " << result.mismatches << " steps, first at step " << result.firstMismatch << std::endl;
+        return 1;
+    }
+    std::cout << "[Benchmark] Every step matches the recording" << std::endl;
+    return 0;
+}
+
+int main(int argc, char** argv) {
     // Enable run-time memory check for debug builds
 #if defined(_DEBUG)
     _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
 #endif
 
+    // Headless golden-image render (no window)
+    if (argc > 1 && std::string(argv[1]) == "--render-scene") {
+        return RunRenderScene(argc, argv);
+    }
+
+    // Headless physics replay (no window)
+    if (argc > 1 && std::string(argv[1]) == "--replay-physics") {
+        return RunPhysicsReplay(argc, argv);
+    }
+
     // Initialize logging system
     GP2Engine::Logger& logger = GP2Engine::Logger::GetInstance();
     logger.Initialize("Hollows_Log.txt");